@@ -4,6 +4,14 @@
 #include "ccxt/base/errors.h"
 #include "ccxt/base/precise.h"
 
+// Components exchange.h only forward-declares
+#include "ccxt/base/backfill.h"
+#include "ccxt/base/event_bus.h"
+#include "ccxt/base/hedging.h"
+#include "ccxt/base/order_tracker.h"
+#include "ccxt/base/path_template.h"
+#include "ccxt/base/request_metrics.h"
+
 // Exchange implementations
 #include "ccxt/exchanges/binance.h"
 
@@ -0,0 +1,171 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace ccxt {
+
+// Fixed-capacity ring of the most recent elements, after ccxt's ArrayCache
+// (e.g. tradesLimit trades per symbol). Slots are allocated once and
+// overwritten in place, so a warm cache appends without allocating beyond
+// what copying T itself needs. Not synchronised: fill and read it on one
+// thread, e.g. the adapter's IO thread or a consumer fed from the EventBus.
+//
+// Every write is stamped with a sequence number. A reader keeps a cursor
+// (start at 0) and since() hands it only what was written after its last
+// call, oldest first.
+template <typename T>
+class ArrayCache {
+public:
+    explicit ArrayCache(size_t capacity = 1000) : slots_(capacity ? capacity : 1), stamps_(slots_.size(), 0) {}
+
+    size_t capacity() const { return slots_.size(); }
+    size_t size() const { return size_; }
+    bool empty() const { return size_ == 0; }
+    // Total writes so far; the cursor value after reading everything
+    uint64_t sequence() const { return sequence_; }
+
+    // 0 is the oldest element still held
+    const T& operator[](size_t i) const { return slots_[slot(i)]; }
+    const T& back() const { return slots_[slot(size_ - 1)]; }
+
+    // Evicts the oldest element once full; returns the slot written
+    size_t append(const T& value) {
+        size_t index;
+        if (size_ < slots_.size()) {
+            index = slot(size_++);
+        } else {
+            index = head_;
+            head_ = head_ + 1 == slots_.size() ? 0 : head_ + 1;
+        }
+        write(index, value);
+        return index;
+    }
+
+    // Calls visit(const T&) for everything written after cursor and moves
+    // the cursor past it. Elements evicted in the meantime are skipped.
+    template <typename F>
+    size_t since(uint64_t& cursor, F&& visit) const {
+        size_t first = size_;
+        while (first > 0 && stamps_[slot(first - 1)] > cursor) {
+            --first;
+        }
+        for (size_t i = first; i < size_; ++i) {
+            visit(slots_[slot(i)]);
+        }
+        cursor = sequence_;
+        return size_ - first;
+    }
+
+    std::vector<T> since(uint64_t& cursor) const {
+        std::vector<T> result;
+        since(cursor, [&result](const T& value) { result.push_back(value); });
+        return result;
+    }
+
+    void clear() {
+        head_ = 0;
+        size_ = 0;
+    }
+
+protected:
+    size_t slot(size_t i) const {
+        const size_t index = head_ + i;
+        return index >= slots_.size() ? index - slots_.size() : index;
+    }
+
+    void write(size_t index, const T& value) {
+        slots_[index] = value;
+        stamps_[index] = ++sequence_;
+    }
+
+    std::vector<T> slots_;
+    // Sequence of the last write to each slot
+    std::vector<uint64_t> stamps_;
+    size_t head_ = 0;
+    size_t size_ = 0;
+    uint64_t sequence_ = 0;
+};
+
+// Candles keyed by timestamp (ccxt's ArrayCacheByTimestamp): an update to
+// the forming candle replaces it in place, a newer one is appended and an
+// older one is ignored.
+template <typename T>
+class ArrayCacheByTimestamp : public ArrayCache<T> {
+public:
+    using ArrayCache<T>::ArrayCache;
+
+    bool append(const T& value) {
+        if (!this->empty()) {
+            const T& last = this->back();
+            if (value.timestamp == last.timestamp) {
+                this->write(this->slot(this->size_ - 1), value);
+                return true;
+            }
+            if (value.timestamp < last.timestamp) {
+                return false;
+            }
+        }
+        ArrayCache<T>::append(value);
+        return true;
+    }
+};
+
+// Orders keyed by id (ccxt's ArrayCacheBySymbolById): an update replaces
+// the cached order where it is, a new id is appended and evicts the oldest.
+// since() scans the whole ring, since updates land anywhere in it.
+template <typename T>
+class ArrayCacheById : public ArrayCache<T> {
+public:
+    explicit ArrayCacheById(size_t capacity = 1000) : ArrayCache<T>(capacity) { index_.reserve(this->capacity()); }
+
+    void append(const T& value) {
+        auto found = index_.find(value.id);
+        if (found != index_.end()) {
+            this->write(found->second, value);
+            return;
+        }
+        if (this->size_ == this->capacity()) {
+            index_.erase(this->slots_[this->head_].id);
+        }
+        index_[value.id] = ArrayCache<T>::append(value);
+    }
+
+    const T* find(const std::string& id) const {
+        auto found = index_.find(id);
+        return found == index_.end() ? nullptr : &this->slots_[found->second];
+    }
+
+    template <typename F>
+    size_t since(uint64_t& cursor, F&& visit) const {
+        size_t visited = 0;
+        for (size_t i = 0; i < this->size_; ++i) {
+            const size_t index = this->slot(i);
+            if (this->stamps_[index] > cursor) {
+                visit(this->slots_[index]);
+                ++visited;
+            }
+        }
+        cursor = this->sequence_;
+        return visited;
+    }
+
+    std::vector<T> since(uint64_t& cursor) const {
+        std::vector<T> result;
+        since(cursor, [&result](const T& value) { result.push_back(value); });
+        return result;
+    }
+
+    void clear() {
+        ArrayCache<T>::clear();
+        index_.clear();
+    }
+
+private:
+    std::unordered_map<std::string, size_t> index_;
+};
+
+} // namespace ccxt
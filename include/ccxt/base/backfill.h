@@ -0,0 +1,67 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <map>
+#include <string>
+#include <vector>
+#include <nlohmann/json.hpp>
+#include <ccxt/base/types.h>
+
+using json = nlohmann::json;
+
+namespace ccxt {
+
+// Progress of one symbol: every candle before `next` has been delivered.
+struct BackfillCheckpoint {
+    std::string symbol;
+    std::string timeframe;
+    long long next = 0;
+    long long until = 0;
+};
+
+struct BackfillOptions {
+    // Candles per request; Exchange::backfillOHLCV defaults it to maxOHLCVLimit
+    int limit = 1000;
+    // Pages in flight at once; the exchange's RateLimiter still spaces them
+    size_t concurrency = 4;
+    // Attempts per page on NetworkError before the run fails
+    int maxRetries = 3;
+    long long retryDelay = 500;  // milliseconds
+    // JSON file of checkpoints, read on start and rewritten as pages land.
+    // A resumed run only fetches (and returns) candles after each checkpoint.
+    std::string checkpointFile;
+    // Called in window order per symbol as the contiguous prefix grows, so
+    // callers can persist candles before the whole run finishes
+    std::function<void(const std::string& symbol, const std::vector<OHLCV>& candles)> onCandles;
+};
+
+// Splits [since, until) into limit-sized windows per symbol and fetches them
+// concurrently on Executor::shared(). Pages may come back in any order and
+// overlap; the result per symbol is sorted and unique by timestamp.
+class OHLCVBackfill {
+public:
+    // Fetches at most `limit` candles starting at `since`
+    using PageFetcher = std::function<std::vector<OHLCV>(const std::string& symbol, const std::string& timeframe,
+                                                         long long since, int limit)>;
+
+    OHLCVBackfill(PageFetcher fetcher, BackfillOptions options = BackfillOptions());
+
+    // Blocks until every window is fetched. The calling thread works through
+    // windows too, so this is safe to call from an executor thread. The first
+    // page that fails for good is rethrown after in-flight pages finish; the
+    // checkpoint file then holds what was completed.
+    std::map<std::string, std::vector<OHLCV>> run(const std::vector<std::string>& symbols,
+                                                  const std::string& timeframe,
+                                                  long long since, long long until);
+
+    // Accepts [[ts, o, h, l, c, v], ...] or [{"timestamp": ..., "open": ...}, ...]
+    // with numeric or string fields
+    static std::vector<OHLCV> parseCandles(const json& page);
+
+private:
+    PageFetcher fetcher_;
+    BackfillOptions options_;
+};
+
+} // namespace ccxt
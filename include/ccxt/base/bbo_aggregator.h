@@ -0,0 +1,159 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include <ccxt/base/event_bus.h>
+
+namespace ccxt {
+
+class Exchange;
+
+// Consolidated best bid and offer across venues. A side with no live quote
+// has price 0 and venue kNoVenue.
+struct TopOfBook {
+    static constexpr uint8_t kNoVenue = 0xff;
+    double bid = 0;
+    double bidSize = 0;
+    double ask = 0;
+    double askSize = 0;
+    uint8_t bidVenue = kNoVenue;
+    uint8_t askVenue = kNoVenue;
+    // Bumped on every change; lets readers skip unchanged books
+    uint32_t version = 0;
+    // publishedAt of the event that caused the last change
+    uint64_t updatedAt = 0;
+};
+
+// One price level of the merged depth
+struct VenueLevel {
+    double price = 0;
+    double amount = 0;
+    uint8_t venue = 0;
+};
+
+struct MergedDepth {
+    std::vector<VenueLevel> bids;
+    std::vector<VenueLevel> asks;
+};
+
+// Maintains NBBO-style top of book per instrument from the Ticker and
+// OrderBook events of several venues' event buses. Market ids are mapped to
+// one instrument key per venue once; after that an update is an integer
+// lookup plus an O(venues) scan. Each instrument's consolidated book sits in
+// its own cache line behind a seqlock, so any number of readers get a
+// consistent copy without locks while poll() keeps writing.
+//
+// OrderBook events are read as snapshots (partial-depth streams); their
+// first levels are the venue's best bid and ask.
+class BboAggregator {
+public:
+    using InstrumentId = uint32_t;
+    static constexpr size_t kMaxVenues = 16;
+    static constexpr InstrumentId kUnknownInstrument = ~InstrumentId(0);
+
+    // Unified instrument key for one of the venue's market ids
+    using KeyMapper = std::function<std::string(const std::string& marketId)>;
+
+    struct Options {
+        // Instruments are preallocated so readers never see storage move
+        size_t maxInstruments = 1024;
+        // Venue quotes older than this (nanoseconds, by publishedAt) are
+        // ignored; 0 keeps every quote until it is replaced
+        uint64_t staleAfter = 0;
+        // Keep each venue's last book and serve depth()
+        bool mergedDepth = false;
+        size_t eventCapacity = EventBus::kDefaultCapacity;
+    };
+
+    BboAggregator();
+    explicit BboAggregator(Options options);
+    ~BboAggregator();
+    BboAggregator(const BboAggregator&) = delete;
+    BboAggregator& operator=(const BboAggregator&) = delete;
+
+    // Subscribes to the venue's Ticker and OrderBook events. Returns the
+    // venue index used in TopOfBook and VenueLevel.
+    uint8_t addVenue(const std::string& name, EventBus& bus, KeyMapper mapper = nullptr);
+    // Uses the exchange's bus, and exchange.symbol() to map market ids
+    // when its markets are loaded
+    uint8_t addVenue(Exchange& exchange);
+    const std::string& venueName(uint8_t venue) const;
+
+    // Drains pending events from every venue; call from one thread.
+    // Returns the number of events applied.
+    size_t poll();
+
+    // Lookups by key take a shared lock; resolve the id once and read by id
+    InstrumentId instrument(const std::string& key) const;
+    bool read(InstrumentId id, TopOfBook& out) const;
+    bool read(const std::string& key, TopOfBook& out) const;
+    // Up to `levels` per side, best first, across all venues
+    MergedDepth depth(const std::string& key, size_t levels = 10) const;
+
+    size_t instruments() const { return instrumentCount_.load(std::memory_order_acquire); }
+
+private:
+    struct Quote {
+        double bid = 0;
+        double bidSize = 0;
+        double ask = 0;
+        double askSize = 0;
+        uint64_t updatedAt = 0;
+    };
+
+    // The reader-facing copy, one cache line per instrument
+    struct alignas(64) Cell {
+        std::atomic<uint32_t> sequence{0};
+        std::atomic<uint32_t> version{0};
+        std::atomic<double> bid{0};
+        std::atomic<double> bidSize{0};
+        std::atomic<double> ask{0};
+        std::atomic<double> askSize{0};
+        std::atomic<uint8_t> bidVenue{TopOfBook::kNoVenue};
+        std::atomic<uint8_t> askVenue{TopOfBook::kNoVenue};
+        std::atomic<uint64_t> updatedAt{0};
+    };
+
+    // Writer-side state, touched by poll() only
+    struct Instrument {
+        std::array<Quote, kMaxVenues> quotes;
+        // Only filled with Options::mergedDepth
+        std::array<OrderBook, kMaxVenues> books;
+    };
+
+    struct Venue {
+        std::string name;
+        EventBus* bus = nullptr;
+        KeyMapper mapper;
+        Subscription<Ticker> tickers;
+        Subscription<OrderBook> books;
+        // topic -> instrument, filled on first sight of a topic
+        std::unordered_map<TopicId, InstrumentId> instruments;
+    };
+
+    InstrumentId resolve(uint8_t venue, TopicId topic);
+    void apply(uint8_t venue, TopicId topic, const Quote& quote);
+    void publish(InstrumentId id, uint64_t now);
+
+    Options options_;
+    std::vector<std::unique_ptr<Venue>> venues_;
+    std::unique_ptr<Cell[]> cells_;
+    std::vector<std::unique_ptr<Instrument>> state_;
+    std::atomic<size_t> instrumentCount_{0};
+
+    mutable std::shared_mutex keysMutex_;
+    std::unordered_map<std::string, InstrumentId> keys_;
+    // Guards state_ growth and Instrument::books against depth()
+    mutable std::mutex booksMutex_;
+};
+
+} // namespace ccxt
@@ -0,0 +1,83 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include <ccxt/base/event_bus.h>
+#include <ccxt/base/types.h>
+
+namespace ccxt {
+
+class Exchange;
+
+// Builds OHLCV bars for several timeframes at once from individual trades.
+// A trade updates one bar per timeframe in place, so the cost per trade is
+// fixed no matter how many symbols are tracked. A bar is emitted when the
+// first trade of a later window arrives (or on flush()); windows without
+// trades produce no bar, as with ccxt's buildOHLCVC. Not thread-safe: feed
+// it from one consumer thread.
+class CandleBuilder {
+public:
+    using SymbolId = uint32_t;
+    // Called with every closed bar; timeframe indexes timeframes()
+    using OnClose = std::function<void(SymbolId symbol, size_t timeframe, const OHLCV& bar)>;
+
+    // Throws NotSupported for a malformed timeframe
+    CandleBuilder(std::vector<std::string> timeframes, OnClose onClose);
+
+    const std::vector<std::string>& timeframes() const { return timeframes_; }
+    // Index into timeframes(), or -1
+    int timeframeIndex(const std::string& timeframe) const;
+
+    // Dense id for a symbol; the same id every time
+    SymbolId addSymbol(const std::string& symbol);
+    const std::string& symbolName(SymbolId id) const { return symbols_.at(id); }
+
+    // timestamp in milliseconds. Trades before the bar currently forming
+    // (late or out of order) are counted and ignored.
+    void update(SymbolId symbol, long long timestamp, double price, double amount);
+    void update(const std::string& symbol, const Trade& trade);
+    // Applies every pending trade of the subscription, keyed by its topic
+    size_t drain(Subscription<Trade>& trades, const EventBus& bus);
+
+    // Starts a timeframe from history (e.g. fetchOHLCV): the last candle
+    // becomes the forming bar, earlier ones are taken as already emitted
+    void seed(SymbolId symbol, const std::string& timeframe, const std::vector<OHLCV>& history);
+    // Seeds every timeframe the exchange supports from backfillOHLCV
+    void seed(Exchange& exchange, const std::string& symbol, long long since);
+
+    // The bar still forming, if any
+    bool current(SymbolId symbol, size_t timeframe, OHLCV& out) const;
+    // Emits every bar whose window ended at or before now (milliseconds),
+    // for symbols that went quiet
+    size_t flush(long long now);
+
+    uint64_t lateTrades() const { return late_; }
+
+private:
+    struct Bar {
+        OHLCV candle{};
+        bool open = false;
+        // Start of the earliest window not yet emitted
+        long long next = std::numeric_limits<long long>::min();
+    };
+
+    Bar& bar(SymbolId symbol, size_t timeframe) { return bars_[symbol * durations_.size() + timeframe]; }
+    void close(SymbolId symbol, size_t timeframe, Bar& current);
+
+    std::vector<std::string> timeframes_;
+    std::vector<long long> durations_;
+    OnClose onClose_;
+    std::vector<std::string> symbols_;
+    std::unordered_map<std::string, SymbolId> ids_;
+    std::unordered_map<TopicId, SymbolId> topics_;
+    // symbol-major: bars_[symbol * timeframes + timeframe]
+    std::vector<Bar> bars_;
+    uint64_t late_ = 0;
+};
+
+} // namespace ccxt
@@ -0,0 +1,74 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+namespace ccxt {
+
+class Exchange;
+
+// Keeps an estimate of (server clock - local clock) from a time endpoint,
+// NTP-style: the server time is taken to be read at the midpoint of the
+// round trip. Each round keeps the sample with the smallest round trip,
+// whose midpoint assumption is the tightest, and blends it into a smoothed
+// offset. Readers only load an atomic.
+class ClockSync {
+public:
+    // Server time in milliseconds; throws on failure
+    using TimeSource = std::function<long long()>;
+    // Called with the new smoothed offset after every round
+    using OnOffset = std::function<void(long long offset)>;
+
+    struct Options {
+        // Between rounds of the background thread
+        std::chrono::milliseconds interval{30000};
+        // Requests per round
+        int samples = 4;
+        // Weight of a new round in the smoothed offset; the first round is
+        // taken as is
+        double smoothing = 0.3;
+    };
+
+    ClockSync(TimeSource source, OnOffset onOffset = nullptr);
+    ClockSync(TimeSource source, OnOffset onOffset, Options options);
+    // Samples exchange.fetchTime() and keeps exchange.clockOffset() current,
+    // so every signed request uses the estimated server time. The exchange
+    // must outlive this object.
+    explicit ClockSync(Exchange& exchange);
+    ClockSync(Exchange& exchange, Options options);
+    ~ClockSync();
+    ClockSync(const ClockSync&) = delete;
+    ClockSync& operator=(const ClockSync&) = delete;
+
+    // One round now, on the calling thread. False if every sample failed.
+    bool sync();
+    // Runs sync() every interval on a background thread until stop()
+    void start();
+    void stop();
+
+    // Milliseconds to add to the local clock to get the server's
+    long long offset() const { return offset_.load(std::memory_order_relaxed); }
+    // Round trip of the sample the last round used, in microseconds
+    long long roundTrip() const { return roundTrip_.load(std::memory_order_relaxed); }
+    uint64_t rounds() const { return rounds_.load(std::memory_order_relaxed); }
+    bool synced() const { return rounds() > 0; }
+
+private:
+    TimeSource source_;
+    OnOffset onOffset_;
+    Options options_;
+    // sync() may run on the background thread and a caller at once
+    std::mutex syncMutex_;
+    double smoothed_ = 0;
+    std::atomic<long long> offset_{0};
+    std::atomic<long long> roundTrip_{0};
+    std::atomic<uint64_t> rounds_{0};
+    std::atomic<bool> running_{false};
+    std::thread thread_;
+};
+
+} // namespace ccxt
@@ -3,7 +3,6 @@
 #include <string>
 #include <map>
 #include <nlohmann/json.hpp>
-#include <fstream>
 #include <boost/coroutine2/coroutine.hpp>
 using json = nlohmann::json;
 using AsyncPullType = boost::coroutines2::coroutine<json>::pull_type;
@@ -16,17 +15,8 @@ struct Config {
     std::string hostname;
     int rateLimit;  // default 50
     bool pro;       // default false    
-    void loadRest(const std::string& filename)
-    {
-        std::ifstream file(filename);
-        json_rest = json::parse(file);
-    }
-
-    void loadWs(const std::string& filename)
-    {
-        std::ifstream file(filename);
-        json_ws = json::parse(file);
-    }
+    void loadRest(const std::string& filename);
+    void loadWs(const std::string& filename);
     
     json json_rest;
     json json_ws;
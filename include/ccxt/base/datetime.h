@@ -0,0 +1,34 @@
+#pragma once
+
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <string_view>
+
+namespace ccxt {
+
+// Thread-safe UTC ISO-8601 helpers built on days-from-civil arithmetic,
+// with no dependency on gmtime/mktime or the process timezone.
+
+// Length of "YYYY-MM-DDTHH:MM:SS.mmmZ"
+constexpr size_t kIso8601Length = 24;
+
+// Writes the millisecond timestamp as "YYYY-MM-DDTHH:MM:SS.mmmZ" into out
+// (at least kIso8601Length bytes) and returns the number of bytes written.
+// Consecutive calls within the same second reuse a per-thread cached prefix.
+size_t formatIso8601(long long timestamp, char* out);
+std::string formatIso8601(long long timestamp);
+
+// Parses "YYYY-MM-DD[(T| )HH:MM[:SS[.fff...]]][Z|(+|-)HH[:]MM]" into
+// milliseconds since the epoch. Fractional digits beyond milliseconds are
+// truncated; returns nullopt if the string is malformed.
+std::optional<long long> parseIso8601(std::string_view datetime);
+
+long long daysFromCivil(int year, unsigned month, unsigned day);
+
+// Duration of a unified timeframe ("1s", "15m", "4h", "1d", "1w", "1M", "1y")
+// in milliseconds, with ccxt's 30-day month and 365-day year; returns
+// nullopt if the string is malformed.
+std::optional<long long> parseTimeframe(std::string_view timeframe);
+
+} // namespace ccxt
@@ -0,0 +1,71 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace boost {
+namespace asio {
+class io_context;
+} // namespace asio
+} // namespace boost
+
+namespace ccxt {
+
+// Process-wide name -> address cache shared by the REST and WebSocket
+// transports, so a host is resolved once per ttl instead of per request or
+// reconnect. Lookups take a shared lock; concurrent misses for the same name
+// share one resolution.
+class DnsCache {
+public:
+    // Addresses in the order to try them: the resolver's first family, then
+    // alternating IPv6/IPv4 (RFC 8305)
+    using Addresses = std::vector<std::string>;
+    // error is set and addresses empty when the name didn't resolve
+    using Handler = std::function<void(const Addresses& addresses, std::exception_ptr error)>;
+
+    struct Options {
+        std::chrono::seconds ttl{60};
+    };
+
+    DnsCache();
+    explicit DnsCache(Options options);
+    ~DnsCache();
+    DnsCache(const DnsCache&) = delete;
+    DnsCache& operator=(const DnsCache&) = delete;
+
+    // The instance every exchange and WebSocketClient uses
+    static DnsCache& shared();
+
+    // Cached, or resolved on the calling thread; throws NetworkError
+    Addresses resolve(const std::string& host, const std::string& port);
+    // Completes on ioc, right away (posted) on a hit
+    void asyncResolve(boost::asio::io_context& ioc, const std::string& host, const std::string& port,
+                      Handler handler);
+    // A fresh entry, without resolving
+    std::optional<Addresses> cached(const std::string& host, const std::string& port) const;
+    void clear();
+
+    std::chrono::seconds ttl() const { return options_.ttl; }
+    size_t size() const;
+    uint64_t hits() const { return hits_.load(std::memory_order_relaxed); }
+    uint64_t misses() const { return misses_.load(std::memory_order_relaxed); }
+
+private:
+    struct Impl;
+
+    void store(const std::string& key, const Addresses& addresses);
+
+    Options options_;
+    std::unique_ptr<Impl> impl_;
+    std::atomic<uint64_t> hits_{0};
+    std::atomic<uint64_t> misses_{0};
+};
+
+} // namespace ccxt
@@ -0,0 +1,251 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <tuple>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+#include <ccxt/base/lockfree_queue.h>
+#include <ccxt/base/types.h>
+
+namespace ccxt {
+
+// Interned name (symbol, exchange id, ...); 0 is never assigned
+using TopicId = uint32_t;
+constexpr TopicId kAllTopics = 0;
+
+// Fills of the account's own orders, kept apart from public trades
+struct MyTrade : Trade {};
+
+template <typename T>
+struct Event {
+    // Exchange that produced the event and the symbol (or currency) it is about
+    TopicId source = 0;
+    TopicId topic = 0;
+    // system_clock nanoseconds when the adapter published it
+    uint64_t publishedAt = 0;
+    T data;
+};
+
+template <typename T>
+class Subscription;
+
+// Typed publish/subscribe between IO threads and consumer threads. Every
+// subscriber owns a bounded ring that publishers copy events into. A publish
+// pins the current epoch, loads the copy-on-write subscriber list, compares
+// integer topics and does one lock-free push per match; no strings, JSON or
+// mutexes are involved. Subscribing and cancelling copy the list and wait
+// for publishes still reading the old one, so keep them off the hot path.
+// A full ring drops the event for that subscriber only and counts it.
+class EventBus {
+public:
+    static constexpr size_t kDefaultCapacity = 4096;
+
+    EventBus() = default;
+    EventBus(const EventBus&) = delete;
+    EventBus& operator=(const EventBus&) = delete;
+
+    // Same id for the same name for the lifetime of the bus. Takes a lock;
+    // resolve ids when subscribing, not per message.
+    TopicId topic(std::string_view name);
+    std::string topicName(TopicId id) const;
+
+    // topic = kAllTopics receives every event of type T
+    template <typename T>
+    Subscription<T> subscribe(TopicId topic = kAllTopics, size_t capacity = kDefaultCapacity);
+
+    // Returns how many subscribers received the event
+    template <typename T>
+    size_t publish(TopicId source, TopicId topic, const T& data, uint64_t publishedAt = now());
+
+    static uint64_t now();
+
+private:
+    template <typename T>
+    friend class Subscription;
+
+    template <typename T>
+    struct Channel {
+        Channel(TopicId t, size_t capacity) : topic(t), queue(capacity) {}
+        const TopicId topic;
+        MpscQueue<Event<T>> queue;
+        std::atomic<uint64_t> dropped{0};
+    };
+
+    // Epoch based reclamation: a publisher counts itself into readers of the
+    // epoch's parity and reads current only once the epoch is confirmed
+    // unchanged. replace() publishes the new list, advances the epoch and
+    // waits for the previous parity to drain; after that no publisher can
+    // still hold the old list, so only the current one is ever kept.
+    template <typename T>
+    struct Channels {
+        using List = std::vector<std::shared_ptr<Channel<T>>>;
+        Channels() : owned(std::make_unique<const List>()), current(owned.get()) {}
+        std::unique_ptr<const List> owned;
+        std::atomic<const List*> current;
+        std::atomic<uint64_t> epoch{0};
+        alignas(64) std::atomic<uint32_t> readers[2] = {};
+        std::mutex writeMutex;
+
+        // Keeps the list that was current at construction alive until destroyed
+        class Reader {
+        public:
+            explicit Reader(Channels& channels) : channels_(channels) {
+                for (;;) {
+                    pinned_ = channels_.epoch.load();
+                    channels_.readers[pinned_ & 1].fetch_add(1);
+                    if (channels_.epoch.load() == pinned_) {
+                        list_ = channels_.current.load();
+                        return;
+                    }
+                    channels_.readers[pinned_ & 1].fetch_sub(1);
+                }
+            }
+            ~Reader() { channels_.readers[pinned_ & 1].fetch_sub(1, std::memory_order_release); }
+            Reader(const Reader&) = delete;
+            Reader& operator=(const Reader&) = delete;
+            const List& list() const { return *list_; }
+
+        private:
+            Channels& channels_;
+            uint64_t pinned_ = 0;
+            const List* list_ = nullptr;
+        };
+
+        // Caller holds writeMutex
+        void replace(std::unique_ptr<const List> list) {
+            const std::unique_ptr<const List> retired = std::move(owned);
+            owned = std::move(list);
+            current.store(owned.get());
+            const uint64_t previous = epoch.fetch_add(1);
+            while (readers[previous & 1].load() != 0) {
+                std::this_thread::yield();
+            }
+        }
+    };
+
+    template <typename T>
+    Channels<T>& channels() {
+        return std::get<Channels<T>>(channels_);
+    }
+
+    template <typename T>
+    void remove(const std::shared_ptr<Channel<T>>& channel);
+
+    std::tuple<Channels<Ticker>, Channels<Trade>, Channels<MyTrade>, Channels<OrderBook>, Channels<OHLCV>,
+               Channels<Order>, Channels<Balance>, Channels<Position>, Channels<MarkPrice>>
+        channels_;
+
+    mutable std::shared_mutex topicsMutex_;
+    std::unordered_map<std::string, TopicId> topics_;
+    std::vector<std::string> names_;
+};
+
+// Consumer end of one subscription, polled from a single thread.
+// Unsubscribes when destroyed; the bus must outlive it.
+template <typename T>
+class Subscription {
+public:
+    Subscription() = default;
+    Subscription(Subscription&&) noexcept = default;
+    Subscription& operator=(Subscription&& other) noexcept {
+        if (this != &other) {
+            cancel();
+            bus_ = other.bus_;
+            channel_ = std::move(other.channel_);
+        }
+        return *this;
+    }
+    ~Subscription() { cancel(); }
+
+    bool poll(Event<T>& out) {
+        return channel_ && channel_->queue.tryPop(out);
+    }
+
+    // Hands up to max queued events to handler(const Event<T>&) in place
+    template <typename F>
+    size_t drain(F&& handler, size_t max = std::numeric_limits<size_t>::max()) {
+        size_t count = 0;
+        while (channel_ && count < max && channel_->queue.tryPop([&handler](Event<T>& event) { handler(event); })) {
+            ++count;
+        }
+        return count;
+    }
+
+    uint64_t dropped() const { return channel_ ? channel_->dropped.load(std::memory_order_relaxed) : 0; }
+    bool active() const { return channel_ != nullptr; }
+
+    void cancel() {
+        if (channel_) {
+            bus_->remove(channel_);
+            channel_.reset();
+        }
+    }
+
+private:
+    friend class EventBus;
+    Subscription(EventBus* bus, std::shared_ptr<EventBus::Channel<T>> channel)
+        : bus_(bus), channel_(std::move(channel)) {}
+
+    EventBus* bus_ = nullptr;
+    std::shared_ptr<EventBus::Channel<T>> channel_;
+};
+
+template <typename T>
+Subscription<T> EventBus::subscribe(TopicId topic, size_t capacity) {
+    Channels<T>& target = channels<T>();
+    auto channel = std::make_shared<Channel<T>>(topic, capacity);
+    std::lock_guard<std::mutex> lock(target.writeMutex);
+    auto list = std::make_unique<typename Channels<T>::List>(*target.current.load(std::memory_order_relaxed));
+    list->push_back(channel);
+    target.replace(std::move(list));
+    return Subscription<T>(this, std::move(channel));
+}
+
+template <typename T>
+void EventBus::remove(const std::shared_ptr<Channel<T>>& channel) {
+    Channels<T>& target = channels<T>();
+    std::lock_guard<std::mutex> lock(target.writeMutex);
+    auto list = std::make_unique<typename Channels<T>::List>(*target.current.load(std::memory_order_relaxed));
+    for (auto it = list->begin(); it != list->end(); ++it) {
+        if (*it == channel) {
+            list->erase(it);
+            break;
+        }
+    }
+    target.replace(std::move(list));
+}
+
+template <typename T>
+size_t EventBus::publish(TopicId source, TopicId topic, const T& data, uint64_t publishedAt) {
+    const typename Channels<T>::Reader reader(channels<T>());
+    size_t delivered = 0;
+    for (const auto& channel : reader.list()) {
+        if (channel->topic != kAllTopics && channel->topic != topic) {
+            continue;
+        }
+        const bool pushed = channel->queue.tryPush([&](Event<T>& slot) {
+            slot.source = source;
+            slot.topic = topic;
+            slot.publishedAt = publishedAt;
+            slot.data = data;
+        });
+        if (pushed) {
+            ++delivered;
+        } else {
+            channel->dropped.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+    return delivered;
+}
+
+} // namespace ccxt
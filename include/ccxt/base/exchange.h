@@ -1,19 +1,35 @@
 #pragma once
 
+#include <atomic>
+#include <future>
 #include <string>
 #include <map>
 #include <vector>
 #include <optional>
-#include <future>
+#include <memory>
+#include <shared_mutex>
+#include <unordered_map>
 #include <nlohmann/json.hpp>
-#include <boost/coroutine2/coroutine.hpp>
 #include "ccxt/base/exchange_base.h"
 
 namespace ccxt {
+// Held by pointer or only named in signatures, so their headers stay out of
+// every adapter; callers using them include the header themselves
+class MarketStore;
+class EventBus;
+class OrderTracker;
+class HedgedHosts;
+class PathTemplate;
+class RequestMetrics;
+struct BackfillOptions;
+struct HedgingPolicy;
+struct HistogramSummary;
+struct MetricsSnapshot;
+
 class Exchange : public ExchangeBase {
 public:
     Exchange(boost::asio::io_context& context, const Config& config = Config());
-    virtual ~Exchange() = default;
+    virtual ~Exchange();
 
     // Common methods
     virtual void init();
@@ -36,8 +52,8 @@ public:
     virtual long long milliseconds() const;
     virtual std::string uuid();
     virtual std::string iso8601(long long timestamp) const;
-    virtual Market market(const std::string& symbol);
-    virtual std::string marketId(const std::string& symbol);
+    virtual Market market(const std::string& symbol) const;
+    virtual std::string marketId(const std::string& symbol) const;
 
     // Synchronous REST API methods
     virtual json fetchMarkets(const json& params = json::object());
@@ -46,34 +62,96 @@ public:
     virtual json fetchOrderBook(const std::string& symbol, int limit = 0, const json& params = json::object());
     virtual json fetchTrades(const std::string& symbol, int since = 0, int limit = 0, const json& params = json::object());
     virtual json fetchOHLCV(const std::string& symbol, const std::string& timeframe = "1m",
-                          int since = 0, int limit = 0, const json& params = json::object());
+                          long long since = 0, int limit = 0, const json& params = json::object());
     virtual json fetchBalance(const json& params = json::object());
     virtual json createOrder(const std::string& symbol, const std::string& type, const std::string& side,
                            double amount, double price = 0, const json& params = json::object());
     virtual json cancelOrder(const std::string& id, const std::string& symbol = "", const json& params = json::object());
     virtual json fetchOrder(const std::string& id, const std::string& symbol = "", const json& params = json::object());
+    // Batches go out through the venue's batch endpoint where it has one and
+    // as concurrent single requests otherwise. The result has one entry per
+    // input, in order; a failed one has status "rejected" and an "error".
+    json createOrders(const std::vector<OrderRequest>& orders);
+    json cancelOrders(const std::vector<std::string>& ids, const std::string& symbol = "");
+    json editOrders(const std::vector<OrderRequest>& orders);
     virtual json fetchOrders(const std::string& symbol = "", int since = 0, int limit = 0, const json& params = json::object());
     virtual json fetchOpenOrders(const std::string& symbol = "", int since = 0, int limit = 0, const json& params = json::object());
     virtual json fetchClosedOrders(const std::string& symbol = "", int since = 0, int limit = 0, const json& params = json::object());
     virtual void loadMarkets(bool reload = false);
-    std::string symbol(const std::string& marketId);
-
-    // Asynchronous REST API methods
-    virtual AsyncPullType fetchMarketsAsync(const json& params = json::object());
-    virtual AsyncPullType fetchTickerAsync(const std::string& symbol, const json& params = json::object());
-    virtual AsyncPullType fetchTickersAsync(const std::vector<std::string>& symbols = {}, const json& params = json::object());
-    virtual AsyncPullType fetchOrderBookAsync(const std::string& symbol, int limit = 0, const json& params = json::object());
-    virtual AsyncPullType fetchTradesAsync(const std::string& symbol, int since = 0, int limit = 0, const json& params = json::object());
-    virtual AsyncPullType fetchOHLCVAsync(const std::string& symbol, const std::string& timeframe = "1m",
-                                           int since = 0, int limit = 0, const json& params = json::object());
-    virtual AsyncPullType fetchBalanceAsync(const json& params = json::object());
-    virtual AsyncPullType createOrderAsync(const std::string& symbol, const std::string& type, const std::string& side,
-                                           double amount, double price = 0, const json& params = json::object());
-    virtual AsyncPullType cancelOrderAsync(const std::string& id, const std::string& symbol = "", const json& params = json::object());
-    virtual AsyncPullType fetchOrderAsync(const std::string& id, const std::string& symbol = "", const json& params = json::object());
-    virtual AsyncPullType fetchOrdersAsync(const std::string& symbol = "", int since = 0, int limit = 0, const json& params = json::object());
-    virtual AsyncPullType fetchOpenOrdersAsync(const std::string& symbol = "", int since = 0, int limit = 0, const json& params = json::object());
-    virtual AsyncPullType fetchClosedOrdersAsync(const std::string& symbol = "", int since = 0, int limit = 0, const json& params = json::object());
+    std::string symbol(const std::string& marketId) const;
+
+    // Full candle history for [since, until), paged through fetchOHLCVImpl
+    // concurrently; options.limit is capped at maxOHLCVLimit
+    std::map<std::string, std::vector<OHLCV>> backfillOHLCV(const std::vector<std::string>& symbols,
+                                                            const std::string& timeframe,
+                                                            long long since, long long until);
+    std::map<std::string, std::vector<OHLCV>> backfillOHLCV(const std::vector<std::string>& symbols,
+                                                            const std::string& timeframe,
+                                                            long long since, long long until,
+                                                            const BackfillOptions& options);
+    // Once set, fetchOHLCV answers with closed candles from the store and
+    // only fetches (and appends) what is missing after its last candle
+    void setStore(std::shared_ptr<MarketStore> store);
+    std::shared_ptr<MarketStore> store() const { return store_; }
+    // Per endpoint latency of every fetch(), broken down by RequestPhase
+    MetricsSnapshot metrics() const;
+    // Typed market and account events published by this exchange's
+    // WebSocket adapters. Several exchanges may share one bus. The reference
+    // from events() lasts until the next setEventBus(); code that may run
+    // across a swap holds eventBus() instead.
+    EventBus& events() const { return *eventBus(); }
+    std::shared_ptr<EventBus> eventBus() const { return std::atomic_load(&events_); }
+    // Safe while adapters are delivering: they keep publishing to the bus
+    // they loaded and switch (dropping their interned topic ids) on their
+    // next message
+    void setEventBus(std::shared_ptr<EventBus> bus);
+    // Server time in milliseconds from fetchTimeImpl
+    long long fetchTime();
+    // Estimated server clock minus local clock (see ClockSync); signing
+    // uses serverMilliseconds() for its timestamps
+    long long clockOffset() const { return clockOffset_.load(std::memory_order_relaxed); }
+    void setClockOffset(long long offset) { clockOffset_.store(offset, std::memory_order_relaxed); }
+    long long serverMilliseconds() const { return milliseconds() + clockOffset(); }
+    // Order state kept current by the private WebSocket streams; query it
+    // instead of polling fetchOrder / fetchOpenOrders
+    OrderTracker& orders() const { return *orders_; }
+    // Corrects orders() from a fetchOpenOrders snapshot and fetches the
+    // orders that closed unseen. Returns the number of orders applied.
+    size_t reconcileOrders(const std::string& symbol = "");
+    // GETs to one of policy.hosts go to the host with the lowest latency and,
+    // when it hasn't answered within its p95, also to the next best host. The
+    // first response that is neither a transport error nor a 5xx wins, so a
+    // 4xx comes back as-is. Only for idempotent requests, which all GETs here
+    // are. An empty host list turns hedging off. Requests in flight finish
+    // under the policy they started with.
+    void setHedging(HedgingPolicy policy);
+    // Latency per hedged host; empty without a policy
+    std::map<std::string, HistogramSummary> hostLatency() const;
+    std::shared_ptr<const HedgedHosts> hedging() const { return std::atomic_load(&hedging_); }
+    // Resolves every host in the REST and WS configs (and the hedging hosts)
+    // into DnsCache::shared() and connects once to each HTTP host, so the
+    // first request after startup skips DNS and resumes a TLS session instead
+    // of a full handshake. Returns the number of hosts that resolved.
+    size_t prewarm();
+    size_t prewarm(const std::vector<std::string>& urls);
+
+    // Asynchronous REST API methods: the synchronous call, run on
+    // Executor::shared()
+    virtual std::future<json> fetchMarketsAsync(const json& params = json::object());
+    virtual std::future<json> fetchTickerAsync(const std::string& symbol, const json& params = json::object());
+    virtual std::future<json> fetchTickersAsync(const std::vector<std::string>& symbols = {}, const json& params = json::object());
+    virtual std::future<json> fetchOrderBookAsync(const std::string& symbol, int limit = 0, const json& params = json::object());
+    virtual std::future<json> fetchTradesAsync(const std::string& symbol, int since = 0, int limit = 0, const json& params = json::object());
+    virtual std::future<json> fetchOHLCVAsync(const std::string& symbol, const std::string& timeframe = "1m",
+                                               long long since = 0, int limit = 0, const json& params = json::object());
+    virtual std::future<json> fetchBalanceAsync(const json& params = json::object());
+    virtual std::future<json> createOrderAsync(const std::string& symbol, const std::string& type, const std::string& side,
+                                               double amount, double price = 0, const json& params = json::object());
+    virtual std::future<json> cancelOrderAsync(const std::string& id, const std::string& symbol = "", const json& params = json::object());
+    virtual std::future<json> fetchOrderAsync(const std::string& id, const std::string& symbol = "", const json& params = json::object());
+    virtual std::future<json> fetchOrdersAsync(const std::string& symbol = "", int since = 0, int limit = 0, const json& params = json::object());
+    virtual std::future<json> fetchOpenOrdersAsync(const std::string& symbol = "", int since = 0, int limit = 0, const json& params = json::object());
+    virtual std::future<json> fetchClosedOrdersAsync(const std::string& symbol = "", int since = 0, int limit = 0, const json& params = json::object());
 
 protected:
     // Synchronous HTTP methods
@@ -81,18 +159,28 @@ protected:
                       const std::string& method = "GET",
                       const std::map<std::string, std::string>& headers = {},
                       const std::string& body = "");
+    // What fetch() sends, callable from the const *Impl hooks. Unthrottled
+    // requests skip the rate limiter, so their latency is the round trip
+    // alone (time probes for ClockSync).
+    json perform(const std::string& url,
+                 const std::string& method = "GET",
+                 const std::map<std::string, std::string>& headers = {},
+                 const std::string& body = "",
+                 bool throttle = true) const;
 
     // Asynchronous HTTP methods
-    virtual AsyncPullType fetchAsync(const std::string& url,
-                                     const std::string& method = "GET",
-                                     const std::map<std::string, std::string>& headers = {},
-                                     const std::string& body = "");
+    virtual std::future<json> fetchAsync(const std::string& url,
+                                         const std::string& method = "GET",
+                                         const std::map<std::string, std::string>& headers = {},
+                                         const std::string& body = "");
 
     // Utility methods
     virtual std::string sign(const std::string& path, const std::string& api = "public",
                      const std::string& method = "GET",
                      const std::map<std::string, std::string>& params = {},
                      const std::map<std::string, std::string>& headers = {});
+    // Parsed once per endpoint path and reused by implodeParams/extractParams
+    const PathTemplate& pathTemplate(const std::string& path);
 
     // Safe type conversion helpers
     std::string safeString(const json& obj, const std::string& key, const std::string& defaultValue = "") const;
@@ -167,6 +255,12 @@ protected:
     virtual json editOrderImpl(const std::string& id, const std::string& symbol, const std::string& type,
                             const std::string& side, const std::optional<double>& amount = std::nullopt,
                             const std::optional<double>& price = std::nullopt) = 0;
+    // Native batch endpoints; the defaults fan out to the single-order Impls
+    virtual json createOrdersImpl(const std::vector<OrderRequest>& orders);
+    virtual json cancelOrdersImpl(const std::vector<std::string>& ids, const std::string& symbol = "");
+    virtual json editOrdersImpl(const std::vector<OrderRequest>& orders);
+    // Result entry for an order of a batch that failed
+    static json rejectedOrder(const std::string& id, const std::string& symbol, const std::string& error);
     virtual json setLeverageImpl(int leverage, const std::string& symbol = "") = 0;
     virtual json setMarginModeImpl(const std::string& marginMode, const std::string& symbol = "") = 0;
     virtual json addMarginImpl(const std::string& symbol, double amount) = 0;
@@ -183,6 +277,22 @@ protected:
                           const std::string& method = "GET", const json& params = json::object(),
                           const std::map<std::string, std::string>& headers = {},
                           const json& body = nullptr) const = 0;
+
+private:
+    // Guards markets/markets_by_id against a concurrent reload
+    mutable std::shared_mutex marketsMutex_;
+    mutable std::shared_mutex pathTemplatesMutex_;
+    std::unique_ptr<std::unordered_map<std::string, PathTemplate>> pathTemplates_;
+    std::shared_ptr<MarketStore> store_;
+    // Internally synchronized; recorded from const perform()
+    std::unique_ptr<RequestMetrics> metrics_;
+    // events_ and hedging_ are only read and replaced with std::atomic_load
+    // and std::atomic_store: perform() and the WS adapters copy them on their
+    // own threads
+    std::shared_ptr<EventBus> events_;
+    std::shared_ptr<OrderTracker> orders_;
+    std::atomic<long long> clockOffset_{0};
+    std::shared_ptr<HedgedHosts> hedging_;
 };
 
 } // namespace ccxt
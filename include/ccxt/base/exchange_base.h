@@ -4,12 +4,22 @@
 #include <map>
 #include <vector>
 #include <optional>
+#include <chrono>
+#include <atomic>
 #include <ccxt/base/types.h>
 #include <ccxt/base/config.h>
-#include <boost/asio.hpp>
-#include <curl/curl.h>
+#include <ccxt/base/hmac_signer.h>
+#include <ccxt/base/rate_limiter.h>
+
+// Forward declaration keeps Boost.Asio out of every adapter's translation
+// unit; sources that need it include the real header.
+namespace boost { namespace asio { class io_context; } }
 
 namespace ccxt {
+// An Exchange may be shared between threads once its markets are loaded.
+// Descriptors, markets and credentials are written during construction,
+// init() and loadMarkets() only; transport handles and scratch buffers are
+// per thread (see Exchange::fetch), never members.
 class ExchangeBase {
 public:
     ExchangeBase( boost::asio::io_context& context, const Config& config = Config()) : config_(config), context_(context) {}
@@ -20,13 +30,18 @@ public:
     std::string name;
     std::vector<std::string> countries;
     std::string version;
+    // Milliseconds between requests; only enforced when enableRateLimit is
+    // set, which the base class leaves off
     int rateLimit;
+    bool enableRateLimit;
+    // Most candles one fetchOHLCV page may return, used to size backfill windows
+    int maxOHLCVLimit;
     bool pro;
     bool certified;
     std::map<std::string, std::map<std::string, std::string>> urls;
     std::map<std::string, std::optional<bool>> has;
     std::map<std::string, std::string> timeframes;
-    long long lastRestRequestTimestamp;
+    mutable std::atomic<long long> lastRestRequestTimestamp{0};
     std::map<std::string, Market> markets;
     std::map<std::string, Market> markets_by_id;
 
@@ -39,9 +54,11 @@ public:
 
 protected:
     Config config_;
+    // Keyed with config_.secret; adapters signing with another digest re-key it in init()
+    HmacSigner signer_;
+    // Spaces every fetch() by rateLimit ms when enableRateLimit is set
+    mutable RateLimiter rateLimiter_;
     boost::asio::io_context& context_;
-    CURL* curl_ = nullptr;
-    
 };
 
 } // namespace ccxt
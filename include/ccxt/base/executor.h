@@ -0,0 +1,48 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <future>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace ccxt {
+
+// Library-wide pool for the blocking *Async REST wrappers. All adapters
+// submit to the same fixed set of threads, so N concurrent calls no longer
+// spawn N OS threads, and every call returns a std::future<T>.
+class Executor {
+public:
+    // Defaults to std::thread::hardware_concurrency() threads (at least 2)
+    explicit Executor(size_t threads = 0);
+    ~Executor();
+    Executor(const Executor&) = delete;
+    Executor& operator=(const Executor&) = delete;
+
+    // The process-wide pool used by all exchanges
+    static Executor& shared();
+
+    template <typename F>
+    auto submit(F&& task) -> std::future<std::invoke_result_t<std::decay_t<F>>> {
+        using Result = std::invoke_result_t<std::decay_t<F>>;
+        auto packaged = std::make_shared<std::packaged_task<Result()>>(std::forward<F>(task));
+        std::future<Result> result = packaged->get_future();
+        post([packaged]() { (*packaged)(); });
+        return result;
+    }
+
+    void post(std::function<void()> task);
+    size_t size() const { return threads_; }
+
+    // Waits for queued work and joins the threads; later posts and submits
+    // throw ExchangeError
+    void shutdown();
+
+private:
+    struct Impl;
+    std::unique_ptr<Impl> impl_;
+    size_t threads_;
+};
+
+} // namespace ccxt
@@ -0,0 +1,96 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+#include <ccxt/base/lockfree_queue.h>
+
+namespace ccxt {
+
+// One received WebSocket frame
+struct RecordedFrame {
+    uint32_t connectionId = 0;
+    // system_clock nanoseconds since the epoch, taken before any handler ran
+    uint64_t receivedAt = 0;
+    std::string payload;
+};
+
+// Frame log layout, host byte order:
+//   file   := "CCXTWSR1" block*
+//   block  := u32 rawSize, u32 storedSize, u8 codec (0 raw, 1 zstd), stored bytes
+//   raw    := (u32 connectionId, u64 receivedAt, u32 length, payload)*
+class FrameRecorder {
+public:
+    struct Options {
+        // Falls back to raw blocks when the library is built without zstd
+        bool compress = true;
+        int compressionLevel = 1;
+        size_t blockSize = 1 << 20;
+        // Frames that may wait for the writer; record() drops beyond this
+        size_t queueCapacity = 1 << 14;
+    };
+
+    explicit FrameRecorder(const std::string& path);
+    FrameRecorder(const std::string& path, Options options);
+    // Writes everything recorded so far before returning
+    ~FrameRecorder();
+    FrameRecorder(const FrameRecorder&) = delete;
+    FrameRecorder& operator=(const FrameRecorder&) = delete;
+
+    // Called on the WebSocket thread: one copy into a preallocated queue
+    // slot, no lock and no syscall. Returns false (and counts a drop) if the
+    // writer has fallen a whole queue behind.
+    bool record(uint32_t connectionId, uint64_t receivedAt, std::string_view payload);
+    bool record(uint32_t connectionId, std::string_view payload);
+
+    // Blocks until every frame recorded before the call is on disk
+    void flush();
+
+    uint64_t recorded() const { return recorded_.load(std::memory_order_relaxed); }
+    uint64_t dropped() const { return dropped_.load(std::memory_order_relaxed); }
+
+    static uint64_t now();
+
+private:
+    void run();
+    void drain();
+    void writeBlock();
+
+    Options options_;
+    std::ofstream file_;
+    MpscQueue<RecordedFrame> queue_;
+    std::string block_;
+    std::string compressed_;
+    std::atomic<uint64_t> recorded_{0};
+    std::atomic<uint64_t> dropped_{0};
+    std::atomic<uint64_t> written_{0};
+    // Frames in block_, touched by the writer thread only
+    uint64_t pending_ = 0;
+    std::atomic<uint64_t> flushTarget_{0};
+    std::atomic<bool> stop_{false};
+    std::thread writer_;
+};
+
+// Sequential reader for logs written by FrameRecorder
+class FrameReader {
+public:
+    explicit FrameReader(const std::string& path);
+
+    // False at the end of the log; throws on a truncated or corrupt block
+    bool next(RecordedFrame& frame);
+
+private:
+    bool loadBlock();
+
+    std::ifstream file_;
+    std::string block_;
+    std::string stored_;
+    size_t offset_ = 0;
+};
+
+} // namespace ccxt
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <string>
+#include <ccxt/base/frame_recorder.h>
+#include <ccxt/base/histogram.h>
+
+namespace ccxt {
+
+class WebSocketClient;
+
+struct ReplayOptions {
+    enum class Pacing {
+        // Back to back, to measure raw handler throughput
+        AsFastAsPossible,
+        // Spaced like the recording (divided by speed)
+        Original
+    };
+    Pacing pacing = Pacing::AsFastAsPossible;
+    double speed = 1.0;
+    // Replay only frames recorded on this connection
+    std::optional<uint32_t> connectionId;
+    // Stop after this many frames; 0 replays the whole log
+    uint64_t limit = 0;
+};
+
+struct ReplayReport {
+    uint64_t messages = 0;
+    uint64_t bytes = 0;
+    // Frames whose handler threw; replay continues past them
+    uint64_t failures = 0;
+    double seconds = 0;
+    double messagesPerSecond = 0;
+    double bytesPerSecond = 0;
+    // Handler time per frame, nanoseconds
+    HistogramSummary latency;
+    // Original pacing only: how far delivery trailed the recorded schedule
+    HistogramSummary lag;
+};
+
+// Feeds a FrameRecorder log through handlers offline. Frames are delivered
+// on the calling thread in recorded order, so runs are deterministic.
+class FrameReplayer {
+public:
+    using Sink = std::function<void(const RecordedFrame& frame)>;
+
+    explicit FrameReplayer(std::string path, ReplayOptions options = ReplayOptions());
+
+    // Delivers each payload through client.deliver(), i.e. the adapter's
+    // handleMessage() and any message handler, exactly as onRead would
+    ReplayReport run(WebSocketClient& client);
+    ReplayReport run(const Sink& sink);
+
+private:
+    std::string path_;
+    ReplayOptions options_;
+};
+
+} // namespace ccxt
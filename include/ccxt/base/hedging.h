@@ -0,0 +1,72 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+#include <ccxt/base/histogram.h>
+
+namespace ccxt {
+
+// Opt-in hedging of GET requests across equivalent API hosts
+struct HedgingPolicy {
+    // Interchangeable origins, e.g. "https://api1.binance.com" and
+    // "https://api-gcp.binance.com". Only GETs to one of them are hedged.
+    std::vector<std::string> hosts;
+    // The duplicate goes out once the primary has taken longer than this
+    // quantile of its own latency
+    double quantile = 0.95;
+    // Samples a host needs before its latency is trusted; until then hosts
+    // take turns as primary and initialDelay is the hedge delay
+    size_t minSamples = 20;
+    std::chrono::milliseconds initialDelay{100};
+    // Floor for the hedge delay, so a fast host isn't hedged on every request
+    std::chrono::milliseconds minDelay{2};
+};
+
+// Per-host latency and the choice of primary, alternate and hedge delay.
+// Thread-safe; record() and the choices are lock-free.
+class HedgedHosts {
+public:
+    explicit HedgedHosts(HedgingPolicy policy);
+
+    const HedgingPolicy& policy() const { return policy_; }
+    size_t size() const { return hosts_.size(); }
+    // Index of the host url points at, or -1
+    int find(const std::string& url) const;
+    // url moved onto host index
+    std::string rewrite(const std::string& url, size_t host) const;
+
+    // Lowest median latency; hosts short of minSamples go first, in turn
+    size_t primary();
+    // The best host other than primary
+    size_t alternate(size_t primary) const;
+    std::chrono::nanoseconds hedgeDelay(size_t host) const;
+
+    // Latency of a request that completed on host
+    void record(size_t host, uint64_t nanoseconds);
+    void noteHedge(bool won);
+
+    std::map<std::string, HistogramSummary> latency() const;
+    // Requests that sent a duplicate, and how many the duplicate answered first
+    uint64_t hedged() const { return hedged_.load(std::memory_order_relaxed); }
+    uint64_t hedgeWins() const { return hedgeWins_.load(std::memory_order_relaxed); }
+
+private:
+    // Median of host, or max() while it has too few samples
+    uint64_t median(size_t host) const;
+
+    HedgingPolicy policy_;
+    // Origins without a trailing '/'
+    std::vector<std::string> hosts_;
+    std::vector<std::unique_ptr<LatencyHistogram>> latency_;
+    std::atomic<size_t> turn_{0};
+    std::atomic<uint64_t> hedged_{0};
+    std::atomic<uint64_t> hedgeWins_{0};
+};
+
+} // namespace ccxt
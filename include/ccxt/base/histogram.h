@@ -0,0 +1,59 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace ccxt {
+
+struct HistogramSummary {
+    uint64_t count = 0;
+    uint64_t min = 0;
+    uint64_t max = 0;
+    double mean = 0;
+    uint64_t p50 = 0;
+    uint64_t p90 = 0;
+    uint64_t p99 = 0;
+    uint64_t p999 = 0;
+};
+
+// Log-linear histogram in the style of HdrHistogram: values below 64 are
+// exact, larger ones fall into 32 sub-buckets per power of two (at most
+// ~3% relative error). record() is a handful of relaxed atomic adds, so any
+// number of threads may record while others read.
+class LatencyHistogram {
+public:
+    static constexpr unsigned kSubBucketBits = 5;
+    static constexpr size_t kSubBuckets = size_t(1) << kSubBucketBits;
+    static constexpr size_t kBuckets = (65 - kSubBucketBits) * kSubBuckets;
+
+    LatencyHistogram();
+    LatencyHistogram(const LatencyHistogram& other);
+    LatencyHistogram& operator=(const LatencyHistogram& other);
+
+    void record(uint64_t value);
+    void merge(const LatencyHistogram& other);
+    void reset();
+
+    uint64_t count() const { return count_.load(std::memory_order_relaxed); }
+    uint64_t min() const;
+    uint64_t max() const { return max_.load(std::memory_order_relaxed); }
+    double mean() const;
+    // Value at quantile q in [0, 1], reported as the middle of its bucket
+    uint64_t percentile(double q) const;
+    HistogramSummary summary() const;
+
+    static size_t bucketIndex(uint64_t value);
+    static uint64_t bucketLow(size_t index);
+    static uint64_t bucketHigh(size_t index);
+
+private:
+    std::array<std::atomic<uint64_t>, kBuckets> buckets_;
+    std::atomic<uint64_t> count_{0};
+    std::atomic<uint64_t> sum_{0};
+    std::atomic<uint64_t> min_;
+    std::atomic<uint64_t> max_{0};
+};
+
+} // namespace ccxt
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+// Same typedef as <openssl/types.h>, which only hmac_signer.cpp includes
+typedef struct evp_mac_ctx_st EVP_MAC_CTX;
+
+namespace ccxt {
+
+// Table-driven encoders writing into caller-provided memory; out must hold
+// 2 * size (hex) or 4 * ((size + 2) / 3) (base64) characters.
+size_t hexEncode(const unsigned char* data, size_t size, char* out);
+size_t base64Encode(const unsigned char* data, size_t size, char* out);
+
+// HMAC keyed once with an exchange secret. Every signature starts from a
+// copy of the keyed template context, so the key schedule isn't repeated
+// per request and const signing is safe to share between threads.
+class HmacSigner {
+public:
+    enum class Algorithm { SHA256, SHA384, SHA512 };
+
+    static constexpr size_t kMaxDigestSize = 64;
+
+    // Stack storage large enough for a hex or base64 encoded SHA512 digest
+    struct Buffer {
+        char data[2 * kMaxDigestSize];
+        size_t size = 0;
+        std::string_view view() const { return std::string_view(data, size); }
+    };
+
+    HmacSigner() = default;
+    HmacSigner(std::string_view secret, Algorithm algorithm = Algorithm::SHA256);
+    ~HmacSigner();
+    HmacSigner(HmacSigner&& other) noexcept;
+    HmacSigner& operator=(HmacSigner&& other) noexcept;
+    HmacSigner(const HmacSigner&) = delete;
+    HmacSigner& operator=(const HmacSigner&) = delete;
+
+    void reset(std::string_view secret, Algorithm algorithm = Algorithm::SHA256);
+    bool valid() const { return templateCtx_ != nullptr; }
+    Algorithm algorithm() const { return algorithm_; }
+    const std::string& secret() const { return secret_; }
+
+    // Raw digest into out (at least kMaxDigestSize bytes), returns its size
+    size_t sign(std::string_view message, unsigned char* out) const;
+    void signHex(std::string_view message, Buffer& out) const;
+    void signBase64(std::string_view message, Buffer& out) const;
+    std::string hex(std::string_view message) const;
+    std::string base64(std::string_view message) const;
+
+    // "sha256", "sha384" or "sha512"; throws NotSupported otherwise
+    static Algorithm parseAlgorithm(const std::string& name);
+
+private:
+    void release();
+
+    EVP_MAC_CTX* templateCtx_ = nullptr;
+    Algorithm algorithm_ = Algorithm::SHA256;
+    std::string secret_;
+};
+
+} // namespace ccxt
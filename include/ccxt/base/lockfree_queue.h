@@ -0,0 +1,95 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <utility>
+
+namespace ccxt {
+
+// Bounded multi-producer queue (Vyukov's sequence-numbered ring). Slots are
+// filled and drained in place, so a slot's storage - e.g. a std::string's
+// capacity - is reused instead of reallocated for every element. Producers
+// never block: tryPush() fails when the ring is full.
+template <typename T>
+class MpscQueue {
+public:
+    // capacity is rounded up to a power of two
+    explicit MpscQueue(size_t capacity) {
+        size_t size = 2;
+        while (size < capacity) {
+            size <<= 1;
+        }
+        mask_ = size - 1;
+        cells_ = std::make_unique<Cell[]>(size);
+        for (size_t i = 0; i < size; ++i) {
+            cells_[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    MpscQueue(const MpscQueue&) = delete;
+    MpscQueue& operator=(const MpscQueue&) = delete;
+
+    size_t capacity() const { return mask_ + 1; }
+
+    // fill(T&) writes the element into its slot
+    template <typename F>
+    bool tryPush(F&& fill) {
+        size_t position = tail_.load(std::memory_order_relaxed);
+        Cell* cell;
+        for (;;) {
+            cell = &cells_[position & mask_];
+            const size_t sequence = cell->sequence.load(std::memory_order_acquire);
+            const std::ptrdiff_t difference = static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(position);
+            if (difference == 0) {
+                if (tail_.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (difference < 0) {
+                return false;
+            } else {
+                position = tail_.load(std::memory_order_relaxed);
+            }
+        }
+        std::forward<F>(fill)(cell->value);
+        cell->sequence.store(position + 1, std::memory_order_release);
+        return true;
+    }
+
+    bool tryPush(T value) {
+        return tryPush([&value](T& slot) { slot = std::move(value); });
+    }
+
+    // consume(T&) reads the element in place; single consumer only
+    template <typename F>
+    bool tryPop(F&& consume) {
+        const size_t position = head_;
+        Cell& cell = cells_[position & mask_];
+        if (cell.sequence.load(std::memory_order_acquire) != position + 1) {
+            return false;
+        }
+        std::forward<F>(consume)(cell.value);
+        cell.sequence.store(position + mask_ + 1, std::memory_order_release);
+        head_ = position + 1;
+        return true;
+    }
+
+    bool tryPop(T& out) {
+        return tryPop([&out](T& slot) { out = std::move(slot); });
+    }
+
+private:
+    struct Cell {
+        std::atomic<size_t> sequence;
+        T value;
+    };
+
+    static constexpr size_t kCacheLine = 64;
+
+    std::unique_ptr<Cell[]> cells_;
+    size_t mask_ = 0;
+    alignas(kCacheLine) std::atomic<size_t> tail_{0};
+    alignas(kCacheLine) size_t head_ = 0;
+};
+
+} // namespace ccxt
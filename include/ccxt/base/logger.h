@@ -0,0 +1,107 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <ccxt/base/lockfree_queue.h>
+
+namespace ccxt {
+
+enum class LogLevel : int { Trace = 0, Debug, Info, Warn, Error, Off };
+
+const char* logLevelName(LogLevel level);
+
+struct LogRecord {
+    LogLevel level = LogLevel::Info;
+    // system_clock nanoseconds since the epoch, taken on the logging thread
+    uint64_t timestamp = 0;
+    // Small per-process number of the logging thread
+    uint32_t thread = 0;
+    std::string message;
+};
+
+// Process-wide asynchronous logger. log() formats on the calling thread into
+// a preallocated ring slot and returns; a background thread hands records to
+// the sink, so a slow terminal or file never stalls a request or WS handler.
+// When the ring is full the record is dropped and counted.
+class Logger {
+public:
+    // Runs on the writer thread only
+    using Sink = std::function<void(const LogRecord& record)>;
+
+    static constexpr size_t kQueueCapacity = 8192;
+
+    static Logger& instance();
+
+    explicit Logger(size_t queueCapacity = kQueueCapacity);
+    ~Logger();
+    Logger(const Logger&) = delete;
+    Logger& operator=(const Logger&) = delete;
+
+    void setLevel(LogLevel level) { level_.store(level, std::memory_order_relaxed); }
+    LogLevel level() const { return level_.load(std::memory_order_relaxed); }
+    bool enabled(LogLevel level) const { return level >= this->level(); }
+
+    // Defaults to stderr; nullptr discards everything
+    void setSink(Sink sink);
+
+    bool log(LogLevel level, std::string_view message);
+    // Blocks until every record logged before the call reached the sink
+    void flush();
+
+    uint64_t logged() const { return logged_.load(std::memory_order_relaxed); }
+    uint64_t dropped() const { return dropped_.load(std::memory_order_relaxed); }
+
+    // "2024-01-02T03:04:05.678Z WARN [3] message"
+    static std::string format(const LogRecord& record);
+
+private:
+    void run();
+    bool drain();
+
+    MpscQueue<LogRecord> queue_;
+    std::atomic<LogLevel> level_{LogLevel::Info};
+    std::mutex sinkMutex_;
+    Sink sink_;
+    std::atomic<uint64_t> logged_{0};
+    std::atomic<uint64_t> dropped_{0};
+    std::atomic<uint64_t> written_{0};
+    std::atomic<bool> stop_{false};
+    std::thread writer_;
+};
+
+namespace detail {
+// Cleared thread-local stream the CCXT_LOG macros format into
+std::ostream& logStream();
+void submitLog(LogLevel level);
+} // namespace detail
+
+} // namespace ccxt
+
+// Records below this level are compiled out entirely; trace is off unless
+// the build sets it to 0 (see CCXT_LOG_MIN_LEVEL in CMakeLists.txt)
+#ifndef CCXT_LOG_MIN_LEVEL
+#define CCXT_LOG_MIN_LEVEL 1
+#endif
+
+// CCXT_LOG_WARN("reconnecting to " << host << " in " << delay << "ms");
+// The message is only formatted when the level is enabled.
+#define CCXT_LOG(level, message)                                                                   \
+    do {                                                                                           \
+        if (static_cast<int>(level) >= CCXT_LOG_MIN_LEVEL && ::ccxt::Logger::instance().enabled(level)) { \
+            ::ccxt::detail::logStream() << message;                                                \
+            ::ccxt::detail::submitLog(level);                                                      \
+        }                                                                                          \
+    } while (0)
+
+#define CCXT_LOG_TRACE(message) CCXT_LOG(::ccxt::LogLevel::Trace, message)
+#define CCXT_LOG_DEBUG(message) CCXT_LOG(::ccxt::LogLevel::Debug, message)
+#define CCXT_LOG_INFO(message) CCXT_LOG(::ccxt::LogLevel::Info, message)
+#define CCXT_LOG_WARN(message) CCXT_LOG(::ccxt::LogLevel::Warn, message)
+#define CCXT_LOG_ERROR(message) CCXT_LOG(::ccxt::LogLevel::Error, message)
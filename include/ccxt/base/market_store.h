@@ -0,0 +1,138 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+#include <ccxt/base/types.h>
+
+namespace ccxt {
+
+// Read-only view over a mapped column. Views stay valid for the lifetime of
+// the store: columns are mapped once at their maximum size and only the file
+// behind them grows.
+template <typename T>
+class ColumnSpan {
+public:
+    ColumnSpan() = default;
+    ColumnSpan(const T* data, size_t size) : data_(data), size_(size) {}
+
+    const T* data() const { return data_; }
+    size_t size() const { return size_; }
+    bool empty() const { return size_ == 0; }
+    const T* begin() const { return data_; }
+    const T* end() const { return data_ + size_; }
+    const T& operator[](size_t i) const { return data_[i]; }
+    const T& front() const { return data_[0]; }
+    const T& back() const { return data_[size_ - 1]; }
+    ColumnSpan subspan(size_t offset, size_t count) const { return ColumnSpan(data_ + offset, count); }
+
+private:
+    const T* data_ = nullptr;
+    size_t size_ = 0;
+};
+
+class MappedColumn;
+
+// Append-only columns sharing one row count. One writer at a time (append
+// is serialized internally); readers never lock and see whole rows only.
+class ColumnSeries {
+public:
+    ~ColumnSeries();
+    ColumnSeries(const ColumnSeries&) = delete;
+    ColumnSeries& operator=(const ColumnSeries&) = delete;
+
+    size_t size() const;
+    bool empty() const { return size() == 0; }
+    ColumnSpan<long long> timestamps() const;
+    std::optional<long long> firstTimestamp() const;
+    std::optional<long long> lastTimestamp() const;
+    // Rows [first, last) with since <= timestamp < until, by binary search
+    std::pair<size_t, size_t> range(long long since, long long until) const;
+
+protected:
+    ColumnSeries(const std::string& directory, const std::vector<std::pair<std::string, size_t>>& columns,
+                 size_t maxRows);
+    template <typename T>
+    ColumnSpan<T> column(size_t index) const;
+    char* columnData(size_t index) const;
+    // Makes rows [size(), size() + count) visible once the caller filled them
+    void reserve(size_t count);
+    void commit(size_t count);
+
+    std::mutex writeMutex_;
+
+private:
+    std::vector<std::unique_ptr<MappedColumn>> columns_;
+    size_t maxRows_;
+    std::atomic<size_t> rows_{0};
+};
+
+// timestamp/open/high/low/close/volume for one exchange, symbol and timeframe
+class OHLCVSeries : public ColumnSeries {
+public:
+    OHLCVSeries(const std::string& directory, size_t maxRows);
+
+    ColumnSpan<double> opens() const { return column<double>(1); }
+    ColumnSpan<double> highs() const { return column<double>(2); }
+    ColumnSpan<double> lows() const { return column<double>(3); }
+    ColumnSpan<double> closes() const { return column<double>(4); }
+    ColumnSpan<double> volumes() const { return column<double>(5); }
+
+    OHLCV at(size_t row) const;
+    std::vector<OHLCV> read(long long since, long long until) const;
+    // Appends candles newer than the last stored one in timestamp order;
+    // older and duplicate candles are skipped. Returns the number appended.
+    size_t append(const std::vector<OHLCV>& candles);
+};
+
+// timestamp/price/amount/side (1 buy, -1 sell, 0 unknown) for one symbol
+class TradeSeries : public ColumnSeries {
+public:
+    TradeSeries(const std::string& directory, size_t maxRows);
+
+    ColumnSpan<double> prices() const { return column<double>(1); }
+    ColumnSpan<double> amounts() const { return column<double>(2); }
+    ColumnSpan<int8_t> sides() const { return column<int8_t>(3); }
+
+    // Appends trades not older than the last stored one; several trades may
+    // share a millisecond, so each trade must be appended once
+    size_t append(const std::vector<Trade>& trades);
+};
+
+// Directory of memory-mapped series laid out as
+// <root>/<exchange>/<symbol>/ohlcv-<timeframe>/ and <root>/<exchange>/<symbol>/trades/
+// with one file per column. Series are opened on first use and cached.
+class MarketStore {
+public:
+    // maxRows bounds every series and sets how much address space each
+    // column reserves (8 bytes per row)
+    explicit MarketStore(std::string root, size_t maxRows = size_t(1) << 24);
+
+    OHLCVSeries& ohlcv(const std::string& exchange, const std::string& symbol, const std::string& timeframe);
+    TradeSeries& trades(const std::string& exchange, const std::string& symbol);
+
+    const std::string& root() const { return root_; }
+
+private:
+    std::string directory(const std::string& exchange, const std::string& symbol, const std::string& leaf) const;
+
+    std::string root_;
+    size_t maxRows_;
+    std::mutex mutex_;
+    std::map<std::string, std::unique_ptr<OHLCVSeries>> ohlcv_;
+    std::map<std::string, std::unique_ptr<TradeSeries>> trades_;
+};
+
+template <typename T>
+ColumnSpan<T> ColumnSeries::column(size_t index) const {
+    return ColumnSpan<T>(reinterpret_cast<const T*>(columnData(index)), size());
+}
+
+} // namespace ccxt
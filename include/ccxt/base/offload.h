@@ -0,0 +1,134 @@
+#pragma once
+
+// Completion-token front end for the blocking REST API. Each call runs the
+// synchronous method on Executor::shared() and completes the token on the
+// handler's executor, so an io_context (or a coroutine co_awaiting with
+// boost::asio::use_awaitable, C++20 / CCXT_ENABLE_COROUTINES) never blocks
+// on a request. This is a thread-pool offload, not non-blocking I/O: every
+// request in flight occupies a pool thread, so at most
+// Executor::shared().size() run at once and the rest queue. Requests are not
+// multiplexed on the io_context; that would need Beast async HTTP.
+//
+// Wrappers exist only for calls that reach a real request in the Binance
+// adapter; run() takes any other callable.
+//
+// This header pulls in Asio and is intentionally not included by exchange.h.
+
+#include <exception>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <boost/asio/async_result.hpp>
+#include <boost/asio/associated_executor.hpp>
+#include <boost/asio/dispatch.hpp>
+#include <boost/asio/executor_work_guard.hpp>
+#include "ccxt/base/exchange.h"
+#include "ccxt/base/executor.h"
+
+namespace ccxt {
+namespace offload {
+
+// Runs function on the shared Executor and completes the token on the
+// handler's associated executor (the awaiting coroutine's io_context).
+template <typename Function, typename CompletionToken>
+auto run(Function&& function, CompletionToken&& token) {
+    using Result = std::invoke_result_t<std::decay_t<Function>>;
+    return boost::asio::async_initiate<CompletionToken, void(std::exception_ptr, Result)>(
+        [](auto handler, std::decay_t<Function> function) {
+            auto executor = boost::asio::get_associated_executor(handler);
+            using Handler = decltype(handler);
+            using Work = decltype(boost::asio::make_work_guard(executor));
+            struct State {
+                Handler handler;
+                std::decay_t<Function> function;
+                Work work;
+            };
+            // Handlers may be move-only, Executor::post needs a copyable callable
+            auto state = std::make_shared<State>(State{std::move(handler), std::move(function),
+                                                       boost::asio::make_work_guard(executor)});
+            Executor::shared().post([state]() {
+                std::exception_ptr error;
+                Result result{};
+                try {
+                    result = state->function();
+                } catch (...) {
+                    error = std::current_exception();
+                }
+                auto target = state->work.get_executor();
+                boost::asio::dispatch(target, [state, error, result = std::move(result)]() mutable {
+                    state->work.reset();
+                    std::move(state->handler)(error, std::move(result));
+                });
+            });
+        },
+        token, std::forward<Function>(function));
+}
+
+template <typename CompletionToken>
+auto fetchTime(Exchange& exchange, CompletionToken&& token) {
+    return run([&exchange]() { return exchange.fetchTime(); }, std::forward<CompletionToken>(token));
+}
+
+template <typename CompletionToken>
+auto fetchTicker(Exchange& exchange, const std::string& symbol, const json& params, CompletionToken&& token) {
+    return run([&exchange, symbol, params]() { return exchange.fetchTicker(symbol, params); },
+                  std::forward<CompletionToken>(token));
+}
+
+template <typename CompletionToken>
+auto fetchOrderBook(Exchange& exchange, const std::string& symbol, int limit, const json& params,
+                    CompletionToken&& token) {
+    return run([&exchange, symbol, limit, params]() { return exchange.fetchOrderBook(symbol, limit, params); },
+                  std::forward<CompletionToken>(token));
+}
+
+template <typename CompletionToken>
+auto fetchOHLCV(Exchange& exchange, const std::string& symbol, const std::string& timeframe, long long since, int limit,
+                const json& params, CompletionToken&& token) {
+    return run([&exchange, symbol, timeframe, since, limit, params]() {
+                      return exchange.fetchOHLCV(symbol, timeframe, since, limit, params);
+                  },
+                  std::forward<CompletionToken>(token));
+}
+
+template <typename CompletionToken>
+auto fetchBalance(Exchange& exchange, const json& params, CompletionToken&& token) {
+    return run([&exchange, params]() { return exchange.fetchBalance(params); },
+                  std::forward<CompletionToken>(token));
+}
+
+template <typename CompletionToken>
+auto createOrder(Exchange& exchange, const std::string& symbol, const std::string& type, const std::string& side,
+                 double amount, double price, const json& params, CompletionToken&& token) {
+    return run([&exchange, symbol, type, side, amount, price, params]() {
+                      return exchange.createOrder(symbol, type, side, amount, price, params);
+                  },
+                  std::forward<CompletionToken>(token));
+}
+
+template <typename CompletionToken>
+auto cancelOrder(Exchange& exchange, const std::string& id, const std::string& symbol, const json& params,
+                 CompletionToken&& token) {
+    return run([&exchange, id, symbol, params]() { return exchange.cancelOrder(id, symbol, params); },
+                  std::forward<CompletionToken>(token));
+}
+
+template <typename CompletionToken>
+auto fetchOrder(Exchange& exchange, const std::string& id, const std::string& symbol, const json& params,
+                CompletionToken&& token) {
+    return run([&exchange, id, symbol, params]() { return exchange.fetchOrder(id, symbol, params); },
+                  std::forward<CompletionToken>(token));
+}
+
+template <typename CompletionToken>
+auto fetchOpenOrders(Exchange& exchange, const std::string& symbol, int since, int limit, const json& params,
+                     CompletionToken&& token) {
+    return run([&exchange, symbol, since, limit, params]() {
+                      return exchange.fetchOpenOrders(symbol, since, limit, params);
+                  },
+                  std::forward<CompletionToken>(token));
+}
+
+} // namespace offload
+} // namespace ccxt
@@ -0,0 +1,69 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <optional>
+#include <shared_mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include <ccxt/base/types.h>
+
+namespace ccxt {
+
+// Last known state of every order of one account, fed by the WebSocket
+// execution reports and corrected by occasional REST snapshots, so status
+// queries are map lookups instead of fetchOrder calls. Updates that arrive
+// out of order are dropped: fills never shrink, an order never reopens
+// once closed and an older update never overwrites a newer one.
+//
+// Written from the IO thread, readable from any thread.
+class OrderTracker {
+public:
+    // Closed orders kept for lookups; the oldest are forgotten first
+    explicit OrderTracker(size_t maxClosed = 1000);
+
+    // updatedAt is the exchange time of the update in milliseconds;
+    // without it order.timestamp is used. Returns false for a stale update.
+    bool apply(const Order& order);
+    bool apply(const Order& order, long long updatedAt);
+
+    // Applies a fetchOpenOrders snapshot of symbol ("" for all) taken at
+    // asOf. Returns the ids still open here but missing from the snapshot,
+    // i.e. closed while no execution report reached us; fetch them.
+    std::vector<std::string> reconcile(const std::vector<Order>& open, const std::string& symbol, long long asOf);
+
+    std::optional<Order> byId(const std::string& id) const;
+    std::optional<Order> byClientOrderId(const std::string& clientOrderId) const;
+    std::vector<Order> open(const std::string& symbol = "") const;
+    size_t size() const;
+    // Updates dropped as stale
+    uint64_t stale() const;
+
+    // Both the unified statuses and raw ones such as Binance's FILLED
+    static bool isClosed(const std::string& status);
+    // A unified order as returned by parseOrder / fetchOrderImpl
+    static Order fromJson(const json& order);
+
+private:
+    struct Entry {
+        Order order;
+        long long updatedAt = 0;
+        bool closed = false;
+        // Every clientOrderId seen for it, e.g. the original and the cancel's
+        std::vector<std::string> clientOrderIds;
+    };
+
+    void forget(const std::string& id);
+
+    const size_t maxClosed_;
+    mutable std::shared_mutex mutex_;
+    std::unordered_map<std::string, Entry> orders_;
+    std::unordered_map<std::string, std::string> byClientOrderId_;
+    // Closed order ids, oldest first
+    std::deque<std::string> closed_;
+    uint64_t stale_ = 0;
+};
+
+} // namespace ccxt
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <nlohmann/json.hpp>
+
+namespace ccxt {
+
+using json = nlohmann::json;
+
+// A REST path such as "api/v3/order/{symbol}/{id}" split once into literal
+// and placeholder segments, so rendering is a single pass of appends.
+class PathTemplate {
+public:
+    PathTemplate() = default;
+    explicit PathTemplate(const std::string& path);
+
+    // Appends the path to out, substituting placeholders found in params.
+    // Placeholders without a matching param are kept verbatim as "{name}".
+    void render(const json& params, std::string& out) const;
+    std::string render(const json& params) const;
+
+    const std::vector<std::string>& params() const { return params_; }
+    bool hasParams() const { return !params_.empty(); }
+
+private:
+    struct Segment {
+        std::string text;
+        bool placeholder;
+    };
+
+    static void appendValue(const json& value, std::string& out);
+
+    std::vector<Segment> segments_;
+    std::vector<std::string> params_;
+    size_t literalSize_ = 0;
+};
+
+} // namespace ccxt
@@ -0,0 +1,73 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+#include <nlohmann/json.hpp>
+
+namespace ccxt {
+
+using json = nlohmann::json;
+
+// Builds "k1=v1&k2=v2" query strings into a buffer that keeps its capacity
+// across clear(), so a warm builder encodes a request without allocating.
+// In sorted mode pairs are emitted ordered by key (ties keep insertion
+// order) for exchanges that sign a canonical query.
+class QueryBuilder {
+public:
+    explicit QueryBuilder(bool sortedKeys = false) : sortedKeys_(sortedKeys) {}
+
+    void clear();
+    bool empty() const { return pairs_ == 0; }
+    void setSortedKeys(bool sortedKeys) { sortedKeys_ = sortedKeys; }
+
+    QueryBuilder& add(std::string_view key, std::string_view value);
+    QueryBuilder& add(std::string_view key, const std::string& value) { return add(key, std::string_view(value)); }
+    QueryBuilder& add(std::string_view key, const char* value) { return add(key, std::string_view(value)); }
+    QueryBuilder& add(std::string_view key, const json& value);
+    template <typename T, std::enable_if_t<std::is_arithmetic_v<T>, int> = 0>
+    QueryBuilder& add(std::string_view key, T value) {
+        if constexpr (std::is_same_v<T, bool>) {
+            return add(key, std::string_view(value ? "true" : "false"));
+        } else if constexpr (std::is_integral_v<T>) {
+            return addInteger(key, static_cast<long long>(value));
+        } else {
+            return addNumber(key, static_cast<double>(value));
+        }
+    }
+    // Adds every member of a json object (nlohmann objects iterate by key)
+    QueryBuilder& add(const json& params);
+
+    // The encoded query; stays valid until the next mutation
+    std::string_view view();
+    const std::string& str();
+
+    // Percent-encodes everything outside RFC 3986 unreserved characters
+    static void encode(std::string_view input, std::string& out);
+    static std::string encode(std::string_view input);
+
+private:
+    struct Entry {
+        size_t offset;
+        size_t keyLength;
+        size_t length;
+    };
+
+    QueryBuilder& addInteger(std::string_view key, long long value);
+    QueryBuilder& addNumber(std::string_view key, double value);
+    std::string& beginPair(std::string_view key);
+    void endPair();
+    void finalize();
+
+    bool sortedKeys_;
+    bool finalized_ = true;
+    size_t pairs_ = 0;
+    size_t pairStart_ = 0;
+    size_t pairKeyLength_ = 0;
+    std::string out_;
+    std::string scratch_;
+    std::vector<Entry> entries_;
+};
+
+} // namespace ccxt
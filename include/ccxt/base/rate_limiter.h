@@ -0,0 +1,31 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+
+namespace ccxt {
+
+// Spaces requests at least `interval` milliseconds apart (ccxt's rateLimit),
+// shared by every thread using the same exchange. Each acquire() reserves the
+// next free slot with a single CAS, so callers are served in arrival order
+// without a lock.
+class RateLimiter {
+public:
+    explicit RateLimiter(double intervalMs = 0);
+
+    // 0 disables throttling
+    void setInterval(double intervalMs);
+    double interval() const;
+
+    // Reserves `cost` slots and returns how long the caller must wait before
+    // sending; acquire() sleeps for that long and returns the same value.
+    std::chrono::nanoseconds reserve(double cost = 1.0);
+    std::chrono::nanoseconds acquire(double cost = 1.0);
+
+private:
+    std::atomic<long long> intervalNs_;
+    // steady_clock time at which the next request may be sent
+    std::atomic<long long> next_{0};
+};
+
+} // namespace ccxt
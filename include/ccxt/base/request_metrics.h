@@ -0,0 +1,87 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <ccxt/base/histogram.h>
+
+namespace ccxt {
+
+// Where one REST round trip spends its time, in the order it happens
+enum class RequestPhase {
+    Queue,      // waiting on the rate limiter
+    Sign,       // building the signed query
+    Dns,        // only recorded when a new connection was opened
+    Connect,
+    Tls,
+    FirstByte,  // request sent until the first response byte
+    Transfer,   // first byte until the body is complete
+    Parse,      // JSON decode
+    Total,
+    Count
+};
+
+const char* phaseName(RequestPhase phase);
+
+// Per phase timings of a single request, nanoseconds; -1 means not measured
+struct RequestTiming {
+    std::array<int64_t, static_cast<size_t>(RequestPhase::Count)> phases;
+    RequestTiming() { phases.fill(-1); }
+
+    int64_t& operator[](RequestPhase phase) { return phases[static_cast<size_t>(phase)]; }
+    int64_t operator[](RequestPhase phase) const { return phases[static_cast<size_t>(phase)]; }
+};
+
+struct EndpointMetrics {
+    uint64_t requests = 0;
+    // Transport failures, non-2xx responses and unparseable bodies
+    uint64_t errors = 0;
+    std::array<HistogramSummary, static_cast<size_t>(RequestPhase::Count)> phases;
+
+    const HistogramSummary& operator[](RequestPhase phase) const { return phases[static_cast<size_t>(phase)]; }
+};
+
+struct MetricsSnapshot {
+    std::string exchange;
+    // Keyed by "<METHOD> <path>", e.g. "GET /api/v3/ticker/24hr"
+    std::map<std::string, EndpointMetrics> endpoints;
+};
+
+// Latency histograms per endpoint and phase. Finding an endpoint takes a
+// shared lock (exclusive only the first time it is seen); recording into it
+// is lock-free, so any number of threads can report concurrently.
+class RequestMetrics {
+public:
+    void record(std::string_view endpoint, const RequestTiming& timing, bool failed = false);
+    MetricsSnapshot snapshot() const;
+    void reset();
+
+    // "<METHOD> <path>" for a full URL: scheme, host and query are dropped
+    static std::string endpointKey(std::string_view method, std::string_view url);
+
+    // sign() runs before fetch() on the same thread; it reports its time
+    // here and the next fetch() on that thread picks it up
+    static void noteSignTime(int64_t nanoseconds);
+    static int64_t takeSignTime();
+
+private:
+    struct Endpoint {
+        std::atomic<uint64_t> requests{0};
+        std::atomic<uint64_t> errors{0};
+        std::array<LatencyHistogram, static_cast<size_t>(RequestPhase::Count)> phases;
+    };
+
+    Endpoint& endpoint(std::string_view key);
+
+    mutable std::shared_mutex mutex_;
+    std::unordered_map<std::string, std::unique_ptr<Endpoint>> endpoints_;
+};
+
+} // namespace ccxt
@@ -3,6 +3,7 @@
 #include <string>
 #include <vector>
 #include <map>
+#include <optional>
 #include <ccxt/base/config.h>
 
 namespace ccxt {
@@ -112,6 +113,17 @@ struct Order {
     std::map<std::string, std::string> info;
 };
 
+// One order of a createOrders / editOrders batch
+struct OrderRequest {
+    std::string symbol;
+    std::string type;
+    std::string side;
+    double amount = 0;
+    std::optional<double> price;
+    // editOrders only: the order to replace
+    std::string id;
+};
+
 struct Trade {
     std::string id;
     std::string order;
@@ -1,47 +1,91 @@
 #ifndef CCXT_WEBSOCKET_CLIENT_H
 #define CCXT_WEBSOCKET_CLIENT_H
 
-#include <boost/beast/core.hpp>
-#include <boost/beast/websocket.hpp>
-#include <boost/beast/websocket/ssl.hpp>
-#include <boost/beast/ssl.hpp>
-#include <boost/asio/strand.hpp>
-#include <boost/asio/io_context.hpp>
-#include <boost/asio/ip/tcp.hpp>
-#include <boost/asio/ssl/context.hpp>
-#include <boost/asio/ssl/stream.hpp>
+#include <chrono>
+#include <cstdint>
+#include <exception>
+#include <future>
+#include <map>
 #include <string>
 #include <functional>
 #include <memory>
+#include <ccxt/base/histogram.h>
+
+// Beast and Asio SSL live behind Impl in websocket_client.cpp so that the
+// WS adapters don't have to parse them.
+namespace boost {
+namespace asio {
+class io_context;
+namespace ssl { class context; }
+} // namespace asio
+namespace system { class error_code; }
+} // namespace boost
 
 namespace ccxt {
 
+class FrameRecorder;
+
 class WebSocketClient : public std::enable_shared_from_this<WebSocketClient> {
 public:
     using MessageHandler = std::function<void(const std::string&)>;
 
     WebSocketClient(boost::asio::io_context& ioc, boost::asio::ssl::context& ctx);
-    ~WebSocketClient();
+    virtual ~WebSocketClient();
 
+    // Throws BadRequest for a port that isn't a number in 1-65535
     void connect(const std::string& host, const std::string& port, const std::string& path);
     void send(const std::string& message);
     void close();
 
     void setMessageHandler(MessageHandler handler);
+    // Runs handleMessage() and then the message handler, as for a frame off
+    // the socket; FrameReplayer uses it to drive adapters offline
+    void deliver(const std::string& message);
+    // Every received frame is handed to the recorder before the handler runs
+    void setRecorder(std::shared_ptr<FrameRecorder> recorder);
+    // Process-unique, tags this client's frames in a recording
+    uint32_t connectionId() const { return connectionId_; }
+
+    // Request/response over the socket (order entry, ws-api calls). Ids
+    // increase monotonically per client; put the id in the message, then
+    // request() sends it and the future gets the frame answering it. A
+    // request that isn't answered within timeout fails with RequestTimeout,
+    // and every pending one fails with NetworkError as soon as resolving,
+    // connecting, a handshake or a write fails, or the socket drops.
+    uint64_t nextRequestId();
+    std::future<std::string> request(uint64_t id, const std::string& method, const std::string& message,
+                                     std::chrono::milliseconds timeout = std::chrono::seconds(10));
+    size_t pendingRequests() const;
+    // Round trip in nanoseconds per method, answered requests only
+    std::map<std::string, HistogramSummary> requestLatency() const;
 protected:
     virtual void handleMessage(const std::string& message) {}
+    // For adapters, from handleMessage(): completes request id with its
+    // response or an error. False if nothing waits for that id (already
+    // timed out, or a subscription ack).
+    bool resolve(uint64_t id, const std::string& response);
+    bool reject(uint64_t id, std::exception_ptr error);
 private:
-    void onResolve(boost::beast::error_code ec, boost::asio::ip::tcp::resolver::results_type results);
-    void onConnect(const boost::system::error_code& ec, const boost::asio::ip::tcp::endpoint& endpoint);
-    void onHandshake(boost::beast::error_code ec);
-    void onWrite(boost::beast::error_code ec, std::size_t bytes_transferred);
-    void onRead(boost::beast::error_code ec, std::size_t bytes_transferred);
-    void onClose(boost::beast::error_code ec);
-
-    boost::beast::websocket::stream<boost::asio::ssl::stream<boost::asio::ip::tcp::socket>> ws_;
-    boost::beast::flat_buffer buffer_;
-    boost::asio::ip::tcp::resolver resolver_;
+    struct Impl;
+    struct Pending;
+
+    void write();
+    void armTimer();
+    void expireRequests();
+    void failRequests(const std::string& reason);
+    std::unique_ptr<Pending> take(uint64_t id);
+
+    void onResolve(const boost::system::error_code& ec);
+    void onConnect(const boost::system::error_code& ec);
+    void onHandshake(const boost::system::error_code& ec);
+    void onWrite(const boost::system::error_code& ec, std::size_t bytes_transferred);
+    void onRead(const boost::system::error_code& ec, std::size_t bytes_transferred);
+    void onClose(const boost::system::error_code& ec);
+
+    std::unique_ptr<Impl> impl_;
     MessageHandler messageHandler_;
+    std::shared_ptr<FrameRecorder> recorder_;
+    uint32_t connectionId_;
 };
 
 } // namespace ccxt
@@ -54,12 +54,12 @@ public:
   json fetchBalance(const json &params = json::object()) override;
 
   // Market Data API - Async
-  AsyncPullType fetchMarketsAsync(const json &params = json::object());
-  AsyncPullType fetchTickerAsync(const std::string &symbol,
-                                 const json &params = json::object());
-  AsyncPullType fetchTickersAsync(const std::vector<std::string> &symbols = std::vector<std::string>(),
+  std::future<json> fetchMarketsAsync(const json &params = json::object());
+  std::future<json> fetchTickerAsync(const std::string &symbol,
+                                     const json &params = json::object());
+  std::future<json> fetchTickersAsync(const std::vector<std::string> &symbols = std::vector<std::string>(),
                     const json &params = json::object());
-  // AsyncPullType fetchOrderBookAsync(const std::string& symbol,
+  // std::future<json> fetchOrderBookAsync(const std::string& symbol,
   //                                                                     const
   //                                                                     long*
   //                                                                     limit =
@@ -69,18 +69,18 @@ public:
   //                                                                     params
   //                                                                     =
   //                                                                     json::object());
-  AsyncPullType fetchOHLCVAsync(const std::string &symbol,
-                                const std::string &timeframe = "1m",
-                                const long *since = nullptr,
-                                const long *limit = nullptr,
-                                const json &params = json::object());
+  std::future<json> fetchOHLCVAsync(const std::string &symbol,
+                                    const std::string &timeframe = "1m",
+                                    const long *since = nullptr,
+                                    const long *limit = nullptr,
+                                    const json &params = json::object());
 
-  AsyncPullType withdrawAsync(const std::string &code, const double &amount,
-                              const std::string &address, const std::string &tag,
-                              const json &params);
+  std::future<json> withdrawAsync(const std::string &code, const double &amount,
+                                  const std::string &address, const std::string &tag,
+                                  const json &params);
 
   // Trading API - Async
-  // AsyncPullType createOrderAsync(const std::string& symbol,
+  // std::future<json> createOrderAsync(const std::string& symbol,
   //                                                                  const
   //                                                                  std::string&
   //                                                                  type,
@@ -98,11 +98,11 @@ public:
   //                                                                  json&
   //                                                                  params =
   //                                                                  json::object());
-  AsyncPullType cancelOrderAsync(const std::string &id, const std::string &symbol = "",
-                                 const json &params = json::object());
-  AsyncPullType fetchOrderAsync(const std::string &id, const std::string &symbol = "",
-                                const json &params = json::object());
-  // AsyncPullType fetchOpenOrdersAsync(const std::string& symbol = "",
+  std::future<json> cancelOrderAsync(const std::string &id, const std::string &symbol = "",
+                                     const json &params = json::object());
+  std::future<json> fetchOrderAsync(const std::string &id, const std::string &symbol = "",
+                                    const json &params = json::object());
+  // std::future<json> fetchOpenOrdersAsync(const std::string& symbol = "",
   //                                                                      const
   //                                                                      long*
   //                                                                      since
@@ -118,7 +118,7 @@ public:
   //                                                                      params
   //                                                                      =
   //                                                                      json::object());
-  // AsyncPullType fetchMyTradesAsync(const std::string& symbol = "",
+  // std::future<json> fetchMyTradesAsync(const std::string& symbol = "",
   //                                                                  const
   //                                                                  long*
   //                                                                  since =
@@ -133,7 +133,7 @@ public:
   //                                                                  json::object());
 
   // Account API - Async
-  AsyncPullType fetchBalanceAsync(const json &params = json::object());
+  std::future<json> fetchBalanceAsync(const json &params = json::object());
 
 protected:
   // Helper Methods
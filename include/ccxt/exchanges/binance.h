@@ -1,13 +1,17 @@
 #pragma once
 
 #include <ccxt/base/exchange.h>
-#include <boost/beast/ssl.hpp>
-#include <boost/asio/ssl.hpp>
-#include <openssl/evp.h>
-#include <openssl/params.h>
+#include <atomic>
+#include <mutex>
+#include <string_view>
 
 namespace ccxt {
+class BinanceWS;
+
 class Binance : public Exchange {
+    // Signs ws-api requests with the REST credentials
+    friend class BinanceWS;
+
 public:
     static const std::string defaultHostname;
     static const int defaultRateLimit;
@@ -77,6 +81,10 @@ protected:
     json editOrderImpl(const std::string& id, const std::string& symbol, const std::string& type,
                     const std::string& side, const std::optional<double>& amount = std::nullopt,
                     const std::optional<double>& price = std::nullopt) override;
+    // USDⓈ-M futures have batchOrders; other markets use the fallback
+    json createOrdersImpl(const std::vector<OrderRequest>& orders) override;
+    json cancelOrdersImpl(const std::vector<std::string>& ids, const std::string& symbol = "") override;
+    json editOrdersImpl(const std::vector<OrderRequest>& orders) override;
     json setLeverageImpl(int leverage, const std::string& symbol = "") override;
     json setMarginModeImpl(const std::string& marginMode, const std::string& symbol = "") override;
     json addMarginImpl(const std::string& symbol, double amount) override;
@@ -104,8 +112,19 @@ private:
                   const std::map<std::string, std::string>& headers = {},
                   const json& body = nullptr) const override;
     std::string getTimestamp() const;
-    std::string createSignature(const std::string& queryString) const;
+    // Sent with every signed request when set (options.recvWindow)
+    int recvWindow_ = 0;
+    void createSignature(std::string_view queryString, HmacSigner::Buffer& signature) const;
     std::string parseSymbol(const std::string& symbol) const;
+    bool hasBatchOrders(const std::string& symbol) const;
+    json batchOrder(const OrderRequest& order);
+    // Unsigned GET on the spot public api
+    json sendPublic(const std::string& path, const json& request) const;
+    // Signed fapi batchOrders request with method POST, PUT or DELETE
+    json sendBatch(const std::string& method, const json& request) const;
+    // One result per request of a batchOrders chunk
+    void parseBatchOrders(const json& response, const std::vector<std::string>& ids,
+                          const std::vector<std::string>& symbols, json& result) const;
     std::string parseTimeInForce(const std::string& timeInForce) const;
     std::string parseOrderType(const std::string& type) const;
     std::string parseOrderSide(const std::string& side) const;
@@ -124,7 +143,8 @@ private:
     json parseDeposit(const json& deposit, const std::string& currency = "") const override;
 
     mutable std::mutex markets_mutex;
-    mutable bool markets_loaded{false};
+    // Set with release once markets are in; read with acquire outside the lock
+    mutable std::atomic<bool> markets_loaded{false};
 
     // Member variables
     std::map<std::string, std::string> timeframes;
@@ -2,7 +2,7 @@
 
 #include "ccxt/base/exchange.h"
 #include <boost/asio.hpp>
-#include <boost/future.hpp>
+#include "ccxt/base/executor.h"
 
 namespace ccxt {
 
@@ -18,7 +18,7 @@ public:
     json fetchOrderBook(const std::string& symbol, int limit = 0, const json& params = json::object()) override;
     json fetchTrades(const std::string& symbol, int since = 0, int limit = 0, const json& params = json::object()) override;
     json fetchOHLCV(const std::string& symbol, const std::string& timeframe = "1m",
-                    int since = 0, int limit = 0, const json& params = json::object()) override;
+                    long long since = 0, int limit = 0, const json& params = json::object()) override;
     json fetchTime(const json& params = json::object()) override;
     json fetchTradingFee(const std::string& symbol, const json& params = json::object()) override;
 
@@ -42,34 +42,34 @@ public:
     json fetchTransfers(const std::string& code = "", int since = 0, int limit = 0, const json& params = json::object()) override;
 
     // Asynchronous Market Data API
-    boost::future<json> fetchMarketsAsync(const json& params = json::object());
-    boost::future<json> fetchTickerAsync(const std::string& symbol, const json& params = json::object());
-    boost::future<json> fetchTickersAsync(const std::vector<std::string>& symbols = {}, const json& params = json::object());
-    boost::future<json> fetchOrderBookAsync(const std::string& symbol, int limit = 0, const json& params = json::object());
-    boost::future<json> fetchTradesAsync(const std::string& symbol, int since = 0, int limit = 0, const json& params = json::object());
-    boost::future<json> fetchOHLCVAsync(const std::string& symbol, const std::string& timeframe = "1m",
-                                      int since = 0, int limit = 0, const json& params = json::object());
-    boost::future<json> fetchTimeAsync(const json& params = json::object());
-    boost::future<json> fetchTradingFeeAsync(const std::string& symbol, const json& params = json::object());
+    std::future<json> fetchMarketsAsync(const json& params = json::object());
+    std::future<json> fetchTickerAsync(const std::string& symbol, const json& params = json::object());
+    std::future<json> fetchTickersAsync(const std::vector<std::string>& symbols = {}, const json& params = json::object());
+    std::future<json> fetchOrderBookAsync(const std::string& symbol, int limit = 0, const json& params = json::object());
+    std::future<json> fetchTradesAsync(const std::string& symbol, int since = 0, int limit = 0, const json& params = json::object());
+    std::future<json> fetchOHLCVAsync(const std::string& symbol, const std::string& timeframe = "1m",
+                                      long long since = 0, int limit = 0, const json& params = json::object());
+    std::future<json> fetchTimeAsync(const json& params = json::object());
+    std::future<json> fetchTradingFeeAsync(const std::string& symbol, const json& params = json::object());
 
     // Asynchronous Trading API
-    boost::future<json> fetchBalanceAsync(const json& params = json::object());
-    boost::future<json> createOrderAsync(const std::string& symbol, const std::string& type, const std::string& side,
+    std::future<json> fetchBalanceAsync(const json& params = json::object());
+    std::future<json> createOrderAsync(const std::string& symbol, const std::string& type, const std::string& side,
                                       double amount, double price = 0, const json& params = json::object());
-    boost::future<json> cancelOrderAsync(const std::string& id, const std::string& symbol = "", const json& params = json::object());
-    boost::future<json> fetchOrderAsync(const std::string& id, const std::string& symbol = "", const json& params = json::object());
-    boost::future<json> fetchOrdersAsync(const std::string& symbol = "", int since = 0, int limit = 0, const json& params = json::object());
-    boost::future<json> fetchOpenOrdersAsync(const std::string& symbol = "", int since = 0, int limit = 0, const json& params = json::object());
-    boost::future<json> fetchClosedOrdersAsync(const std::string& symbol = "", int since = 0, int limit = 0, const json& params = json::object());
-    boost::future<json> fetchMyTradesAsync(const std::string& symbol = "", int since = 0, int limit = 0, const json& params = json::object());
+    std::future<json> cancelOrderAsync(const std::string& id, const std::string& symbol = "", const json& params = json::object());
+    std::future<json> fetchOrderAsync(const std::string& id, const std::string& symbol = "", const json& params = json::object());
+    std::future<json> fetchOrdersAsync(const std::string& symbol = "", int since = 0, int limit = 0, const json& params = json::object());
+    std::future<json> fetchOpenOrdersAsync(const std::string& symbol = "", int since = 0, int limit = 0, const json& params = json::object());
+    std::future<json> fetchClosedOrdersAsync(const std::string& symbol = "", int since = 0, int limit = 0, const json& params = json::object());
+    std::future<json> fetchMyTradesAsync(const std::string& symbol = "", int since = 0, int limit = 0, const json& params = json::object());
 
     // Asynchronous Account API
-    boost::future<json> fetchDepositsAsync(const std::string& code = "", int since = 0, int limit = 0, const json& params = json::object());
-    boost::future<json> fetchWithdrawalsAsync(const std::string& code = "", int since = 0, int limit = 0, const json& params = json::object());
-    boost::future<json> fetchDepositAddressAsync(const std::string& code, const json& params = json::object());
-    boost::future<json> withdrawAsync(const std::string& code, double amount, const std::string& address, const std::string& tag = "", const json& params = json::object());
-    boost::future<json> transferAsync(const std::string& code, double amount, const std::string& fromAccount, const std::string& toAccount, const json& params = json::object());
-    boost::future<json> fetchTransfersAsync(const std::string& code = "", int since = 0, int limit = 0, const json& params = json::object());
+    std::future<json> fetchDepositsAsync(const std::string& code = "", int since = 0, int limit = 0, const json& params = json::object());
+    std::future<json> fetchWithdrawalsAsync(const std::string& code = "", int since = 0, int limit = 0, const json& params = json::object());
+    std::future<json> fetchDepositAddressAsync(const std::string& code, const json& params = json::object());
+    std::future<json> withdrawAsync(const std::string& code, double amount, const std::string& address, const std::string& tag = "", const json& params = json::object());
+    std::future<json> transferAsync(const std::string& code, double amount, const std::string& fromAccount, const std::string& toAccount, const json& params = json::object());
+    std::future<json> fetchTransfersAsync(const std::string& code = "", int since = 0, int limit = 0, const json& params = json::object());
 
     // Perpetual Swap API (both sync and async)
     json fetchPerpetualMarkets(const json& params = json::object());
@@ -85,18 +85,18 @@ public:
     json setMarginMode(const std::string& marginMode, const std::string& symbol = "", const json& params = json::object());
     json setPositionMode(const std::string& hedged, const std::string& symbol = "", const json& params = json::object());
 
-    boost::future<json> fetchPerpetualMarketsAsync(const json& params = json::object());
-    boost::future<json> fetchPerpetualBalanceAsync(const json& params = json::object());
-    boost::future<json> createPerpetualOrderAsync(const std::string& symbol, const std::string& type, const std::string& side,
+    std::future<json> fetchPerpetualMarketsAsync(const json& params = json::object());
+    std::future<json> fetchPerpetualBalanceAsync(const json& params = json::object());
+    std::future<json> createPerpetualOrderAsync(const std::string& symbol, const std::string& type, const std::string& side,
                                                double amount, double price = 0, const json& params = json::object());
-    boost::future<json> cancelPerpetualOrderAsync(const std::string& id, const std::string& symbol = "", const json& params = json::object());
-    boost::future<json> fetchPerpetualPositionAsync(const std::string& symbol = "", const json& params = json::object());
-    boost::future<json> fetchPerpetualPositionsAsync(const std::vector<std::string>& symbols = {}, const json& params = json::object());
-    boost::future<json> fetchPerpetualFundingRateAsync(const std::string& symbol, const json& params = json::object());
-    boost::future<json> fetchPerpetualFundingHistoryAsync(const std::string& symbol = "", int since = 0, int limit = 0, const json& params = json::object());
-    boost::future<json> setLeverageAsync(int leverage, const std::string& symbol = "", const json& params = json::object());
-    boost::future<json> setMarginModeAsync(const std::string& marginMode, const std::string& symbol = "", const json& params = json::object());
-    boost::future<json> setPositionModeAsync(const std::string& hedged, const std::string& symbol = "", const json& params = json::object());
+    std::future<json> cancelPerpetualOrderAsync(const std::string& id, const std::string& symbol = "", const json& params = json::object());
+    std::future<json> fetchPerpetualPositionAsync(const std::string& symbol = "", const json& params = json::object());
+    std::future<json> fetchPerpetualPositionsAsync(const std::vector<std::string>& symbols = {}, const json& params = json::object());
+    std::future<json> fetchPerpetualFundingRateAsync(const std::string& symbol, const json& params = json::object());
+    std::future<json> fetchPerpetualFundingHistoryAsync(const std::string& symbol = "", int since = 0, int limit = 0, const json& params = json::object());
+    std::future<json> setLeverageAsync(int leverage, const std::string& symbol = "", const json& params = json::object());
+    std::future<json> setMarginModeAsync(const std::string& marginMode, const std::string& symbol = "", const json& params = json::object());
+    std::future<json> setPositionModeAsync(const std::string& hedged, const std::string& symbol = "", const json& params = json::object());
 
     // Copy Trading API (both sync and async)
     json fetchCopyTradingPositions(const json& params = json::object());
@@ -105,11 +105,11 @@ public:
     json cancelCopyTradingOrder(const std::string& id, const std::string& symbol = "", const json& params = json::object());
     json fetchCopyTradingBalance(const json& params = json::object());
 
-    boost::future<json> fetchCopyTradingPositionsAsync(const json& params = json::object());
-    boost::future<json> createCopyTradingOrderAsync(const std::string& symbol, const std::string& type, const std::string& side,
+    std::future<json> fetchCopyTradingPositionsAsync(const json& params = json::object());
+    std::future<json> createCopyTradingOrderAsync(const std::string& symbol, const std::string& type, const std::string& side,
                                                  double amount, double price = 0, const json& params = json::object());
-    boost::future<json> cancelCopyTradingOrderAsync(const std::string& id, const std::string& symbol = "", const json& params = json::object());
-    boost::future<json> fetchCopyTradingBalanceAsync(const json& params = json::object());
+    std::future<json> cancelCopyTradingOrderAsync(const std::string& id, const std::string& symbol = "", const json& params = json::object());
+    std::future<json> fetchCopyTradingBalanceAsync(const json& params = json::object());
 
 protected:
     std::string sign(const std::string& path, const std::string& api = "public",
@@ -135,7 +135,7 @@ private:
                          const std::string& path, const std::string& querystd::string);
 
     // Asynchronous helpers
-    boost::future<json> makeAsyncRequest(const std::string& path, const std::string& api,
+    std::future<json> makeAsyncRequest(const std::string& path, const std::string& api,
                                       const std::string& method, const json& params = json::object(),
                                       const std::map<std::string, std::string>& headers = {}, const json& body = nullptr);
 
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "ccxt/base/exchange.h"
+#include "ccxt/base/executor.h"
 
 namespace ccxt {
 
@@ -18,12 +19,12 @@ public:
     nlohmann::json fetchTradingFees(const nlohmann::json& params = nlohmann::json::object()) override;
 
     // Async Market Data API
-    boost::future<nlohmann::json> fetchMarketsAsync(const nlohmann::json& params = nlohmann::json::object());
-    boost::future<nlohmann::json> fetchTickerAsync(const std::string& symbol, const nlohmann::json& params = nlohmann::json::object());
-    boost::future<nlohmann::json> fetchTickersAsync(const std::vector<std::string>& symbols = {}, const nlohmann::json& params = nlohmann::json::object());
-    boost::future<nlohmann::json> fetchOrderBookAsync(const std::string& symbol, int limit = 0, const nlohmann::json& params = nlohmann::json::object());
-    boost::future<nlohmann::json> fetchTradesAsync(const std::string& symbol, int since = 0, int limit = 0, const nlohmann::json& params = nlohmann::json::object());
-    boost::future<nlohmann::json> fetchTradingFeesAsync(const nlohmann::json& params = nlohmann::json::object());
+    std::future<nlohmann::json> fetchMarketsAsync(const nlohmann::json& params = nlohmann::json::object());
+    std::future<nlohmann::json> fetchTickerAsync(const std::string& symbol, const nlohmann::json& params = nlohmann::json::object());
+    std::future<nlohmann::json> fetchTickersAsync(const std::vector<std::string>& symbols = {}, const nlohmann::json& params = nlohmann::json::object());
+    std::future<nlohmann::json> fetchOrderBookAsync(const std::string& symbol, int limit = 0, const nlohmann::json& params = nlohmann::json::object());
+    std::future<nlohmann::json> fetchTradesAsync(const std::string& symbol, int since = 0, int limit = 0, const nlohmann::json& params = nlohmann::json::object());
+    std::future<nlohmann::json> fetchTradingFeesAsync(const nlohmann::json& params = nlohmann::json::object());
 
     // Trading API
     nlohmann::json fetchBalance(const nlohmann::json& params = nlohmann::json::object()) override;
@@ -35,19 +36,19 @@ public:
     nlohmann::json fetchMyTrades(const std::string& symbol = "", int since = 0, int limit = 0, const nlohmann::json& params = nlohmann::json::object()) override;
 
     // Async Trading API
-    boost::future<nlohmann::json> fetchBalanceAsync(const nlohmann::json& params = nlohmann::json::object());
-    boost::future<nlohmann::json> createOrderAsync(const std::string& symbol, const std::string& type, const std::string& side,
+    std::future<nlohmann::json> fetchBalanceAsync(const nlohmann::json& params = nlohmann::json::object());
+    std::future<nlohmann::json> createOrderAsync(const std::string& symbol, const std::string& type, const std::string& side,
                                                   double amount, double price = 0, const nlohmann::json& params = nlohmann::json::object());
-    boost::future<nlohmann::json> cancelOrderAsync(const std::string& id, const std::string& symbol = "", const nlohmann::json& params = nlohmann::json::object());
-    boost::future<nlohmann::json> fetchOrderAsync(const std::string& id, const std::string& symbol = "", const nlohmann::json& params = nlohmann::json::object());
-    boost::future<nlohmann::json> fetchOpenOrdersAsync(const std::string& symbol = "", int since = 0, int limit = 0, const nlohmann::json& params = nlohmann::json::object());
-    boost::future<nlohmann::json> fetchMyTradesAsync(const std::string& symbol = "", int since = 0, int limit = 0, const nlohmann::json& params = nlohmann::json::object());
+    std::future<nlohmann::json> cancelOrderAsync(const std::string& id, const std::string& symbol = "", const nlohmann::json& params = nlohmann::json::object());
+    std::future<nlohmann::json> fetchOrderAsync(const std::string& id, const std::string& symbol = "", const nlohmann::json& params = nlohmann::json::object());
+    std::future<nlohmann::json> fetchOpenOrdersAsync(const std::string& symbol = "", int since = 0, int limit = 0, const nlohmann::json& params = nlohmann::json::object());
+    std::future<nlohmann::json> fetchMyTradesAsync(const std::string& symbol = "", int since = 0, int limit = 0, const nlohmann::json& params = nlohmann::json::object());
 
     // Account API
     nlohmann::json fetchDepositAddress(const std::string& code, const nlohmann::json& params = nlohmann::json::object()) override;
 
     // Async Account API
-    boost::future<nlohmann::json> fetchDepositAddressAsync(const std::string& code, const nlohmann::json& params = nlohmann::json::object());
+    std::future<nlohmann::json> fetchDepositAddressAsync(const std::string& code, const nlohmann::json& params = nlohmann::json::object());
 
 protected:
     std::string sign(const std::string& path, const std::string& api = "public",
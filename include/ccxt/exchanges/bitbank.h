@@ -1,6 +1,7 @@
 #pragma once
 
 #include "ccxt/base/exchange.h"
+#include "ccxt/base/executor.h"
 
 namespace ccxt {
 
@@ -15,17 +16,17 @@ public:
     json fetchOrderBook(const std::string& symbol, int limit = 0, const json& params = json::object()) override;
     json fetchTrades(const std::string& symbol, int since = 0, int limit = 0, const json& params = json::object()) override;
     json fetchOHLCV(const std::string& symbol, const std::string& timeframe = "1m",
-                    int since = 0, int limit = 0, const json& params = json::object()) override;
+                    long long since = 0, int limit = 0, const json& params = json::object()) override;
     json fetchTradingFees(const json& params = json::object()) override;
 
     // Async Market Data API
-    boost::future<json> fetchMarketsAsync(const json& params = json::object());
-    boost::future<json> fetchTickerAsync(const std::string& symbol, const json& params = json::object());
-    boost::future<json> fetchOrderBookAsync(const std::string& symbol, int limit = 0, const json& params = json::object());
-    boost::future<json> fetchTradesAsync(const std::string& symbol, int since = 0, int limit = 0, const json& params = json::object());
-    boost::future<json> fetchOHLCVAsync(const std::string& symbol, const std::string& timeframe = "1m",
-                                      int since = 0, int limit = 0, const json& params = json::object());
-    boost::future<json> fetchTradingFeesAsync(const json& params = json::object());
+    std::future<json> fetchMarketsAsync(const json& params = json::object());
+    std::future<json> fetchTickerAsync(const std::string& symbol, const json& params = json::object());
+    std::future<json> fetchOrderBookAsync(const std::string& symbol, int limit = 0, const json& params = json::object());
+    std::future<json> fetchTradesAsync(const std::string& symbol, int since = 0, int limit = 0, const json& params = json::object());
+    std::future<json> fetchOHLCVAsync(const std::string& symbol, const std::string& timeframe = "1m",
+                                      long long since = 0, int limit = 0, const json& params = json::object());
+    std::future<json> fetchTradingFeesAsync(const json& params = json::object());
 
     // Trading API
     json fetchBalance(const json& params = json::object()) override;
@@ -37,21 +38,21 @@ public:
     json fetchMyTrades(const std::string& symbol = "", int since = 0, int limit = 0, const json& params = json::object()) override;
 
     // Async Trading API
-    boost::future<json> fetchBalanceAsync(const json& params = json::object());
-    boost::future<json> createOrderAsync(const std::string& symbol, const std::string& type, const std::string& side,
+    std::future<json> fetchBalanceAsync(const json& params = json::object());
+    std::future<json> createOrderAsync(const std::string& symbol, const std::string& type, const std::string& side,
                                       double amount, double price = 0, const json& params = json::object());
-    boost::future<json> cancelOrderAsync(const std::string& id, const std::string& symbol = "", const json& params = json::object());
-    boost::future<json> fetchOrderAsync(const std::string& id, const std::string& symbol = "", const json& params = json::object());
-    boost::future<json> fetchOpenOrdersAsync(const std::string& symbol = "", int since = 0, int limit = 0, const json& params = json::object());
-    boost::future<json> fetchMyTradesAsync(const std::string& symbol = "", int since = 0, int limit = 0, const json& params = json::object());
+    std::future<json> cancelOrderAsync(const std::string& id, const std::string& symbol = "", const json& params = json::object());
+    std::future<json> fetchOrderAsync(const std::string& id, const std::string& symbol = "", const json& params = json::object());
+    std::future<json> fetchOpenOrdersAsync(const std::string& symbol = "", int since = 0, int limit = 0, const json& params = json::object());
+    std::future<json> fetchMyTradesAsync(const std::string& symbol = "", int since = 0, int limit = 0, const json& params = json::object());
 
     // Account API
     json fetchDepositAddress(const std::string& code, const json& params = json::object()) override;
     json withdraw(const std::string& code, double amount, const std::string& address, const std::string& tag = "", const json& params = json::object()) override;
 
     // Async Account API
-    boost::future<json> fetchDepositAddressAsync(const std::string& code, const json& params = json::object());
-    boost::future<json> withdrawAsync(const std::string& code, double amount, const std::string& address, const std::string& tag = "", const json& params = json::object());
+    std::future<json> fetchDepositAddressAsync(const std::string& code, const json& params = json::object());
+    std::future<json> withdrawAsync(const std::string& code, double amount, const std::string& address, const std::string& tag = "", const json& params = json::object());
 
 protected:
     std::string sign(const std::string& path, const std::string& api = "public",
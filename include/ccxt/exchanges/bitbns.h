@@ -1,7 +1,7 @@
 #pragma once
 
 #include "ccxt/base/exchange.h"
-#include <boost/thread/future.hpp>
+#include "ccxt/base/executor.h"
 
 namespace ccxt {
 
@@ -19,11 +19,11 @@ public:
                               int since = 0, int limit = 0);
 
     // Market Data - Async
-    boost::future<nlohmann::json> fetch_markets_async(const nlohmann::json& params = nlohmann::json::object());
-    boost::future<nlohmann::json> fetch_ticker_async(const std::string& symbol, const nlohmann::json& params = nlohmann::json::object());
-    boost::future<nlohmann::json> fetch_order_book_async(const std::string& symbol, int limit = 0, const nlohmann::json& params = nlohmann::json::object());
-    boost::future<nlohmann::json> fetch_trades_async(const std::string& symbol, int since = 0, int limit = 0, const nlohmann::json& params = nlohmann::json::object());
-    boost::future<nlohmann::json> fetch_ohlcv_async(const std::string& symbol, const std::string& timeframe = "1m",
+    std::future<nlohmann::json> fetch_markets_async(const nlohmann::json& params = nlohmann::json::object());
+    std::future<nlohmann::json> fetch_ticker_async(const std::string& symbol, const nlohmann::json& params = nlohmann::json::object());
+    std::future<nlohmann::json> fetch_order_book_async(const std::string& symbol, int limit = 0, const nlohmann::json& params = nlohmann::json::object());
+    std::future<nlohmann::json> fetch_trades_async(const std::string& symbol, int since = 0, int limit = 0, const nlohmann::json& params = nlohmann::json::object());
+    std::future<nlohmann::json> fetch_ohlcv_async(const std::string& symbol, const std::string& timeframe = "1m",
                                                   int since = 0, int limit = 0, const nlohmann::json& params = nlohmann::json::object());
 
     // Trading - Sync
@@ -38,15 +38,15 @@ public:
     nlohmann::json fetch_my_trades(const std::string& symbol = "", int since = 0, int limit = 0);
 
     // Trading - Async
-    boost::future<nlohmann::json> create_order_async(const std::string& symbol, const std::string& type,
+    std::future<nlohmann::json> create_order_async(const std::string& symbol, const std::string& type,
                                                    const std::string& side, double amount,
                                                    double price = 0, const nlohmann::json& params = nlohmann::json::object());
-    boost::future<nlohmann::json> cancel_order_async(const std::string& id, const std::string& symbol = "", const nlohmann::json& params = nlohmann::json::object());
-    boost::future<nlohmann::json> fetch_order_async(const std::string& id, const std::string& symbol = "", const nlohmann::json& params = nlohmann::json::object());
-    boost::future<nlohmann::json> fetch_orders_async(const std::string& symbol = "", int since = 0, int limit = 0, const nlohmann::json& params = nlohmann::json::object());
-    boost::future<nlohmann::json> fetch_open_orders_async(const std::string& symbol = "", int since = 0, int limit = 0, const nlohmann::json& params = nlohmann::json::object());
-    boost::future<nlohmann::json> fetch_closed_orders_async(const std::string& symbol = "", int since = 0, int limit = 0, const nlohmann::json& params = nlohmann::json::object());
-    boost::future<nlohmann::json> fetch_my_trades_async(const std::string& symbol = "", int since = 0, int limit = 0, const nlohmann::json& params = nlohmann::json::object());
+    std::future<nlohmann::json> cancel_order_async(const std::string& id, const std::string& symbol = "", const nlohmann::json& params = nlohmann::json::object());
+    std::future<nlohmann::json> fetch_order_async(const std::string& id, const std::string& symbol = "", const nlohmann::json& params = nlohmann::json::object());
+    std::future<nlohmann::json> fetch_orders_async(const std::string& symbol = "", int since = 0, int limit = 0, const nlohmann::json& params = nlohmann::json::object());
+    std::future<nlohmann::json> fetch_open_orders_async(const std::string& symbol = "", int since = 0, int limit = 0, const nlohmann::json& params = nlohmann::json::object());
+    std::future<nlohmann::json> fetch_closed_orders_async(const std::string& symbol = "", int since = 0, int limit = 0, const nlohmann::json& params = nlohmann::json::object());
+    std::future<nlohmann::json> fetch_my_trades_async(const std::string& symbol = "", int since = 0, int limit = 0, const nlohmann::json& params = nlohmann::json::object());
 
     // Account - Sync
     nlohmann::json fetch_balance();
@@ -55,10 +55,10 @@ public:
     nlohmann::json fetch_deposit_address(const std::string& code);
 
     // Account - Async
-    boost::future<nlohmann::json> fetch_balance_async(const nlohmann::json& params = nlohmann::json::object());
-    boost::future<nlohmann::json> fetch_deposits_async(const std::string& code = "", int since = 0, int limit = 0, const nlohmann::json& params = nlohmann::json::object());
-    boost::future<nlohmann::json> fetch_withdrawals_async(const std::string& code = "", int since = 0, int limit = 0, const nlohmann::json& params = nlohmann::json::object());
-    boost::future<nlohmann::json> fetch_deposit_address_async(const std::string& code, const nlohmann::json& params = nlohmann::json::object());
+    std::future<nlohmann::json> fetch_balance_async(const nlohmann::json& params = nlohmann::json::object());
+    std::future<nlohmann::json> fetch_deposits_async(const std::string& code = "", int since = 0, int limit = 0, const nlohmann::json& params = nlohmann::json::object());
+    std::future<nlohmann::json> fetch_withdrawals_async(const std::string& code = "", int since = 0, int limit = 0, const nlohmann::json& params = nlohmann::json::object());
+    std::future<nlohmann::json> fetch_deposit_address_async(const std::string& code, const nlohmann::json& params = nlohmann::json::object());
 
 protected:
     std::string sign(const std::string& path, const std::string& api = "public",
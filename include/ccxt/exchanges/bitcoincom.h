@@ -4,7 +4,7 @@
 #include "ccxt/base/exchange.h"
 #include <string>
 #include <map>
-#include <boost/thread/future.hpp>
+#include "ccxt/base/executor.h"
 
 namespace ccxt {
 
@@ -25,15 +25,15 @@ public:
     json fetch_trading_fees(const std::string& symbol = "");
 
     // Public API - Market Data - Async
-    boost::future<json> fetch_markets_async(const json& params = json::object());
-    boost::future<json> fetch_currencies_async(const json& params = json::object());
-    boost::future<json> fetch_ticker_async(const std::string& symbol, const json& params = json::object());
-    boost::future<json> fetch_tickers_async(const std::vector<std::string>& symbols = {}, const json& params = json::object());
-    boost::future<json> fetch_order_book_async(const std::string& symbol, int limit = 100, const json& params = json::object());
-    boost::future<json> fetch_trades_async(const std::string& symbol, int limit = 100, const json& params = json::object());
-    boost::future<json> fetch_ohlcv_async(const std::string& symbol, const std::string& timeframe = "1m",
+    std::future<json> fetch_markets_async(const json& params = json::object());
+    std::future<json> fetch_currencies_async(const json& params = json::object());
+    std::future<json> fetch_ticker_async(const std::string& symbol, const json& params = json::object());
+    std::future<json> fetch_tickers_async(const std::vector<std::string>& symbols = {}, const json& params = json::object());
+    std::future<json> fetch_order_book_async(const std::string& symbol, int limit = 100, const json& params = json::object());
+    std::future<json> fetch_trades_async(const std::string& symbol, int limit = 100, const json& params = json::object());
+    std::future<json> fetch_ohlcv_async(const std::string& symbol, const std::string& timeframe = "1m",
                                        long since = 0, int limit = 100, const json& params = json::object());
-    boost::future<json> fetch_trading_fees_async(const std::string& symbol = "", const json& params = json::object());
+    std::future<json> fetch_trading_fees_async(const std::string& symbol = "", const json& params = json::object());
 
     // Private API - Trading - Sync
     json create_order(const std::string& symbol, const std::string& type, const std::string& side,
@@ -45,14 +45,14 @@ public:
                    const std::map<std::string, std::string>& params = {});
 
     // Private API - Trading - Async
-    boost::future<json> create_order_async(const std::string& symbol, const std::string& type,
+    std::future<json> create_order_async(const std::string& symbol, const std::string& type,
                                        const std::string& side, double amount, double price = 0,
                                        const json& params = json::object());
-    boost::future<json> cancel_order_async(const std::string& id, const std::string& symbol = "",
+    std::future<json> cancel_order_async(const std::string& id, const std::string& symbol = "",
                                        const json& params = json::object());
-    boost::future<json> cancel_all_orders_async(const std::string& symbol = "",
+    std::future<json> cancel_all_orders_async(const std::string& symbol = "",
                                             const json& params = json::object());
-    boost::future<json> edit_order_async(const std::string& id, const std::string& symbol,
+    std::future<json> edit_order_async(const std::string& id, const std::string& symbol,
                                      const std::string& type, const std::string& side,
                                      double amount, double price = 0,
                                      const json& params = json::object());
@@ -67,21 +67,21 @@ public:
     json fetch_trading_fee(const std::string& symbol);
 
     // Private API - Account/Balance - Async
-    boost::future<json> fetch_balance_async(const json& params = json::object());
-    boost::future<json> fetch_open_orders_async(const std::string& symbol = "",
+    std::future<json> fetch_balance_async(const json& params = json::object());
+    std::future<json> fetch_open_orders_async(const std::string& symbol = "",
                                             const json& params = json::object());
-    boost::future<json> fetch_closed_orders_async(const std::string& symbol = "",
+    std::future<json> fetch_closed_orders_async(const std::string& symbol = "",
                                               long since = 0, int limit = 100,
                                               const json& params = json::object());
-    boost::future<json> fetch_order_async(const std::string& id, const std::string& symbol = "",
+    std::future<json> fetch_order_async(const std::string& id, const std::string& symbol = "",
                                       const json& params = json::object());
-    boost::future<json> fetch_orders_async(const std::string& symbol = "",
+    std::future<json> fetch_orders_async(const std::string& symbol = "",
                                        long since = 0, int limit = 100,
                                        const json& params = json::object());
-    boost::future<json> fetch_my_trades_async(const std::string& symbol = "",
+    std::future<json> fetch_my_trades_async(const std::string& symbol = "",
                                           long since = 0, int limit = 100,
                                           const json& params = json::object());
-    boost::future<json> fetch_trading_fee_async(const std::string& symbol,
+    std::future<json> fetch_trading_fee_async(const std::string& symbol,
                                             const json& params = json::object());
 
     // Account Management - Sync
@@ -92,15 +92,15 @@ public:
                  const std::string& tag = "", const std::map<std::string, std::string>& params = {});
 
     // Account Management - Async
-    boost::future<json> fetch_deposit_address_async(const std::string& code,
+    std::future<json> fetch_deposit_address_async(const std::string& code,
                                                 const json& params = json::object());
-    boost::future<json> fetch_deposits_async(const std::string& code = "",
+    std::future<json> fetch_deposits_async(const std::string& code = "",
                                          long since = 0, int limit = 100,
                                          const json& params = json::object());
-    boost::future<json> fetch_withdrawals_async(const std::string& code = "",
+    std::future<json> fetch_withdrawals_async(const std::string& code = "",
                                             long since = 0, int limit = 100,
                                             const json& params = json::object());
-    boost::future<json> withdraw_async(const std::string& code, double amount,
+    std::future<json> withdraw_async(const std::string& code, double amount,
                                    const std::string& address, const std::string& tag = "",
                                    const json& params = json::object());
 
@@ -1,7 +1,7 @@
 #pragma once
 
 #include "ccxt/base/exchange.h"
-#include <boost/thread/future.hpp>
+#include "ccxt/base/executor.h"
 
 namespace ccxt {
 
@@ -17,16 +17,16 @@ public:
     json fetchOrderBook(const std::string& symbol, int limit = 0, const json& params = json::object()) override;
     json fetchTrades(const std::string& symbol, int since = 0, int limit = 0, const json& params = json::object()) override;
     json fetchOHLCV(const std::string& symbol, const std::string& timeframe = "1m",
-                    int since = 0, int limit = 0, const json& params = json::object()) override;
+                    long long since = 0, int limit = 0, const json& params = json::object()) override;
 
     // Market Data API - Async
-    boost::future<json> fetchMarketsAsync(const json& params = json::object());
-    boost::future<json> fetchTickerAsync(const std::string& symbol, const json& params = json::object());
-    boost::future<json> fetchTickersAsync(const std::vector<std::string>& symbols = {}, const json& params = json::object());
-    boost::future<json> fetchOrderBookAsync(const std::string& symbol, int limit = 0, const json& params = json::object());
-    boost::future<json> fetchTradesAsync(const std::string& symbol, int since = 0, int limit = 0, const json& params = json::object());
-    boost::future<json> fetchOHLCVAsync(const std::string& symbol, const std::string& timeframe = "1m",
-                                     int since = 0, int limit = 0, const json& params = json::object());
+    std::future<json> fetchMarketsAsync(const json& params = json::object());
+    std::future<json> fetchTickerAsync(const std::string& symbol, const json& params = json::object());
+    std::future<json> fetchTickersAsync(const std::vector<std::string>& symbols = {}, const json& params = json::object());
+    std::future<json> fetchOrderBookAsync(const std::string& symbol, int limit = 0, const json& params = json::object());
+    std::future<json> fetchTradesAsync(const std::string& symbol, int since = 0, int limit = 0, const json& params = json::object());
+    std::future<json> fetchOHLCVAsync(const std::string& symbol, const std::string& timeframe = "1m",
+                                     long long since = 0, int limit = 0, const json& params = json::object());
 
     // Trading API - Sync
     json fetchBalance(const json& params = json::object()) override;
@@ -39,14 +39,14 @@ public:
     json fetchClosedOrders(const std::string& symbol = "", int since = 0, int limit = 0, const json& params = json::object()) override;
 
     // Trading API - Async
-    boost::future<json> fetchBalanceAsync(const json& params = json::object());
-    boost::future<json> createOrderAsync(const std::string& symbol, const std::string& type, const std::string& side,
+    std::future<json> fetchBalanceAsync(const json& params = json::object());
+    std::future<json> createOrderAsync(const std::string& symbol, const std::string& type, const std::string& side,
                                      double amount, double price = 0, const json& params = json::object());
-    boost::future<json> cancelOrderAsync(const std::string& id, const std::string& symbol = "", const json& params = json::object());
-    boost::future<json> fetchOrderAsync(const std::string& id, const std::string& symbol = "", const json& params = json::object());
-    boost::future<json> fetchOrdersAsync(const std::string& symbol = "", int since = 0, int limit = 0, const json& params = json::object());
-    boost::future<json> fetchOpenOrdersAsync(const std::string& symbol = "", int since = 0, int limit = 0, const json& params = json::object());
-    boost::future<json> fetchClosedOrdersAsync(const std::string& symbol = "", int since = 0, int limit = 0, const json& params = json::object());
+    std::future<json> cancelOrderAsync(const std::string& id, const std::string& symbol = "", const json& params = json::object());
+    std::future<json> fetchOrderAsync(const std::string& id, const std::string& symbol = "", const json& params = json::object());
+    std::future<json> fetchOrdersAsync(const std::string& symbol = "", int since = 0, int limit = 0, const json& params = json::object());
+    std::future<json> fetchOpenOrdersAsync(const std::string& symbol = "", int since = 0, int limit = 0, const json& params = json::object());
+    std::future<json> fetchClosedOrdersAsync(const std::string& symbol = "", int since = 0, int limit = 0, const json& params = json::object());
 
     // Bitfinex specific methods - Sync
     json fetchPositions(const std::string& symbol = "", const json& params = json::object());
@@ -58,13 +58,13 @@ public:
     json fetchWithdrawals(const std::string& code = "", int since = 0, int limit = 0, const json& params = json::object());
 
     // Bitfinex specific methods - Async
-    boost::future<json> fetchPositionsAsync(const std::string& symbol = "", const json& params = json::object());
-    boost::future<json> fetchMyTradesAsync(const std::string& symbol = "", int since = 0, int limit = 0, const json& params = json::object());
-    boost::future<json> fetchLedgerAsync(const std::string& code = "", int since = 0, int limit = 0, const json& params = json::object());
-    boost::future<json> fetchFundingRatesAsync(const std::vector<std::string>& symbols = {}, const json& params = json::object());
-    boost::future<json> setLeverageAsync(const std::string& symbol, double leverage, const json& params = json::object());
-    boost::future<json> fetchDepositsAsync(const std::string& code = "", int since = 0, int limit = 0, const json& params = json::object());
-    boost::future<json> fetchWithdrawalsAsync(const std::string& code = "", int since = 0, int limit = 0, const json& params = json::object());
+    std::future<json> fetchPositionsAsync(const std::string& symbol = "", const json& params = json::object());
+    std::future<json> fetchMyTradesAsync(const std::string& symbol = "", int since = 0, int limit = 0, const json& params = json::object());
+    std::future<json> fetchLedgerAsync(const std::string& code = "", int since = 0, int limit = 0, const json& params = json::object());
+    std::future<json> fetchFundingRatesAsync(const std::vector<std::string>& symbols = {}, const json& params = json::object());
+    std::future<json> setLeverageAsync(const std::string& symbol, double leverage, const json& params = json::object());
+    std::future<json> fetchDepositsAsync(const std::string& code = "", int since = 0, int limit = 0, const json& params = json::object());
+    std::future<json> fetchWithdrawalsAsync(const std::string& code = "", int since = 0, int limit = 0, const json& params = json::object());
 
 protected:
     std::string sign(const std::string& path, const std::string& api = "public",
@@ -3,7 +3,7 @@
 
 #include "ccxt/base/exchange.h"
 #include <boost/asio.hpp>
-#include <boost/thread/future.hpp>
+#include "ccxt/base/executor.h"
 
 namespace ccxt {
 
@@ -48,40 +48,40 @@ public:
                      const std::string& tag = "", const Json& params = Json::object()) override;
 
     // Async Methods
-    boost::future<Json> fetchMarketsAsync() const;
-    boost::future<Json> fetchTickerAsync(const std::string& symbol) const;
-    boost::future<Json> fetchOrderBookAsync(const std::string& symbol, const std::optional<int>& limit = std::nullopt) const;
-    boost::future<Json> fetchTradesAsync(const std::string& symbol, const std::optional<long long>& since = std::nullopt,
+    std::future<Json> fetchMarketsAsync() const;
+    std::future<Json> fetchTickerAsync(const std::string& symbol) const;
+    std::future<Json> fetchOrderBookAsync(const std::string& symbol, const std::optional<int>& limit = std::nullopt) const;
+    std::future<Json> fetchTradesAsync(const std::string& symbol, const std::optional<long long>& since = std::nullopt,
                                        const std::optional<int>& limit = std::nullopt) const;
-    boost::future<Json> fetchOHLCVAsync(const std::string& symbol, const std::string& timeframe = "1m",
+    std::future<Json> fetchOHLCVAsync(const std::string& symbol, const std::string& timeframe = "1m",
                                        const std::optional<long long>& since = std::nullopt,
                                        const std::optional<int>& limit = std::nullopt) const;
 
-    boost::future<Json> createOrderAsync(const std::string& symbol, const std::string& type, const std::string& side,
+    std::future<Json> createOrderAsync(const std::string& symbol, const std::string& type, const std::string& side,
                                        double amount, const std::optional<double>& price = std::nullopt);
-    boost::future<Json> cancelOrderAsync(const std::string& id, const std::string& symbol);
-    boost::future<Json> fetchOrderAsync(const std::string& id, const std::string& symbol) const;
-    boost::future<Json> fetchOrdersAsync(const std::string& symbol, const std::optional<long long>& since = std::nullopt,
+    std::future<Json> cancelOrderAsync(const std::string& id, const std::string& symbol);
+    std::future<Json> fetchOrderAsync(const std::string& id, const std::string& symbol) const;
+    std::future<Json> fetchOrdersAsync(const std::string& symbol, const std::optional<long long>& since = std::nullopt,
                                        const std::optional<int>& limit = std::nullopt) const;
-    boost::future<Json> fetchOpenOrdersAsync(const std::string& symbol, const std::optional<long long>& since = std::nullopt,
+    std::future<Json> fetchOpenOrdersAsync(const std::string& symbol, const std::optional<long long>& since = std::nullopt,
                                            const std::optional<int>& limit = std::nullopt) const;
-    boost::future<Json> fetchClosedOrdersAsync(const std::string& symbol, const std::optional<long long>& since = std::nullopt,
+    std::future<Json> fetchClosedOrdersAsync(const std::string& symbol, const std::optional<long long>& since = std::nullopt,
                                              const std::optional<int>& limit = std::nullopt) const;
 
-    boost::future<Json> fetchBalanceAsync() const;
-    boost::future<Json> fetchPositionsAsync(const std::string& symbols, const std::optional<long long>& since = std::nullopt,
+    std::future<Json> fetchBalanceAsync() const;
+    std::future<Json> fetchPositionsAsync(const std::string& symbols, const std::optional<long long>& since = std::nullopt,
                                           const std::optional<int>& limit = std::nullopt) const;
-    boost::future<Json> fetchMyTradesAsync(const std::string& symbol, const std::optional<long long>& since = std::nullopt,
+    std::future<Json> fetchMyTradesAsync(const std::string& symbol, const std::optional<long long>& since = std::nullopt,
                                           const std::optional<int>& limit = std::nullopt) const;
-    boost::future<Json> fetchDepositsAsync(const std::string& code, const std::optional<long long>& since = std::nullopt,
+    std::future<Json> fetchDepositsAsync(const std::string& code, const std::optional<long long>& since = std::nullopt,
                                           const std::optional<int>& limit = std::nullopt) const;
-    boost::future<Json> fetchWithdrawalsAsync(const std::string& code, const std::optional<long long>& since = std::nullopt,
+    std::future<Json> fetchWithdrawalsAsync(const std::string& code, const std::optional<long long>& since = std::nullopt,
                                              const std::optional<int>& limit = std::nullopt) const;
-    boost::future<Json> withdrawAsync(const std::string& code, double amount, const std::string& address,
+    std::future<Json> withdrawAsync(const std::string& code, double amount, const std::string& address,
                                     const std::string& tag = "", const Json& params = Json::object());
 
 protected:
-    boost::future<Json> fetchAsync(const std::string& path, const std::string& api = "public",
+    std::future<Json> fetchAsync(const std::string& path, const std::string& api = "public",
                                  const std::string& method = "GET", const Json& params = Json::object(),
                                  const std::map<std::string, std::string>& headers = {}) const;
 
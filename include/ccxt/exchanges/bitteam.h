@@ -3,7 +3,7 @@
 
 #include "ccxt/base/exchange.h"
 #include <boost/asio.hpp>
-#include <boost/future.hpp>
+#include "ccxt/base/executor.h"
 
 namespace ccxt {
 
@@ -23,7 +23,7 @@ public:
     Json fetchTickers(const std::vector<std::string>& symbols = {}, const json& params = json::object()) override;
     Json fetchOrderBook(const std::string& symbol, int limit = 0, const json& params = json::object()) override;
     Json fetchTrades(const std::string& symbol, int since = 0, int limit = 0, const json& params = json::object()) override;
-    Json fetchOHLCV(const std::string& symbol, const std::string& timeframe = "1m", int since = 0, int limit = 0, const json& params = json::object()) override;
+    Json fetchOHLCV(const std::string& symbol, const std::string& timeframe = "1m", long long since = 0, int limit = 0, const json& params = json::object()) override;
     Json fetchBalance(const json& params = json::object()) override;
     Json createOrder(const std::string& symbol, const std::string& type, const std::string& side, double amount, double price = 0, const json& params = json::object()) override;
     Json cancelOrder(const std::string& id, const std::string& symbol = "", const json& params = json::object()) override;
@@ -35,22 +35,22 @@ public:
     Json fetchMyTrades(const std::string& symbol = "", int since = 0, int limit = 0, const json& params = json::object()) override;
 
     // Asynchronous REST API
-    boost::future<Json> fetchMarketsAsync(const json& params = json::object());
-    boost::future<Json> fetchCurrenciesAsync(const json& params = json::object());
-    boost::future<Json> fetchTickerAsync(const std::string& symbol, const json& params = json::object());
-    boost::future<Json> fetchTickersAsync(const std::vector<std::string>& symbols = {}, const json& params = json::object());
-    boost::future<Json> fetchOrderBookAsync(const std::string& symbol, int limit = 0, const json& params = json::object());
-    boost::future<Json> fetchTradesAsync(const std::string& symbol, int since = 0, int limit = 0, const json& params = json::object());
-    boost::future<Json> fetchOHLCVAsync(const std::string& symbol, const std::string& timeframe = "1m", int since = 0, int limit = 0, const json& params = json::object());
-    boost::future<Json> fetchBalanceAsync(const json& params = json::object());
-    boost::future<Json> createOrderAsync(const std::string& symbol, const std::string& type, const std::string& side, double amount, double price = 0, const json& params = json::object());
-    boost::future<Json> cancelOrderAsync(const std::string& id, const std::string& symbol = "", const json& params = json::object());
-    boost::future<Json> cancelAllOrdersAsync(const std::string& symbol = "", const json& params = json::object());
-    boost::future<Json> fetchOrderAsync(const std::string& id, const std::string& symbol = "", const json& params = json::object());
-    boost::future<Json> fetchOrdersAsync(const std::string& symbol = "", int since = 0, int limit = 0, const json& params = json::object());
-    boost::future<Json> fetchOpenOrdersAsync(const std::string& symbol = "", int since = 0, int limit = 0, const json& params = json::object());
-    boost::future<Json> fetchClosedOrdersAsync(const std::string& symbol = "", int since = 0, int limit = 0, const json& params = json::object());
-    boost::future<Json> fetchMyTradesAsync(const std::string& symbol = "", int since = 0, int limit = 0, const json& params = json::object());
+    std::future<Json> fetchMarketsAsync(const json& params = json::object());
+    std::future<Json> fetchCurrenciesAsync(const json& params = json::object());
+    std::future<Json> fetchTickerAsync(const std::string& symbol, const json& params = json::object());
+    std::future<Json> fetchTickersAsync(const std::vector<std::string>& symbols = {}, const json& params = json::object());
+    std::future<Json> fetchOrderBookAsync(const std::string& symbol, int limit = 0, const json& params = json::object());
+    std::future<Json> fetchTradesAsync(const std::string& symbol, int since = 0, int limit = 0, const json& params = json::object());
+    std::future<Json> fetchOHLCVAsync(const std::string& symbol, const std::string& timeframe = "1m", long long since = 0, int limit = 0, const json& params = json::object());
+    std::future<Json> fetchBalanceAsync(const json& params = json::object());
+    std::future<Json> createOrderAsync(const std::string& symbol, const std::string& type, const std::string& side, double amount, double price = 0, const json& params = json::object());
+    std::future<Json> cancelOrderAsync(const std::string& id, const std::string& symbol = "", const json& params = json::object());
+    std::future<Json> cancelAllOrdersAsync(const std::string& symbol = "", const json& params = json::object());
+    std::future<Json> fetchOrderAsync(const std::string& id, const std::string& symbol = "", const json& params = json::object());
+    std::future<Json> fetchOrdersAsync(const std::string& symbol = "", int since = 0, int limit = 0, const json& params = json::object());
+    std::future<Json> fetchOpenOrdersAsync(const std::string& symbol = "", int since = 0, int limit = 0, const json& params = json::object());
+    std::future<Json> fetchClosedOrdersAsync(const std::string& symbol = "", int since = 0, int limit = 0, const json& params = json::object());
+    std::future<Json> fetchMyTradesAsync(const std::string& symbol = "", int since = 0, int limit = 0, const json& params = json::object());
 
 protected:
     void init() override;
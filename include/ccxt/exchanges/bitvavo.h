@@ -1,6 +1,7 @@
 #pragma once
 
 #include "ccxt/base/exchange.h"
+#include "ccxt/base/executor.h"
 
 namespace ccxt {
 
@@ -16,16 +17,16 @@ public:
     json fetchOrderBook(const std::string& symbol, int limit = 0, const json& params = json::object()) override;
     json fetchTrades(const std::string& symbol, int since = 0, int limit = 0, const json& params = json::object()) override;
     json fetchOHLCV(const std::string& symbol, const std::string& timeframe = "1m",
-                    int since = 0, int limit = 0, const json& params = json::object()) override;
+                    long long since = 0, int limit = 0, const json& params = json::object()) override;
 
     // Async Market Data API
-    boost::future<json> fetchMarketsAsync(const json& params = json::object());
-    boost::future<json> fetchTickerAsync(const std::string& symbol, const json& params = json::object());
-    boost::future<json> fetchTickersAsync(const std::vector<std::string>& symbols = {}, const json& params = json::object());
-    boost::future<json> fetchOrderBookAsync(const std::string& symbol, int limit = 0, const json& params = json::object());
-    boost::future<json> fetchTradesAsync(const std::string& symbol, int since = 0, int limit = 0, const json& params = json::object());
-    boost::future<json> fetchOHLCVAsync(const std::string& symbol, const std::string& timeframe = "1m",
-                    int since = 0, int limit = 0, const json& params = json::object());
+    std::future<json> fetchMarketsAsync(const json& params = json::object());
+    std::future<json> fetchTickerAsync(const std::string& symbol, const json& params = json::object());
+    std::future<json> fetchTickersAsync(const std::vector<std::string>& symbols = {}, const json& params = json::object());
+    std::future<json> fetchOrderBookAsync(const std::string& symbol, int limit = 0, const json& params = json::object());
+    std::future<json> fetchTradesAsync(const std::string& symbol, int since = 0, int limit = 0, const json& params = json::object());
+    std::future<json> fetchOHLCVAsync(const std::string& symbol, const std::string& timeframe = "1m",
+                    long long since = 0, int limit = 0, const json& params = json::object());
 
     // Trading API
     json fetchBalance(const json& params = json::object()) override;
@@ -38,14 +39,14 @@ public:
     json fetchClosedOrders(const std::string& symbol = "", int since = 0, int limit = 0, const json& params = json::object()) override;
 
     // Async Trading API
-    boost::future<json> fetchBalanceAsync(const json& params = json::object());
-    boost::future<json> createOrderAsync(const std::string& symbol, const std::string& type, const std::string& side,
+    std::future<json> fetchBalanceAsync(const json& params = json::object());
+    std::future<json> createOrderAsync(const std::string& symbol, const std::string& type, const std::string& side,
                     double amount, double price = 0, const json& params = json::object());
-    boost::future<json> cancelOrderAsync(const std::string& id, const std::string& symbol = "", const json& params = json::object());
-    boost::future<json> fetchOrderAsync(const std::string& id, const std::string& symbol = "", const json& params = json::object());
-    boost::future<json> fetchOrdersAsync(const std::string& symbol = "", int since = 0, int limit = 0, const json& params = json::object());
-    boost::future<json> fetchOpenOrdersAsync(const std::string& symbol = "", int since = 0, int limit = 0, const json& params = json::object());
-    boost::future<json> fetchClosedOrdersAsync(const std::string& symbol = "", int since = 0, int limit = 0, const json& params = json::object());
+    std::future<json> cancelOrderAsync(const std::string& id, const std::string& symbol = "", const json& params = json::object());
+    std::future<json> fetchOrderAsync(const std::string& id, const std::string& symbol = "", const json& params = json::object());
+    std::future<json> fetchOrdersAsync(const std::string& symbol = "", int since = 0, int limit = 0, const json& params = json::object());
+    std::future<json> fetchOpenOrdersAsync(const std::string& symbol = "", int since = 0, int limit = 0, const json& params = json::object());
+    std::future<json> fetchClosedOrdersAsync(const std::string& symbol = "", int since = 0, int limit = 0, const json& params = json::object());
 
     // Account API
     json fetchMyTrades(const std::string& symbol = "", int since = 0, int limit = 0, const json& params = json::object());
@@ -55,11 +56,11 @@ public:
     json withdraw(const std::string& code, double amount, const std::string& address, const std::string& tag = "", const json& params = json::object());
 
     // Async Account API
-    boost::future<json> fetchMyTradesAsync(const std::string& symbol = "", int since = 0, int limit = 0, const json& params = json::object());
-    boost::future<json> fetchDepositsAsync(const std::string& code = "", int since = 0, int limit = 0, const json& params = json::object());
-    boost::future<json> fetchWithdrawalsAsync(const std::string& code = "", int since = 0, int limit = 0, const json& params = json::object());
-    boost::future<json> fetchDepositAddressAsync(const std::string& code, const json& params = json::object());
-    boost::future<json> withdrawAsync(const std::string& code, double amount, const std::string& address, const std::string& tag = "", const json& params = json::object());
+    std::future<json> fetchMyTradesAsync(const std::string& symbol = "", int since = 0, int limit = 0, const json& params = json::object());
+    std::future<json> fetchDepositsAsync(const std::string& code = "", int since = 0, int limit = 0, const json& params = json::object());
+    std::future<json> fetchWithdrawalsAsync(const std::string& code = "", int since = 0, int limit = 0, const json& params = json::object());
+    std::future<json> fetchDepositAddressAsync(const std::string& code, const json& params = json::object());
+    std::future<json> withdrawAsync(const std::string& code, double amount, const std::string& address, const std::string& tag = "", const json& params = json::object());
 
     // Additional Features
     json fetchCurrencies(const json& params = json::object());
@@ -68,10 +69,10 @@ public:
     json fetchLedger(const std::string& code = "", int since = 0, int limit = 0, const json& params = json::object());
 
     // Async Additional Features
-    boost::future<json> fetchCurrenciesAsync(const json& params = json::object());
-    boost::future<json> fetchTradingFeesAsync(const json& params = json::object());
-    boost::future<json> fetchFundingFeesAsync(const json& params = json::object());
-    boost::future<json> fetchLedgerAsync(const std::string& code = "", int since = 0, int limit = 0, const json& params = json::object());
+    std::future<json> fetchCurrenciesAsync(const json& params = json::object());
+    std::future<json> fetchTradingFeesAsync(const json& params = json::object());
+    std::future<json> fetchFundingFeesAsync(const json& params = json::object());
+    std::future<json> fetchLedgerAsync(const std::string& code = "", int since = 0, int limit = 0, const json& params = json::object());
 
 protected:
     std::string sign(const std::string& path, const std::string& api = "public",
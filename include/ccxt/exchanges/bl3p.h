@@ -3,7 +3,7 @@
 
 #include "ccxt/base/exchange.h"
 #include <boost/asio.hpp>
-#include <boost/future.hpp>
+#include "ccxt/base/executor.h"
 
 namespace ccxt {
 
@@ -23,10 +23,10 @@ public:
     Json fetchTradingFeesImpl() const override;
 
     // Async Market Data
-    boost::future<Json> fetchTickerAsync(const std::string& symbol) const;
-    boost::future<Json> fetchOrderBookAsync(const std::string& symbol, const std::optional<int>& limit = std::nullopt) const;
-    boost::future<Json> fetchTradesAsync(const std::string& symbol, const std::optional<long long>& since = std::nullopt, const std::optional<int>& limit = std::nullopt) const;
-    boost::future<Json> fetchTradingFeesAsync() const;
+    std::future<Json> fetchTickerAsync(const std::string& symbol) const;
+    std::future<Json> fetchOrderBookAsync(const std::string& symbol, const std::optional<int>& limit = std::nullopt) const;
+    std::future<Json> fetchTradesAsync(const std::string& symbol, const std::optional<long long>& since = std::nullopt, const std::optional<int>& limit = std::nullopt) const;
+    std::future<Json> fetchTradingFeesAsync() const;
 
     // Trading
     Json createOrderImpl(const std::string& symbol, const std::string& type, const std::string& side, double amount, const std::optional<double>& price = std::nullopt) override;
@@ -34,15 +34,15 @@ public:
     Json createDepositAddressImpl(const std::string& code, const std::optional<std::string>& network = std::nullopt) override;
 
     // Async Trading
-    boost::future<Json> createOrderAsync(const std::string& symbol, const std::string& type, const std::string& side, double amount, const std::optional<double>& price = std::nullopt);
-    boost::future<Json> cancelOrderAsync(const std::string& id, const std::string& symbol);
-    boost::future<Json> createDepositAddressAsync(const std::string& code, const std::optional<std::string>& network = std::nullopt);
+    std::future<Json> createOrderAsync(const std::string& symbol, const std::string& type, const std::string& side, double amount, const std::optional<double>& price = std::nullopt);
+    std::future<Json> cancelOrderAsync(const std::string& id, const std::string& symbol);
+    std::future<Json> createDepositAddressAsync(const std::string& code, const std::optional<std::string>& network = std::nullopt);
 
     // Account
     Json fetchBalanceImpl() const override;
 
     // Async Account
-    boost::future<Json> fetchBalanceAsync() const;
+    std::future<Json> fetchBalanceAsync() const;
 
 protected:
     void init() override;
@@ -2,6 +2,7 @@
 #define CCXT_EXCHANGE_CEX_H
 
 #include "ccxt/base/exchange.h"
+#include "ccxt/base/executor.h"
 
 namespace ccxt {
 
@@ -30,12 +31,12 @@ protected:
     Json fetchTradingFeesImpl() const override;
 
     // Async Market Data Functions
-    boost::future<Json> fetchMarketsAsync(const Json& params = Json()) const;
-    boost::future<Json> fetchTickerAsync(const std::string& symbol, const Json& params = Json()) const;
-    boost::future<Json> fetchTickersAsync(const std::vector<std::string>& symbols = std::vector<std::string>(), const Json& params = Json()) const;
-    boost::future<Json> fetchOrderBookAsync(const std::string& symbol, const std::optional<int>& limit = std::nullopt, const Json& params = Json()) const;
-    boost::future<Json> fetchTradesAsync(const std::string& symbol, const std::optional<long long>& since = std::nullopt, const std::optional<int>& limit = std::nullopt, const Json& params = Json()) const;
-    boost::future<Json> fetchOHLCVAsync(const std::string& symbol, const std::string& timeframe, const std::optional<long long>& since = std::nullopt, const std::optional<int>& limit = std::nullopt, const Json& params = Json()) const;
+    std::future<Json> fetchMarketsAsync(const Json& params = Json()) const;
+    std::future<Json> fetchTickerAsync(const std::string& symbol, const Json& params = Json()) const;
+    std::future<Json> fetchTickersAsync(const std::vector<std::string>& symbols = std::vector<std::string>(), const Json& params = Json()) const;
+    std::future<Json> fetchOrderBookAsync(const std::string& symbol, const std::optional<int>& limit = std::nullopt, const Json& params = Json()) const;
+    std::future<Json> fetchTradesAsync(const std::string& symbol, const std::optional<long long>& since = std::nullopt, const std::optional<int>& limit = std::nullopt, const Json& params = Json()) const;
+    std::future<Json> fetchOHLCVAsync(const std::string& symbol, const std::string& timeframe, const std::optional<long long>& since = std::nullopt, const std::optional<int>& limit = std::nullopt, const Json& params = Json()) const;
 
     // Trading
     Json createOrderImpl(const std::string& symbol, const std::string& type, const std::string& side, double amount, const std::optional<double>& price = std::nullopt) override;
@@ -50,11 +51,11 @@ protected:
     Json fetchClosedOrdersImpl(const std::optional<std::string>& symbol = std::nullopt, const std::optional<long long>& since = std::nullopt, const std::optional<int>& limit = std::nullopt) const override;
 
     // Async Trading Functions
-    boost::future<Json> createOrderAsync(const std::string& symbol, const std::string& type, const std::string& side, double amount, const std::optional<double>& price = std::nullopt, const Json& params = Json());
-    boost::future<Json> cancelOrderAsync(const std::string& id, const std::string& symbol, const Json& params = Json());
-    boost::future<Json> fetchOrderAsync(const std::string& id, const std::string& symbol, const Json& params = Json()) const;
-    boost::future<Json> fetchOpenOrdersAsync(const std::optional<std::string>& symbol = std::nullopt, const std::optional<long long>& since = std::nullopt, const std::optional<int>& limit = std::nullopt, const Json& params = Json()) const;
-    boost::future<Json> fetchClosedOrdersAsync(const std::optional<std::string>& symbol = std::nullopt, const std::optional<long long>& since = std::nullopt, const std::optional<int>& limit = std::nullopt, const Json& params = Json()) const;
+    std::future<Json> createOrderAsync(const std::string& symbol, const std::string& type, const std::string& side, double amount, const std::optional<double>& price = std::nullopt, const Json& params = Json());
+    std::future<Json> cancelOrderAsync(const std::string& id, const std::string& symbol, const Json& params = Json());
+    std::future<Json> fetchOrderAsync(const std::string& id, const std::string& symbol, const Json& params = Json()) const;
+    std::future<Json> fetchOpenOrdersAsync(const std::optional<std::string>& symbol = std::nullopt, const std::optional<long long>& since = std::nullopt, const std::optional<int>& limit = std::nullopt, const Json& params = Json()) const;
+    std::future<Json> fetchClosedOrdersAsync(const std::optional<std::string>& symbol = std::nullopt, const std::optional<long long>& since = std::nullopt, const std::optional<int>& limit = std::nullopt, const Json& params = Json()) const;
 
     // Account
     Json fetchAccountsImpl() const override;
@@ -65,9 +66,9 @@ protected:
     Json transferImpl(const std::string& code, double amount, const std::string& fromAccount, const std::string& toAccount, const std::optional<Json>& params = std::nullopt) override;
 
     // Async Account Functions
-    boost::future<Json> fetchBalanceAsync(const Json& params = Json()) const;
-    boost::future<Json> fetchDepositAddressAsync(const std::string& code, const std::optional<std::string>& network = std::nullopt, const Json& params = Json()) const;
-    boost::future<Json> fetchTransactionsAsync(const std::optional<std::string>& code = std::nullopt, const std::optional<long long>& since = std::nullopt, const std::optional<int>& limit = std::nullopt, const Json& params = Json()) const;
+    std::future<Json> fetchBalanceAsync(const Json& params = Json()) const;
+    std::future<Json> fetchDepositAddressAsync(const std::string& code, const std::optional<std::string>& network = std::nullopt, const Json& params = Json()) const;
+    std::future<Json> fetchTransactionsAsync(const std::optional<std::string>& code = std::nullopt, const std::optional<long long>& since = std::nullopt, const std::optional<int>& limit = std::nullopt, const Json& params = Json()) const;
 
 private:
     static Exchange* createInstance(const Config& config) {
@@ -1,7 +1,7 @@
 #pragma once
 
 #include "ccxt/base/exchange.h"
-#include <boost/future.hpp>
+#include "ccxt/base/executor.h"
 
 namespace ccxt {
 
@@ -17,7 +17,7 @@ public:
     json fetchOrderBook(const std::string& symbol, int limit = 0, const json& params = json::object()) override;
     json fetchTrades(const std::string& symbol, int since = 0, int limit = 0, const json& params = json::object()) override;
     json fetchOHLCV(const std::string& symbol, const std::string& timeframe = "1m",
-                    int since = 0, int limit = 0, const json& params = json::object()) override;
+                    long long since = 0, int limit = 0, const json& params = json::object()) override;
 
     // Trading API - Synchronous
     json fetchBalance(const json& params = json::object()) override;
@@ -30,23 +30,23 @@ public:
     json fetchClosedOrders(const std::string& symbol = "", int since = 0, int limit = 0, const json& params = json::object()) override;
 
     // Market Data API - Asynchronous
-    boost::future<json> fetchMarketsAsync(const json& params = json::object()) const;
-    boost::future<json> fetchTickerAsync(const std::string& symbol, const json& params = json::object()) const;
-    boost::future<json> fetchTickersAsync(const std::vector<std::string>& symbols = {}, const json& params = json::object()) const;
-    boost::future<json> fetchOrderBookAsync(const std::string& symbol, int limit = 0, const json& params = json::object()) const;
-    boost::future<json> fetchTradesAsync(const std::string& symbol, int since = 0, int limit = 0, const json& params = json::object()) const;
-    boost::future<json> fetchOHLCVAsync(const std::string& symbol, const std::string& timeframe = "1m",
-                                     int since = 0, int limit = 0, const json& params = json::object()) const;
+    std::future<json> fetchMarketsAsync(const json& params = json::object()) const;
+    std::future<json> fetchTickerAsync(const std::string& symbol, const json& params = json::object()) const;
+    std::future<json> fetchTickersAsync(const std::vector<std::string>& symbols = {}, const json& params = json::object()) const;
+    std::future<json> fetchOrderBookAsync(const std::string& symbol, int limit = 0, const json& params = json::object()) const;
+    std::future<json> fetchTradesAsync(const std::string& symbol, int since = 0, int limit = 0, const json& params = json::object()) const;
+    std::future<json> fetchOHLCVAsync(const std::string& symbol, const std::string& timeframe = "1m",
+                                     long long since = 0, int limit = 0, const json& params = json::object()) const;
 
     // Trading API - Asynchronous
-    boost::future<json> fetchBalanceAsync(const json& params = json::object()) const;
-    boost::future<json> createOrderAsync(const std::string& symbol, const std::string& type, const std::string& side,
+    std::future<json> fetchBalanceAsync(const json& params = json::object()) const;
+    std::future<json> createOrderAsync(const std::string& symbol, const std::string& type, const std::string& side,
                                      double amount, double price = 0, const json& params = json::object());
-    boost::future<json> cancelOrderAsync(const std::string& id, const std::string& symbol = "", const json& params = json::object());
-    boost::future<json> fetchOrderAsync(const std::string& id, const std::string& symbol = "", const json& params = json::object()) const;
-    boost::future<json> fetchOrdersAsync(const std::string& symbol = "", int since = 0, int limit = 0, const json& params = json::object()) const;
-    boost::future<json> fetchOpenOrdersAsync(const std::string& symbol = "", int since = 0, int limit = 0, const json& params = json::object()) const;
-    boost::future<json> fetchClosedOrdersAsync(const std::string& symbol = "", int since = 0, int limit = 0, const json& params = json::object()) const;
+    std::future<json> cancelOrderAsync(const std::string& id, const std::string& symbol = "", const json& params = json::object());
+    std::future<json> fetchOrderAsync(const std::string& id, const std::string& symbol = "", const json& params = json::object()) const;
+    std::future<json> fetchOrdersAsync(const std::string& symbol = "", int since = 0, int limit = 0, const json& params = json::object()) const;
+    std::future<json> fetchOpenOrdersAsync(const std::string& symbol = "", int since = 0, int limit = 0, const json& params = json::object()) const;
+    std::future<json> fetchClosedOrdersAsync(const std::string& symbol = "", int since = 0, int limit = 0, const json& params = json::object()) const;
 
 protected:
     std::string sign(const std::string& path, const std::string& api = "public",
@@ -2,6 +2,7 @@
 #define CCXT_EXCHANGE_COINLIST_H
 
 #include "ccxt/base/exchange.h"
+#include <future>
 
 
 namespace ccxt {
@@ -41,24 +42,24 @@ protected:
 
     // Async Methods
     // Market Data
-    AsyncPullType fetchMarketsAsync() const;
-    AsyncPullType fetchCurrenciesAsync() const;
-    AsyncPullType fetchTickerAsync(const std::string& symbol) const;
-    AsyncPullType fetchTickersAsync(const std::vector<std::string>& symbols = {}) const;
-    AsyncPullType fetchOrderBookAsync(const std::string& symbol, const std::optional<int>& limit = std::nullopt) const;
-    AsyncPullType fetchOHLCVAsync(const std::string& symbol, const std::string& timeframe, const std::optional<long long>& since = std::nullopt, const std::optional<int>& limit = std::nullopt) const;
+    std::future<Json> fetchMarketsAsync() const;
+    std::future<Json> fetchCurrenciesAsync() const;
+    std::future<Json> fetchTickerAsync(const std::string& symbol) const;
+    std::future<Json> fetchTickersAsync(const std::vector<std::string>& symbols = {}) const;
+    std::future<Json> fetchOrderBookAsync(const std::string& symbol, const std::optional<int>& limit = std::nullopt) const;
+    std::future<Json> fetchOHLCVAsync(const std::string& symbol, const std::string& timeframe, const std::optional<long long>& since = std::nullopt, const std::optional<int>& limit = std::nullopt) const;
 
     // Trading
-    AsyncPullType createOrderAsync(const std::string& symbol, const std::string& type, const std::string& side, double amount, const std::optional<double>& price = std::nullopt);
-    AsyncPullType cancelOrderAsync(const std::string& id, const std::string& symbol);
-    AsyncPullType fetchOrderAsync(const std::string& id, const std::string& symbol) const;
-    AsyncPullType fetchOpenOrdersAsync(const std::string& symbol = "", const std::optional<long long>& since = std::nullopt, const std::optional<int>& limit = std::nullopt) const;
-    AsyncPullType fetchClosedOrdersAsync(const std::string& symbol = "", const std::optional<long long>& since = std::nullopt, const std::optional<int>& limit = std::nullopt) const;
-    AsyncPullType fetchMyTradesAsync(const std::string& symbol = "", const std::optional<long long>& since = std::nullopt, const std::optional<int>& limit = std::nullopt) const;
+    std::future<Json> createOrderAsync(const std::string& symbol, const std::string& type, const std::string& side, double amount, const std::optional<double>& price = std::nullopt);
+    std::future<Json> cancelOrderAsync(const std::string& id, const std::string& symbol);
+    std::future<Json> fetchOrderAsync(const std::string& id, const std::string& symbol) const;
+    std::future<Json> fetchOpenOrdersAsync(const std::string& symbol = "", const std::optional<long long>& since = std::nullopt, const std::optional<int>& limit = std::nullopt) const;
+    std::future<Json> fetchClosedOrdersAsync(const std::string& symbol = "", const std::optional<long long>& since = std::nullopt, const std::optional<int>& limit = std::nullopt) const;
+    std::future<Json> fetchMyTradesAsync(const std::string& symbol = "", const std::optional<long long>& since = std::nullopt, const std::optional<int>& limit = std::nullopt) const;
 
     // Account
-    AsyncPullType fetchBalanceAsync() const;
-    AsyncPullType fetchLedgerAsync(const std::optional<std::string>& code = std::nullopt, const std::optional<long long>& since = std::nullopt, const std::optional<int>& limit = std::nullopt) const;
+    std::future<Json> fetchBalanceAsync() const;
+    std::future<Json> fetchLedgerAsync(const std::optional<std::string>& code = std::nullopt, const std::optional<long long>& since = std::nullopt, const std::optional<int>& limit = std::nullopt) const;
 
 private:
     static Exchange* createInstance(const Config& config) {
@@ -17,7 +17,7 @@ public:
     Json fetchTicker(const std::string &symbol, const Json &params = Json::object()) override;
     Json fetchOrderBook(const std::string &symbol, const int limit = 0, const Json &params = Json::object()) override;
     Json fetchTrades(const std::string &symbol, int since = 0, int limit = 0, const Json &params = Json::object()) override;
-    Json fetchOHLCV(const std::string &symbol, const std::string &timeframe = "1m", int since = 0, int limit = 0, const Json &params = Json::object()) override;
+    Json fetchOHLCV(const std::string &symbol, const std::string &timeframe = "1m", long long since = 0, int limit = 0, const Json &params = Json::object()) override;
 
     // Trading
     Json createOrder(const std::string &symbol, const std::string &type, const std::string &side,
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "ccxt/base/exchange.h"
+#include <future>
 
 namespace ccxt {
 
@@ -16,16 +17,16 @@ public:
     json fetchOrderBook(const std::string& symbol, int limit = 0, const json& params = json::object()) override;
     json fetchTrades(const std::string& symbol, int since = 0, int limit = 0, const json& params = json::object()) override;
     json fetchOHLCV(const std::string& symbol, const std::string& timeframe = "1m",
-                    int since = 0, int limit = 0, const json& params = json::object()) override;
+                    long long since = 0, int limit = 0, const json& params = json::object()) override;
 
     // Async Market Data API
-    AsyncPullType fetchMarketsAsync(const json& params = json::object());
-    AsyncPullType fetchTickerAsync(const std::string& symbol, const json& params = json::object());
-    AsyncPullType fetchTickersAsync(const std::vector<std::string>& symbols = {}, const json& params = json::object());
-    AsyncPullType fetchOrderBookAsync(const std::string& symbol, int limit = 0, const json& params = json::object());
-    AsyncPullType fetchTradesAsync(const std::string& symbol, int since = 0, int limit = 0, const json& params = json::object());
-    AsyncPullType fetchOHLCVAsync(const std::string& symbol, const std::string& timeframe = "1m",
-                    int since = 0, int limit = 0, const json& params = json::object());
+    std::future<json> fetchMarketsAsync(const json& params = json::object());
+    std::future<json> fetchTickerAsync(const std::string& symbol, const json& params = json::object());
+    std::future<json> fetchTickersAsync(const std::vector<std::string>& symbols = {}, const json& params = json::object());
+    std::future<json> fetchOrderBookAsync(const std::string& symbol, int limit = 0, const json& params = json::object());
+    std::future<json> fetchTradesAsync(const std::string& symbol, int since = 0, int limit = 0, const json& params = json::object());
+    std::future<json> fetchOHLCVAsync(const std::string& symbol, const std::string& timeframe = "1m",
+                    long long since = 0, int limit = 0, const json& params = json::object());
 
     // Trading API
     json fetchBalance(const json& params = json::object()) override;
@@ -38,14 +39,14 @@ public:
     json fetchClosedOrders(const std::string& symbol = "", int since = 0, int limit = 0, const json& params = json::object()) override;
 
     // Async Trading API
-    AsyncPullType fetchBalanceAsync(const json& params = json::object());
-    AsyncPullType createOrderAsync(const std::string& symbol, const std::string& type, const std::string& side,
+    std::future<json> fetchBalanceAsync(const json& params = json::object());
+    std::future<json> createOrderAsync(const std::string& symbol, const std::string& type, const std::string& side,
                     double amount, double price = 0, const json& params = json::object());
-    AsyncPullType cancelOrderAsync(const std::string& id, const std::string& symbol = "", const json& params = json::object());
-    AsyncPullType fetchOrderAsync(const std::string& id, const std::string& symbol = "", const json& params = json::object());
-    AsyncPullType fetchOrdersAsync(const std::string& symbol = "", int since = 0, int limit = 0, const json& params = json::object());
-    AsyncPullType fetchOpenOrdersAsync(const std::string& symbol = "", int since = 0, int limit = 0, const json& params = json::object());
-    AsyncPullType fetchClosedOrdersAsync(const std::string& symbol = "", int since = 0, int limit = 0, const json& params = json::object());
+    std::future<json> cancelOrderAsync(const std::string& id, const std::string& symbol = "", const json& params = json::object());
+    std::future<json> fetchOrderAsync(const std::string& id, const std::string& symbol = "", const json& params = json::object());
+    std::future<json> fetchOrdersAsync(const std::string& symbol = "", int since = 0, int limit = 0, const json& params = json::object());
+    std::future<json> fetchOpenOrdersAsync(const std::string& symbol = "", int since = 0, int limit = 0, const json& params = json::object());
+    std::future<json> fetchClosedOrdersAsync(const std::string& symbol = "", int since = 0, int limit = 0, const json& params = json::object());
 
     // Gemini specific methods
     json fetchMyTrades(const std::string& symbol = "", int since = 0, int limit = 0, const json& params = json::object());
@@ -62,18 +63,18 @@ public:
     json fetchPaymentMethods(const json& params = json::object());
 
     // Async Gemini specific methods
-    AsyncPullType fetchMyTradesAsync(const std::string& symbol = "", int since = 0, int limit = 0, const json& params = json::object());
-    AsyncPullType fetchDepositsAsync(const std::string& code = "", int since = 0, int limit = 0, const json& params = json::object());
-    AsyncPullType fetchWithdrawalsAsync(const std::string& code = "", int since = 0, int limit = 0, const json& params = json::object());
-    AsyncPullType fetchTransfersAsync(const std::string& code = "", int since = 0, int limit = 0, const json& params = json::object());
-    AsyncPullType transferAsync(const std::string& code, double amount, const std::string& fromAccount,
+    std::future<json> fetchMyTradesAsync(const std::string& symbol = "", int since = 0, int limit = 0, const json& params = json::object());
+    std::future<json> fetchDepositsAsync(const std::string& code = "", int since = 0, int limit = 0, const json& params = json::object());
+    std::future<json> fetchWithdrawalsAsync(const std::string& code = "", int since = 0, int limit = 0, const json& params = json::object());
+    std::future<json> fetchTransfersAsync(const std::string& code = "", int since = 0, int limit = 0, const json& params = json::object());
+    std::future<json> transferAsync(const std::string& code, double amount, const std::string& fromAccount,
                  const std::string& toAccount, const json& params = json::object());
-    AsyncPullType fetchDepositAddressAsync(const std::string& code, const json& params = json::object());
-    AsyncPullType createDepositAddressAsync(const std::string& code, const json& params = json::object());
-    AsyncPullType withdrawAsync(const std::string& code, double amount, const std::string& address,
+    std::future<json> fetchDepositAddressAsync(const std::string& code, const json& params = json::object());
+    std::future<json> createDepositAddressAsync(const std::string& code, const json& params = json::object());
+    std::future<json> withdrawAsync(const std::string& code, double amount, const std::string& address,
                  const std::string& tag = "", const json& params = json::object());
-    AsyncPullType fetchLedgerAsync(const std::string& code = "", int since = 0, int limit = 0, const json& params = json::object());
-    AsyncPullType fetchPaymentMethodsAsync(const json& params = json::object());
+    std::future<json> fetchLedgerAsync(const std::string& code = "", int since = 0, int limit = 0, const json& params = json::object());
+    std::future<json> fetchPaymentMethodsAsync(const json& params = json::object());
 
 protected:
     std::string sign(const std::string& path, const std::string& api = "public",
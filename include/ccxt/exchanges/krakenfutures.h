@@ -17,7 +17,7 @@ public:
     Ticker fetchTicker(const std::string& symbol, const Params& params = Params()) override;
     std::map<std::string, Ticker> fetchTickers(const std::vector<std::string>& symbols = std::vector<std::string>(), const Params& params = Params()) override;
     std::vector<Trade> fetchTrades(const std::string& symbol, int since = 0, int limit = 0, const Params& params = Params()) override;
-    std::vector<OHLCV> fetchOHLCV(const std::string& symbol, const std::string& timeframe = "1m", int since = 0, int limit = 0, const Params& params = Params()) override;
+    std::vector<OHLCV> fetchOHLCV(const std::string& symbol, const std::string& timeframe = "1m", long long since = 0, int limit = 0, const Params& params = Params()) override;
     
     // Trading Methods - Sync
     Order createOrder(const std::string& symbol, const std::string& type, const std::string& side,
@@ -44,7 +44,7 @@ public:
     std::future<Ticker> fetchTickerAsync(const std::string& symbol, const Params& params = Params());
     std::future<std::map<std::string, Ticker>> fetchTickersAsync(const std::vector<std::string>& symbols = std::vector<std::string>(), const Params& params = Params());
     std::future<std::vector<Trade>> fetchTradesAsync(const std::string& symbol, int since = 0, int limit = 0, const Params& params = Params());
-    std::future<std::vector<OHLCV>> fetchOHLCVAsync(const std::string& symbol, const std::string& timeframe = "1m", int since = 0, int limit = 0, const Params& params = Params());
+    std::future<std::vector<OHLCV>> fetchOHLCVAsync(const std::string& symbol, const std::string& timeframe = "1m", long long since = 0, int limit = 0, const Params& params = Params());
     
     // Trading Methods - Async
     std::future<Order> createOrderAsync(const std::string& symbol, const std::string& type, const std::string& side,
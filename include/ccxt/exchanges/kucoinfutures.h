@@ -16,7 +16,7 @@ public:
     Ticker fetchTicker(const std::string& symbol, const Params& params = Params()) override;
     std::map<std::string, Ticker> fetchTickers(const std::vector<std::string>& symbols = std::vector<std::string>(), const Params& params = Params()) override;
     std::vector<Trade> fetchTrades(const std::string& symbol, int since = 0, int limit = 0, const Params& params = Params()) override;
-    std::vector<OHLCV> fetchOHLCV(const std::string& symbol, const std::string& timeframe = "1m", int since = 0, int limit = 0, const Params& params = Params()) override;
+    std::vector<OHLCV> fetchOHLCV(const std::string& symbol, const std::string& timeframe = "1m", long long since = 0, int limit = 0, const Params& params = Params()) override;
     FundingRate fetchFundingRate(const std::string& symbol, const Params& params = Params());
     std::map<std::string, FundingRate> fetchFundingRates(const std::vector<std::string>& symbols = std::vector<std::string>(), const Params& params = Params());
     std::vector<FundingRate> fetchFundingRateHistory(const std::string& symbol = "", int since = 0, int limit = 0, const Params& params = Params());
@@ -45,7 +45,7 @@ public:
     std::future<Ticker> fetchTickerAsync(const std::string& symbol, const Params& params = Params());
     std::future<std::map<std::string, Ticker>> fetchTickersAsync(const std::vector<std::string>& symbols = std::vector<std::string>(), const Params& params = Params());
     std::future<std::vector<Trade>> fetchTradesAsync(const std::string& symbol, int since = 0, int limit = 0, const Params& params = Params());
-    std::future<std::vector<OHLCV>> fetchOHLCVAsync(const std::string& symbol, const std::string& timeframe = "1m", int since = 0, int limit = 0, const Params& params = Params());
+    std::future<std::vector<OHLCV>> fetchOHLCVAsync(const std::string& symbol, const std::string& timeframe = "1m", long long since = 0, int limit = 0, const Params& params = Params());
     std::future<FundingRate> fetchFundingRateAsync(const std::string& symbol, const Params& params = Params());
     std::future<std::map<std::string, FundingRate>> fetchFundingRatesAsync(const std::vector<std::string>& symbols = std::vector<std::string>(), const Params& params = Params());
     std::future<std::vector<FundingRate>> fetchFundingRateHistoryAsync(const std::string& symbol = "", int since = 0, int limit = 0, const Params& params = Params());
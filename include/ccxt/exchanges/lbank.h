@@ -1,6 +1,7 @@
 #pragma once
 
 #include "ccxt/base/exchange.h"
+#include <future>
 
 namespace ccxt {
 
@@ -16,15 +17,15 @@ public:
     json fetchOrderBook(const std::string& symbol, int limit = 0, const json& params = json::object()) override;
     json fetchTrades(const std::string& symbol, int since = 0, int limit = 0, const json& params = json::object()) override;
     json fetchOHLCV(const std::string& symbol, const std::string& timeframe = "1m",
-                    int since = 0, int limit = 0, const json& params = json::object()) override;
+                    long long since = 0, int limit = 0, const json& params = json::object()) override;
 
     // Async Market Data API
-    AsyncPullType asyncFetchMarkets(const json& params = json::object());
-    AsyncPullType asyncFetchTicker(const std::string& symbol, const json& params = json::object());
-    AsyncPullType asyncFetchTickers(const std::vector<std::string>& symbols = {}, const json& params = json::object());
-    AsyncPullType asyncFetchOrderBook(const std::string& symbol, int limit = 0, const json& params = json::object());
-    AsyncPullType asyncFetchTrades(const std::string& symbol, int since = 0, int limit = 0, const json& params = json::object());
-    AsyncPullType asyncFetchOHLCV(const std::string& symbol, const std::string& timeframe = "1m",
+    std::future<json> asyncFetchMarkets(const json& params = json::object());
+    std::future<json> asyncFetchTicker(const std::string& symbol, const json& params = json::object());
+    std::future<json> asyncFetchTickers(const std::vector<std::string>& symbols = {}, const json& params = json::object());
+    std::future<json> asyncFetchOrderBook(const std::string& symbol, int limit = 0, const json& params = json::object());
+    std::future<json> asyncFetchTrades(const std::string& symbol, int since = 0, int limit = 0, const json& params = json::object());
+    std::future<json> asyncFetchOHLCV(const std::string& symbol, const std::string& timeframe = "1m",
                                      int since = 0, int limit = 0, const json& params = json::object());
 
     // Trading API
@@ -38,14 +39,14 @@ public:
     json fetchClosedOrders(const std::string& symbol = "", int since = 0, int limit = 0, const json& params = json::object()) override;
 
     // Async Trading API
-    AsyncPullType asyncFetchBalance(const json& params = json::object());
-    AsyncPullType asyncCreateOrder(const std::string& symbol, const std::string& type, const std::string& side,
+    std::future<json> asyncFetchBalance(const json& params = json::object());
+    std::future<json> asyncCreateOrder(const std::string& symbol, const std::string& type, const std::string& side,
                                      double amount, double price = 0, const json& params = json::object());
-    AsyncPullType asyncCancelOrder(const std::string& id, const std::string& symbol = "", const json& params = json::object());
-    AsyncPullType asyncFetchOrder(const std::string& id, const std::string& symbol = "", const json& params = json::object());
-    AsyncPullType asyncFetchOrders(const std::string& symbol = "", int since = 0, int limit = 0, const json& params = json::object());
-    AsyncPullType asyncFetchOpenOrders(const std::string& symbol = "", int since = 0, int limit = 0, const json& params = json::object());
-    AsyncPullType asyncFetchClosedOrders(const std::string& symbol = "", int since = 0, int limit = 0, const json& params = json::object());
+    std::future<json> asyncCancelOrder(const std::string& id, const std::string& symbol = "", const json& params = json::object());
+    std::future<json> asyncFetchOrder(const std::string& id, const std::string& symbol = "", const json& params = json::object());
+    std::future<json> asyncFetchOrders(const std::string& symbol = "", int since = 0, int limit = 0, const json& params = json::object());
+    std::future<json> asyncFetchOpenOrders(const std::string& symbol = "", int since = 0, int limit = 0, const json& params = json::object());
+    std::future<json> asyncFetchClosedOrders(const std::string& symbol = "", int since = 0, int limit = 0, const json& params = json::object());
 
     // Account API
     json fetchMyTrades(const std::string& symbol = "", int since = 0, int limit = 0, const json& params = json::object());
@@ -55,11 +56,11 @@ public:
     json withdraw(const std::string& code, double amount, const std::string& address, const std::string& tag = "", const json& params = json::object());
 
     // Async Account API
-    AsyncPullType asyncFetchMyTrades(const std::string& symbol = "", int since = 0, int limit = 0, const json& params = json::object());
-    AsyncPullType asyncFetchDeposits(const std::string& code = "", int since = 0, int limit = 0, const json& params = json::object());
-    AsyncPullType asyncFetchWithdrawals(const std::string& code = "", int since = 0, int limit = 0, const json& params = json::object());
-    AsyncPullType asyncFetchDepositAddress(const std::string& code, const json& params = json::object());
-    AsyncPullType asyncWithdraw(const std::string& code, double amount, const std::string& address, const std::string& tag = "", const json& params = json::object());
+    std::future<json> asyncFetchMyTrades(const std::string& symbol = "", int since = 0, int limit = 0, const json& params = json::object());
+    std::future<json> asyncFetchDeposits(const std::string& code = "", int since = 0, int limit = 0, const json& params = json::object());
+    std::future<json> asyncFetchWithdrawals(const std::string& code = "", int since = 0, int limit = 0, const json& params = json::object());
+    std::future<json> asyncFetchDepositAddress(const std::string& code, const json& params = json::object());
+    std::future<json> asyncWithdraw(const std::string& code, double amount, const std::string& address, const std::string& tag = "", const json& params = json::object());
 
     // Additional Features
     json fetchCurrencies(const json& params = json::object());
@@ -70,12 +71,12 @@ public:
     json fetchTime(const json& params = json::object());
 
     // Async Additional Features
-    AsyncPullType asyncFetchCurrencies(const json& params = json::object());
-    AsyncPullType asyncFetchTradingFees(const json& params = json::object());
-    AsyncPullType asyncFetchFundingFees(const json& params = json::object());
-    AsyncPullType asyncFetchTransactionFees(const json& params = json::object());
-    AsyncPullType asyncFetchSystemStatus(const json& params = json::object());
-    AsyncPullType asyncFetchTime(const json& params = json::object());
+    std::future<json> asyncFetchCurrencies(const json& params = json::object());
+    std::future<json> asyncFetchTradingFees(const json& params = json::object());
+    std::future<json> asyncFetchFundingFees(const json& params = json::object());
+    std::future<json> asyncFetchTransactionFees(const json& params = json::object());
+    std::future<json> asyncFetchSystemStatus(const json& params = json::object());
+    std::future<json> asyncFetchTime(const json& params = json::object());
 
 protected:
     std::string sign(const std::string& path, const std::string& api = "public",
@@ -18,7 +18,7 @@ public:
     json fetchOrderBook(const std::string& symbol, int limit = 0, const json& params = json()) override;
     json fetchTrades(const std::string& symbol, int since = 0, int limit = 0, const json& params = json()) override;
     json fetchOHLCV(const std::string& symbol, const std::string& timeframe = "1m",
-                    int since = 0, int limit = 0, const json& params = json()) override;
+                    long long since = 0, int limit = 0, const json& params = json()) override;
 
     // Trading API
     json fetchBalance(const json& params = json()) override;
@@ -37,29 +37,29 @@ public:
     json fetchTradingFee(const std::string& symbol, const json& params = json());
 
     // Async Market Data API
-    AsyncPullType asyncFetchMarkets(const json& params = json());
-    AsyncPullType asyncFetchTicker(const std::string& symbol, const json& params = json());
-    AsyncPullType asyncFetchTickers(const std::vector<std::string>& symbols = {}, const json& params = json());
-    AsyncPullType asyncFetchOrderBook(const std::string& symbol, int limit = 0, const json& params = json());
-    AsyncPullType asyncFetchTrades(const std::string& symbol, int since = 0, int limit = 0, const json& params = json());
-    AsyncPullType asyncFetchOHLCV(const std::string& symbol, const std::string& timeframe = "1m",
+    std::future<json> asyncFetchMarkets(const json& params = json());
+    std::future<json> asyncFetchTicker(const std::string& symbol, const json& params = json());
+    std::future<json> asyncFetchTickers(const std::vector<std::string>& symbols = {}, const json& params = json());
+    std::future<json> asyncFetchOrderBook(const std::string& symbol, int limit = 0, const json& params = json());
+    std::future<json> asyncFetchTrades(const std::string& symbol, int since = 0, int limit = 0, const json& params = json());
+    std::future<json> asyncFetchOHLCV(const std::string& symbol, const std::string& timeframe = "1m",
                                      int since = 0, int limit = 0, const json& params = json());
 
     // Async Trading API
-    AsyncPullType asyncFetchBalance(const json& params = json());
-    AsyncPullType asyncCreateOrder(const std::string& symbol, const std::string& type, const std::string& side,
+    std::future<json> asyncFetchBalance(const json& params = json());
+    std::future<json> asyncCreateOrder(const std::string& symbol, const std::string& type, const std::string& side,
                                      double amount, double price = 0, const json& params = json());
-    AsyncPullType asyncCancelOrder(const std::string& id, const std::string& symbol = "", const json& params = json());
-    AsyncPullType asyncFetchOrder(const std::string& id, const std::string& symbol = "", const json& params = json());
-    AsyncPullType asyncFetchOrders(const std::string& symbol = "", int since = 0, int limit = 0, const json& params = json());
-    AsyncPullType asyncFetchOpenOrders(const std::string& symbol = "", int since = 0, int limit = 0, const json& params = json());
-    AsyncPullType asyncFetchClosedOrders(const std::string& symbol = "", int since = 0, int limit = 0, const json& params = json());
-    AsyncPullType asyncFetchMyTrades(const std::string& symbol = "", int since = 0, int limit = 0, const json& params = json());
+    std::future<json> asyncCancelOrder(const std::string& id, const std::string& symbol = "", const json& params = json());
+    std::future<json> asyncFetchOrder(const std::string& id, const std::string& symbol = "", const json& params = json());
+    std::future<json> asyncFetchOrders(const std::string& symbol = "", int since = 0, int limit = 0, const json& params = json());
+    std::future<json> asyncFetchOpenOrders(const std::string& symbol = "", int since = 0, int limit = 0, const json& params = json());
+    std::future<json> asyncFetchClosedOrders(const std::string& symbol = "", int since = 0, int limit = 0, const json& params = json());
+    std::future<json> asyncFetchMyTrades(const std::string& symbol = "", int since = 0, int limit = 0, const json& params = json());
 
     // Async Account API
-    AsyncPullType asyncFetchAccounts(const json& params = json());
-    AsyncPullType asyncFetchLedger(const std::string& code, int since = 0, int limit = 0, const json& params = json());
-    AsyncPullType asyncFetchTradingFee(const std::string& symbol, const json& params = json());
+    std::future<json> asyncFetchAccounts(const json& params = json());
+    std::future<json> asyncFetchLedger(const std::string& code, int since = 0, int limit = 0, const json& params = json());
+    std::future<json> asyncFetchTradingFee(const std::string& symbol, const json& params = json());
 
 protected:
     std::string sign(const std::string& path, const std::string& api = "public",
@@ -16,7 +16,7 @@ public:
     json fetchOrderBook(const std::string& symbol, int limit = 0, const json& params = json::object()) override;
     json fetchTrades(const std::string& symbol, int since = 0, int limit = 0, const json& params = json::object()) override;
     json fetchOHLCV(const std::string& symbol, const std::string& timeframe = "1m",
-                    int since = 0, int limit = 0, const json& params = json::object()) override;
+                    long long since = 0, int limit = 0, const json& params = json::object()) override;
 
     // Trading API
     json fetchBalance(const json& params = json::object()) override;
@@ -46,7 +46,7 @@ public:
     json fetchOrderBookAsync(const std::string& symbol, int limit = 0, const json& params = json::object());
     json fetchTradesAsync(const std::string& symbol, int since = 0, int limit = 0, const json& params = json::object());
     json fetchOHLCVAsync(const std::string& symbol, const std::string& timeframe = "1m",
-                        int since = 0, int limit = 0, const json& params = json::object());
+                        long long since = 0, int limit = 0, const json& params = json::object());
     json fetchBalanceAsync(const json& params = json::object());
     json createOrderAsync(const std::string& symbol, const std::string& type, const std::string& side,
                          double amount, double price = 0, const json& params = json::object());
@@ -63,63 +63,63 @@ public:
     Json fetchFundingIntervalImpl(const std::string& symbol) const override;
 
     // Async Market Data
-    AsyncPullType fetchMarketsAsync() const;
-    AsyncPullType fetchTimeAsync() const;
-    AsyncPullType fetchTickerAsync(const std::string& symbol) const;
-    AsyncPullType fetchTickersAsync(const std::vector<std::string>& symbols = {}) const;
-    AsyncPullType fetchOrderBookAsync(const std::string& symbol,
+    std::future<Json> fetchMarketsAsync() const;
+    std::future<Json> fetchTimeAsync() const;
+    std::future<Json> fetchTickerAsync(const std::string& symbol) const;
+    std::future<Json> fetchTickersAsync(const std::vector<std::string>& symbols = {}) const;
+    std::future<Json> fetchOrderBookAsync(const std::string& symbol,
                                         const std::optional<int>& limit = std::nullopt) const;
-    AsyncPullType fetchOHLCVAsync(const std::string& symbol,
+    std::future<Json> fetchOHLCVAsync(const std::string& symbol,
                                      const std::string& timeframe,
                                      const std::optional<long long>& since = std::nullopt,
                                      const std::optional<int>& limit = std::nullopt) const;
-    AsyncPullType fetchTradesAsync(const std::string& symbol,
+    std::future<Json> fetchTradesAsync(const std::string& symbol,
                                       const std::optional<int>& limit = std::nullopt,
                                       const std::optional<long long>& since = std::nullopt) const;
 
     // Async Trading
-    AsyncPullType createOrderAsync(const std::string& symbol,
+    std::future<Json> createOrderAsync(const std::string& symbol,
                                      const std::string& type,
                                      const std::string& side,
                                      double amount,
                                      const std::optional<double>& price = std::nullopt);
-    AsyncPullType createStopOrderAsync(const std::string& symbol,
+    std::future<Json> createStopOrderAsync(const std::string& symbol,
                                          const std::string& type,
                                          const std::string& side,
                                          double amount,
                                          const std::optional<double>& price = std::nullopt,
                                          const Json& params = Json::object());
-    AsyncPullType cancelOrderAsync(const std::string& id,
+    std::future<Json> cancelOrderAsync(const std::string& id,
                                      const std::string& symbol);
-    AsyncPullType cancelAllOrdersAsync(const std::string& symbol = "");
-    AsyncPullType fetchOrderAsync(const std::string& id,
+    std::future<Json> cancelAllOrdersAsync(const std::string& symbol = "");
+    std::future<Json> fetchOrderAsync(const std::string& id,
                                     const std::string& symbol) const;
-    AsyncPullType fetchOrdersAsync(const std::string& symbol = "",
+    std::future<Json> fetchOrdersAsync(const std::string& symbol = "",
                                      const std::optional<long long>& since = std::nullopt,
                                      const std::optional<int>& limit = std::nullopt) const;
-    AsyncPullType fetchOpenOrdersAsync(const std::string& symbol = "",
+    std::future<Json> fetchOpenOrdersAsync(const std::string& symbol = "",
                                          const std::optional<long long>& since = std::nullopt,
                                          const std::optional<int>& limit = std::nullopt) const;
-    AsyncPullType fetchClosedOrdersAsync(const std::string& symbol = "",
+    std::future<Json> fetchClosedOrdersAsync(const std::string& symbol = "",
                                            const std::optional<long long>& since = std::nullopt,
                                            const std::optional<int>& limit = std::nullopt) const;
-    AsyncPullType fetchMyTradesAsync(const std::string& symbol = "",
+    std::future<Json> fetchMyTradesAsync(const std::string& symbol = "",
                                         const std::optional<long long>& since = std::nullopt,
                                         const std::optional<int>& limit = std::nullopt) const;
 
     // Async Account
-    AsyncPullType fetchBalanceAsync() const;
-    AsyncPullType fetchPositionsAsync(const std::vector<std::string>& symbols = {}) const;
-    AsyncPullType setMarginModeAsync(const std::string& marginMode,
+    std::future<Json> fetchBalanceAsync() const;
+    std::future<Json> fetchPositionsAsync(const std::vector<std::string>& symbols = {}) const;
+    std::future<Json> setMarginModeAsync(const std::string& marginMode,
                                         const std::string& symbol = "",
                                         const Json& params = Json::object());
 
     // Async Funding
-    AsyncPullType fetchFundingRateAsync(const std::string& symbol) const;
-    AsyncPullType fetchFundingRateHistoryAsync(const std::string& symbol,
+    std::future<Json> fetchFundingRateAsync(const std::string& symbol) const;
+    std::future<Json> fetchFundingRateHistoryAsync(const std::string& symbol,
                                                   const std::optional<long long>& since = std::nullopt,
                                                   const std::optional<int>& limit = std::nullopt) const;
-    AsyncPullType fetchFundingIntervalAsync(const std::string& symbol) const;
+    std::future<Json> fetchFundingIntervalAsync(const std::string& symbol) const;
 
 private:
     static const std::string defaultBaseURL;
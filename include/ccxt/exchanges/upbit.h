@@ -55,51 +55,51 @@ public:
                              const std::optional<int>& limit = std::nullopt) const override;
 
     // Async Market Data
-    AsyncPullType fetchMarketsAsync() const;
-    AsyncPullType fetchCurrenciesAsync() const;
-    AsyncPullType fetchTickerAsync(const std::string& symbol) const;
-    AsyncPullType fetchTickersAsync(const std::vector<std::string>& symbols = {}) const;
-    AsyncPullType fetchOrderBookAsync(const std::string& symbol,
+    std::future<Json> fetchMarketsAsync() const;
+    std::future<Json> fetchCurrenciesAsync() const;
+    std::future<Json> fetchTickerAsync(const std::string& symbol) const;
+    std::future<Json> fetchTickersAsync(const std::vector<std::string>& symbols = {}) const;
+    std::future<Json> fetchOrderBookAsync(const std::string& symbol,
                                         const std::optional<int>& limit = std::nullopt) const;
-    AsyncPullType fetchTradesAsync(const std::string& symbol,
+    std::future<Json> fetchTradesAsync(const std::string& symbol,
                                       const std::optional<int>& limit = std::nullopt,
                                       const std::optional<long long>& since = std::nullopt) const;
-    AsyncPullType fetchOHLCVAsync(const std::string& symbol,
+    std::future<Json> fetchOHLCVAsync(const std::string& symbol,
                                      const std::string& timeframe,
                                      const std::optional<long long>& since = std::nullopt,
                                      const std::optional<int>& limit = std::nullopt) const;
 
     // Async Trading
-    AsyncPullType createOrderAsync(const std::string& symbol,
+    std::future<Json> createOrderAsync(const std::string& symbol,
                                      const std::string& type,
                                      const std::string& side,
                                      double amount,
                                      const std::optional<double>& price = std::nullopt);
-    AsyncPullType cancelOrderAsync(const std::string& id,
+    std::future<Json> cancelOrderAsync(const std::string& id,
                                      const std::string& symbol);
-    AsyncPullType fetchOrderAsync(const std::string& id,
+    std::future<Json> fetchOrderAsync(const std::string& id,
                                     const std::string& symbol) const;
-    AsyncPullType fetchOrdersAsync(const std::string& symbol = "",
+    std::future<Json> fetchOrdersAsync(const std::string& symbol = "",
                                      const std::optional<long long>& since = std::nullopt,
                                      const std::optional<int>& limit = std::nullopt) const;
-    AsyncPullType fetchOpenOrdersAsync(const std::string& symbol = "",
+    std::future<Json> fetchOpenOrdersAsync(const std::string& symbol = "",
                                          const std::optional<long long>& since = std::nullopt,
                                          const std::optional<int>& limit = std::nullopt) const;
-    AsyncPullType fetchClosedOrdersAsync(const std::string& symbol = "",
+    std::future<Json> fetchClosedOrdersAsync(const std::string& symbol = "",
                                            const std::optional<long long>& since = std::nullopt,
                                            const std::optional<int>& limit = std::nullopt) const;
-    AsyncPullType fetchMyTradesAsync(const std::string& symbol = "",
+    std::future<Json> fetchMyTradesAsync(const std::string& symbol = "",
                                         const std::optional<long long>& since = std::nullopt,
                                         const std::optional<int>& limit = std::nullopt) const;
 
     // Async Account
-    AsyncPullType fetchBalanceAsync() const;
-    AsyncPullType fetchDepositAddressAsync(const std::string& code,
+    std::future<Json> fetchBalanceAsync() const;
+    std::future<Json> fetchDepositAddressAsync(const std::string& code,
                                               const std::optional<std::string>& network = std::nullopt) const;
-    AsyncPullType fetchDepositsAsync(const std::optional<std::string>& code = std::nullopt,
+    std::future<Json> fetchDepositsAsync(const std::optional<std::string>& code = std::nullopt,
                                         const std::optional<long long>& since = std::nullopt,
                                         const std::optional<int>& limit = std::nullopt) const;
-    AsyncPullType fetchWithdrawalsAsync(const std::optional<std::string>& code = std::nullopt,
+    std::future<Json> fetchWithdrawalsAsync(const std::optional<std::string>& code = std::nullopt,
                                            const std::optional<long long>& since = std::nullopt,
                                            const std::optional<int>& limit = std::nullopt) const;
 
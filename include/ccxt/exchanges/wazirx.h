@@ -16,7 +16,7 @@ public:
     json fetchTickers(const std::vector<std::string>& symbols = {}, const json& params = {}) override;
     json fetchOrderBook(const std::string& symbol, int limit = 0, const json& params = {}) override;
     json fetchOHLCV(const std::string& symbol, const std::string& timeframe = "1m",
-                    int since = 0, int limit = 0, const json& params = {}) override;
+                    long long since = 0, int limit = 0, const json& params = {}) override;
     json fetchTrades(const std::string& symbol, int since = 0, int limit = 0,
                     const json& params = {}) override;
 
@@ -2,6 +2,8 @@
 #define CCXT_WOOFIPRO_H
 
 #include "ccxt/base/exchange.h"
+#include "ccxt/base/executor.h"
+#include <functional>
 #include <future>
 
 namespace ccxt {
@@ -21,7 +23,7 @@ public:
     json fetchTrades(const std::string& symbol, int since = 0, int limit = 0,
                     const json& params = json::object()) override;
     json fetchOHLCV(const std::string& symbol, const std::string& timeframe = "1m",
-                   int since = 0, int limit = 0, const json& params = json::object()) override;
+                   long long since = 0, int limit = 0, const json& params = json::object()) override;
     json fetchFundingRate(const std::string& symbol, const json& params = json::object()) override;
     json fetchFundingRates(const std::vector<std::string>& symbols = {}, const json& params = json::object()) override;
     json fetchFundingRateHistory(const std::string& symbol = "", int since = 0, int limit = 0,
@@ -66,65 +68,65 @@ public:
                     const json& params = json::object()) override;
 
     // Market Data Methods - Async
-    AsyncPullType fetchMarketsAsync(const json& params = json::object());
-    AsyncPullType fetchCurrenciesAsync(const json& params = json::object());
-    AsyncPullType fetchTimeAsync(const json& params = json::object());
-    AsyncPullType fetchTickerAsync(const std::string& symbol, const json& params = json::object());
-    AsyncPullType fetchTickersAsync(const std::vector<std::string>& symbols = {},
+    std::future<json> fetchMarketsAsync(const json& params = json::object());
+    std::future<json> fetchCurrenciesAsync(const json& params = json::object());
+    std::future<json> fetchTimeAsync(const json& params = json::object());
+    std::future<json> fetchTickerAsync(const std::string& symbol, const json& params = json::object());
+    std::future<json> fetchTickersAsync(const std::vector<std::string>& symbols = {},
                                       const json& params = json::object());
-    AsyncPullType fetchOrderBookAsync(const std::string& symbol, int limit = 0,
+    std::future<json> fetchOrderBookAsync(const std::string& symbol, int limit = 0,
                                         const json& params = json::object());
-    AsyncPullType fetchTradesAsync(const std::string& symbol, int since = 0, int limit = 0,
+    std::future<json> fetchTradesAsync(const std::string& symbol, int since = 0, int limit = 0,
                                      const json& params = json::object());
-    AsyncPullType fetchOHLCVAsync(const std::string& symbol, const std::string& timeframe = "1m",
-                                    int since = 0, int limit = 0, const json& params = json::object());
-    AsyncPullType fetchFundingRateAsync(const std::string& symbol, const json& params = json::object());
-    AsyncPullType fetchFundingRatesAsync(const std::vector<std::string>& symbols = {},
+    std::future<json> fetchOHLCVAsync(const std::string& symbol, const std::string& timeframe = "1m",
+                                    long long since = 0, int limit = 0, const json& params = json::object());
+    std::future<json> fetchFundingRateAsync(const std::string& symbol, const json& params = json::object());
+    std::future<json> fetchFundingRatesAsync(const std::vector<std::string>& symbols = {},
                                            const json& params = json::object());
-    AsyncPullType fetchFundingRateHistoryAsync(const std::string& symbol = "", int since = 0,
+    std::future<json> fetchFundingRateHistoryAsync(const std::string& symbol = "", int since = 0,
                                                  int limit = 0, const json& params = json::object());
 
     // Trading Methods - Async
-    AsyncPullType createOrderAsync(const std::string& symbol, const std::string& type,
+    std::future<json> createOrderAsync(const std::string& symbol, const std::string& type,
                                      const std::string& side, double amount, double price = 0,
                                      const json& params = json::object());
-    AsyncPullType createMarketBuyOrderWithCostAsync(const std::string& symbol, double cost,
+    std::future<json> createMarketBuyOrderWithCostAsync(const std::string& symbol, double cost,
                                                       const json& params = json::object());
-    AsyncPullType createMarketSellOrderWithCostAsync(const std::string& symbol, double cost,
+    std::future<json> createMarketSellOrderWithCostAsync(const std::string& symbol, double cost,
                                                        const json& params = json::object());
-    AsyncPullType cancelOrderAsync(const std::string& id, const std::string& symbol = "",
+    std::future<json> cancelOrderAsync(const std::string& id, const std::string& symbol = "",
                                      const json& params = json::object());
-    AsyncPullType cancelAllOrdersAsync(const std::string& symbol = "",
+    std::future<json> cancelAllOrdersAsync(const std::string& symbol = "",
                                          const json& params = json::object());
-    AsyncPullType fetchOrderAsync(const std::string& id, const std::string& symbol = "",
+    std::future<json> fetchOrderAsync(const std::string& id, const std::string& symbol = "",
                                     const json& params = json::object());
-    AsyncPullType fetchOrdersAsync(const std::string& symbol = "", int since = 0, int limit = 0,
+    std::future<json> fetchOrdersAsync(const std::string& symbol = "", int since = 0, int limit = 0,
                                      const json& params = json::object());
-    AsyncPullType fetchOpenOrdersAsync(const std::string& symbol = "", int since = 0, int limit = 0,
+    std::future<json> fetchOpenOrdersAsync(const std::string& symbol = "", int since = 0, int limit = 0,
                                          const json& params = json::object());
-    AsyncPullType fetchClosedOrdersAsync(const std::string& symbol = "", int since = 0, int limit = 0,
+    std::future<json> fetchClosedOrdersAsync(const std::string& symbol = "", int since = 0, int limit = 0,
                                            const json& params = json::object());
-    AsyncPullType fetchMyTradesAsync(const std::string& symbol = "", int since = 0, int limit = 0,
+    std::future<json> fetchMyTradesAsync(const std::string& symbol = "", int since = 0, int limit = 0,
                                         const json& params = json::object());
 
     // Account Methods - Async
-    AsyncPullType fetchAccountsAsync(const json& params = json::object());
-    AsyncPullType fetchBalanceAsync(const json& params = json::object());
-    AsyncPullType fetchLedgerAsync(const std::string& code = "", int since = 0, int limit = 0,
+    std::future<json> fetchAccountsAsync(const json& params = json::object());
+    std::future<json> fetchBalanceAsync(const json& params = json::object());
+    std::future<json> fetchLedgerAsync(const std::string& code = "", int since = 0, int limit = 0,
                                      const json& params = json::object());
-    AsyncPullType fetchDepositAddressAsync(const std::string& code,
+    std::future<json> fetchDepositAddressAsync(const std::string& code,
                                              const json& params = json::object());
-    AsyncPullType fetchDepositsAsync(const std::string& code = "", int since = 0, int limit = 0,
+    std::future<json> fetchDepositsAsync(const std::string& code = "", int since = 0, int limit = 0,
                                        const json& params = json::object());
-    AsyncPullType fetchWithdrawalsAsync(const std::string& code = "", int since = 0, int limit = 0,
+    std::future<json> fetchWithdrawalsAsync(const std::string& code = "", int since = 0, int limit = 0,
                                           const json& params = json::object());
 
     // Margin Trading Methods - Async
-    AsyncPullType addMarginAsync(const std::string& symbol, double amount,
+    std::future<json> addMarginAsync(const std::string& symbol, double amount,
                                    const json& params = json::object());
-    AsyncPullType fetchLeverageAsync(const std::string& symbol,
+    std::future<json> fetchLeverageAsync(const std::string& symbol,
                                        const json& params = json::object());
-    AsyncPullType setLeverageAsync(int leverage, const std::string& symbol = "",
+    std::future<json> setLeverageAsync(int leverage, const std::string& symbol = "",
                                      const json& params = json::object());
 
 protected:
@@ -147,13 +149,10 @@ protected:
                const json& headers = nullptr, const std::string& body = "") override;
 
 private:
-    // Async helper methods
+    // Runs a member function on the shared executor pool
     template<typename Func, typename... Args>
-    AsyncPullType async(Func&& func, Args&&... args) {
-        return std::async(std::launch::async,
-                         std::forward<Func>(func),
-                         this,
-                         std::forward<Args>(args)...);
+    auto async(Func&& func, Args&&... args) {
+        return Executor::shared().submit(std::bind(std::forward<Func>(func), this, std::forward<Args>(args)...));
     }
 
     // API endpoint versions
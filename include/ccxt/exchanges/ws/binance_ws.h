@@ -1,9 +1,14 @@
 #ifndef CCXT_BINANCE_WS_H
 #define CCXT_BINANCE_WS_H
 
+#include <ccxt/base/array_cache.h>
+#include <ccxt/base/event_bus.h>
 #include <ccxt/base/websocket_client.h>
 #include <ccxt/exchanges/binance.h>
 #include <nlohmann/json.hpp>
+#include <future>
+#include <memory>
+#include <optional>
 #include <string>
 #include <unordered_map>
 
@@ -14,10 +19,14 @@ public:
     BinanceWS(boost::asio::io_context& ioc, boost::asio::ssl::context& ctx, Binance& exchange);
 
     std::string getEndpoint();
+    // Order entry runs over a separate connection to this endpoint
+    std::string getApiEndpoint();
     void authenticate();
 
     // Market Data Methods
     void watchTicker(const std::string& symbol);
+    // Top 5, 10 or 20 levels (default 20) as a full snapshot every 100ms.
+    // Published books are whole, so their first levels are the best prices.
     void watchOrderBook(const std::string& symbol, const std::string& limit = "");
     void watchTrades(const std::string& symbol);
     void watchOHLCV(const std::string& symbol, const std::string& timeframe);
@@ -30,17 +39,31 @@ public:
     void watchPositions();
     void watchMarkPrice(const std::string& symbol);
 
+    // Signed ws-api order entry. The future gets the raw response frame,
+    // or the venue's error as ExchangeError.
+    std::future<std::string> createOrderWs(const std::string& symbol, const std::string& type, const std::string& side,
+                                           double amount, const std::optional<double>& price = std::nullopt);
+    std::future<std::string> cancelOrderWs(const std::string& id, const std::string& symbol);
+
+    // Recent stream data by market id, bounded by tradesLimit, OHLCVLimit
+    // and ordersLimit. Filled on the IO thread; read it there or once the
+    // connection is idle. nullptr until the first message for that key.
+    const ArrayCache<Trade>* trades(const std::string& marketId) const;
+    const ArrayCacheByTimestamp<OHLCV>* ohlcv(const std::string& marketId, const std::string& timeframe) const;
+    const ArrayCacheById<Order>& orders() const { return orders_; }
+    const ArrayCache<MyTrade>& myTrades() const { return myTrades_; }
+
 protected:
     void handleMessage(const std::string& message) override;
     void checkSubscriptionLimit(const std::string& type, const std::string& stream, int numSubscriptions);
     std::string getStream(const std::string& type, const std::string& subscriptionHash, int numSubscriptions);
     void handlePosition(const nlohmann::json& data);
     void handleMarkPrice(const nlohmann::json& data);
+    std::future<std::string> signedRequest(const std::string& method, nlohmann::json params);
 
 private:
     Binance& exchange_;
     bool checksumEnabled_;
-    int nextRequestId_ = 1;
     bool authenticated_ = false;
     std::unordered_map<std::string, int> streamLimits_;
     std::unordered_map<std::string, int> subscriptionLimits_;
@@ -48,14 +71,35 @@ private:
     int streamIndex_ = -1;
     std::unordered_map<std::string, std::string> streamBySubscriptionsHash_;
 
+    size_t limit(const std::string& option) const;
+    std::unordered_map<std::string, ArrayCache<Trade>> trades_;
+    // Keyed by market id, then interval
+    std::unordered_map<std::string, std::unordered_map<std::string, ArrayCacheByTimestamp<OHLCV>>> ohlcvs_;
+    ArrayCacheById<Order> orders_;
+    ArrayCache<MyTrade> myTrades_;
+
     // Message Handlers
     void handleTicker(const nlohmann::json& data);
-    void handleOrderBook(const nlohmann::json& data);
+    // Partial-depth snapshots only; diff streams (@depth, @depth@100ms)
+    // would need a locally maintained book and are ignored
+    static bool isPartialDepth(const std::string& stream);
+    void handleOrderBook(const std::string& stream, const nlohmann::json& data);
     void handleTrade(const nlohmann::json& data);
     void handleOHLCV(const nlohmann::json& data);
     void handleBalance(const nlohmann::json& data);
     void handleOrder(const nlohmann::json& data);
     void handleMyTrade(const nlohmann::json& data);
+
+    // Publishes on exchange_.events() under the market id's topic, or
+    // "<market id>@<interval>" for candles
+    template <typename T>
+    void emit(const std::string& topic, const T& event);
+    TopicId topicId(const std::string& name);
+    // Interned on the IO thread so publishing doesn't take the bus's lock.
+    // Valid for topicsBus_ only: the bus emit() last loaded from the exchange.
+    std::shared_ptr<EventBus> topicsBus_;
+    std::unordered_map<std::string, TopicId> topicIds_;
+    TopicId sourceId_ = 0;
 };
 
 } // namespace ccxt
@@ -2,6 +2,8 @@
 #define CCXT_XT_H
 
 #include "ccxt/base/exchange.h"
+#include "ccxt/base/executor.h"
+#include <functional>
 #include <future>
 
 namespace ccxt {
@@ -20,7 +22,7 @@ public:
     json fetchTrades(const std::string& symbol, int since = 0, int limit = 0,
                     const json& params = json::object()) override;
     json fetchOHLCV(const std::string& symbol, const std::string& timeframe = "1m",
-                   int since = 0, int limit = 0, const json& params = json::object()) override;
+                   long long since = 0, int limit = 0, const json& params = json::object()) override;
 
     // Trading Methods - Sync
     json createOrder(const std::string& symbol, const std::string& type, const std::string& side,
@@ -46,40 +48,40 @@ public:
                          const json& params = json::object()) override;
 
     // Market Data Methods - Async
-    AsyncPullType fetchMarketsAsync(const json& params = json::object());
-    AsyncPullType fetchCurrenciesAsync(const json& params = json::object());
-    AsyncPullType fetchTickerAsync(const std::string& symbol, const json& params = json::object());
-    AsyncPullType fetchTickersAsync(const std::vector<std::string>& symbols = {},
+    std::future<json> fetchMarketsAsync(const json& params = json::object());
+    std::future<json> fetchCurrenciesAsync(const json& params = json::object());
+    std::future<json> fetchTickerAsync(const std::string& symbol, const json& params = json::object());
+    std::future<json> fetchTickersAsync(const std::vector<std::string>& symbols = {},
                                       const json& params = json::object());
-    AsyncPullType fetchOrderBookAsync(const std::string& symbol, int limit = 0,
+    std::future<json> fetchOrderBookAsync(const std::string& symbol, int limit = 0,
                                         const json& params = json::object());
-    AsyncPullType fetchTradesAsync(const std::string& symbol, int since = 0, int limit = 0,
+    std::future<json> fetchTradesAsync(const std::string& symbol, int since = 0, int limit = 0,
                                      const json& params = json::object());
-    AsyncPullType fetchOHLCVAsync(const std::string& symbol, const std::string& timeframe = "1m",
-                                    int since = 0, int limit = 0, const json& params = json::object());
+    std::future<json> fetchOHLCVAsync(const std::string& symbol, const std::string& timeframe = "1m",
+                                    long long since = 0, int limit = 0, const json& params = json::object());
 
     // Trading Methods - Async
-    AsyncPullType createOrderAsync(const std::string& symbol, const std::string& type,
+    std::future<json> createOrderAsync(const std::string& symbol, const std::string& type,
                                      const std::string& side, double amount, double price = 0,
                                      const json& params = json::object());
-    AsyncPullType cancelOrderAsync(const std::string& id, const std::string& symbol = "",
+    std::future<json> cancelOrderAsync(const std::string& id, const std::string& symbol = "",
                                      const json& params = json::object());
-    AsyncPullType fetchOrderAsync(const std::string& id, const std::string& symbol = "",
+    std::future<json> fetchOrderAsync(const std::string& id, const std::string& symbol = "",
                                     const json& params = json::object());
-    AsyncPullType fetchOrdersAsync(const std::string& symbol = "", int since = 0, int limit = 0,
+    std::future<json> fetchOrdersAsync(const std::string& symbol = "", int since = 0, int limit = 0,
                                      const json& params = json::object());
-    AsyncPullType fetchOpenOrdersAsync(const std::string& symbol = "", int since = 0, int limit = 0,
+    std::future<json> fetchOpenOrdersAsync(const std::string& symbol = "", int since = 0, int limit = 0,
                                          const json& params = json::object());
-    AsyncPullType fetchClosedOrdersAsync(const std::string& symbol = "", int since = 0, int limit = 0,
+    std::future<json> fetchClosedOrdersAsync(const std::string& symbol = "", int since = 0, int limit = 0,
                                            const json& params = json::object());
-    AsyncPullType fetchMyTradesAsync(const std::string& symbol = "", int since = 0, int limit = 0,
+    std::future<json> fetchMyTradesAsync(const std::string& symbol = "", int since = 0, int limit = 0,
                                        const json& params = json::object());
 
     // Account Methods - Async
-    AsyncPullType fetchBalanceAsync(const json& params = json::object());
-    AsyncPullType fetchDepositsAsync(const std::string& code = "", int since = 0, int limit = 0,
+    std::future<json> fetchBalanceAsync(const json& params = json::object());
+    std::future<json> fetchDepositsAsync(const std::string& code = "", int since = 0, int limit = 0,
                                        const json& params = json::object());
-    AsyncPullType fetchWithdrawalsAsync(const std::string& code = "", int since = 0, int limit = 0,
+    std::future<json> fetchWithdrawalsAsync(const std::string& code = "", int since = 0, int limit = 0,
                                           const json& params = json::object());
 
 protected:
@@ -98,13 +100,10 @@ protected:
                const json& headers = nullptr, const std::string& body = "") override;
 
 private:
-    // Async helper methods
+    // Runs a member function on the shared executor pool
     template<typename Func, typename... Args>
-    AsyncPullType async(Func&& func, Args&&... args) {
-        return std::async(std::launch::async,
-                         std::forward<Func>(func),
-                         this,
-                         std::forward<Args>(args)...);
+    auto async(Func&& func, Args&&... args) {
+        return Executor::shared().submit(std::bind(std::forward<Func>(func), this, std::forward<Args>(args)...));
     }
 
     std::string v1;
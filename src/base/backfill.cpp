@@ -0,0 +1,289 @@
+#include "ccxt/base/backfill.h"
+#include "ccxt/base/datetime.h"
+#include "ccxt/base/errors.h"
+#include "ccxt/base/executor.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <exception>
+#include <fstream>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+
+namespace ccxt {
+
+namespace {
+
+double number(const json& value) {
+    if (value.is_number()) {
+        return value.get<double>();
+    }
+    if (value.is_string()) {
+        return std::strtod(value.get_ref<const std::string&>().c_str(), nullptr);
+    }
+    return 0.0;
+}
+
+struct Window {
+    size_t symbol;
+    size_t page;
+    long long start;
+    long long end;
+    int limit;
+};
+
+struct SymbolProgress {
+    std::string symbol;
+    std::vector<long long> starts;
+    std::vector<std::vector<OHLCV>> pages;
+    std::vector<bool> done;
+    // Pages [0, prefix) have been appended to candles
+    size_t prefix = 0;
+    long long until = 0;
+    std::vector<OHLCV> candles;
+
+    long long next() const {
+        return prefix < starts.size() ? starts[prefix] : until;
+    }
+};
+
+// Shared with the submitted workers, which may start after run() returned
+// and must then find no work left.
+struct BackfillRun {
+    OHLCVBackfill::PageFetcher fetcher;
+    BackfillOptions options;
+    std::string timeframe;
+    std::vector<Window> windows;
+    std::vector<SymbolProgress> symbols;
+    json checkpoints = json::object();
+
+    std::atomic<size_t> nextWindow{0};
+    std::atomic<bool> failed{false};
+    std::mutex mutex;
+    size_t finished = 0;
+    std::promise<void> allFinished;
+    std::exception_ptr error;
+    std::chrono::steady_clock::time_point lastSave;
+
+    void saveCheckpoints(bool force) {
+        if (options.checkpointFile.empty()) {
+            return;
+        }
+        const auto now = std::chrono::steady_clock::now();
+        if (!force && now - lastSave < std::chrono::seconds(1)) {
+            return;
+        }
+        lastSave = now;
+        for (const auto& progress : symbols) {
+            checkpoints[timeframe][progress.symbol] = {{"next", progress.next()}, {"until", progress.until}};
+        }
+        // Write-then-rename so a crash never leaves a truncated file behind
+        const std::string temporary = options.checkpointFile + ".tmp";
+        {
+            std::ofstream file(temporary, std::ios::trunc);
+            file << checkpoints.dump();
+        }
+        std::rename(temporary.c_str(), options.checkpointFile.c_str());
+    }
+
+    // Called with mutex held
+    void complete(const Window& window, std::vector<OHLCV> page) {
+        auto& progress = symbols[window.symbol];
+        page.erase(std::remove_if(page.begin(), page.end(), [&](const OHLCV& candle) {
+            return candle.timestamp < window.start || candle.timestamp >= window.end;
+        }), page.end());
+        std::sort(page.begin(), page.end(), [](const OHLCV& a, const OHLCV& b) {
+            return a.timestamp < b.timestamp;
+        });
+        page.erase(std::unique(page.begin(), page.end(), [](const OHLCV& a, const OHLCV& b) {
+            return a.timestamp == b.timestamp;
+        }), page.end());
+        progress.pages[window.page] = std::move(page);
+        progress.done[window.page] = true;
+
+        bool advanced = false;
+        while (progress.prefix < progress.done.size() && progress.done[progress.prefix]) {
+            auto& ready = progress.pages[progress.prefix];
+            if (options.onCandles && !ready.empty()) {
+                options.onCandles(progress.symbol, ready);
+            }
+            progress.candles.insert(progress.candles.end(), ready.begin(), ready.end());
+            std::vector<OHLCV>().swap(ready);
+            ++progress.prefix;
+            advanced = true;
+        }
+        if (advanced) {
+            saveCheckpoints(false);
+        }
+    }
+
+    std::vector<OHLCV> fetchWindow(const Window& window) {
+        const std::string& symbol = symbols[window.symbol].symbol;
+        for (int attempt = 1;; ++attempt) {
+            try {
+                return fetcher(symbol, timeframe, window.start, window.limit);
+            } catch (const NetworkError&) {
+                if (attempt >= options.maxRetries) {
+                    throw;
+                }
+            } catch (const RateLimitExceeded&) {
+                if (attempt >= options.maxRetries) {
+                    throw;
+                }
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(options.retryDelay * attempt));
+        }
+    }
+
+    void work() {
+        for (;;) {
+            const size_t index = nextWindow.fetch_add(1, std::memory_order_relaxed);
+            if (index >= windows.size()) {
+                return;
+            }
+            const Window& window = windows[index];
+            std::vector<OHLCV> page;
+            std::exception_ptr pageError;
+            if (!failed.load(std::memory_order_relaxed)) {
+                try {
+                    page = fetchWindow(window);
+                } catch (...) {
+                    pageError = std::current_exception();
+                }
+            }
+            std::lock_guard<std::mutex> lock(mutex);
+            if (pageError) {
+                if (!error) {
+                    error = pageError;
+                }
+                failed = true;
+            } else if (!failed) {
+                try {
+                    complete(window, std::move(page));
+                } catch (...) {
+                    if (!error) {
+                        error = std::current_exception();
+                    }
+                    failed = true;
+                }
+            }
+            if (++finished == windows.size()) {
+                allFinished.set_value();
+            }
+        }
+    }
+};
+
+} // namespace
+
+OHLCVBackfill::OHLCVBackfill(PageFetcher fetcher, BackfillOptions options)
+    : fetcher_(std::move(fetcher)), options_(std::move(options)) {}
+
+std::map<std::string, std::vector<OHLCV>> OHLCVBackfill::run(const std::vector<std::string>& symbols,
+                                                             const std::string& timeframe,
+                                                             long long since, long long until) {
+    const std::optional<long long> duration = parseTimeframe(timeframe);
+    if (!duration) {
+        throw NotSupported("backfill: unsupported timeframe " + timeframe);
+    }
+    if (options_.limit <= 0) {
+        throw BadRequest("backfill: limit must be positive");
+    }
+
+    auto state = std::make_shared<BackfillRun>();
+    state->fetcher = fetcher_;
+    state->options = options_;
+    state->timeframe = timeframe;
+    if (!options_.checkpointFile.empty()) {
+        std::ifstream file(options_.checkpointFile);
+        if (file) {
+            state->checkpoints = json::parse(file, nullptr, false);
+            if (!state->checkpoints.is_object()) {
+                state->checkpoints = json::object();
+            }
+        }
+    }
+
+    const long long step = *duration * options_.limit;
+    state->symbols.resize(symbols.size());
+    for (size_t i = 0; i < symbols.size(); ++i) {
+        auto& progress = state->symbols[i];
+        progress.symbol = symbols[i];
+        progress.until = until;
+        long long start = since;
+        if (state->checkpoints.contains(timeframe) && state->checkpoints[timeframe].contains(symbols[i])) {
+            start = std::max(start, state->checkpoints[timeframe][symbols[i]].value("next", start));
+        }
+        for (; start < until; start += step) {
+            const long long end = std::min(start + step, until);
+            const long long count = (end - start + *duration - 1) / *duration;
+            state->windows.push_back({i, progress.starts.size(), start, end, static_cast<int>(count)});
+            progress.starts.push_back(start);
+        }
+        progress.pages.resize(progress.starts.size());
+        progress.done.resize(progress.starts.size(), false);
+    }
+
+    if (!state->windows.empty()) {
+        // Interleave symbols so early windows of every symbol land first and
+        // one slow symbol doesn't hold back every checkpoint
+        std::stable_sort(state->windows.begin(), state->windows.end(), [](const Window& a, const Window& b) {
+            return a.page < b.page;
+        });
+        std::future<void> finished = state->allFinished.get_future();
+        const size_t helpers = std::min(std::max<size_t>(options_.concurrency, 1), state->windows.size()) - 1;
+        for (size_t i = 0; i < helpers; ++i) {
+            Executor::shared().post([state]() { state->work(); });
+        }
+        state->work();
+        finished.wait();
+    }
+
+    std::lock_guard<std::mutex> lock(state->mutex);
+    state->saveCheckpoints(true);
+    if (state->error) {
+        std::rethrow_exception(state->error);
+    }
+    std::map<std::string, std::vector<OHLCV>> result;
+    for (auto& progress : state->symbols) {
+        result[progress.symbol] = std::move(progress.candles);
+    }
+    return result;
+}
+
+std::vector<OHLCV> OHLCVBackfill::parseCandles(const json& page) {
+    std::vector<OHLCV> candles;
+    if (!page.is_array()) {
+        return candles;
+    }
+    candles.reserve(page.size());
+    for (const auto& row : page) {
+        OHLCV candle{};
+        if (row.is_array() && row.size() >= 6) {
+            candle.timestamp = static_cast<long long>(number(row[0]));
+            candle.open = number(row[1]);
+            candle.high = number(row[2]);
+            candle.low = number(row[3]);
+            candle.close = number(row[4]);
+            candle.volume = number(row[5]);
+        } else if (row.is_object() && row.contains("timestamp")) {
+            candle.timestamp = static_cast<long long>(number(row["timestamp"]));
+            candle.open = number(row.value("open", json()));
+            candle.high = number(row.value("high", json()));
+            candle.low = number(row.value("low", json()));
+            candle.close = number(row.value("close", json()));
+            candle.volume = number(row.value("volume", json()));
+        } else {
+            continue;
+        }
+        candles.push_back(candle);
+    }
+    return candles;
+}
+
+} // namespace ccxt
@@ -0,0 +1,241 @@
+#include "ccxt/base/bbo_aggregator.h"
+#include "ccxt/base/errors.h"
+#include "ccxt/base/exchange.h"
+#include "ccxt/base/logger.h"
+#include <algorithm>
+
+namespace ccxt {
+
+namespace {
+
+bool better(double price, double best, bool bid) {
+    return best == 0 || (bid ? price > best : price < best);
+}
+
+void collect(const std::vector<std::vector<double>>& levels, uint8_t venue, size_t limit,
+             std::vector<VenueLevel>& out) {
+    for (size_t i = 0; i < levels.size() && i < limit; ++i) {
+        if (levels[i].size() >= 2) {
+            out.push_back({levels[i][0], levels[i][1], venue});
+        }
+    }
+}
+
+} // namespace
+
+BboAggregator::BboAggregator() : BboAggregator(Options()) {}
+
+BboAggregator::BboAggregator(Options options)
+    : options_(options), cells_(std::make_unique<Cell[]>(options.maxInstruments)) {}
+
+BboAggregator::~BboAggregator() = default;
+
+uint8_t BboAggregator::addVenue(const std::string& name, EventBus& bus, KeyMapper mapper) {
+    if (venues_.size() >= kMaxVenues) {
+        throw Error("BboAggregator supports at most " + std::to_string(kMaxVenues) + " venues");
+    }
+    auto venue = std::make_unique<Venue>();
+    venue->name = name;
+    venue->bus = &bus;
+    venue->mapper = std::move(mapper);
+    venue->tickers = bus.subscribe<Ticker>(kAllTopics, options_.eventCapacity);
+    venue->books = bus.subscribe<OrderBook>(kAllTopics, options_.eventCapacity);
+    venues_.push_back(std::move(venue));
+    return static_cast<uint8_t>(venues_.size() - 1);
+}
+
+uint8_t BboAggregator::addVenue(Exchange& exchange) {
+    return addVenue(exchange.id, exchange.events(), [&exchange](const std::string& marketId) {
+        try {
+            return exchange.symbol(marketId);
+        } catch (const ExchangeError&) {
+            return marketId;
+        }
+    });
+}
+
+const std::string& BboAggregator::venueName(uint8_t venue) const {
+    return venues_.at(venue)->name;
+}
+
+size_t BboAggregator::poll() {
+    size_t applied = 0;
+    for (size_t v = 0; v < venues_.size(); ++v) {
+        Venue& venue = *venues_[v];
+        const uint8_t index = static_cast<uint8_t>(v);
+        applied += venue.tickers.drain([this, index](const Event<Ticker>& event) {
+            Quote quote;
+            quote.bid = event.data.bid;
+            quote.bidSize = event.data.bidVolume;
+            quote.ask = event.data.ask;
+            quote.askSize = event.data.askVolume;
+            quote.updatedAt = event.publishedAt;
+            apply(index, event.topic, quote);
+        });
+        applied += venue.books.drain([this, index](const Event<OrderBook>& event) {
+            const OrderBook& book = event.data;
+            Quote quote;
+            if (!book.bids.empty() && book.bids[0].size() >= 2) {
+                quote.bid = book.bids[0][0];
+                quote.bidSize = book.bids[0][1];
+            }
+            if (!book.asks.empty() && book.asks[0].size() >= 2) {
+                quote.ask = book.asks[0][0];
+                quote.askSize = book.asks[0][1];
+            }
+            quote.updatedAt = event.publishedAt;
+            const InstrumentId id = resolve(index, event.topic);
+            if (id != kUnknownInstrument && options_.mergedDepth) {
+                std::lock_guard<std::mutex> lock(booksMutex_);
+                state_[id]->books[index] = book;
+            }
+            apply(index, event.topic, quote);
+        });
+    }
+    return applied;
+}
+
+BboAggregator::InstrumentId BboAggregator::resolve(uint8_t index, TopicId topic) {
+    Venue& venue = *venues_[index];
+    auto known = venue.instruments.find(topic);
+    if (known != venue.instruments.end()) {
+        return known->second;
+    }
+    const std::string marketId = venue.bus->topicName(topic);
+    const std::string key = venue.mapper ? venue.mapper(marketId) : marketId;
+
+    InstrumentId id;
+    {
+        std::unique_lock<std::shared_mutex> lock(keysMutex_);
+        auto existing = keys_.find(key);
+        if (existing != keys_.end()) {
+            id = existing->second;
+        } else if (state_.size() >= options_.maxInstruments) {
+            CCXT_LOG_WARN("BboAggregator is full, ignoring " << key << " from " << venue.name);
+            id = kUnknownInstrument;
+        } else {
+            id = static_cast<InstrumentId>(state_.size());
+            {
+                std::lock_guard<std::mutex> books(booksMutex_);
+                state_.push_back(std::make_unique<Instrument>());
+            }
+            keys_.emplace(key, id);
+            instrumentCount_.store(state_.size(), std::memory_order_release);
+        }
+    }
+    venue.instruments.emplace(topic, id);
+    return id;
+}
+
+void BboAggregator::apply(uint8_t venue, TopicId topic, const Quote& quote) {
+    const InstrumentId id = resolve(venue, topic);
+    if (id == kUnknownInstrument) {
+        return;
+    }
+    state_[id]->quotes[venue] = quote;
+    publish(id, quote.updatedAt);
+}
+
+void BboAggregator::publish(InstrumentId id, uint64_t now) {
+    const Instrument& instrument = *state_[id];
+    TopOfBook best;
+    for (size_t v = 0; v < venues_.size(); ++v) {
+        const Quote& quote = instrument.quotes[v];
+        if (options_.staleAfter > 0 && now > quote.updatedAt + options_.staleAfter) {
+            continue;
+        }
+        if (quote.bid > 0 && better(quote.bid, best.bid, true)) {
+            best.bid = quote.bid;
+            best.bidSize = quote.bidSize;
+            best.bidVenue = static_cast<uint8_t>(v);
+        }
+        if (quote.ask > 0 && better(quote.ask, best.ask, false)) {
+            best.ask = quote.ask;
+            best.askSize = quote.askSize;
+            best.askVenue = static_cast<uint8_t>(v);
+        }
+    }
+
+    // Single writer: plain relaxed loads of our own last values are exact
+    Cell& cell = cells_[id];
+    if (cell.bid.load(std::memory_order_relaxed) == best.bid &&
+        cell.bidSize.load(std::memory_order_relaxed) == best.bidSize &&
+        cell.ask.load(std::memory_order_relaxed) == best.ask &&
+        cell.askSize.load(std::memory_order_relaxed) == best.askSize &&
+        cell.bidVenue.load(std::memory_order_relaxed) == best.bidVenue &&
+        cell.askVenue.load(std::memory_order_relaxed) == best.askVenue) {
+        return;
+    }
+    const uint32_t sequence = cell.sequence.load(std::memory_order_relaxed);
+    cell.sequence.store(sequence + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    cell.bid.store(best.bid, std::memory_order_relaxed);
+    cell.bidSize.store(best.bidSize, std::memory_order_relaxed);
+    cell.ask.store(best.ask, std::memory_order_relaxed);
+    cell.askSize.store(best.askSize, std::memory_order_relaxed);
+    cell.bidVenue.store(best.bidVenue, std::memory_order_relaxed);
+    cell.askVenue.store(best.askVenue, std::memory_order_relaxed);
+    cell.version.store(cell.version.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    cell.updatedAt.store(now, std::memory_order_relaxed);
+    cell.sequence.store(sequence + 2, std::memory_order_release);
+}
+
+BboAggregator::InstrumentId BboAggregator::instrument(const std::string& key) const {
+    std::shared_lock<std::shared_mutex> lock(keysMutex_);
+    auto it = keys_.find(key);
+    return it == keys_.end() ? kUnknownInstrument : it->second;
+}
+
+bool BboAggregator::read(InstrumentId id, TopOfBook& out) const {
+    if (id >= instrumentCount_.load(std::memory_order_acquire)) {
+        return false;
+    }
+    const Cell& cell = cells_[id];
+    for (;;) {
+        const uint32_t before = cell.sequence.load(std::memory_order_acquire);
+        if (before & 1) {
+            continue;
+        }
+        out.bid = cell.bid.load(std::memory_order_relaxed);
+        out.bidSize = cell.bidSize.load(std::memory_order_relaxed);
+        out.ask = cell.ask.load(std::memory_order_relaxed);
+        out.askSize = cell.askSize.load(std::memory_order_relaxed);
+        out.bidVenue = cell.bidVenue.load(std::memory_order_relaxed);
+        out.askVenue = cell.askVenue.load(std::memory_order_relaxed);
+        out.version = cell.version.load(std::memory_order_relaxed);
+        out.updatedAt = cell.updatedAt.load(std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (cell.sequence.load(std::memory_order_relaxed) == before) {
+            return true;
+        }
+    }
+}
+
+bool BboAggregator::read(const std::string& key, TopOfBook& out) const {
+    return read(instrument(key), out);
+}
+
+MergedDepth BboAggregator::depth(const std::string& key, size_t levels) const {
+    MergedDepth result;
+    const InstrumentId id = instrument(key);
+    if (id == kUnknownInstrument) {
+        return result;
+    }
+    {
+        std::lock_guard<std::mutex> lock(booksMutex_);
+        const Instrument& instrument = *state_[id];
+        for (size_t v = 0; v < venues_.size(); ++v) {
+            collect(instrument.books[v].bids, static_cast<uint8_t>(v), levels, result.bids);
+            collect(instrument.books[v].asks, static_cast<uint8_t>(v), levels, result.asks);
+        }
+    }
+    std::stable_sort(result.bids.begin(), result.bids.end(),
+                     [](const VenueLevel& a, const VenueLevel& b) { return a.price > b.price; });
+    std::stable_sort(result.asks.begin(), result.asks.end(),
+                     [](const VenueLevel& a, const VenueLevel& b) { return a.price < b.price; });
+    result.bids.resize(std::min(result.bids.size(), levels));
+    result.asks.resize(std::min(result.asks.size(), levels));
+    return result;
+}
+
+} // namespace ccxt
@@ -0,0 +1,142 @@
+#include "ccxt/base/candle_builder.h"
+#include "ccxt/base/datetime.h"
+#include "ccxt/base/errors.h"
+#include "ccxt/base/exchange.h"
+#include "ccxt/base/logger.h"
+#include <algorithm>
+
+namespace ccxt {
+
+namespace {
+
+long long windowStart(long long timestamp, long long duration) {
+    const long long offset = timestamp % duration;
+    return timestamp - (offset < 0 ? offset + duration : offset);
+}
+
+} // namespace
+
+CandleBuilder::CandleBuilder(std::vector<std::string> timeframes, OnClose onClose)
+    : timeframes_(std::move(timeframes)), onClose_(std::move(onClose)) {
+    for (const auto& timeframe : timeframes_) {
+        const std::optional<long long> duration = parseTimeframe(timeframe);
+        if (!duration) {
+            throw NotSupported("CandleBuilder does not support timeframe " + timeframe);
+        }
+        durations_.push_back(*duration);
+    }
+}
+
+int CandleBuilder::timeframeIndex(const std::string& timeframe) const {
+    auto it = std::find(timeframes_.begin(), timeframes_.end(), timeframe);
+    return it == timeframes_.end() ? -1 : static_cast<int>(it - timeframes_.begin());
+}
+
+CandleBuilder::SymbolId CandleBuilder::addSymbol(const std::string& symbol) {
+    auto [it, inserted] = ids_.emplace(symbol, static_cast<SymbolId>(symbols_.size()));
+    if (inserted) {
+        symbols_.push_back(symbol);
+        bars_.resize(symbols_.size() * durations_.size());
+    }
+    return it->second;
+}
+
+void CandleBuilder::update(SymbolId symbol, long long timestamp, double price, double amount) {
+    for (size_t t = 0; t < durations_.size(); ++t) {
+        Bar& current = bar(symbol, t);
+        const long long start = windowStart(timestamp, durations_[t]);
+        if (start < current.next || (current.open && start < current.candle.timestamp)) {
+            // Timeframes share the trade, so count it once
+            late_ += t == 0;
+            continue;
+        }
+        if (current.open && start != current.candle.timestamp) {
+            close(symbol, t, current);
+        }
+        if (!current.open) {
+            current.candle = {start, price, price, price, price, amount};
+            current.open = true;
+        } else {
+            OHLCV& candle = current.candle;
+            candle.high = std::max(candle.high, price);
+            candle.low = std::min(candle.low, price);
+            candle.close = price;
+            candle.volume += amount;
+        }
+    }
+}
+
+void CandleBuilder::close(SymbolId symbol, size_t timeframe, Bar& current) {
+    if (onClose_) {
+        onClose_(symbol, timeframe, current.candle);
+    }
+    current.open = false;
+    current.next = current.candle.timestamp + durations_[timeframe];
+}
+
+void CandleBuilder::update(const std::string& symbol, const Trade& trade) {
+    update(addSymbol(symbol), trade.timestamp, trade.price, trade.amount);
+}
+
+size_t CandleBuilder::drain(Subscription<Trade>& trades, const EventBus& bus) {
+    return trades.drain([this, &bus](const Event<Trade>& event) {
+        auto it = topics_.find(event.topic);
+        if (it == topics_.end()) {
+            it = topics_.emplace(event.topic, addSymbol(bus.topicName(event.topic))).first;
+        }
+        update(it->second, event.data.timestamp, event.data.price, event.data.amount);
+    });
+}
+
+void CandleBuilder::seed(SymbolId symbol, const std::string& timeframe, const std::vector<OHLCV>& history) {
+    const int t = timeframeIndex(timeframe);
+    if (t < 0 || history.empty()) {
+        return;
+    }
+    Bar& current = bar(symbol, static_cast<size_t>(t));
+    const OHLCV& last = history.back();
+    if (last.timestamp >= current.next && (!current.open || last.timestamp >= current.candle.timestamp)) {
+        current.candle = last;
+        current.open = true;
+        current.next = last.timestamp;
+    }
+}
+
+void CandleBuilder::seed(Exchange& exchange, const std::string& symbol, long long since) {
+    const SymbolId id = addSymbol(symbol);
+    const long long now = exchange.milliseconds();
+    for (const auto& timeframe : timeframes_) {
+        try {
+            auto history = exchange.backfillOHLCV({symbol}, timeframe, since, now);
+            seed(id, timeframe, history[symbol]);
+        } catch (const NotSupported&) {
+            // e.g. "1s" on a venue without second candles: built from trades only
+            CCXT_LOG_DEBUG(exchange.id << " has no " << timeframe << " candles to seed " << symbol);
+        }
+    }
+}
+
+bool CandleBuilder::current(SymbolId symbol, size_t timeframe, OHLCV& out) const {
+    const Bar& current = bars_.at(symbol * durations_.size() + timeframe);
+    if (!current.open) {
+        return false;
+    }
+    out = current.candle;
+    return true;
+}
+
+size_t CandleBuilder::flush(long long now) {
+    size_t closed = 0;
+    for (SymbolId symbol = 0; symbol < symbols_.size(); ++symbol) {
+        for (size_t t = 0; t < durations_.size(); ++t) {
+            Bar& current = bar(symbol, t);
+            if (current.open && current.candle.timestamp + durations_[t] <= now) {
+                close(symbol, t, current);
+                ++closed;
+            }
+        }
+    }
+    return closed;
+}
+
+} // namespace ccxt
@@ -0,0 +1,89 @@
+#include "ccxt/base/clock_sync.h"
+#include "ccxt/base/exchange.h"
+#include "ccxt/base/logger.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace ccxt {
+
+ClockSync::ClockSync(TimeSource source, OnOffset onOffset)
+    : ClockSync(std::move(source), std::move(onOffset), Options()) {}
+
+ClockSync::ClockSync(TimeSource source, OnOffset onOffset, Options options)
+    : source_(std::move(source)), onOffset_(std::move(onOffset)), options_(options) {}
+
+ClockSync::ClockSync(Exchange& exchange) : ClockSync(exchange, Options()) {}
+
+ClockSync::ClockSync(Exchange& exchange, Options options)
+    : ClockSync([&exchange]() { return exchange.fetchTime(); },
+                [&exchange](long long offset) { exchange.setClockOffset(offset); }, options) {}
+
+ClockSync::~ClockSync() {
+    stop();
+}
+
+bool ClockSync::sync() {
+    std::lock_guard<std::mutex> lock(syncMutex_);
+    double bestOffset = 0;
+    long long bestRoundTrip = std::numeric_limits<long long>::max();
+    for (int i = 0; i < std::max(options_.samples, 1); ++i) {
+        const auto sent = std::chrono::system_clock::now();
+        const auto started = std::chrono::steady_clock::now();
+        long long server;
+        try {
+            server = source_();
+        } catch (const std::exception& e) {
+            CCXT_LOG_WARN("clock sync sample failed: " << e.what());
+            continue;
+        }
+        const long long roundTrip =
+            std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - started).count();
+        if (roundTrip < bestRoundTrip) {
+            const double midpoint =
+                std::chrono::duration<double, std::milli>(sent.time_since_epoch()).count() + roundTrip / 2000.0;
+            bestOffset = static_cast<double>(server) - midpoint;
+            bestRoundTrip = roundTrip;
+        }
+    }
+    if (bestRoundTrip == std::numeric_limits<long long>::max()) {
+        return false;
+    }
+    smoothed_ = rounds_.load(std::memory_order_relaxed) == 0
+                    ? bestOffset
+                    : smoothed_ + options_.smoothing * (bestOffset - smoothed_);
+    const long long offset = std::llround(smoothed_);
+    offset_.store(offset, std::memory_order_relaxed);
+    roundTrip_.store(bestRoundTrip, std::memory_order_relaxed);
+    rounds_.fetch_add(1, std::memory_order_relaxed);
+    if (onOffset_) {
+        onOffset_(offset);
+    }
+    CCXT_LOG_DEBUG("clock offset " << offset << " ms, round trip " << bestRoundTrip << " us");
+    return true;
+}
+
+void ClockSync::start() {
+    if (running_.exchange(true)) {
+        return;
+    }
+    thread_ = std::thread([this]() {
+        while (running_.load(std::memory_order_relaxed)) {
+            sync();
+            // Short sleeps so stop() doesn't wait out a whole interval
+            const auto next = std::chrono::steady_clock::now() + options_.interval;
+            while (running_.load(std::memory_order_relaxed) && std::chrono::steady_clock::now() < next) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(10));
+            }
+        }
+    });
+}
+
+void ClockSync::stop() {
+    running_ = false;
+    if (thread_.joinable()) {
+        thread_.join();
+    }
+}
+
+} // namespace ccxt
@@ -0,0 +1,18 @@
+#include "ccxt/base/config.h"
+#include <fstream>
+
+namespace ccxt {
+
+void Config::loadRest(const std::string& filename)
+{
+    std::ifstream file(filename);
+    json_rest = json::parse(file);
+}
+
+void Config::loadWs(const std::string& filename)
+{
+    std::ifstream file(filename);
+    json_ws = json::parse(file);
+}
+
+} // namespace ccxt
@@ -0,0 +1,209 @@
+#include "ccxt/base/datetime.h"
+#include <cstring>
+
+namespace ccxt {
+
+namespace {
+
+constexpr long long kMillisecondsPerDay = 86400000LL;
+
+struct CivilDate {
+    int year;
+    unsigned month;
+    unsigned day;
+};
+
+// http://howardhinnant.github.io/date_algorithms.html
+CivilDate civilFromDays(long long days) {
+    days += 719468;
+    const long long era = (days >= 0 ? days : days - 146096) / 146097;
+    const unsigned doe = static_cast<unsigned>(days - era * 146097);
+    const unsigned yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;
+    const unsigned doy = doe - (365 * yoe + yoe / 4 - yoe / 100);
+    const unsigned mp = (5 * doy + 2) / 153;
+    const unsigned day = doy - (153 * mp + 2) / 5 + 1;
+    const unsigned month = mp < 10 ? mp + 3 : mp - 9;
+    const long long year = static_cast<long long>(yoe) + era * 400 + (month <= 2);
+    return {static_cast<int>(year), month, day};
+}
+
+inline void write2(char* out, unsigned value) {
+    out[0] = static_cast<char>('0' + value / 10);
+    out[1] = static_cast<char>('0' + value % 10);
+}
+
+inline void write4(char* out, unsigned value) {
+    write2(out, value / 100);
+    write2(out + 2, value % 100);
+}
+
+inline bool digits(std::string_view s, size_t pos, size_t count, unsigned& value) {
+    if (pos + count > s.size()) {
+        return false;
+    }
+    value = 0;
+    for (size_t i = pos; i < pos + count; ++i) {
+        unsigned d = static_cast<unsigned char>(s[i]) - '0';
+        if (d > 9) {
+            return false;
+        }
+        value = value * 10 + d;
+    }
+    return true;
+}
+
+struct SecondCache {
+    long long second = -1;
+    char prefix[19];  // "YYYY-MM-DDTHH:MM:SS"
+};
+
+thread_local SecondCache secondCache;
+
+} // namespace
+
+long long daysFromCivil(int year, unsigned month, unsigned day) {
+    year -= month <= 2;
+    const long long era = (year >= 0 ? year : year - 399) / 400;
+    const unsigned yoe = static_cast<unsigned>(year - era * 400);
+    const unsigned doy = (153 * (month > 2 ? month - 3 : month + 9) + 2) / 5 + day - 1;
+    const unsigned doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+    return era * 146097 + static_cast<long long>(doe) - 719468;
+}
+
+size_t formatIso8601(long long timestamp, char* out) {
+    long long second = timestamp >= 0 ? timestamp / 1000 : (timestamp - 999) / 1000;
+    unsigned millis = static_cast<unsigned>(timestamp - second * 1000);
+
+    SecondCache& cache = secondCache;
+    if (cache.second != second) {
+        long long days = second >= 0 ? second / 86400 : (second - 86399) / 86400;
+        unsigned secondOfDay = static_cast<unsigned>(second - days * 86400);
+        CivilDate date = civilFromDays(days);
+        char* p = cache.prefix;
+        write4(p, static_cast<unsigned>(date.year) % 10000);
+        p[4] = '-';
+        write2(p + 5, date.month);
+        p[7] = '-';
+        write2(p + 8, date.day);
+        p[10] = 'T';
+        write2(p + 11, secondOfDay / 3600);
+        p[13] = ':';
+        write2(p + 14, secondOfDay / 60 % 60);
+        p[16] = ':';
+        write2(p + 17, secondOfDay % 60);
+        cache.second = second;
+    }
+    std::memcpy(out, cache.prefix, sizeof(cache.prefix));
+    out[19] = '.';
+    out[20] = static_cast<char>('0' + millis / 100);
+    write2(out + 21, millis % 100);
+    out[23] = 'Z';
+    return kIso8601Length;
+}
+
+std::string formatIso8601(long long timestamp) {
+    char buffer[kIso8601Length];
+    return std::string(buffer, formatIso8601(timestamp, buffer));
+}
+
+std::optional<long long> parseIso8601(std::string_view s) {
+    unsigned year, month, day, hour = 0, minute = 0, second = 0, millis = 0;
+    if (!digits(s, 0, 4, year) || s.size() < 10 || s[4] != '-' || !digits(s, 5, 2, month)
+        || s[7] != '-' || !digits(s, 8, 2, day) || month < 1 || month > 12 || day < 1 || day > 31) {
+        return std::nullopt;
+    }
+    size_t pos = 10;
+    if (pos < s.size() && (s[pos] == 'T' || s[pos] == ' ')) {
+        if (!digits(s, pos + 1, 2, hour) || pos + 3 >= s.size() || s[pos + 3] != ':'
+            || !digits(s, pos + 4, 2, minute)) {
+            return std::nullopt;
+        }
+        pos += 6;
+        if (pos < s.size() && s[pos] == ':') {
+            if (!digits(s, pos + 1, 2, second)) {
+                return std::nullopt;
+            }
+            pos += 3;
+            if (pos < s.size() && (s[pos] == '.' || s[pos] == ',')) {
+                size_t start = ++pos;
+                unsigned scale = 100;
+                while (pos < s.size() && static_cast<unsigned>(static_cast<unsigned char>(s[pos]) - '0') <= 9) {
+                    millis += (s[pos] - '0') * scale;
+                    scale /= 10;
+                    ++pos;
+                }
+                if (pos == start) {
+                    return std::nullopt;
+                }
+            }
+        }
+        if (hour > 23 || minute > 59 || second > 60) {
+            return std::nullopt;
+        }
+    }
+
+    long long offsetMinutes = 0;
+    if (pos < s.size()) {
+        char sign = s[pos];
+        if (sign == 'Z' || sign == 'z') {
+            ++pos;
+        } else if (sign == '+' || sign == '-') {
+            unsigned offsetHours, offsetMins = 0;
+            if (!digits(s, pos + 1, 2, offsetHours)) {
+                return std::nullopt;
+            }
+            pos += 3;
+            if (pos < s.size() && s[pos] == ':') {
+                ++pos;
+            }
+            if (pos < s.size()) {
+                if (!digits(s, pos, 2, offsetMins)) {
+                    return std::nullopt;
+                }
+                pos += 2;
+            }
+            offsetMinutes = static_cast<long long>(offsetHours * 60 + offsetMins);
+            if (sign == '-') {
+                offsetMinutes = -offsetMinutes;
+            }
+        }
+        if (pos != s.size()) {
+            return std::nullopt;
+        }
+    }
+
+    long long days = daysFromCivil(static_cast<int>(year), month, day);
+    long long seconds = static_cast<long long>(hour) * 3600 + minute * 60 + second - offsetMinutes * 60;
+    return days * kMillisecondsPerDay + seconds * 1000 + millis;
+}
+
+std::optional<long long> parseTimeframe(std::string_view timeframe) {
+    if (timeframe.size() < 2) {
+        return std::nullopt;
+    }
+    long long amount = 0;
+    for (size_t i = 0; i + 1 < timeframe.size(); ++i) {
+        const char c = timeframe[i];
+        if (c < '0' || c > '9' || amount > 1000000) {
+            return std::nullopt;
+        }
+        amount = amount * 10 + (c - '0');
+    }
+    long long unit;
+    switch (timeframe.back()) {
+        case 's': unit = 1000; break;
+        case 'm': unit = 60 * 1000; break;
+        case 'h': unit = 3600 * 1000; break;
+        case 'd': unit = kMillisecondsPerDay; break;
+        case 'w': unit = 7 * kMillisecondsPerDay; break;
+        case 'M': unit = 30 * kMillisecondsPerDay; break;
+        case 'y': unit = 365 * kMillisecondsPerDay; break;
+        default: return std::nullopt;
+    }
+    if (amount == 0) {
+        return std::nullopt;
+    }
+    return amount * unit;
+}
+
+} // namespace ccxt
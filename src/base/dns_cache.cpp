@@ -0,0 +1,166 @@
+#include "ccxt/base/dns_cache.h"
+#include "ccxt/base/errors.h"
+#include <algorithm>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/ip/tcp.hpp>
+#include <boost/asio/post.hpp>
+
+namespace ccxt {
+
+namespace {
+
+std::string cacheKey(const std::string& host, const std::string& port) {
+    return host + ':' + port;
+}
+
+DnsCache::Addresses order(const boost::asio::ip::tcp::resolver::results_type& results) {
+    DnsCache::Addresses first;
+    DnsCache::Addresses second;
+    bool firstV6 = false;
+    for (const auto& entry : results) {
+        const boost::asio::ip::address address = entry.endpoint().address();
+        if (first.empty()) {
+            firstV6 = address.is_v6();
+        }
+        const std::string text = address.to_string();
+        auto& family = address.is_v6() == firstV6 ? first : second;
+        // getaddrinfo repeats addresses once per socket type
+        if (std::find(family.begin(), family.end(), text) == family.end()) {
+            family.push_back(text);
+        }
+    }
+    DnsCache::Addresses result;
+    for (size_t i = 0; i < std::max(first.size(), second.size()); ++i) {
+        if (i < first.size()) {
+            result.push_back(first[i]);
+        }
+        if (i < second.size()) {
+            result.push_back(second[i]);
+        }
+    }
+    return result;
+}
+
+} // namespace
+
+struct DnsCache::Impl {
+    struct Entry {
+        Addresses addresses;
+        std::chrono::steady_clock::time_point expires;
+    };
+    struct Waiter {
+        boost::asio::io_context* ioc;
+        Handler handler;
+    };
+
+    mutable std::shared_mutex mutex_;
+    std::unordered_map<std::string, Entry> entries_;
+    std::mutex inflightMutex_;
+    std::unordered_map<std::string, std::vector<Waiter>> inflight_;
+    // Only for blocking lookups, which don't need it running
+    boost::asio::io_context context_;
+};
+
+DnsCache::DnsCache() : DnsCache(Options()) {}
+
+DnsCache::DnsCache(Options options) : options_(options), impl_(std::make_unique<Impl>()) {}
+
+DnsCache::~DnsCache() = default;
+
+DnsCache& DnsCache::shared() {
+    static DnsCache cache;
+    return cache;
+}
+
+std::optional<DnsCache::Addresses> DnsCache::cached(const std::string& host, const std::string& port) const {
+    std::shared_lock<std::shared_mutex> lock(impl_->mutex_);
+    auto it = impl_->entries_.find(cacheKey(host, port));
+    if (it == impl_->entries_.end() || it->second.expires <= std::chrono::steady_clock::now()) {
+        return std::nullopt;
+    }
+    return it->second.addresses;
+}
+
+void DnsCache::store(const std::string& key, const Addresses& addresses) {
+    std::unique_lock<std::shared_mutex> lock(impl_->mutex_);
+    impl_->entries_[key] = {addresses, std::chrono::steady_clock::now() + options_.ttl};
+}
+
+DnsCache::Addresses DnsCache::resolve(const std::string& host, const std::string& port) {
+    if (auto addresses = cached(host, port)) {
+        hits_.fetch_add(1, std::memory_order_relaxed);
+        return *addresses;
+    }
+    misses_.fetch_add(1, std::memory_order_relaxed);
+    boost::asio::ip::tcp::resolver resolver(impl_->context_);
+    boost::system::error_code ec;
+    const auto results = resolver.resolve(host, port, ec);
+    if (ec || results.empty()) {
+        throw NetworkError("cannot resolve " + host + ": " + (ec ? ec.message() : "no addresses"));
+    }
+    Addresses addresses = order(results);
+    store(cacheKey(host, port), addresses);
+    return addresses;
+}
+
+void DnsCache::asyncResolve(boost::asio::io_context& ioc, const std::string& host, const std::string& port,
+                            Handler handler) {
+    if (auto addresses = cached(host, port)) {
+        hits_.fetch_add(1, std::memory_order_relaxed);
+        boost::asio::post(ioc, [handler = std::move(handler), addresses = std::move(*addresses)]() {
+            handler(addresses, nullptr);
+        });
+        return;
+    }
+    misses_.fetch_add(1, std::memory_order_relaxed);
+    const std::string key = cacheKey(host, port);
+    {
+        std::lock_guard<std::mutex> lock(impl_->inflightMutex_);
+        auto [it, first] = impl_->inflight_.try_emplace(key);
+        it->second.push_back({&ioc, std::move(handler)});
+        if (!first) {
+            return;
+        }
+    }
+    auto resolver = std::make_shared<boost::asio::ip::tcp::resolver>(ioc);
+    resolver->async_resolve(host, port,
+        [this, key, host, resolver](const boost::system::error_code& ec,
+                                    boost::asio::ip::tcp::resolver::results_type results) {
+            Addresses addresses;
+            std::exception_ptr error;
+            if (ec || results.empty()) {
+                error = std::make_exception_ptr(
+                    NetworkError("cannot resolve " + host + ": " + (ec ? ec.message() : "no addresses")));
+            } else {
+                addresses = order(results);
+                store(key, addresses);
+            }
+            std::vector<Impl::Waiter> waiters;
+            {
+                std::lock_guard<std::mutex> lock(impl_->inflightMutex_);
+                auto it = impl_->inflight_.find(key);
+                waiters = std::move(it->second);
+                impl_->inflight_.erase(it);
+            }
+            for (auto& waiter : waiters) {
+                boost::asio::post(*waiter.ioc, [handler = std::move(waiter.handler), addresses, error]() {
+                    handler(addresses, error);
+                });
+            }
+        });
+}
+
+void DnsCache::clear() {
+    std::unique_lock<std::shared_mutex> lock(impl_->mutex_);
+    impl_->entries_.clear();
+}
+
+size_t DnsCache::size() const {
+    std::shared_lock<std::shared_mutex> lock(impl_->mutex_);
+    return impl_->entries_.size();
+}
+
+} // namespace ccxt
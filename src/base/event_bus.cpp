@@ -0,0 +1,34 @@
+#include "ccxt/base/event_bus.h"
+#include <chrono>
+#include <mutex>
+
+namespace ccxt {
+
+TopicId EventBus::topic(std::string_view name) {
+    const std::string key(name);
+    {
+        std::shared_lock<std::shared_mutex> lock(topicsMutex_);
+        auto it = topics_.find(key);
+        if (it != topics_.end()) {
+            return it->second;
+        }
+    }
+    std::unique_lock<std::shared_mutex> lock(topicsMutex_);
+    auto [it, inserted] = topics_.emplace(key, static_cast<TopicId>(names_.size() + 1));
+    if (inserted) {
+        names_.push_back(key);
+    }
+    return it->second;
+}
+
+std::string EventBus::topicName(TopicId id) const {
+    std::shared_lock<std::shared_mutex> lock(topicsMutex_);
+    return id == 0 || id > names_.size() ? std::string() : names_[id - 1];
+}
+
+uint64_t EventBus::now() {
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count());
+}
+
+} // namespace ccxt
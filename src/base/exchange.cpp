@@ -1,23 +1,37 @@
 #include "ccxt/base/exchange.h"
+#include "ccxt/base/backfill.h"
 #include "ccxt/base/errors.h"
+#include "ccxt/base/event_bus.h"
+#include "ccxt/base/hedging.h"
+#include "ccxt/base/order_tracker.h"
+#include "ccxt/base/path_template.h"
+#include "ccxt/base/request_metrics.h"
+#include "ccxt/base/query_builder.h"
+#include "ccxt/base/datetime.h"
+#include "ccxt/base/dns_cache.h"
+#include "ccxt/base/executor.h"
+#include "ccxt/base/market_store.h"
+#include "ccxt/base/logger.h"
+#include <algorithm>
+#include <atomic>
 #include <chrono>
 #include <random>
 #include <sstream>
 #include <iomanip>
-#include <regex>
-#include <openssl/hmac.h>
-#include <openssl/sha.h>
+#include <mutex>
+#include <shared_mutex>
 #include <curl/curl.h>
-#include <iostream>
 #include <map>
 #include <string>
 #include <vector>
 #include <optional>
 #include <stdexcept>
+#include <functional>
 #include <future>
 #include <boost/beast/version.hpp>
 #include <boost/beast/core.hpp>
 #include <boost/beast/http.hpp>
+#include <boost/asio/io_context.hpp>
 #include <boost/asio/ip/tcp.hpp>
 #include <boost/asio/ssl/error.hpp>
 #include <boost/asio/ssl/stream.hpp>
@@ -26,15 +40,31 @@
 
 namespace ccxt {
 
-Exchange::Exchange(boost::asio::io_context& context, const Config& config) : ExchangeBase(context, config) {
+Exchange::Exchange(boost::asio::io_context& context, const Config& config)
+    : ExchangeBase(context, config),
+      pathTemplates_(std::make_unique<std::unordered_map<std::string, PathTemplate>>()),
+      metrics_(std::make_unique<RequestMetrics>()) {
     rateLimit= 2000;
+    // Off until an adapter states its own rateLimit (Binance reads both from
+    // its descriptor); the 2000 ms placeholder would throttle everything else
+    enableRateLimit = false;
+    maxOHLCVLimit = 1000;
     pro = false;
     certified = false;
     lastRestRequestTimestamp = 0;
-    curl_ = curl_easy_init();
+    events_ = std::make_shared<EventBus>();
+    orders_ = std::make_shared<OrderTracker>();
+    // curl_global_init isn't thread-safe, run it once before any handle exists
+    static const CURLcode curlGlobal = curl_global_init(CURL_GLOBAL_DEFAULT);
+    (void)curlGlobal;
+    if (!config_.secret.empty()) {
+        signer_.reset(config_.secret);
+    }
     init();
 }
 
+Exchange::~Exchange() = default;
+
 void Exchange::init() {
     // Default implementation
 }
@@ -47,11 +77,13 @@ AsyncPullType Exchange::performHttpRequest(const std::string& host, const std::s
             return AsyncPullType(
             [this, host, target, method](boost::coroutines2::coroutine<json>::push_type& yield) {
                 try {
-                    boost::asio::ip::tcp::resolver resolver(context_);
                     boost::beast::tcp_stream stream(context_);
 
-                    auto const results = resolver.resolve(host, "443");
-                    stream.connect(results);
+                    std::vector<boost::asio::ip::tcp::endpoint> endpoints;
+                    for (const auto& address : DnsCache::shared().resolve(host, "443")) {
+                        endpoints.emplace_back(boost::asio::ip::make_address(address), 443);
+                    }
+                    stream.connect(endpoints);
 
                     boost::beast::http::request<boost::beast::http::string_body> req{
                         boost::beast::http::string_to_verb(method), target, 11};
@@ -84,260 +116,377 @@ AsyncPullType Exchange::performHttpRequest(const std::string& host, const std::s
            
 }
 
-// Synchronous REST API methods
+namespace {
+
+// The public API takes 0 for "not given", the *Impl methods take nullopt
+template <typename T>
+std::optional<T> given(T value) {
+    return value > 0 ? std::optional<T>(value) : std::nullopt;
+}
+
+} // namespace
+
+// Synchronous REST API methods: the adapter's *Impl
 json Exchange::fetchMarkets(const json& params) {
-    return json::object();
+    return fetchMarketsImpl();
 }
 
 json Exchange::fetchTicker(const std::string& symbol, const json& params) {
-    return json::object();
+    return fetchTickerImpl(symbol);
 }
 
 json Exchange::fetchTickers(const std::vector<std::string>& symbols, const json& params) {
-    return json::object();
+    return fetchTickersImpl(symbols);
 }
 
 json Exchange::fetchOrderBook(const std::string& symbol, int limit, const json& params) {
-    return json::object();
+    return fetchOrderBookImpl(symbol, given(limit));
 }
 
 json Exchange::fetchTrades(const std::string& symbol, int since, int limit, const json& params) {
-    return json::object();
+    return fetchTradesImpl(symbol, given<long long>(since), given(limit));
 }
 
 json Exchange::fetchOHLCV(const std::string& symbol, const std::string& timeframe,
-                         int since, int limit, const json& params) {
-    return json::object();
+                         long long since, int limit, const json& params) {
+    if (!store_) {
+        return fetchOHLCVImpl(symbol, timeframe, given(since), given(limit));
+    }
+    const std::optional<long long> duration = parseTimeframe(timeframe);
+    if (!duration) {
+        throw NotSupported(id + " fetchOHLCV() does not support timeframe " + timeframe);
+    }
+    // Only closed candles are stored; the one still forming starts at closedUntil
+    const long long closedUntil = milliseconds() / *duration * *duration;
+    const long long count = limit > 0 ? limit : maxOHLCVLimit;
+    const long long start = since > 0 ? since : closedUntil - count * *duration;
+    const long long requestedEnd = start + count * *duration;
+    const long long end = std::min(requestedEnd, closedUntil);
+
+    std::vector<OHLCV> candles;
+    OHLCVSeries& series = store_->ohlcv(id, symbol, timeframe);
+    const std::optional<long long> first = series.firstTimestamp();
+    if (first && start < *first) {
+        // The store is append-only, so history before it is fetched uncached
+        candles = std::move(backfillOHLCV({symbol}, timeframe, start, end)[symbol]);
+    } else {
+        const std::optional<long long> last = series.lastTimestamp();
+        const long long missing = last ? *last + *duration : start;
+        if (missing < end) {
+            BackfillOptions options;
+            options.onCandles = [&series](const std::string&, const std::vector<OHLCV>& page) {
+                series.append(page);
+            };
+            backfillOHLCV({symbol}, timeframe, missing, closedUntil, options);
+        }
+        candles = series.read(start, end);
+    }
+    // A range reaching past closedUntil also gets the forming candle, fetched
+    // live and never stored since it still changes
+    if (requestedEnd > closedUntil && static_cast<long long>(candles.size()) < count) {
+        for (const auto& candle : OHLCVBackfill::parseCandles(fetchOHLCVImpl(symbol, timeframe, closedUntil, 1))) {
+            if (candle.timestamp >= closedUntil && candle.timestamp < requestedEnd) {
+                candles.push_back(candle);
+            }
+        }
+    }
+
+    json result = json::array();
+    for (const auto& candle : candles) {
+        result.push_back({candle.timestamp, candle.open, candle.high, candle.low, candle.close, candle.volume});
+    }
+    return result;
+}
+
+std::map<std::string, std::vector<OHLCV>> Exchange::backfillOHLCV(const std::vector<std::string>& symbols,
+                                                                  const std::string& timeframe,
+                                                                  long long since, long long until) {
+    return backfillOHLCV(symbols, timeframe, since, until, BackfillOptions());
+}
+
+std::map<std::string, std::vector<OHLCV>> Exchange::backfillOHLCV(const std::vector<std::string>& symbols,
+                                                                  const std::string& timeframe,
+                                                                  long long since, long long until,
+                                                                  const BackfillOptions& requested) {
+    BackfillOptions options = requested;
+    if (!timeframes.empty() && timeframes.find(timeframe) == timeframes.end()) {
+        throw NotSupported(id + " backfillOHLCV() does not support timeframe " + timeframe);
+    }
+    if (maxOHLCVLimit > 0) {
+        options.limit = std::min(options.limit, maxOHLCVLimit);
+    }
+    OHLCVBackfill backfill([this](const std::string& symbol, const std::string& frame, long long start, int limit) {
+        return OHLCVBackfill::parseCandles(fetchOHLCVImpl(symbol, frame, start, limit));
+    }, std::move(options));
+    return backfill.run(symbols, timeframe, since, until);
+}
+
+void Exchange::setStore(std::shared_ptr<MarketStore> store) {
+    store_ = std::move(store);
+}
+
+void Exchange::setEventBus(std::shared_ptr<EventBus> bus) {
+    std::atomic_store(&events_, bus ? std::move(bus) : std::make_shared<EventBus>());
+}
+
+long long Exchange::fetchTime() {
+    const json response = fetchTimeImpl();
+    if (response.is_number()) {
+        return response.get<long long>();
+    }
+    if (response.is_object() && response.contains("serverTime") && response["serverTime"].is_number()) {
+        return response["serverTime"].get<long long>();
+    }
+    throw BadResponse(id + " fetchTime returned " + response.dump());
+}
+
+size_t Exchange::reconcileOrders(const std::string& symbol) {
+    // Compared with the venue's update times, so on the server's clock
+    const long long asOf = serverMilliseconds();
+    const json response = fetchOpenOrdersImpl(symbol);
+    if (!response.is_array()) {
+        CCXT_LOG_WARN(id << " fetchOpenOrders returned no list, orders not reconciled");
+        return 0;
+    }
+    std::vector<Order> open;
+    open.reserve(response.size());
+    for (const auto& order : response) {
+        open.push_back(OrderTracker::fromJson(order));
+    }
+    size_t applied = open.size();
+    for (const auto& orderId : orders_->reconcile(open, symbol, asOf)) {
+        const std::optional<Order> known = orders_->byId(orderId);
+        try {
+            orders_->apply(OrderTracker::fromJson(fetchOrderImpl(orderId, known ? known->symbol : symbol)),
+                           serverMilliseconds());
+            ++applied;
+        } catch (const std::exception& e) {
+            CCXT_LOG_WARN(id << " could not fetch order " << orderId << ": " << e.what());
+        }
+    }
+    return applied;
+}
+
+void Exchange::setHedging(HedgingPolicy policy) {
+    std::atomic_store(&hedging_, policy.hosts.empty() ? nullptr : std::make_shared<HedgedHosts>(std::move(policy)));
+}
+
+std::map<std::string, HistogramSummary> Exchange::hostLatency() const {
+    const std::shared_ptr<HedgedHosts> hedging = std::atomic_load(&hedging_);
+    return hedging ? hedging->latency() : std::map<std::string, HistogramSummary>();
+}
+
+MetricsSnapshot Exchange::metrics() const {
+    MetricsSnapshot result = metrics_->snapshot();
+    result.exchange = id;
+    return result;
 }
 
 json Exchange::fetchBalance(const json& params) {
-    return json::object();
+    return fetchBalanceImpl();
 }
 
 json Exchange::createOrder(const std::string& symbol, const std::string& type, const std::string& side,
                          double amount, double price, const json& params) {
-    return json::object();
+    return createOrderImpl(symbol, type, side, amount, given(price));
 }
 
 json Exchange::cancelOrder(const std::string& id, const std::string& symbol, const json& params) {
-    return json::object();
+    return cancelOrderImpl(id, symbol);
 }
 
 json Exchange::fetchOrder(const std::string& id, const std::string& symbol, const json& params) {
-    return json::object();
+    return fetchOrderImpl(id, symbol);
+}
+
+namespace {
+
+// Single requests in flight at once when a venue has no batch endpoint;
+// the RateLimiter still spaces them
+constexpr size_t kBatchConcurrency = 5;
+
+// Shared with the submitted workers, which may start after runBatch()
+// returned and must then find no work left
+struct BatchRun {
+    std::function<json(size_t)> task;
+    std::function<json(size_t, const std::string&)> onError;
+    std::vector<json> results;
+    std::atomic<size_t> next{0};
+    std::mutex mutex;
+    size_t finished = 0;
+    std::promise<void> allFinished;
+
+    void work() {
+        for (;;) {
+            const size_t index = next.fetch_add(1, std::memory_order_relaxed);
+            if (index >= results.size()) {
+                return;
+            }
+            json result;
+            try {
+                result = task(index);
+            } catch (const std::exception& e) {
+                result = onError(index, e.what());
+            }
+            std::lock_guard<std::mutex> lock(mutex);
+            results[index] = std::move(result);
+            if (++finished == results.size()) {
+                allFinished.set_value();
+            }
+        }
+    }
+};
+
+// Runs task(i) for every i on Executor::shared(), the calling thread
+// included, and returns the results in input order
+json runBatch(size_t count, std::function<json(size_t)> task,
+              std::function<json(size_t, const std::string&)> onError) {
+    json result = json::array();
+    if (count == 0) {
+        return result;
+    }
+    auto state = std::make_shared<BatchRun>();
+    state->task = std::move(task);
+    state->onError = std::move(onError);
+    state->results.resize(count);
+    std::future<void> finished = state->allFinished.get_future();
+    for (size_t i = 1; i < std::min(count, kBatchConcurrency); ++i) {
+        Executor::shared().post([state]() { state->work(); });
+    }
+    state->work();
+    finished.wait();
+    std::lock_guard<std::mutex> lock(state->mutex);
+    for (auto& entry : state->results) {
+        result.push_back(std::move(entry));
+    }
+    return result;
+}
+
+} // namespace
+
+json Exchange::createOrders(const std::vector<OrderRequest>& orders) {
+    return createOrdersImpl(orders);
+}
+
+json Exchange::cancelOrders(const std::vector<std::string>& ids, const std::string& symbol) {
+    return cancelOrdersImpl(ids, symbol);
+}
+
+json Exchange::editOrders(const std::vector<OrderRequest>& orders) {
+    return editOrdersImpl(orders);
+}
+
+json Exchange::createOrdersImpl(const std::vector<OrderRequest>& orders) {
+    return runBatch(
+        orders.size(),
+        [this, &orders](size_t i) {
+            const OrderRequest& order = orders[i];
+            return createOrderImpl(order.symbol, order.type, order.side, order.amount, order.price);
+        },
+        [&orders](size_t i, const std::string& error) { return rejectedOrder("", orders[i].symbol, error); });
+}
+
+json Exchange::cancelOrdersImpl(const std::vector<std::string>& ids, const std::string& symbol) {
+    return runBatch(
+        ids.size(), [this, &ids, &symbol](size_t i) { return cancelOrderImpl(ids[i], symbol); },
+        [&ids, &symbol](size_t i, const std::string& error) { return rejectedOrder(ids[i], symbol, error); });
+}
+
+json Exchange::editOrdersImpl(const std::vector<OrderRequest>& orders) {
+    return runBatch(
+        orders.size(),
+        [this, &orders](size_t i) {
+            const OrderRequest& order = orders[i];
+            return editOrderImpl(order.id, order.symbol, order.type, order.side, order.amount, order.price);
+        },
+        [&orders](size_t i, const std::string& error) {
+            return rejectedOrder(orders[i].id, orders[i].symbol, error);
+        });
+}
+
+json Exchange::rejectedOrder(const std::string& id, const std::string& symbol, const std::string& error) {
+    return {{"id", id}, {"symbol", symbol}, {"status", "rejected"}, {"error", error}};
 }
 
 json Exchange::fetchOrders(const std::string& symbol, int since, int limit, const json& params) {
-    return json::object();
+    return fetchOrdersImpl(symbol, given<long long>(since), given(limit));
 }
 
 json Exchange::fetchOpenOrders(const std::string& symbol, int since, int limit, const json& params) {
-    return json::object();
+    return fetchOpenOrdersImpl(symbol, given<long long>(since), given(limit));
 }
 
 json Exchange::fetchClosedOrders(const std::string& symbol, int since, int limit, const json& params) {
-    return json::object();
+    return fetchClosedOrdersImpl(symbol, given<long long>(since), given(limit));
 }
 
-// Asynchronous REST API methods
-AsyncPullType Exchange::fetchMarketsAsync(const json& params) {
-    return AsyncPullType(
-        [this](boost::coroutines2::coroutine<json>::push_type& yield) {
-            try {
-                // Call the synchronous fetchOrder method
-                
-                yield(json::object()); // Yield the result to the caller
-            } catch (const std::exception& e) {
-                // Handle exceptions and yield an error response if needed
-                throw; // or yield an error response
-            }
-        });
+// Asynchronous REST API methods: the synchronous call on Executor::shared()
+std::future<json> Exchange::fetchMarketsAsync(const json& params) {
+    return Executor::shared().submit([this, params]() { return fetchMarkets(params); });
 }
 
-AsyncPullType Exchange::fetchTickerAsync(const std::string& symbol, const json& params) {
-    return AsyncPullType(
-        [this, symbol, params](boost::coroutines2::coroutine<json>::push_type& yield) {
-            try {
-                // Call the synchronous fetchOrder method
-                
-                yield(json::object()); // Yield the result to the caller
-            } catch (const std::exception& e) {
-                // Handle exceptions and yield an error response if needed
-                throw; // or yield an error response
-            }
-        });
+std::future<json> Exchange::fetchTickerAsync(const std::string& symbol, const json& params) {
+    return Executor::shared().submit([this, symbol, params]() { return fetchTicker(symbol, params); });
 }
 
-AsyncPullType Exchange::fetchTickersAsync(const std::vector<std::string>& symbols, const json& params) {
-    return AsyncPullType(
-        [this](boost::coroutines2::coroutine<json>::push_type& yield) {
-            try {
-                // Call the synchronous fetchOrder method
-                
-                yield(json::object()); // Yield the result to the caller
-            } catch (const std::exception& e) {
-                // Handle exceptions and yield an error response if needed
-                throw; // or yield an error response
-            }
-        });
+std::future<json> Exchange::fetchTickersAsync(const std::vector<std::string>& symbols, const json& params) {
+    return Executor::shared().submit([this, symbols, params]() { return fetchTickers(symbols, params); });
 }
 
-AsyncPullType Exchange::fetchOrderBookAsync(const std::string& symbol, int limit, const json& params) {
-    return AsyncPullType(
-        [this](boost::coroutines2::coroutine<json>::push_type& yield) {
-            try {
-                // Call the synchronous fetchOrder method
-                
-                yield(json::object()); // Yield the result to the caller
-            } catch (const std::exception& e) {
-                // Handle exceptions and yield an error response if needed
-                throw; // or yield an error response
-            }
-        });
+std::future<json> Exchange::fetchOrderBookAsync(const std::string& symbol, int limit, const json& params) {
+    return Executor::shared().submit([this, symbol, limit, params]() { return fetchOrderBook(symbol, limit, params); });
 }
 
-AsyncPullType Exchange::fetchTradesAsync(const std::string& symbol, int since, int limit, const json& params) {
-    return AsyncPullType(
-        [this](boost::coroutines2::coroutine<json>::push_type& yield) {
-            try {
-                // Call the synchronous fetchOrder method
-                
-                yield(json::object()); // Yield the result to the caller
-            } catch (const std::exception& e) {
-                // Handle exceptions and yield an error response if needed
-                throw; // or yield an error response
-            }
-        });
+std::future<json> Exchange::fetchTradesAsync(const std::string& symbol, int since, int limit, const json& params) {
+    return Executor::shared().submit(
+        [this, symbol, since, limit, params]() { return fetchTrades(symbol, since, limit, params); });
 }
 
-AsyncPullType Exchange::fetchOHLCVAsync(const std::string& symbol, const std::string& timeframe,
-                                         int since, int limit, const json& params) {
-    return AsyncPullType(
-        [this](boost::coroutines2::coroutine<json>::push_type& yield) {
-            try {
-                // Call the synchronous fetchOrder method
-                
-                yield(json::object()); // Yield the result to the caller
-            } catch (const std::exception& e) {
-                // Handle exceptions and yield an error response if needed
-                throw; // or yield an error response
-            }
-        });
+std::future<json> Exchange::fetchOHLCVAsync(const std::string& symbol, const std::string& timeframe,
+                                            long long since, int limit, const json& params) {
+    return Executor::shared().submit([this, symbol, timeframe, since, limit, params]() {
+        return fetchOHLCV(symbol, timeframe, since, limit, params);
+    });
 }
 
-AsyncPullType Exchange::fetchBalanceAsync(const json& params) {
-    return AsyncPullType(
-        [this](boost::coroutines2::coroutine<json>::push_type& yield) {
-            try {
-                // Call the synchronous fetchOrder method
-                
-                yield(json::object()); // Yield the result to the caller
-            } catch (const std::exception& e) {
-                // Handle exceptions and yield an error response if needed
-                throw; // or yield an error response
-            }
-        });
+std::future<json> Exchange::fetchBalanceAsync(const json& params) {
+    return Executor::shared().submit([this, params]() { return fetchBalance(params); });
 }
 
-AsyncPullType Exchange::createOrderAsync(const std::string& symbol, const std::string& type, const std::string& side,
-                                         double amount, double price, const json& params) {
-    return AsyncPullType(
-        [this](boost::coroutines2::coroutine<json>::push_type& yield) {
-            try {
-                // Call the synchronous fetchOrder method
-                
-                yield(json::object()); // Yield the result to the caller
-            } catch (const std::exception& e) {
-                // Handle exceptions and yield an error response if needed
-                throw; // or yield an error response
-            }
-        });
+std::future<json> Exchange::createOrderAsync(const std::string& symbol, const std::string& type, const std::string& side,
+                                             double amount, double price, const json& params) {
+    return Executor::shared().submit([this, symbol, type, side, amount, price, params]() {
+        return createOrder(symbol, type, side, amount, price, params);
+    });
 }
 
-AsyncPullType Exchange::cancelOrderAsync(const std::string& id, const std::string& symbol, const json& params) {
-    return AsyncPullType(
-        [this](boost::coroutines2::coroutine<json>::push_type& yield) {
-            try {
-                // Call the synchronous fetchOrder method
-                
-                yield(json::object()); // Yield the result to the caller
-            } catch (const std::exception& e) {
-                // Handle exceptions and yield an error response if needed
-                throw; // or yield an error response
-            }
-        });
+std::future<json> Exchange::cancelOrderAsync(const std::string& id, const std::string& symbol, const json& params) {
+    return Executor::shared().submit([this, id, symbol, params]() { return cancelOrder(id, symbol, params); });
 }
 
-AsyncPullType Exchange::fetchOrderAsync(const std::string& id, const std::string& symbol, const json& params) {
-    return AsyncPullType(
-        [this](boost::coroutines2::coroutine<json>::push_type& yield) {
-            try {
-                // Call the synchronous fetchOrder method
-                
-                yield(json::object()); // Yield the result to the caller
-            } catch (const std::exception& e) {
-                // Handle exceptions and yield an error response if needed
-                throw; // or yield an error response
-            }
-        });
+std::future<json> Exchange::fetchOrderAsync(const std::string& id, const std::string& symbol, const json& params) {
+    return Executor::shared().submit([this, id, symbol, params]() { return fetchOrder(id, symbol, params); });
 }
 
-AsyncPullType Exchange::fetchOrdersAsync(const std::string& symbol, int since, int limit, const json& params) {
-    return AsyncPullType(
-        [this](boost::coroutines2::coroutine<json>::push_type& yield) {
-            try {
-                // Call the synchronous fetchOrder method
-                
-                yield(json::object()); // Yield the result to the caller
-            } catch (const std::exception& e) {
-                // Handle exceptions and yield an error response if needed
-                throw; // or yield an error response
-            }
-        });
+std::future<json> Exchange::fetchOrdersAsync(const std::string& symbol, int since, int limit, const json& params) {
+    return Executor::shared().submit(
+        [this, symbol, since, limit, params]() { return fetchOrders(symbol, since, limit, params); });
 }
 
-AsyncPullType Exchange::fetchOpenOrdersAsync(const std::string& symbol, int since, int limit, const json& params) {
-     return AsyncPullType(
-        [this](boost::coroutines2::coroutine<json>::push_type& yield) {
-            try {
-                // Call the synchronous fetchOrder method
-                
-                yield(json::object()); // Yield the result to the caller
-            } catch (const std::exception& e) {
-                // Handle exceptions and yield an error response if needed
-                throw; // or yield an error response
-            }
-        });
+std::future<json> Exchange::fetchOpenOrdersAsync(const std::string& symbol, int since, int limit, const json& params) {
+    return Executor::shared().submit(
+        [this, symbol, since, limit, params]() { return fetchOpenOrders(symbol, since, limit, params); });
 }
 
-AsyncPullType Exchange::fetchClosedOrdersAsync(const std::string& symbol, int since, int limit, const json& params) {
-   return AsyncPullType(
-        [this](boost::coroutines2::coroutine<json>::push_type& yield) {
-            try {
-                // Call the synchronous fetchOrder method
-                
-                yield(json::object()); // Yield the result to the caller
-            } catch (const std::exception& e) {
-                // Handle exceptions and yield an error response if needed
-                throw; // or yield an error response
-            }
-        });
+std::future<json> Exchange::fetchClosedOrdersAsync(const std::string& symbol, int since, int limit, const json& params) {
+    return Executor::shared().submit(
+        [this, symbol, since, limit, params]() { return fetchClosedOrders(symbol, since, limit, params); });
 }
 
-AsyncPullType Exchange::fetchAsync(const std::string& url, const std::string& method,
-                                   const std::map<std::string, std::string>& headers,
-                                   const std::string& body) {
-     return AsyncPullType(
-        [this](boost::coroutines2::coroutine<json>::push_type& yield) {
-            try {
-                // Call the synchronous fetchOrder method
-                
-                yield(json::object()); // Yield the result to the caller
-            } catch (const std::exception& e) {
-                // Handle exceptions and yield an error response if needed
-                throw; // or yield an error response
-            }
-        });
+std::future<json> Exchange::fetchAsync(const std::string& url, const std::string& method,
+                                       const std::map<std::string, std::string>& headers,
+                                       const std::string& body) {
+    return Executor::shared().submit([this, url, method, headers, body]() { return fetch(url, method, headers, body); });
 }
 
 // Utility methods
@@ -347,93 +496,61 @@ std::string Exchange::sign(const std::string& path, const std::string& api,
     return "";
 }
 
-std::string Exchange::implodeParams(const std::string& path, const json& params) {
-    std::string result = path;
-    for (const auto& [key, value] : params.items()) {
-        result = std::regex_replace(result, std::regex("\\{" + key + "\\}"),
-                                  value.get<std::string>());
+const PathTemplate& Exchange::pathTemplate(const std::string& path) {
+    {
+        std::shared_lock<std::shared_mutex> lock(pathTemplatesMutex_);
+        auto it = pathTemplates_->find(path);
+        if (it != pathTemplates_->end()) {
+            return it->second;
+        }
     }
-    return result;
+    PathTemplate parsed(path);
+    std::unique_lock<std::shared_mutex> lock(pathTemplatesMutex_);
+    // Nodes are stable, so the reference outlives later insertions
+    return pathTemplates_->emplace(path, std::move(parsed)).first->second;
+}
+
+std::string Exchange::implodeParams(const std::string& path, const json& params) {
+    return pathTemplate(path).render(params);
 }
 
 std::vector<std::string> Exchange::extractParams(const std::string& path) {
-    std::vector<std::string> result;
-    std::regex pattern("\\{([^}]+)\\}");
-    auto words_begin = std::sregex_iterator(path.begin(), path.end(), pattern);
-    auto words_end = std::sregex_iterator();
-    for (std::sregex_iterator i = words_begin; i != words_end; ++i) {
-        std::smatch match = *i;
-        result.push_back(match[1].str());
-    }
-    return result;
+    return pathTemplate(path).params();
 }
 
 std::string Exchange::urlencode(const json& params) {
-    std::ostringstream result;
-    bool first = true;
-    for (const auto& [key, value] : params.items()) {
-        if (!first) {
-            result << "&";
-        }
-        first = false;
-        result << encode(key) << "=" << encode(value.get<std::string>());
-    }
-    return result.str();
+    thread_local QueryBuilder query;
+    query.clear();
+    query.add(params);
+    return query.str();
 }
 
 std::string Exchange::encode(const std::string& string) {
-    std::ostringstream escaped;
-    escaped.fill('0');
-    escaped << std::hex;
-
-    for (char c : string) {
-        if (isalnum(c) || c == '-' || c == '_' || c == '.' || c == '~') {
-            escaped << c;
-            continue;
-        }
-        escaped << std::uppercase;
-        escaped << '%' << std::setw(2) << int((unsigned char)c);
-        escaped << std::nouppercase;
-    }
-
-    return escaped.str();
+    return QueryBuilder::encode(string);
 }
 
 std::string Exchange::hmac(const std::string& message, const std::string& secret,
                      const std::string& algorithm, const std::string& digest) {
-    unsigned char* digest_value = nullptr;
-    unsigned int digest_len = 0;
-
-    if (algorithm == "sha256") {
-        digest_value = HMAC(EVP_sha256(), secret.c_str(), secret.length(),
-                          (unsigned char*)message.c_str(), message.length(),
-                          nullptr, &digest_len);
-    } else if (algorithm == "sha512") {
-        digest_value = HMAC(EVP_sha512(), secret.c_str(), secret.length(),
-                          (unsigned char*)message.c_str(), message.length(),
-                          nullptr, &digest_len);
-    } else {
-        throw NotSupported("Unsupported hash algorithm: " + algorithm);
+    HmacSigner::Algorithm hash = HmacSigner::parseAlgorithm(algorithm);
+    if (digest != "hex" && digest != "base64") {
+        throw NotSupported("Unsupported digest format: " + digest);
     }
 
-    if (!digest_value) {
-        throw ExchangeError("HMAC failed");
+    // Reuse the pre-keyed signer for the exchange's own secret
+    HmacSigner oneShot;
+    const HmacSigner* signer = &signer_;
+    if (!signer_.valid() || signer_.algorithm() != hash || signer_.secret() != secret) {
+        oneShot.reset(secret, hash);
+        signer = &oneShot;
     }
 
-    std::ostringstream result;
+    HmacSigner::Buffer result;
     if (digest == "hex") {
-        for (unsigned int i = 0; i < digest_len; i++) {
-            result << std::hex << std::setw(2) << std::setfill('0')
-                  << (int)digest_value[i];
-        }
-    } else if (digest == "base64") {
-        // TODO: Implement base64 encoding
-        throw NotSupported("Base64 encoding not implemented yet");
+        signer->signHex(message, result);
     } else {
-        throw NotSupported("Unsupported digest format: " + digest);
+        signer->signBase64(message, result);
     }
-
-    return result.str();
+    return std::string(result.view());
 }
 
 long long Exchange::milliseconds() const {
@@ -443,76 +560,64 @@ long long Exchange::milliseconds() const {
 }
 
 std::string Exchange::uuid() {
-    static std::random_device rd;
-    static std::mt19937 gen(rd());
-    static std::uniform_int_distribution<> dis(0, 15);
-    static std::uniform_int_distribution<> dis2(8, 11);
-
-    std::stringstream ss;
-    int i;
-    ss << std::hex;
-    for (i = 0; i < 8; i++) {
-        ss << dis(gen);
-    }
-    ss << "-";
-    for (i = 0; i < 4; i++) {
-        ss << dis(gen);
-    }
-    ss << "-4";
-    for (i = 0; i < 3; i++) {
-        ss << dis(gen);
-    }
-    ss << "-";
-    ss << dis2(gen);
-    for (i = 0; i < 3; i++) {
-        ss << dis(gen);
-    }
-    ss << "-";
-    for (i = 0; i < 12; i++) {
-        ss << dis(gen);
-    };
-    return ss.str();
+    thread_local std::mt19937_64 gen(std::random_device{}());
+    static constexpr char hex[] = "0123456789abcdef";
+
+    unsigned long long bits[2] = {gen(), gen()};
+    bits[0] = (bits[0] & ~0xF000ULL) | 0x4000ULL;                  // version 4
+    bits[1] = (bits[1] & ~(0xCULL << 60)) | (0x8ULL << 60);        // variant 10xx
+
+    char out[36];
+    int pos = 0;
+    for (int i = 0; i < 32; ++i) {
+        if (i == 8 || i == 12 || i == 16 || i == 20) {
+            out[pos++] = '-';
+        }
+        unsigned long long word = bits[i / 16];
+        out[pos++] = hex[(word >> (60 - 4 * (i % 16))) & 0xF];
+    }
+    return std::string(out, sizeof(out));
 }
 
 std::string Exchange::iso8601(long long timestamp) const {
-    std::time_t time = timestamp / 1000;
-    std::tm* tm = std::gmtime(&time);
-    char buffer[30];
-    std::strftime(buffer, sizeof(buffer), "%Y-%m-%dT%H:%M:%S", tm);
-    int milliseconds = timestamp % 1000;
-    sprintf(buffer + strlen(buffer), ".%03dZ", milliseconds);
-    return std::string(buffer);
+    char buffer[kIso8601Length];
+    return std::string(buffer, formatIso8601(timestamp, buffer));
 }
 
+// Returns 0 when the string isn't a valid ISO-8601 datetime
 long long Exchange::parse8601(const std::string& datetime) {
-    std::tm tm = {};
-    std::istringstream ss(datetime);
-    ss >> std::get_time(&tm, "%Y-%m-%dT%H:%M:%S");
-    auto tp = std::chrono::system_clock::from_time_t(std::mktime(&tm));
-    return std::chrono::duration_cast<std::chrono::milliseconds>(
-        tp.time_since_epoch()
-    ).count();
+    return parseIso8601(datetime).value_or(0);
 }
 
-Market Exchange::market(const std::string& symbol) {
-    if (markets.find(symbol) == markets.end()) {
+Market Exchange::market(const std::string& symbol) const {
+    std::shared_lock<std::shared_mutex> lock(marketsMutex_);
+    auto it = markets.find(symbol);
+    if (it == markets.end()) {
         throw ExchangeError("Market '" + symbol + "' does not exist");
     }
-    return markets[symbol];
+    return it->second;
 }
 
 void Exchange::loadMarkets(bool reload) {
-    if (!markets.empty() && !reload) {
-        return;
+    {
+        std::shared_lock<std::shared_mutex> lock(marketsMutex_);
+        if (!markets.empty() && !reload) {
+            return;
+        }
     }
     json response = fetchMarkets();
+    std::map<std::string, Market> bySymbol;
+    std::map<std::string, Market> byId;
     for (const auto& market : response) {
-        markets[market["symbol"]] = market;
-        markets_by_id[market["id"]] = market;
+        bySymbol[market["symbol"]] = market;
+        byId[market["id"]] = market;
     }
+    std::unique_lock<std::shared_mutex> lock(marketsMutex_);
+    markets.swap(bySymbol);
+    markets_by_id.swap(byId);
 }
 
-std::string Exchange::marketId(const std::string& symbol) {
+std::string Exchange::marketId(const std::string& symbol) const {
     return market(symbol).id;
 }
 
@@ -572,11 +677,13 @@ bool Exchange::safeBoolean(const json& obj, const std::string& key, bool default
     return defaultValue;
 }
 
-std::string Exchange::symbol(const std::string& marketId) {
-    if (markets_by_id.find(marketId) == markets_by_id.end()) {
+std::string Exchange::symbol(const std::string& marketId) const {
+    std::shared_lock<std::shared_mutex> lock(marketsMutex_);
+    auto it = markets_by_id.find(marketId);
+    if (it == markets_by_id.end()) {
         throw ExchangeError("Market ID '" + marketId + "' does not exist");
     }
-    return markets_by_id[marketId].symbol;
+    return it->second.symbol;
 }
 
 std::string Exchange::amountToPrecision(const std::string& symbol, double amount) {
@@ -609,45 +716,452 @@ std::string Exchange::costToPrecision(const std::string& symbol, double cost) {
     return ss.str();
 }
 
+namespace {
+
+size_t curlWrite(char* data, size_t size, size_t nmemb, void* userdata) {
+    static_cast<std::string*>(userdata)->append(data, size * nmemb);
+    return size * nmemb;
+}
+
+// One easy handle and response buffer per thread. curl_easy_reset keeps the
+// handle's connection and DNS caches, so threads reuse warm connections
+// without sharing mutable transport state between them.
+struct CurlSession {
+    CURL* handle = curl_easy_init();
+    std::string response;
+    ~CurlSession() {
+        if (handle) {
+            curl_easy_cleanup(handle);
+        }
+    }
+};
+
+CurlSession& curlSession() {
+    thread_local CurlSession session;
+    return session;
+}
+
+// DNS answers and TLS sessions shared by every handle in the process, so a
+// name resolved or a session negotiated on one thread (or by prewarm()) is
+// reused on all of them. curl can't share live connections across threads.
+struct CurlShare {
+    CURLSH* handle = curl_share_init();
+    std::mutex locks[CURL_LOCK_DATA_LAST];
+
+    CurlShare() {
+        curl_share_setopt(handle, CURLSHOPT_LOCKFUNC, lock);
+        curl_share_setopt(handle, CURLSHOPT_UNLOCKFUNC, unlock);
+        curl_share_setopt(handle, CURLSHOPT_USERDATA, this);
+        curl_share_setopt(handle, CURLSHOPT_SHARE, CURL_LOCK_DATA_DNS);
+        curl_share_setopt(handle, CURLSHOPT_SHARE, CURL_LOCK_DATA_SSL_SESSION);
+    }
+    // Never cleaned up: thread_local handles may still use it at exit
+
+    static void lock(CURL*, curl_lock_data data, curl_lock_access, void* share) {
+        static_cast<CurlShare*>(share)->locks[data].lock();
+    }
+    static void unlock(CURL*, curl_lock_data data, void* share) {
+        static_cast<CurlShare*>(share)->locks[data].unlock();
+    }
+};
+
+void shareCaches(CURL* handle) {
+    static CurlShare* share = new CurlShare();
+    curl_easy_setopt(handle, CURLOPT_SHARE, share->handle);
+    curl_easy_setopt(handle, CURLOPT_DNS_CACHE_TIMEOUT, static_cast<long>(DnsCache::shared().ttl().count()));
+}
+
+struct Origin {
+    std::string scheme;
+    std::string host;
+    std::string port;
+};
+
+// "wss://stream.binance.com:9443/ws" -> {"wss", "stream.binance.com", "9443"}
+std::optional<Origin> parseOrigin(const std::string& url) {
+    const size_t scheme = url.find("://");
+    if (scheme == std::string::npos) {
+        return std::nullopt;
+    }
+    Origin origin;
+    origin.scheme = url.substr(0, scheme);
+    const size_t start = scheme + 3;
+    const size_t end = std::min(url.find_first_of("/?#", start), url.size());
+    const std::string authority = url.substr(start, end - start);
+    const size_t bracket = authority.rfind(']');
+    const size_t colon = authority.rfind(':');
+    if (colon != std::string::npos && (bracket == std::string::npos || colon > bracket)) {
+        origin.host = authority.substr(0, colon);
+        origin.port = authority.substr(colon + 1);
+    } else {
+        origin.host = authority;
+        origin.port = origin.scheme == "http" || origin.scheme == "ws" ? "80" : "443";
+    }
+    if (origin.host.size() > 1 && origin.host.front() == '[') {
+        origin.host = origin.host.substr(1, origin.host.size() - 2);
+    }
+    if (origin.host.empty()) {
+        return std::nullopt;
+    }
+    return origin;
+}
+
+void collectUrls(const json& node, std::vector<std::string>& urls) {
+    if (node.is_string()) {
+        urls.push_back(node.get<std::string>());
+    } else if (node.is_structured()) {
+        for (const auto& child : node) {
+            collectUrls(child, urls);
+        }
+    }
+}
+
+int64_t elapsedNs(std::chrono::steady_clock::time_point since) {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - since).count();
+}
+
+// Splits curl's cumulative timestamps (microseconds from the start of the
+// transfer) into phases. Reused connections report no DNS/connect/TLS.
+void curlPhases(CURL* curl, RequestTiming& timing) {
+    curl_off_t dns = 0, connect = 0, tls = 0, pretransfer = 0, firstByte = 0, total = 0;
+    long connects = 0;
+    curl_easy_getinfo(curl, CURLINFO_NAMELOOKUP_TIME_T, &dns);
+    curl_easy_getinfo(curl, CURLINFO_CONNECT_TIME_T, &connect);
+    curl_easy_getinfo(curl, CURLINFO_APPCONNECT_TIME_T, &tls);
+    curl_easy_getinfo(curl, CURLINFO_PRETRANSFER_TIME_T, &pretransfer);
+    curl_easy_getinfo(curl, CURLINFO_STARTTRANSFER_TIME_T, &firstByte);
+    curl_easy_getinfo(curl, CURLINFO_TOTAL_TIME_T, &total);
+    curl_easy_getinfo(curl, CURLINFO_NUM_CONNECTS, &connects);
+    if (connects > 0) {
+        timing[RequestPhase::Dns] = dns * 1000;
+        timing[RequestPhase::Connect] = std::max<curl_off_t>(0, connect - dns) * 1000;
+        if (tls > 0) {
+            timing[RequestPhase::Tls] = std::max<curl_off_t>(0, tls - connect) * 1000;
+        }
+    }
+    if (firstByte > 0) {
+        timing[RequestPhase::FirstByte] = std::max<curl_off_t>(0, firstByte - pretransfer) * 1000;
+        timing[RequestPhase::Transfer] = std::max<curl_off_t>(0, total - firstByte) * 1000;
+    }
+}
+
+// The second handle and the multi handle a hedged GET races the thread's
+// CurlSession handle on
+struct HedgeSession {
+    CURLM* multi = curl_multi_init();
+    CURL* handle = curl_easy_init();
+    std::string response;
+    ~HedgeSession() {
+        if (handle) {
+            curl_easy_cleanup(handle);
+        }
+        if (multi) {
+            curl_multi_cleanup(multi);
+        }
+    }
+};
+
+HedgeSession& hedgeSession() {
+    thread_local HedgeSession session;
+    return session;
+}
+
+struct Transfer {
+    CURL* handle;
+    std::string* response;
+    size_t host;
+    std::chrono::steady_clock::time_point started;
+    bool added = false;
+    bool done = false;
+    CURLcode code = CURLE_OK;
+    long httpCode = 0;
+};
+
+// Runs primary and, once its hedge delay has passed without an answer (or at
+// once if it fails with a transport error or 5xx), alternate. Returns the
+// transfer whose response to use: the first answer below 500, else the last
+// to fail.
+Transfer* hedgedPerform(HedgedHosts& hosts, CURLM* multi, Transfer& primary, Transfer& alternate) {
+    const auto deadline = primary.started + hosts.hedgeDelay(primary.host);
+    auto add = [multi](Transfer& transfer) {
+        transfer.started = std::chrono::steady_clock::now();
+        transfer.added = curl_multi_add_handle(multi, transfer.handle) == CURLM_OK;
+        if (!transfer.added) {
+            transfer.done = true;
+            transfer.code = CURLE_FAILED_INIT;
+        }
+    };
+    add(primary);
+    Transfer* result = &primary;
+    Transfer* winner = nullptr;
+    while (!winner) {
+        int running = 0;
+        if (curl_multi_perform(multi, &running) != CURLM_OK) {
+            break;
+        }
+        int queued = 0;
+        while (CURLMsg* message = curl_multi_info_read(multi, &queued)) {
+            if (message->msg != CURLMSG_DONE) {
+                continue;
+            }
+            Transfer& transfer = message->easy_handle == primary.handle ? primary : alternate;
+            transfer.done = true;
+            transfer.code = message->data.result;
+            curl_easy_getinfo(transfer.handle, CURLINFO_RESPONSE_CODE, &transfer.httpCode);
+            result = &transfer;
+            // A 4xx is the venue's answer to the request itself (bad
+            // parameters, 418/429 bans) and the other host would give the
+            // same; only transport errors and 5xx are worth the other host
+            if (transfer.code == CURLE_OK && transfer.httpCode > 0 && transfer.httpCode < 500) {
+                winner = &transfer;
+                break;
+            }
+        }
+        if (winner || (primary.done && alternate.done)) {
+            break;
+        }
+        const auto now = std::chrono::steady_clock::now();
+        if (!alternate.added && (primary.done || now >= deadline)) {
+            add(alternate);
+            continue;
+        }
+        int timeout = 100;
+        if (!alternate.added) {
+            timeout = static_cast<int>(
+                std::chrono::duration_cast<std::chrono::milliseconds>(deadline - now).count()) + 1;
+        }
+        curl_multi_poll(multi, nullptr, 0, std::min(timeout, 100), nullptr);
+    }
+    // Removing a transfer still in flight abandons it
+    for (Transfer* transfer : {&primary, &alternate}) {
+        if (transfer->added) {
+            curl_multi_remove_handle(multi, transfer->handle);
+        }
+    }
+    if (alternate.added) {
+        hosts.noteHedge(winner == &alternate);
+    }
+    if (winner) {
+        hosts.record(winner->host, elapsedNs(winner->started));
+        // The loser took at least this long, which is what its latency
+        // should reflect when it keeps losing
+        Transfer& loser = winner == &primary ? alternate : primary;
+        if (loser.added && !loser.done) {
+            hosts.record(loser.host, elapsedNs(loser.started));
+        }
+    }
+    return result;
+}
+
+} // namespace
+
 json Exchange::fetch(const std::string& url, const std::string& method,
                     const std::map<std::string, std::string>& headers,
                     const std::string& body) {
+    return perform(url, method, headers, body);
+}
 
-    std::string readBuffer;
-    if(curl_) {
-        struct curl_slist* curl_headers = nullptr;
-        std::map<std::string, std::string>::const_iterator it = headers.begin();
-        for (; it != headers.end(); ++it) {
-            curl_headers = curl_slist_append(curl_headers, (it->first + ": " + it->second).c_str());
-        }
-        curl_easy_setopt(curl_, CURLOPT_HTTPHEADER, curl_headers);
-        curl_easy_setopt(curl_, CURLOPT_URL, url.c_str());
-        curl_easy_setopt(curl_, CURLOPT_POSTFIELDS, body.c_str());
-        curl_easy_setopt(curl_, CURLOPT_WRITEFUNCTION, NULL);
-        curl_easy_setopt(curl_, CURLOPT_WRITEDATA, &readBuffer);
-        CURLcode res = curl_easy_perform(curl_);
-        long httpCode = 0;
-        curl_easy_getinfo(curl_, CURLINFO_RESPONSE_CODE, &httpCode);
-
-        if(res != CURLE_OK) {
-            std::cerr << "curl_easy_perform() failed: " << curl_easy_strerror(res) << std::endl;
-        } else if (httpCode != 200) {
-            std::cerr << "HTTP request failed with code: " << httpCode << std::endl;
-        } else {
-            try {
-                auto jsonResponse = nlohmann::json::parse(readBuffer);
-                // Process the JSON response (e.g., check order status)
-                std::cout << jsonResponse.dump(4) << std::endl;
-                return jsonResponse; // Pretty print
-            } catch (const nlohmann::json::parse_error& e) {
-                std::cerr << "JSON parse error: " << e.what() << std::endl;
-            }
+json Exchange::perform(const std::string& url, const std::string& method,
+                       const std::map<std::string, std::string>& headers,
+                       const std::string& body, bool throttle) const {
+    const auto started = std::chrono::steady_clock::now();
+    RequestTiming timing;
+    timing[RequestPhase::Sign] = RequestMetrics::takeSignTime();
+    if (throttle && enableRateLimit) {
+        rateLimiter_.setInterval(rateLimit);
+        timing[RequestPhase::Queue] = rateLimiter_.acquire().count();
+    } else {
+        timing[RequestPhase::Queue] = 0;
+    }
+
+    CurlSession& session = curlSession();
+    if (!session.handle) {
+        throw NetworkError("curl_easy_init() failed");
+    }
+    const std::shared_ptr<HedgedHosts> hedging = std::atomic_load(&hedging_);
+    const int hedgedHost = hedging && method == "GET" ? hedging->find(url) : -1;
+
+    struct curl_slist* curl_headers = nullptr;
+    std::string header;
+    for (const auto& [key, value] : headers) {
+        header.assign(key).append(": ").append(value);
+        curl_headers = curl_slist_append(curl_headers, header.c_str());
+    }
+    auto prepare = [&](CURL* handle, const std::string& target, std::string& response) {
+        response.clear();
+        curl_easy_reset(handle);
+        shareCaches(handle);
+        curl_easy_setopt(handle, CURLOPT_HTTPHEADER, curl_headers);
+        curl_easy_setopt(handle, CURLOPT_URL, target.c_str());
+        if (method != "GET") {
+            curl_easy_setopt(handle, CURLOPT_CUSTOMREQUEST, method.c_str());
+        }
+        if (!body.empty()) {
+            curl_easy_setopt(handle, CURLOPT_POSTFIELDS, body.c_str());
+            curl_easy_setopt(handle, CURLOPT_POSTFIELDSIZE, static_cast<long>(body.size()));
+        }
+        curl_easy_setopt(handle, CURLOPT_WRITEFUNCTION, curlWrite);
+        curl_easy_setopt(handle, CURLOPT_WRITEDATA, &response);
+    };
+
+    CURL* curl = session.handle;
+    std::string* response = &session.response;
+    CURLcode res;
+    long httpCode = 0;
+    HedgeSession& hedge = hedgeSession();
+    if (hedgedHost >= 0 && hedge.multi && hedge.handle) {
+        const size_t primaryHost = hedging->primary();
+        const size_t alternateHost = hedging->alternate(primaryHost);
+        const std::string primaryUrl = hedging->rewrite(url, primaryHost);
+        const std::string alternateUrl = hedging->rewrite(url, alternateHost);
+        prepare(session.handle, primaryUrl, session.response);
+        prepare(hedge.handle, alternateUrl, hedge.response);
+        Transfer primary{session.handle, &session.response, primaryHost, std::chrono::steady_clock::now()};
+        Transfer alternate{hedge.handle, &hedge.response, alternateHost, primary.started};
+        const Transfer* used = hedgedPerform(*hedging, hedge.multi, primary, alternate);
+        curl = used->handle;
+        response = used->response;
+        res = used->done ? used->code : CURLE_OPERATION_TIMEDOUT;
+        httpCode = used->httpCode;
+    } else {
+        prepare(curl, url, session.response);
+        res = curl_easy_perform(curl);
+        curl_easy_getinfo(curl, CURLINFO_RESPONSE_CODE, &httpCode);
+    }
+    curl_slist_free_all(curl_headers);
+    lastRestRequestTimestamp = milliseconds();
+    std::string& readBuffer = *response;
+    curlPhases(curl, timing);
+    const std::string endpoint = RequestMetrics::endpointKey(method, url);
+
+    if(res != CURLE_OK) {
+        timing[RequestPhase::Total] = elapsedNs(started);
+        metrics_->record(endpoint, timing, true);
+        CCXT_LOG_ERROR(id << " " << endpoint << " failed: " << curl_easy_strerror(res));
+    } else if (httpCode != 200) {
+        timing[RequestPhase::Total] = elapsedNs(started);
+        metrics_->record(endpoint, timing, true);
+        CCXT_LOG_WARN(id << " " << endpoint << " returned HTTP " << httpCode);
+    } else {
+        const auto parseStart = std::chrono::steady_clock::now();
+        try {
+            auto jsonResponse = nlohmann::json::parse(readBuffer);
+            timing[RequestPhase::Parse] = elapsedNs(parseStart);
+            timing[RequestPhase::Total] = elapsedNs(started);
+            metrics_->record(endpoint, timing);
+            CCXT_LOG_TRACE(id << " " << endpoint << " -> " << readBuffer);
+            return jsonResponse;
+        } catch (const nlohmann::json::parse_error& e) {
+            timing[RequestPhase::Total] = elapsedNs(started);
+            metrics_->record(endpoint, timing, true);
+            CCXT_LOG_ERROR(id << " " << endpoint << " JSON parse error: " << e.what());
         }
-        curl_easy_cleanup(curl_);
     }
     return json::parse(readBuffer);
 }
 
+size_t Exchange::prewarm() {
+    std::vector<std::string> urls;
+    if (config_.json_rest.contains("urls")) {
+        collectUrls(config_.json_rest["urls"].value("api", json()), urls);
+    }
+    if (config_.json_ws.contains("urls")) {
+        collectUrls(config_.json_ws["urls"].value("api", json()), urls);
+    }
+    if (const std::shared_ptr<HedgedHosts> hedging = std::atomic_load(&hedging_)) {
+        urls.insert(urls.end(), hedging->policy().hosts.begin(), hedging->policy().hosts.end());
+    }
+    return prewarm(urls);
+}
+
+size_t Exchange::prewarm(const std::vector<std::string>& urls) {
+    std::map<std::string, Origin> origins;
+    for (const auto& url : urls) {
+        if (auto origin = parseOrigin(url)) {
+            origins.emplace(origin->scheme + "://" + origin->host + ":" + origin->port, *origin);
+        }
+    }
+
+    // All names at once, with blocking lookups: an asyncResolve could join a
+    // lookup another, not yet running, io_context started and never finish
+    std::vector<std::string> keys;
+    for (const auto& entry : origins) {
+        keys.push_back(entry.first);
+    }
+    const json lookups = runBatch(keys.size(),
+        [&](size_t i) -> json {
+            const Origin& origin = origins.at(keys[i]);
+            return DnsCache::shared().resolve(origin.host, origin.port);
+        },
+        [&](size_t i, const std::string&) -> json {
+            CCXT_LOG_WARN(id << " prewarm could not resolve " << keys[i]);
+            return nullptr;
+        });
+    std::map<std::string, DnsCache::Addresses> resolved;
+    for (size_t i = 0; i < keys.size(); ++i) {
+        if (!lookups[i].is_null()) {
+            resolved[keys[i]] = lookups[i].get<DnsCache::Addresses>();
+        }
+    }
+
+    // Then one connection per HTTP host, all in flight together. HEAD / is
+    // enough to complete TCP and TLS and seed the shared TLS session cache.
+    CURLM* multi = curl_multi_init();
+    std::vector<std::pair<CURL*, curl_slist*>> transfers;
+    for (const auto& [key, addresses] : resolved) {
+        const Origin& origin = origins.at(key);
+        if (origin.scheme != "http" && origin.scheme != "https") {
+            continue;
+        }
+        CURL* handle = curl_easy_init();
+        if (!handle) {
+            continue;
+        }
+        shareCaches(handle);
+        // Hand curl the addresses already in DnsCache; they land in the
+        // shared DNS cache every thread's handle reads, and '+' lets them
+        // expire like a lookup of curl's own
+        std::string entry = "+" + origin.host + ":" + origin.port + ":";
+        for (size_t i = 0; i < addresses.size(); ++i) {
+            const bool v6 = addresses[i].find(':') != std::string::npos;
+            entry.append(i ? "," : "").append(v6 ? "[" + addresses[i] + "]" : addresses[i]);
+        }
+        curl_slist* resolve = curl_slist_append(nullptr, entry.c_str());
+        const std::string url = key + "/";
+        curl_easy_setopt(handle, CURLOPT_RESOLVE, resolve);
+        curl_easy_setopt(handle, CURLOPT_URL, url.c_str());
+        curl_easy_setopt(handle, CURLOPT_NOBODY, 1L);
+        curl_easy_setopt(handle, CURLOPT_TIMEOUT_MS, 10000L);
+        curl_multi_add_handle(multi, handle);
+        transfers.emplace_back(handle, resolve);
+    }
+    int running = 0;
+    do {
+        if (curl_multi_perform(multi, &running) != CURLM_OK) {
+            break;
+        }
+        if (running) {
+            curl_multi_poll(multi, nullptr, 0, 100, nullptr);
+        }
+    } while (running);
+    int queued = 0;
+    while (CURLMsg* message = curl_multi_info_read(multi, &queued)) {
+        if (message->msg == CURLMSG_DONE && message->data.result != CURLE_OK) {
+            char* url = nullptr;
+            curl_easy_getinfo(message->easy_handle, CURLINFO_EFFECTIVE_URL, &url);
+            CCXT_LOG_WARN(id << " prewarm could not connect to " << (url ? url : "?") << ": "
+                             << curl_easy_strerror(message->data.result));
+        }
+    }
+    for (auto& [handle, resolve] : transfers) {
+        curl_multi_remove_handle(multi, handle);
+        curl_easy_cleanup(handle);
+        curl_slist_free_all(resolve);
+    }
+    curl_multi_cleanup(multi);
+    return resolved.size();
+}
+
 json Exchange::omit(const json& params, const std::vector<std::string>& keys) {
     json result = params;
     for (const auto& key : keys) {
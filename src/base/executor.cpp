@@ -0,0 +1,48 @@
+#include "ccxt/base/executor.h"
+#include "ccxt/base/errors.h"
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <boost/asio/post.hpp>
+#include <boost/asio/thread_pool.hpp>
+
+namespace ccxt {
+
+struct Executor::Impl {
+    explicit Impl(size_t threads) : pool(threads) {}
+
+    boost::asio::thread_pool pool;
+    std::atomic<bool> stopped{false};
+};
+
+Executor::Executor(size_t threads) {
+    if (threads == 0) {
+        threads = std::max<size_t>(2, std::thread::hardware_concurrency());
+    }
+    threads_ = threads;
+    impl_ = std::make_unique<Impl>(threads);
+}
+
+Executor::~Executor() {
+    shutdown();
+}
+
+Executor& Executor::shared() {
+    static Executor executor;
+    return executor;
+}
+
+void Executor::post(std::function<void()> task) {
+    // A joined thread_pool would keep the task queued forever
+    if (impl_->stopped.load(std::memory_order_acquire)) {
+        throw ExchangeError("executor is shut down");
+    }
+    boost::asio::post(impl_->pool, std::move(task));
+}
+
+void Executor::shutdown() {
+    impl_->stopped.store(true, std::memory_order_release);
+    impl_->pool.join();
+}
+
+} // namespace ccxt
@@ -0,0 +1,214 @@
+#include "ccxt/base/frame_recorder.h"
+#include "ccxt/base/errors.h"
+#include <chrono>
+#include <cstring>
+#if defined(CCXT_HAS_ZSTD)
+#include <zstd.h>
+#endif
+
+namespace ccxt {
+
+namespace {
+
+constexpr char kMagic[8] = {'C', 'C', 'X', 'T', 'W', 'S', 'R', '1'};
+constexpr size_t kBlockHeaderSize = 9;
+constexpr size_t kFrameHeaderSize = 16;
+constexpr uint8_t kCodecRaw = 0;
+constexpr uint8_t kCodecZstd = 1;
+
+template <typename T>
+void put(std::string& out, T value) {
+    char bytes[sizeof(T)];
+    std::memcpy(bytes, &value, sizeof(T));
+    out.append(bytes, sizeof(T));
+}
+
+template <typename T>
+T get(const char* in) {
+    T value;
+    std::memcpy(&value, in, sizeof(T));
+    return value;
+}
+
+} // namespace
+
+FrameRecorder::FrameRecorder(const std::string& path) : FrameRecorder(path, Options()) {}
+
+FrameRecorder::FrameRecorder(const std::string& path, Options options)
+    : options_(options),
+      file_(path, std::ios::binary | std::ios::trunc),
+      queue_(options.queueCapacity) {
+    if (!file_) {
+        throw Error("cannot open frame log " + path);
+    }
+    file_.write(kMagic, sizeof(kMagic));
+    block_.reserve(options_.blockSize + options_.blockSize / 8);
+    writer_ = std::thread([this]() { run(); });
+}
+
+FrameRecorder::~FrameRecorder() {
+    stop_.store(true, std::memory_order_release);
+    writer_.join();
+}
+
+uint64_t FrameRecorder::now() {
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count());
+}
+
+bool FrameRecorder::record(uint32_t connectionId, std::string_view payload) {
+    return record(connectionId, now(), payload);
+}
+
+bool FrameRecorder::record(uint32_t connectionId, uint64_t receivedAt, std::string_view payload) {
+    const bool pushed = queue_.tryPush([&](RecordedFrame& slot) {
+        slot.connectionId = connectionId;
+        slot.receivedAt = receivedAt;
+        slot.payload.assign(payload.data(), payload.size());
+    });
+    if (!pushed) {
+        dropped_.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+    recorded_.fetch_add(1, std::memory_order_release);
+    return true;
+}
+
+void FrameRecorder::flush() {
+    const uint64_t target = recorded_.load(std::memory_order_acquire);
+    uint64_t current = flushTarget_.load(std::memory_order_relaxed);
+    while (current < target && !flushTarget_.compare_exchange_weak(current, target)) {
+    }
+    while (written_.load(std::memory_order_acquire) < target) {
+        std::this_thread::sleep_for(std::chrono::microseconds(200));
+    }
+}
+
+void FrameRecorder::run() {
+    auto lastWrite = std::chrono::steady_clock::now();
+    while (!stop_.load(std::memory_order_acquire)) {
+        const uint64_t before = written_.load(std::memory_order_relaxed) + pending_;
+        drain();
+        const bool idle = written_.load(std::memory_order_relaxed) + pending_ == before;
+        const auto now = std::chrono::steady_clock::now();
+        // Flush on request, and at least once a second so a crash loses little
+        if (pending_ > 0 && (flushTarget_.load(std::memory_order_relaxed) > written_.load(std::memory_order_relaxed) ||
+                             now - lastWrite > std::chrono::seconds(1))) {
+            writeBlock();
+            lastWrite = now;
+        }
+        if (idle) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    }
+    drain();
+    writeBlock();
+}
+
+void FrameRecorder::drain() {
+    while (queue_.tryPop([this](RecordedFrame& frame) {
+        put<uint32_t>(block_, frame.connectionId);
+        put<uint64_t>(block_, frame.receivedAt);
+        put<uint32_t>(block_, static_cast<uint32_t>(frame.payload.size()));
+        block_.append(frame.payload);
+    })) {
+        ++pending_;
+        if (block_.size() >= options_.blockSize) {
+            writeBlock();
+        }
+    }
+}
+
+void FrameRecorder::writeBlock() {
+    if (block_.empty()) {
+        return;
+    }
+    const std::string* stored = &block_;
+    uint8_t codec = kCodecRaw;
+#if defined(CCXT_HAS_ZSTD)
+    if (options_.compress) {
+        compressed_.resize(ZSTD_compressBound(block_.size()));
+        const size_t size = ZSTD_compress(compressed_.data(), compressed_.size(), block_.data(), block_.size(),
+                                          options_.compressionLevel);
+        if (!ZSTD_isError(size) && size < block_.size()) {
+            compressed_.resize(size);
+            stored = &compressed_;
+            codec = kCodecZstd;
+        }
+    }
+#endif
+    std::string header;
+    put<uint32_t>(header, static_cast<uint32_t>(block_.size()));
+    put<uint32_t>(header, static_cast<uint32_t>(stored->size()));
+    put<uint8_t>(header, codec);
+    file_.write(header.data(), static_cast<std::streamsize>(header.size()));
+    file_.write(stored->data(), static_cast<std::streamsize>(stored->size()));
+    file_.flush();
+    block_.clear();
+    written_.fetch_add(pending_, std::memory_order_release);
+    pending_ = 0;
+}
+
+FrameReader::FrameReader(const std::string& path) : file_(path, std::ios::binary) {
+    char magic[sizeof(kMagic)];
+    if (!file_.read(magic, sizeof(magic)) || std::memcmp(magic, kMagic, sizeof(kMagic)) != 0) {
+        throw Error("not a frame log: " + path);
+    }
+}
+
+bool FrameReader::loadBlock() {
+    char header[kBlockHeaderSize];
+    if (!file_.read(header, sizeof(header))) {
+        if (file_.gcount() == 0) {
+            return false;
+        }
+        throw Error("truncated frame log block header");
+    }
+    const uint32_t storedSize = get<uint32_t>(header + 4);
+    const uint8_t codec = get<uint8_t>(header + 8);
+    stored_.resize(storedSize);
+    if (!file_.read(stored_.data(), storedSize)) {
+        throw Error("truncated frame log block");
+    }
+    if (codec == kCodecRaw) {
+        block_.swap(stored_);
+    } else if (codec == kCodecZstd) {
+#if defined(CCXT_HAS_ZSTD)
+        const uint32_t rawSize = get<uint32_t>(header);
+        block_.resize(rawSize);
+        const size_t size = ZSTD_decompress(block_.data(), block_.size(), stored_.data(), stored_.size());
+        if (ZSTD_isError(size) || size != rawSize) {
+            throw Error("corrupt zstd block in frame log");
+        }
+#else
+        throw NotSupported("frame log is zstd-compressed but ccxt was built without zstd");
+#endif
+    } else {
+        throw Error("unknown frame log codec");
+    }
+    offset_ = 0;
+    return true;
+}
+
+bool FrameReader::next(RecordedFrame& frame) {
+    while (offset_ >= block_.size()) {
+        if (!loadBlock()) {
+            return false;
+        }
+    }
+    if (block_.size() - offset_ < kFrameHeaderSize) {
+        throw Error("corrupt frame log record");
+    }
+    const char* record = block_.data() + offset_;
+    frame.connectionId = get<uint32_t>(record);
+    frame.receivedAt = get<uint64_t>(record + 4);
+    const uint32_t length = get<uint32_t>(record + 12);
+    if (block_.size() - offset_ - kFrameHeaderSize < length) {
+        throw Error("corrupt frame log record");
+    }
+    frame.payload.assign(record + kFrameHeaderSize, length);
+    offset_ += kFrameHeaderSize + length;
+    return true;
+}
+
+} // namespace ccxt
@@ -0,0 +1,65 @@
+#include "ccxt/base/frame_replay.h"
+#include "ccxt/base/websocket_client.h"
+#include <algorithm>
+#include <chrono>
+#include <thread>
+
+namespace ccxt {
+
+FrameReplayer::FrameReplayer(std::string path, ReplayOptions options)
+    : path_(std::move(path)), options_(options) {}
+
+ReplayReport FrameReplayer::run(WebSocketClient& client) {
+    return run([&client](const RecordedFrame& frame) { client.deliver(frame.payload); });
+}
+
+ReplayReport FrameReplayer::run(const Sink& sink) {
+    using Clock = std::chrono::steady_clock;
+    FrameReader reader(path_);
+    RecordedFrame frame;
+    ReplayReport report;
+    LatencyHistogram latency;
+    LatencyHistogram lag;
+    const bool paced = options_.pacing == ReplayOptions::Pacing::Original && options_.speed > 0;
+    std::optional<uint64_t> firstReceived;
+
+    const Clock::time_point start = Clock::now();
+    while ((options_.limit == 0 || report.messages < options_.limit) && reader.next(frame)) {
+        if (options_.connectionId && frame.connectionId != *options_.connectionId) {
+            continue;
+        }
+        if (paced) {
+            if (!firstReceived) {
+                firstReceived = frame.receivedAt;
+            }
+            const auto offset = std::chrono::nanoseconds(
+                static_cast<long long>(static_cast<double>(frame.receivedAt - *firstReceived) / options_.speed));
+            const Clock::time_point due = start + offset;
+            std::this_thread::sleep_until(due);
+            lag.record(static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::max(Clock::duration::zero(), Clock::now() - due)).count()));
+        }
+
+        const Clock::time_point before = Clock::now();
+        try {
+            sink(frame);
+        } catch (const std::exception&) {
+            ++report.failures;
+        }
+        latency.record(static_cast<uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - before).count()));
+        ++report.messages;
+        report.bytes += frame.payload.size();
+    }
+
+    report.seconds = std::chrono::duration<double>(Clock::now() - start).count();
+    if (report.seconds > 0) {
+        report.messagesPerSecond = static_cast<double>(report.messages) / report.seconds;
+        report.bytesPerSecond = static_cast<double>(report.bytes) / report.seconds;
+    }
+    report.latency = latency.summary();
+    report.lag = lag.summary();
+    return report;
+}
+
+} // namespace ccxt
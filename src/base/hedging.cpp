@@ -0,0 +1,110 @@
+#include "ccxt/base/hedging.h"
+#include "ccxt/base/errors.h"
+#include <algorithm>
+#include <limits>
+
+namespace ccxt {
+
+namespace {
+
+// Length of "scheme://authority" at the start of url
+size_t originLength(const std::string& url) {
+    const size_t scheme = url.find("://");
+    if (scheme == std::string::npos) {
+        return 0;
+    }
+    const size_t path = url.find_first_of("/?#", scheme + 3);
+    return path == std::string::npos ? url.size() : path;
+}
+
+} // namespace
+
+HedgedHosts::HedgedHosts(HedgingPolicy policy) : policy_(std::move(policy)) {
+    if (policy_.hosts.size() < 2) {
+        throw ArgumentsRequired("hedging needs at least two hosts");
+    }
+    for (const auto& host : policy_.hosts) {
+        hosts_.push_back(host.substr(0, originLength(host)));
+        latency_.push_back(std::make_unique<LatencyHistogram>());
+    }
+}
+
+int HedgedHosts::find(const std::string& url) const {
+    const size_t length = originLength(url);
+    for (size_t i = 0; i < hosts_.size(); ++i) {
+        if (hosts_[i].size() == length && url.compare(0, length, hosts_[i]) == 0) {
+            return static_cast<int>(i);
+        }
+    }
+    return -1;
+}
+
+std::string HedgedHosts::rewrite(const std::string& url, size_t host) const {
+    return hosts_[host] + url.substr(originLength(url));
+}
+
+uint64_t HedgedHosts::median(size_t host) const {
+    const LatencyHistogram& histogram = *latency_[host];
+    if (histogram.count() < policy_.minSamples) {
+        return std::numeric_limits<uint64_t>::max();
+    }
+    return histogram.percentile(0.5);
+}
+
+size_t HedgedHosts::primary() {
+    size_t best = 0;
+    uint64_t bestMedian = std::numeric_limits<uint64_t>::max();
+    bool warming = false;
+    for (size_t i = 0; i < hosts_.size(); ++i) {
+        const uint64_t m = median(i);
+        warming |= m == std::numeric_limits<uint64_t>::max();
+        if (m < bestMedian) {
+            best = i;
+            bestMedian = m;
+        }
+    }
+    if (warming) {
+        return turn_.fetch_add(1, std::memory_order_relaxed) % hosts_.size();
+    }
+    return best;
+}
+
+size_t HedgedHosts::alternate(size_t primary) const {
+    size_t best = primary == 0 ? 1 : 0;
+    for (size_t i = 0; i < hosts_.size(); ++i) {
+        if (i != primary && median(i) < median(best)) {
+            best = i;
+        }
+    }
+    return best;
+}
+
+std::chrono::nanoseconds HedgedHosts::hedgeDelay(size_t host) const {
+    const LatencyHistogram& histogram = *latency_[host];
+    if (histogram.count() < policy_.minSamples) {
+        return policy_.initialDelay;
+    }
+    return std::max<std::chrono::nanoseconds>(std::chrono::nanoseconds(histogram.percentile(policy_.quantile)),
+                                              policy_.minDelay);
+}
+
+void HedgedHosts::record(size_t host, uint64_t nanoseconds) {
+    latency_[host]->record(nanoseconds);
+}
+
+void HedgedHosts::noteHedge(bool won) {
+    hedged_.fetch_add(1, std::memory_order_relaxed);
+    if (won) {
+        hedgeWins_.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+std::map<std::string, HistogramSummary> HedgedHosts::latency() const {
+    std::map<std::string, HistogramSummary> result;
+    for (size_t i = 0; i < hosts_.size(); ++i) {
+        result[hosts_[i]] = latency_[i]->summary();
+    }
+    return result;
+}
+
+} // namespace ccxt
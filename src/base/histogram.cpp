@@ -0,0 +1,141 @@
+#include "ccxt/base/histogram.h"
+#include <algorithm>
+#include <limits>
+
+namespace ccxt {
+
+namespace {
+
+unsigned highestBit(uint64_t value) {
+    return 63u - static_cast<unsigned>(__builtin_clzll(value));
+}
+
+void storeMin(std::atomic<uint64_t>& target, uint64_t value) {
+    uint64_t current = target.load(std::memory_order_relaxed);
+    while (value < current && !target.compare_exchange_weak(current, value, std::memory_order_relaxed)) {
+    }
+}
+
+void storeMax(std::atomic<uint64_t>& target, uint64_t value) {
+    uint64_t current = target.load(std::memory_order_relaxed);
+    while (value > current && !target.compare_exchange_weak(current, value, std::memory_order_relaxed)) {
+    }
+}
+
+} // namespace
+
+LatencyHistogram::LatencyHistogram() : min_(std::numeric_limits<uint64_t>::max()) {
+    for (auto& bucket : buckets_) {
+        bucket.store(0, std::memory_order_relaxed);
+    }
+}
+
+LatencyHistogram::LatencyHistogram(const LatencyHistogram& other) : LatencyHistogram() {
+    merge(other);
+}
+
+LatencyHistogram& LatencyHistogram::operator=(const LatencyHistogram& other) {
+    if (this != &other) {
+        reset();
+        merge(other);
+    }
+    return *this;
+}
+
+size_t LatencyHistogram::bucketIndex(uint64_t value) {
+    if (value < 2 * kSubBuckets) {
+        return static_cast<size_t>(value);
+    }
+    const unsigned exponent = highestBit(value) - kSubBucketBits;
+    const uint64_t mantissa = value >> exponent;  // in [kSubBuckets, 2 * kSubBuckets)
+    return (exponent + 1) * kSubBuckets + static_cast<size_t>(mantissa - kSubBuckets);
+}
+
+uint64_t LatencyHistogram::bucketLow(size_t index) {
+    if (index < 2 * kSubBuckets) {
+        return index;
+    }
+    const unsigned exponent = static_cast<unsigned>(index / kSubBuckets - 1);
+    return (kSubBuckets + index % kSubBuckets) << exponent;
+}
+
+uint64_t LatencyHistogram::bucketHigh(size_t index) {
+    if (index < 2 * kSubBuckets) {
+        return index;
+    }
+    const unsigned exponent = static_cast<unsigned>(index / kSubBuckets - 1);
+    return bucketLow(index) + ((uint64_t(1) << exponent) - 1);
+}
+
+void LatencyHistogram::record(uint64_t value) {
+    buckets_[bucketIndex(value)].fetch_add(1, std::memory_order_relaxed);
+    count_.fetch_add(1, std::memory_order_relaxed);
+    sum_.fetch_add(value, std::memory_order_relaxed);
+    storeMin(min_, value);
+    storeMax(max_, value);
+}
+
+void LatencyHistogram::merge(const LatencyHistogram& other) {
+    for (size_t i = 0; i < kBuckets; ++i) {
+        const uint64_t n = other.buckets_[i].load(std::memory_order_relaxed);
+        if (n != 0) {
+            buckets_[i].fetch_add(n, std::memory_order_relaxed);
+        }
+    }
+    count_.fetch_add(other.count_.load(std::memory_order_relaxed), std::memory_order_relaxed);
+    sum_.fetch_add(other.sum_.load(std::memory_order_relaxed), std::memory_order_relaxed);
+    storeMin(min_, other.min_.load(std::memory_order_relaxed));
+    storeMax(max_, other.max_.load(std::memory_order_relaxed));
+}
+
+void LatencyHistogram::reset() {
+    for (auto& bucket : buckets_) {
+        bucket.store(0, std::memory_order_relaxed);
+    }
+    count_.store(0, std::memory_order_relaxed);
+    sum_.store(0, std::memory_order_relaxed);
+    min_.store(std::numeric_limits<uint64_t>::max(), std::memory_order_relaxed);
+    max_.store(0, std::memory_order_relaxed);
+}
+
+uint64_t LatencyHistogram::min() const {
+    return count() == 0 ? 0 : min_.load(std::memory_order_relaxed);
+}
+
+double LatencyHistogram::mean() const {
+    const uint64_t n = count();
+    return n == 0 ? 0.0 : static_cast<double>(sum_.load(std::memory_order_relaxed)) / static_cast<double>(n);
+}
+
+uint64_t LatencyHistogram::percentile(double q) const {
+    const uint64_t n = count();
+    if (n == 0) {
+        return 0;
+    }
+    q = std::clamp(q, 0.0, 1.0);
+    const uint64_t rank = std::max<uint64_t>(1, static_cast<uint64_t>(q * static_cast<double>(n) + 0.5));
+    uint64_t seen = 0;
+    for (size_t i = 0; i < kBuckets; ++i) {
+        seen += buckets_[i].load(std::memory_order_relaxed);
+        if (seen >= rank) {
+            const uint64_t middle = bucketLow(i) + (bucketHigh(i) - bucketLow(i)) / 2;
+            return std::clamp(middle, min(), max());
+        }
+    }
+    return max();
+}
+
+HistogramSummary LatencyHistogram::summary() const {
+    HistogramSummary result;
+    result.count = count();
+    result.min = min();
+    result.max = max();
+    result.mean = mean();
+    result.p50 = percentile(0.50);
+    result.p90 = percentile(0.90);
+    result.p99 = percentile(0.99);
+    result.p999 = percentile(0.999);
+    return result;
+}
+
+} // namespace ccxt
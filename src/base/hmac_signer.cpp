@@ -0,0 +1,162 @@
+#include "ccxt/base/hmac_signer.h"
+#include "ccxt/base/errors.h"
+#include <openssl/core_names.h>
+#include <openssl/evp.h>
+#include <openssl/params.h>
+#include <utility>
+
+namespace ccxt {
+
+namespace {
+
+constexpr char kHexLower[] = "0123456789abcdef";
+constexpr char kBase64[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+const char* digestName(HmacSigner::Algorithm algorithm) {
+    switch (algorithm) {
+        case HmacSigner::Algorithm::SHA384: return "SHA384";
+        case HmacSigner::Algorithm::SHA512: return "SHA512";
+        default: return "SHA256";
+    }
+}
+
+// EVP_MAC_fetch goes through the provider store, so do it once per process
+EVP_MAC* hmacAlgorithm() {
+    static EVP_MAC* mac = EVP_MAC_fetch(nullptr, "HMAC", nullptr);
+    return mac;
+}
+
+} // namespace
+
+size_t hexEncode(const unsigned char* data, size_t size, char* out) {
+    for (size_t i = 0; i < size; ++i) {
+        out[2 * i] = kHexLower[data[i] >> 4];
+        out[2 * i + 1] = kHexLower[data[i] & 0x0F];
+    }
+    return 2 * size;
+}
+
+size_t base64Encode(const unsigned char* data, size_t size, char* out) {
+    char* start = out;
+    size_t i = 0;
+    for (; i + 3 <= size; i += 3) {
+        unsigned int chunk = (data[i] << 16) | (data[i + 1] << 8) | data[i + 2];
+        *out++ = kBase64[(chunk >> 18) & 0x3F];
+        *out++ = kBase64[(chunk >> 12) & 0x3F];
+        *out++ = kBase64[(chunk >> 6) & 0x3F];
+        *out++ = kBase64[chunk & 0x3F];
+    }
+    if (i < size) {
+        unsigned int chunk = data[i] << 16;
+        if (i + 1 < size) {
+            chunk |= data[i + 1] << 8;
+        }
+        *out++ = kBase64[(chunk >> 18) & 0x3F];
+        *out++ = kBase64[(chunk >> 12) & 0x3F];
+        *out++ = i + 1 < size ? kBase64[(chunk >> 6) & 0x3F] : '=';
+        *out++ = '=';
+    }
+    return static_cast<size_t>(out - start);
+}
+
+HmacSigner::HmacSigner(std::string_view secret, Algorithm algorithm) {
+    reset(secret, algorithm);
+}
+
+HmacSigner::~HmacSigner() {
+    release();
+}
+
+HmacSigner::HmacSigner(HmacSigner&& other) noexcept
+    : templateCtx_(std::exchange(other.templateCtx_, nullptr)),
+      algorithm_(other.algorithm_),
+      secret_(std::move(other.secret_)) {}
+
+HmacSigner& HmacSigner::operator=(HmacSigner&& other) noexcept {
+    if (this != &other) {
+        release();
+        templateCtx_ = std::exchange(other.templateCtx_, nullptr);
+        algorithm_ = other.algorithm_;
+        secret_ = std::move(other.secret_);
+    }
+    return *this;
+}
+
+void HmacSigner::release() {
+    if (templateCtx_) {
+        EVP_MAC_CTX_free(templateCtx_);
+        templateCtx_ = nullptr;
+    }
+}
+
+void HmacSigner::reset(std::string_view secret, Algorithm algorithm) {
+    release();
+    algorithm_ = algorithm;
+    secret_.assign(secret.data(), secret.size());
+
+    EVP_MAC* mac = hmacAlgorithm();
+    EVP_MAC_CTX* ctx = mac ? EVP_MAC_CTX_new(mac) : nullptr;
+    if (!ctx) {
+        throw ExchangeError("HMAC context creation failed");
+    }
+    OSSL_PARAM params[] = {
+        OSSL_PARAM_construct_utf8_string(OSSL_MAC_PARAM_DIGEST, const_cast<char*>(digestName(algorithm)), 0),
+        OSSL_PARAM_construct_end()
+    };
+    if (!EVP_MAC_init(ctx, reinterpret_cast<const unsigned char*>(secret_.data()), secret_.size(), params)) {
+        EVP_MAC_CTX_free(ctx);
+        throw ExchangeError("HMAC initialization failed");
+    }
+    templateCtx_ = ctx;
+}
+
+size_t HmacSigner::sign(std::string_view message, unsigned char* out) const {
+    if (!templateCtx_) {
+        throw AuthenticationError("HMAC signer has no secret");
+    }
+    EVP_MAC_CTX* ctx = EVP_MAC_CTX_dup(templateCtx_);
+    if (!ctx) {
+        throw ExchangeError("HMAC context copy failed");
+    }
+    size_t size = 0;
+    bool ok = EVP_MAC_update(ctx, reinterpret_cast<const unsigned char*>(message.data()), message.size())
+        && EVP_MAC_final(ctx, out, &size, kMaxDigestSize);
+    EVP_MAC_CTX_free(ctx);
+    if (!ok) {
+        throw ExchangeError("HMAC failed");
+    }
+    return size;
+}
+
+void HmacSigner::signHex(std::string_view message, Buffer& out) const {
+    unsigned char digest[kMaxDigestSize];
+    size_t size = sign(message, digest);
+    out.size = hexEncode(digest, size, out.data);
+}
+
+void HmacSigner::signBase64(std::string_view message, Buffer& out) const {
+    unsigned char digest[kMaxDigestSize];
+    size_t size = sign(message, digest);
+    out.size = base64Encode(digest, size, out.data);
+}
+
+std::string HmacSigner::hex(std::string_view message) const {
+    Buffer buffer;
+    signHex(message, buffer);
+    return std::string(buffer.view());
+}
+
+std::string HmacSigner::base64(std::string_view message) const {
+    Buffer buffer;
+    signBase64(message, buffer);
+    return std::string(buffer.view());
+}
+
+HmacSigner::Algorithm HmacSigner::parseAlgorithm(const std::string& name) {
+    if (name == "sha256") return Algorithm::SHA256;
+    if (name == "sha384") return Algorithm::SHA384;
+    if (name == "sha512") return Algorithm::SHA512;
+    throw NotSupported("Unsupported hash algorithm: " + name);
+}
+
+} // namespace ccxt
@@ -0,0 +1,145 @@
+#include "ccxt/base/logger.h"
+#include "ccxt/base/datetime.h"
+#include <chrono>
+#include <cstdio>
+#include <sstream>
+
+namespace ccxt {
+
+namespace {
+
+uint32_t threadNumber() {
+    static std::atomic<uint32_t> next{1};
+    thread_local const uint32_t number = next.fetch_add(1, std::memory_order_relaxed);
+    return number;
+}
+
+void writeStderr(const LogRecord& record) {
+    std::string line = Logger::format(record);
+    line += '\n';
+    std::fwrite(line.data(), 1, line.size(), stderr);
+}
+
+} // namespace
+
+const char* logLevelName(LogLevel level) {
+    switch (level) {
+        case LogLevel::Trace: return "TRACE";
+        case LogLevel::Debug: return "DEBUG";
+        case LogLevel::Info: return "INFO";
+        case LogLevel::Warn: return "WARN";
+        case LogLevel::Error: return "ERROR";
+        default: return "OFF";
+    }
+}
+
+Logger& Logger::instance() {
+    static Logger logger;
+    return logger;
+}
+
+Logger::Logger(size_t queueCapacity) : queue_(queueCapacity), sink_(writeStderr) {
+    writer_ = std::thread([this]() { run(); });
+}
+
+Logger::~Logger() {
+    stop_.store(true, std::memory_order_release);
+    writer_.join();
+}
+
+void Logger::setSink(Sink sink) {
+    std::lock_guard<std::mutex> lock(sinkMutex_);
+    sink_ = std::move(sink);
+}
+
+bool Logger::log(LogLevel level, std::string_view message) {
+    const uint64_t timestamp = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count());
+    const uint32_t thread = threadNumber();
+    const bool pushed = queue_.tryPush([&](LogRecord& slot) {
+        slot.level = level;
+        slot.timestamp = timestamp;
+        slot.thread = thread;
+        slot.message.assign(message.data(), message.size());
+    });
+    if (!pushed) {
+        dropped_.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+    logged_.fetch_add(1, std::memory_order_release);
+    return true;
+}
+
+void Logger::flush() {
+    const uint64_t target = logged_.load(std::memory_order_acquire);
+    while (written_.load(std::memory_order_acquire) < target) {
+        std::this_thread::sleep_for(std::chrono::microseconds(200));
+    }
+}
+
+std::string Logger::format(const LogRecord& record) {
+    char time[kIso8601Length];
+    std::string line;
+    line.reserve(kIso8601Length + record.message.size() + 16);
+    line.append(time, formatIso8601(static_cast<long long>(record.timestamp / 1000000), time));
+    line.append(" ").append(logLevelName(record.level));
+    line.append(" [").append(std::to_string(record.thread)).append("] ");
+    line.append(record.message);
+    return line;
+}
+
+void Logger::run() {
+    while (!stop_.load(std::memory_order_acquire)) {
+        if (!drain()) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    }
+    drain();
+}
+
+bool Logger::drain() {
+    std::lock_guard<std::mutex> lock(sinkMutex_);
+    uint64_t count = 0;
+    while (queue_.tryPop([this](LogRecord& record) {
+        if (sink_) {
+            try {
+                sink_(record);
+            } catch (...) {
+                // A failing sink must not take the writer thread down
+            }
+        }
+    })) {
+        ++count;
+    }
+    if (count > 0) {
+        written_.fetch_add(count, std::memory_order_release);
+    }
+    return count > 0;
+}
+
+namespace detail {
+
+namespace {
+
+std::ostringstream& threadStream() {
+    thread_local std::ostringstream stream;
+    return stream;
+}
+
+} // namespace
+
+std::ostream& logStream() {
+    std::ostringstream& stream = threadStream();
+    stream.str(std::string());
+    stream.clear();
+    return stream;
+}
+
+void submitLog(LogLevel level) {
+    const std::string message = threadStream().str();
+    Logger::instance().log(level, message);
+}
+
+} // namespace detail
+
+} // namespace ccxt
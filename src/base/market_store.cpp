@@ -0,0 +1,291 @@
+#include "ccxt/base/market_store.h"
+#include "ccxt/base/errors.h"
+#include "ccxt/base/query_builder.h"
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <filesystem>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace ccxt {
+
+namespace {
+
+constexpr char kMagic[8] = {'C', 'C', 'X', 'T', 'C', 'O', 'L', '1'};
+constexpr size_t kHeaderSize = 64;
+constexpr size_t kMinGrowthRows = 4096;
+
+struct ColumnHeader {
+    char magic[8];
+    uint64_t elementSize;
+    uint64_t rows;
+};
+
+Error systemError(const std::string& what, const std::string& path) {
+    return Error(what + " " + path + ": " + std::strerror(errno));
+}
+
+} // namespace
+
+// One file: a 64-byte header followed by a flat array of elements. The whole
+// maxRows range is mapped up front, so growing the file never moves data().
+class MappedColumn {
+public:
+    MappedColumn(const std::string& path, size_t elementSize, size_t maxRows)
+        : path_(path), elementSize_(elementSize) {
+        fd_ = ::open(path.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+        if (fd_ < 0) {
+            throw systemError("cannot open", path);
+        }
+        struct stat info;
+        if (::fstat(fd_, &info) != 0) {
+            ::close(fd_);
+            throw systemError("cannot stat", path);
+        }
+        const bool created = info.st_size == 0;
+        fileRows_ = created ? 0 : (static_cast<size_t>(info.st_size) - kHeaderSize) / elementSize_;
+        if (created && ::ftruncate(fd_, kHeaderSize) != 0) {
+            ::close(fd_);
+            throw systemError("cannot size", path);
+        }
+        mapped_ = kHeaderSize + maxRows * elementSize_;
+        void* base = ::mmap(nullptr, mapped_, PROT_READ | PROT_WRITE, MAP_SHARED, fd_, 0);
+        if (base == MAP_FAILED) {
+            ::close(fd_);
+            throw systemError("cannot map", path);
+        }
+        base_ = static_cast<char*>(base);
+        if (created) {
+            ColumnHeader* header = this->header();
+            std::memcpy(header->magic, kMagic, sizeof(kMagic));
+            header->elementSize = elementSize_;
+            header->rows = 0;
+        } else if (std::memcmp(header()->magic, kMagic, sizeof(kMagic)) != 0 ||
+                   header()->elementSize != elementSize_) {
+            ::munmap(base_, mapped_);
+            ::close(fd_);
+            throw Error("not a column file: " + path);
+        }
+    }
+
+    ~MappedColumn() {
+        ::munmap(base_, mapped_);
+        ::close(fd_);
+    }
+
+    char* data() const { return base_ + kHeaderSize; }
+    size_t storedRows() const { return std::min<size_t>(header()->rows, fileRows_); }
+
+    void ensureCapacity(size_t rows, size_t maxRows) {
+        if (rows <= fileRows_) {
+            return;
+        }
+        const size_t grown = std::min(maxRows, std::max({rows, fileRows_ * 2, kMinGrowthRows}));
+        if (::ftruncate(fd_, static_cast<off_t>(kHeaderSize + grown * elementSize_)) != 0) {
+            throw systemError("cannot grow", path_);
+        }
+        fileRows_ = grown;
+    }
+
+    void setRows(size_t rows) { header()->rows = rows; }
+
+private:
+    ColumnHeader* header() const { return reinterpret_cast<ColumnHeader*>(base_); }
+
+    std::string path_;
+    size_t elementSize_;
+    int fd_ = -1;
+    char* base_ = nullptr;
+    size_t mapped_ = 0;
+    size_t fileRows_ = 0;
+};
+
+ColumnSeries::ColumnSeries(const std::string& directory,
+                           const std::vector<std::pair<std::string, size_t>>& columns, size_t maxRows)
+    : maxRows_(maxRows) {
+    std::filesystem::create_directories(directory);
+    size_t rows = maxRows;
+    for (const auto& [name, elementSize] : columns) {
+        columns_.push_back(std::make_unique<MappedColumn>(directory + "/" + name + ".col", elementSize, maxRows));
+        // A crash between column writes leaves the shortest column authoritative
+        rows = std::min(rows, columns_.back()->storedRows());
+    }
+    rows_.store(rows, std::memory_order_release);
+}
+
+ColumnSeries::~ColumnSeries() = default;
+
+size_t ColumnSeries::size() const {
+    return rows_.load(std::memory_order_acquire);
+}
+
+ColumnSpan<long long> ColumnSeries::timestamps() const {
+    return column<long long>(0);
+}
+
+std::optional<long long> ColumnSeries::firstTimestamp() const {
+    auto column = timestamps();
+    return column.empty() ? std::nullopt : std::optional<long long>(column.front());
+}
+
+std::optional<long long> ColumnSeries::lastTimestamp() const {
+    auto column = timestamps();
+    return column.empty() ? std::nullopt : std::optional<long long>(column.back());
+}
+
+std::pair<size_t, size_t> ColumnSeries::range(long long since, long long until) const {
+    auto column = timestamps();
+    const long long* first = std::lower_bound(column.begin(), column.end(), since);
+    const long long* last = std::lower_bound(first, column.end(), std::max(since, until));
+    return {static_cast<size_t>(first - column.begin()), static_cast<size_t>(last - column.begin())};
+}
+
+char* ColumnSeries::columnData(size_t index) const {
+    return columns_[index]->data();
+}
+
+void ColumnSeries::reserve(size_t count) {
+    const size_t rows = size() + count;
+    if (rows > maxRows_) {
+        throw Error("column store is full");
+    }
+    for (auto& column : columns_) {
+        column->ensureCapacity(rows, maxRows_);
+    }
+}
+
+void ColumnSeries::commit(size_t count) {
+    const size_t rows = size() + count;
+    // Timestamps last: on reopen a row counts only once every column has it
+    for (size_t i = columns_.size(); i-- > 0;) {
+        columns_[i]->setRows(rows);
+    }
+    rows_.store(rows, std::memory_order_release);
+}
+
+OHLCVSeries::OHLCVSeries(const std::string& directory, size_t maxRows)
+    : ColumnSeries(directory, {{"timestamp", sizeof(long long)}, {"open", sizeof(double)}, {"high", sizeof(double)},
+                               {"low", sizeof(double)}, {"close", sizeof(double)}, {"volume", sizeof(double)}},
+                   maxRows) {}
+
+OHLCV OHLCVSeries::at(size_t row) const {
+    return {timestamps()[row], opens()[row], highs()[row], lows()[row], closes()[row], volumes()[row]};
+}
+
+std::vector<OHLCV> OHLCVSeries::read(long long since, long long until) const {
+    const auto [first, last] = range(since, until);
+    std::vector<OHLCV> candles;
+    candles.reserve(last - first);
+    for (size_t row = first; row < last; ++row) {
+        candles.push_back(at(row));
+    }
+    return candles;
+}
+
+size_t OHLCVSeries::append(const std::vector<OHLCV>& candles) {
+    std::lock_guard<std::mutex> lock(writeMutex_);
+    std::vector<OHLCV> fresh;
+    const std::optional<long long> last = lastTimestamp();
+    for (const auto& candle : candles) {
+        if (!last || candle.timestamp > *last) {
+            fresh.push_back(candle);
+        }
+    }
+    std::sort(fresh.begin(), fresh.end(), [](const OHLCV& a, const OHLCV& b) { return a.timestamp < b.timestamp; });
+    fresh.erase(std::unique(fresh.begin(), fresh.end(), [](const OHLCV& a, const OHLCV& b) {
+        return a.timestamp == b.timestamp;
+    }), fresh.end());
+    if (fresh.empty()) {
+        return 0;
+    }
+
+    reserve(fresh.size());
+    const size_t offset = size();
+    auto* timestamp = reinterpret_cast<long long*>(columnData(0)) + offset;
+    auto* open = reinterpret_cast<double*>(columnData(1)) + offset;
+    auto* high = reinterpret_cast<double*>(columnData(2)) + offset;
+    auto* low = reinterpret_cast<double*>(columnData(3)) + offset;
+    auto* close = reinterpret_cast<double*>(columnData(4)) + offset;
+    auto* volume = reinterpret_cast<double*>(columnData(5)) + offset;
+    for (size_t i = 0; i < fresh.size(); ++i) {
+        timestamp[i] = fresh[i].timestamp;
+        open[i] = fresh[i].open;
+        high[i] = fresh[i].high;
+        low[i] = fresh[i].low;
+        close[i] = fresh[i].close;
+        volume[i] = fresh[i].volume;
+    }
+    commit(fresh.size());
+    return fresh.size();
+}
+
+TradeSeries::TradeSeries(const std::string& directory, size_t maxRows)
+    : ColumnSeries(directory, {{"timestamp", sizeof(long long)}, {"price", sizeof(double)},
+                               {"amount", sizeof(double)}, {"side", sizeof(int8_t)}},
+                   maxRows) {}
+
+size_t TradeSeries::append(const std::vector<Trade>& trades) {
+    std::lock_guard<std::mutex> lock(writeMutex_);
+    std::vector<const Trade*> fresh;
+    const std::optional<long long> last = lastTimestamp();
+    for (const auto& trade : trades) {
+        if (!last || trade.timestamp >= *last) {
+            fresh.push_back(&trade);
+        }
+    }
+    std::stable_sort(fresh.begin(), fresh.end(), [](const Trade* a, const Trade* b) {
+        return a->timestamp < b->timestamp;
+    });
+    if (fresh.empty()) {
+        return 0;
+    }
+
+    reserve(fresh.size());
+    const size_t offset = size();
+    auto* timestamp = reinterpret_cast<long long*>(columnData(0)) + offset;
+    auto* price = reinterpret_cast<double*>(columnData(1)) + offset;
+    auto* amount = reinterpret_cast<double*>(columnData(2)) + offset;
+    auto* side = reinterpret_cast<int8_t*>(columnData(3)) + offset;
+    for (size_t i = 0; i < fresh.size(); ++i) {
+        timestamp[i] = fresh[i]->timestamp;
+        price[i] = fresh[i]->price;
+        amount[i] = fresh[i]->amount;
+        side[i] = fresh[i]->side == "buy" ? 1 : fresh[i]->side == "sell" ? -1 : 0;
+    }
+    commit(fresh.size());
+    return fresh.size();
+}
+
+MarketStore::MarketStore(std::string root, size_t maxRows) : root_(std::move(root)), maxRows_(maxRows) {}
+
+std::string MarketStore::directory(const std::string& exchange, const std::string& symbol,
+                                   const std::string& leaf) const {
+    // Percent-encoding keeps "BTC/USDT:USDT" a single path component
+    return root_ + "/" + QueryBuilder::encode(exchange) + "/" + QueryBuilder::encode(symbol) + "/" + leaf;
+}
+
+OHLCVSeries& MarketStore::ohlcv(const std::string& exchange, const std::string& symbol,
+                                const std::string& timeframe) {
+    const std::string path = directory(exchange, symbol, "ohlcv-" + QueryBuilder::encode(timeframe));
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto& series = ohlcv_[path];
+    if (!series) {
+        series = std::make_unique<OHLCVSeries>(path, maxRows_);
+    }
+    return *series;
+}
+
+TradeSeries& MarketStore::trades(const std::string& exchange, const std::string& symbol) {
+    const std::string path = directory(exchange, symbol, "trades");
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto& series = trades_[path];
+    if (!series) {
+        series = std::make_unique<TradeSeries>(path, maxRows_);
+    }
+    return *series;
+}
+
+} // namespace ccxt
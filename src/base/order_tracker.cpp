@@ -0,0 +1,176 @@
+#include "ccxt/base/order_tracker.h"
+#include <mutex>
+#include <unordered_set>
+
+namespace ccxt {
+
+namespace {
+
+// REST payloads carry numbers either as JSON numbers or as strings
+double number(const json& order, const char* key) {
+    auto it = order.find(key);
+    if (it == order.end() || it->is_null()) {
+        return 0;
+    }
+    if (it->is_string()) {
+        const std::string& text = it->get_ref<const std::string&>();
+        return text.empty() ? 0 : std::stod(text);
+    }
+    return it->is_number() ? it->get<double>() : 0;
+}
+
+std::string text(const json& order, const char* key) {
+    auto it = order.find(key);
+    if (it == order.end() || it->is_null()) {
+        return "";
+    }
+    if (it->is_string()) {
+        return it->get<std::string>();
+    }
+    return it->is_number_integer() ? std::to_string(it->get<long long>()) : it->dump();
+}
+
+bool matches(const Order& order, const std::string& symbol) {
+    return symbol.empty() || order.symbol == symbol;
+}
+
+} // namespace
+
+OrderTracker::OrderTracker(size_t maxClosed) : maxClosed_(maxClosed) {}
+
+bool OrderTracker::apply(const Order& order) {
+    return apply(order, order.timestamp);
+}
+
+bool OrderTracker::apply(const Order& order, long long updatedAt) {
+    if (order.id.empty()) {
+        return false;
+    }
+    const bool closed = isClosed(order.status);
+    std::unique_lock<std::shared_mutex> lock(mutex_);
+    auto [it, inserted] = orders_.try_emplace(order.id);
+    Entry& entry = it->second;
+    if (!inserted) {
+        const bool reopens = entry.closed && !closed;
+        const bool older = updatedAt < entry.updatedAt && order.filled <= entry.order.filled &&
+                           !(closed && !entry.closed);
+        if (reopens || older || order.filled < entry.order.filled) {
+            ++stale_;
+            return false;
+        }
+    }
+    entry.order = order;
+    entry.updatedAt = updatedAt;
+    if (!order.clientOrderId.empty() &&
+        byClientOrderId_.emplace(order.clientOrderId, order.id).second) {
+        entry.clientOrderIds.push_back(order.clientOrderId);
+    }
+    if (closed && !entry.closed) {
+        entry.closed = true;
+        closed_.push_back(order.id);
+        while (closed_.size() > maxClosed_) {
+            const std::string oldest = std::move(closed_.front());
+            closed_.pop_front();
+            forget(oldest);
+        }
+    }
+    return true;
+}
+
+void OrderTracker::forget(const std::string& id) {
+    auto it = orders_.find(id);
+    if (it == orders_.end()) {
+        return;
+    }
+    for (const auto& clientOrderId : it->second.clientOrderIds) {
+        byClientOrderId_.erase(clientOrderId);
+    }
+    orders_.erase(it);
+}
+
+std::vector<std::string> OrderTracker::reconcile(const std::vector<Order>& open, const std::string& symbol,
+                                                 long long asOf) {
+    std::unordered_set<std::string> listed;
+    for (const auto& order : open) {
+        listed.insert(order.id);
+        apply(order, asOf);
+    }
+    std::vector<std::string> vanished;
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    for (const auto& [id, entry] : orders_) {
+        // Anything updated after the snapshot was taken is newer than it
+        if (!entry.closed && entry.updatedAt < asOf && matches(entry.order, symbol) && !listed.count(id)) {
+            vanished.push_back(id);
+        }
+    }
+    return vanished;
+}
+
+std::optional<Order> OrderTracker::byId(const std::string& id) const {
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    auto it = orders_.find(id);
+    if (it == orders_.end()) {
+        return std::nullopt;
+    }
+    return it->second.order;
+}
+
+std::optional<Order> OrderTracker::byClientOrderId(const std::string& clientOrderId) const {
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    auto id = byClientOrderId_.find(clientOrderId);
+    if (id == byClientOrderId_.end()) {
+        return std::nullopt;
+    }
+    return orders_.at(id->second).order;
+}
+
+std::vector<Order> OrderTracker::open(const std::string& symbol) const {
+    std::vector<Order> result;
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    for (const auto& [id, entry] : orders_) {
+        if (!entry.closed && matches(entry.order, symbol)) {
+            result.push_back(entry.order);
+        }
+    }
+    return result;
+}
+
+size_t OrderTracker::size() const {
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    return orders_.size();
+}
+
+uint64_t OrderTracker::stale() const {
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    return stale_;
+}
+
+bool OrderTracker::isClosed(const std::string& status) {
+    static const std::unordered_set<std::string> closed = {
+        "closed", "canceled", "expired", "rejected",
+        "FILLED", "CANCELED", "EXPIRED", "REJECTED", "EXPIRED_IN_MATCH"};
+    return closed.count(status) != 0;
+}
+
+Order OrderTracker::fromJson(const json& order) {
+    Order result{};
+    result.id = text(order, "id");
+    result.clientOrderId = text(order, "clientOrderId");
+    result.datetime = text(order, "datetime");
+    result.timestamp = static_cast<long long>(number(order, "timestamp"));
+    result.lastTradeTimestamp = text(order, "lastTradeTimestamp");
+    result.status = text(order, "status");
+    result.symbol = text(order, "symbol");
+    result.type = text(order, "type");
+    result.timeInForce = text(order, "timeInForce");
+    result.side = text(order, "side");
+    result.price = number(order, "price");
+    result.average = number(order, "average");
+    result.amount = number(order, "amount");
+    result.filled = number(order, "filled");
+    result.remaining = number(order, "remaining");
+    result.cost = number(order, "cost");
+    return result;
+}
+
+} // namespace ccxt
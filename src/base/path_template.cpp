@@ -0,0 +1,73 @@
+#include "ccxt/base/path_template.h"
+
+namespace ccxt {
+
+PathTemplate::PathTemplate(const std::string& path) {
+    size_t pos = 0;
+    while (pos < path.size()) {
+        size_t open = path.find('{', pos);
+        size_t close = open == std::string::npos ? std::string::npos : path.find('}', open + 1);
+        if (close == std::string::npos) {
+            segments_.push_back({path.substr(pos), false});
+            literalSize_ += path.size() - pos;
+            break;
+        }
+        if (open > pos) {
+            segments_.push_back({path.substr(pos, open - pos), false});
+            literalSize_ += open - pos;
+        }
+        if (close == open + 1) {
+            // "{}" is not a placeholder, keep it as text
+            segments_.push_back({"{}", false});
+            literalSize_ += 2;
+        } else {
+            std::string name = path.substr(open + 1, close - open - 1);
+            params_.push_back(name);
+            segments_.push_back({std::move(name), true});
+        }
+        pos = close + 1;
+    }
+}
+
+void PathTemplate::render(const json& params, std::string& out) const {
+    out.reserve(out.size() + literalSize_ + 16 * params_.size());
+    for (const auto& segment : segments_) {
+        if (!segment.placeholder) {
+            out += segment.text;
+            continue;
+        }
+        auto it = params.is_object() ? params.find(segment.text) : params.end();
+        if (it == params.end()) {
+            out += '{';
+            out += segment.text;
+            out += '}';
+        } else {
+            appendValue(*it, out);
+        }
+    }
+}
+
+std::string PathTemplate::render(const json& params) const {
+    std::string out;
+    render(params, out);
+    return out;
+}
+
+void PathTemplate::appendValue(const json& value, std::string& out) {
+    switch (value.type()) {
+        case json::value_t::string:
+            out += value.get_ref<const std::string&>();
+            break;
+        case json::value_t::number_integer:
+            out += std::to_string(value.get<long long>());
+            break;
+        case json::value_t::number_unsigned:
+            out += std::to_string(value.get<unsigned long long>());
+            break;
+        default:
+            out += value.dump();
+            break;
+    }
+}
+
+} // namespace ccxt
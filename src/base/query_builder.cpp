@@ -0,0 +1,200 @@
+#include "ccxt/base/query_builder.h"
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <cstring>
+#if defined(__SSE2__) && !defined(CCXT_NO_SIMD)
+#include <emmintrin.h>
+#define CCXT_QUERY_SSE2 1
+#endif
+
+namespace ccxt {
+
+namespace {
+
+constexpr std::array<bool, 256> makeUnreservedTable() {
+    std::array<bool, 256> table{};
+    for (int c = '0'; c <= '9'; ++c) table[c] = true;
+    for (int c = 'A'; c <= 'Z'; ++c) table[c] = true;
+    for (int c = 'a'; c <= 'z'; ++c) table[c] = true;
+    table['-'] = table['_'] = table['.'] = table['~'] = true;
+    return table;
+}
+
+constexpr std::array<bool, 256> kUnreserved = makeUnreservedTable();
+constexpr char kHexUpper[] = "0123456789ABCDEF";
+
+// Length of the leading run of characters that need no escaping
+size_t safeRunLength(const char* data, size_t size) {
+    size_t i = 0;
+#ifdef CCXT_QUERY_SSE2
+    const __m128i zeroMinus = _mm_set1_epi8('0' - 1);
+    const __m128i ninePlus = _mm_set1_epi8('9' + 1);
+    const __m128i lowerA = _mm_set1_epi8('a' - 1);
+    const __m128i lowerZ = _mm_set1_epi8('z' + 1);
+    const __m128i caseBit = _mm_set1_epi8(0x20);
+    const __m128i dash = _mm_set1_epi8('-');
+    const __m128i underscore = _mm_set1_epi8('_');
+    const __m128i dot = _mm_set1_epi8('.');
+    const __m128i tilde = _mm_set1_epi8('~');
+    for (; i + 16 <= size; i += 16) {
+        __m128i c = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+        // Bytes >= 0x80 compare as negative and fall outside every range
+        __m128i digit = _mm_and_si128(_mm_cmpgt_epi8(c, zeroMinus), _mm_cmplt_epi8(c, ninePlus));
+        __m128i folded = _mm_or_si128(c, caseBit);
+        __m128i alpha = _mm_and_si128(_mm_cmpgt_epi8(folded, lowerA), _mm_cmplt_epi8(folded, lowerZ));
+        __m128i mark = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(c, dash), _mm_cmpeq_epi8(c, underscore)),
+                                    _mm_or_si128(_mm_cmpeq_epi8(c, dot), _mm_cmpeq_epi8(c, tilde)));
+        unsigned mask = static_cast<unsigned>(_mm_movemask_epi8(_mm_or_si128(_mm_or_si128(digit, alpha), mark)));
+        if (mask != 0xFFFF) {
+            return i + static_cast<size_t>(__builtin_ctz(~mask));
+        }
+    }
+#endif
+    while (i < size && kUnreserved[static_cast<unsigned char>(data[i])]) {
+        ++i;
+    }
+    return i;
+}
+
+} // namespace
+
+void QueryBuilder::encode(std::string_view input, std::string& out) {
+    const char* data = input.data();
+    size_t size = input.size();
+    size_t pos = 0;
+    while (pos < size) {
+        size_t run = safeRunLength(data + pos, size - pos);
+        out.append(data + pos, run);
+        pos += run;
+        if (pos < size) {
+            unsigned char c = static_cast<unsigned char>(data[pos++]);
+            char escaped[3] = {'%', kHexUpper[c >> 4], kHexUpper[c & 0x0F]};
+            out.append(escaped, 3);
+        }
+    }
+}
+
+std::string QueryBuilder::encode(std::string_view input) {
+    std::string out;
+    out.reserve(input.size());
+    encode(input, out);
+    return out;
+}
+
+void QueryBuilder::clear() {
+    out_.clear();
+    scratch_.clear();
+    entries_.clear();
+    pairs_ = 0;
+    finalized_ = true;
+}
+
+std::string& QueryBuilder::beginPair(std::string_view key) {
+    std::string& target = sortedKeys_ ? scratch_ : out_;
+    if (!sortedKeys_ && pairs_ > 0) {
+        out_ += '&';
+    }
+    pairStart_ = target.size();
+    encode(key, target);
+    pairKeyLength_ = target.size() - pairStart_;
+    target += '=';
+    return target;
+}
+
+void QueryBuilder::endPair() {
+    if (sortedKeys_) {
+        entries_.push_back({pairStart_, pairKeyLength_, scratch_.size() - pairStart_});
+        finalized_ = false;
+    }
+    ++pairs_;
+}
+
+QueryBuilder& QueryBuilder::add(std::string_view key, std::string_view value) {
+    encode(value, beginPair(key));
+    endPair();
+    return *this;
+}
+
+QueryBuilder& QueryBuilder::addInteger(std::string_view key, long long value) {
+    char buffer[24];
+    auto result = std::to_chars(buffer, buffer + sizeof(buffer), value);
+    beginPair(key).append(buffer, result.ptr);
+    endPair();
+    return *this;
+}
+
+QueryBuilder& QueryBuilder::addNumber(std::string_view key, double value) {
+    // Shortest round-trip digits in plain notation, e.g. 1e-7 -> "0.0000001"
+    char buffer[512];
+    auto result = std::to_chars(buffer, buffer + sizeof(buffer), value, std::chars_format::fixed);
+    if (result.ec != std::errc()) {
+        result = std::to_chars(buffer, buffer + sizeof(buffer), value);
+    }
+    encode(std::string_view(buffer, result.ptr - buffer), beginPair(key));
+    endPair();
+    return *this;
+}
+
+QueryBuilder& QueryBuilder::add(std::string_view key, const json& value) {
+    switch (value.type()) {
+        case json::value_t::string:
+            return add(key, std::string_view(value.get_ref<const std::string&>()));
+        case json::value_t::number_integer:
+            return addInteger(key, value.get<long long>());
+        case json::value_t::number_unsigned: {
+            char buffer[24];
+            auto result = std::to_chars(buffer, buffer + sizeof(buffer), value.get<unsigned long long>());
+            beginPair(key).append(buffer, result.ptr);
+            endPair();
+            return *this;
+        }
+        case json::value_t::number_float:
+            return addNumber(key, value.get<double>());
+        case json::value_t::boolean:
+            return add(key, std::string_view(value.get<bool>() ? "true" : "false"));
+        default:
+            // Arrays and objects (e.g. batchOrders) are sent as encoded JSON
+            return add(key, std::string_view(value.dump()));
+    }
+}
+
+QueryBuilder& QueryBuilder::add(const json& params) {
+    if (params.is_object()) {
+        for (const auto& [key, value] : params.items()) {
+            add(key, value);
+        }
+    }
+    return *this;
+}
+
+void QueryBuilder::finalize() {
+    if (finalized_) {
+        return;
+    }
+    std::string_view scratch(scratch_);
+    std::sort(entries_.begin(), entries_.end(), [scratch](const Entry& a, const Entry& b) {
+        int order = scratch.substr(a.offset, a.keyLength).compare(scratch.substr(b.offset, b.keyLength));
+        return order != 0 ? order < 0 : a.offset < b.offset;
+    });
+    out_.clear();
+    for (size_t i = 0; i < entries_.size(); ++i) {
+        if (i > 0) {
+            out_ += '&';
+        }
+        out_.append(scratch_, entries_[i].offset, entries_[i].length);
+    }
+    finalized_ = true;
+}
+
+std::string_view QueryBuilder::view() {
+    finalize();
+    return out_;
+}
+
+const std::string& QueryBuilder::str() {
+    finalize();
+    return out_;
+}
+
+} // namespace ccxt
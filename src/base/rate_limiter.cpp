@@ -0,0 +1,49 @@
+#include "ccxt/base/rate_limiter.h"
+#include <algorithm>
+#include <thread>
+
+namespace ccxt {
+
+namespace {
+
+long long steadyNow() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+} // namespace
+
+RateLimiter::RateLimiter(double intervalMs)
+    : intervalNs_(static_cast<long long>(intervalMs * 1e6)) {}
+
+void RateLimiter::setInterval(double intervalMs) {
+    intervalNs_.store(static_cast<long long>(std::max(0.0, intervalMs) * 1e6), std::memory_order_relaxed);
+}
+
+double RateLimiter::interval() const {
+    return intervalNs_.load(std::memory_order_relaxed) / 1e6;
+}
+
+std::chrono::nanoseconds RateLimiter::reserve(double cost) {
+    const long long spacing = static_cast<long long>(intervalNs_.load(std::memory_order_relaxed) * cost);
+    if (spacing <= 0) {
+        return std::chrono::nanoseconds(0);
+    }
+    const long long now = steadyNow();
+    long long next = next_.load(std::memory_order_relaxed);
+    long long slot;
+    do {
+        slot = std::max(now, next);
+    } while (!next_.compare_exchange_weak(next, slot + spacing, std::memory_order_relaxed));
+    return std::chrono::nanoseconds(slot - now);
+}
+
+std::chrono::nanoseconds RateLimiter::acquire(double cost) {
+    const std::chrono::nanoseconds wait = reserve(cost);
+    if (wait.count() > 0) {
+        std::this_thread::sleep_for(wait);
+    }
+    return wait;
+}
+
+} // namespace ccxt
@@ -0,0 +1,111 @@
+#include "ccxt/base/request_metrics.h"
+#include <mutex>
+
+namespace ccxt {
+
+namespace {
+
+thread_local int64_t pendingSignTime = -1;
+
+} // namespace
+
+const char* phaseName(RequestPhase phase) {
+    switch (phase) {
+        case RequestPhase::Queue: return "queue";
+        case RequestPhase::Sign: return "sign";
+        case RequestPhase::Dns: return "dns";
+        case RequestPhase::Connect: return "connect";
+        case RequestPhase::Tls: return "tls";
+        case RequestPhase::FirstByte: return "firstByte";
+        case RequestPhase::Transfer: return "transfer";
+        case RequestPhase::Parse: return "parse";
+        case RequestPhase::Total: return "total";
+        default: return "unknown";
+    }
+}
+
+RequestMetrics::Endpoint& RequestMetrics::endpoint(std::string_view key) {
+    {
+        std::shared_lock<std::shared_mutex> lock(mutex_);
+        auto it = endpoints_.find(std::string(key));
+        if (it != endpoints_.end()) {
+            return *it->second;
+        }
+    }
+    std::unique_lock<std::shared_mutex> lock(mutex_);
+    auto& slot = endpoints_[std::string(key)];
+    if (!slot) {
+        slot = std::make_unique<Endpoint>();
+    }
+    return *slot;
+}
+
+void RequestMetrics::record(std::string_view key, const RequestTiming& timing, bool failed) {
+    Endpoint& target = endpoint(key);
+    target.requests.fetch_add(1, std::memory_order_relaxed);
+    if (failed) {
+        target.errors.fetch_add(1, std::memory_order_relaxed);
+    }
+    for (size_t i = 0; i < timing.phases.size(); ++i) {
+        if (timing.phases[i] >= 0) {
+            target.phases[i].record(static_cast<uint64_t>(timing.phases[i]));
+        }
+    }
+}
+
+MetricsSnapshot RequestMetrics::snapshot() const {
+    MetricsSnapshot result;
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    for (const auto& [key, source] : endpoints_) {
+        EndpointMetrics& metrics = result.endpoints[key];
+        metrics.requests = source->requests.load(std::memory_order_relaxed);
+        metrics.errors = source->errors.load(std::memory_order_relaxed);
+        for (size_t i = 0; i < source->phases.size(); ++i) {
+            metrics.phases[i] = source->phases[i].summary();
+        }
+    }
+    return result;
+}
+
+void RequestMetrics::reset() {
+    // Entries stay put: a concurrent record() may still hold one
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    for (auto& [key, target] : endpoints_) {
+        target->requests.store(0, std::memory_order_relaxed);
+        target->errors.store(0, std::memory_order_relaxed);
+        for (auto& histogram : target->phases) {
+            histogram.reset();
+        }
+    }
+}
+
+std::string RequestMetrics::endpointKey(std::string_view method, std::string_view url) {
+    const size_t scheme = url.find("://");
+    if (scheme != std::string_view::npos) {
+        url.remove_prefix(scheme + 3);
+        const size_t path = url.find('/');
+        url.remove_prefix(path == std::string_view::npos ? url.size() : path);
+    }
+    url = url.substr(0, url.find_first_of("?#"));
+    std::string key;
+    key.reserve(method.size() + 1 + url.size() + 1);
+    key.append(method).append(" ");
+    if (url.empty()) {
+        key += '/';
+    } else {
+        key.append(url);
+    }
+    return key;
+}
+
+void RequestMetrics::noteSignTime(int64_t nanoseconds) {
+    pendingSignTime = nanoseconds;
+}
+
+int64_t RequestMetrics::takeSignTime() {
+    const int64_t value = pendingSignTime;
+    pendingSignTime = -1;
+    return value;
+}
+
+} // namespace ccxt
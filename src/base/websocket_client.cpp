@@ -1,81 +1,297 @@
 #include <ccxt/base/websocket_client.h>
+#include <ccxt/base/dns_cache.h>
+#include <ccxt/base/errors.h>
+#include <ccxt/base/frame_recorder.h>
+#include <algorithm>
+#include <atomic>
+#include <charconv>
+#include <deque>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+#include <vector>
+#include <boost/beast/core.hpp>
+#include <boost/beast/websocket.hpp>
+#include <boost/beast/websocket/ssl.hpp>
+#include <boost/beast/ssl.hpp>
+#include <boost/asio/dispatch.hpp>
+#include <boost/asio/steady_timer.hpp>
+#include <boost/asio/post.hpp>
+#include <boost/asio/strand.hpp>
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/ip/tcp.hpp>
+#include <boost/asio/ssl/context.hpp>
+#include <boost/asio/ssl/stream.hpp>
 
 namespace ccxt {
 
+struct WebSocketClient::Pending {
+    std::string method;
+    std::promise<std::string> promise;
+    std::chrono::steady_clock::time_point sent;
+    std::chrono::steady_clock::time_point deadline;
+    LatencyHistogram* latency = nullptr;
+};
+
+struct WebSocketClient::Impl {
+    Impl(boost::asio::io_context& ioc, boost::asio::ssl::context& ctx)
+        : ioc_(ioc), ws_(ioc, ctx), timer_(ioc) {}
+
+    boost::asio::io_context& ioc_;
+
+    boost::beast::websocket::stream<boost::asio::ssl::stream<boost::asio::ip::tcp::socket>> ws_;
+    boost::beast::flat_buffer buffer_;
+    std::vector<boost::asio::ip::tcp::endpoint> endpoints_;
+    std::string host_;
+    std::string path_;
+    // Beast allows one write in flight, and none before the handshake is
+    // done; the rest wait here (IO thread only)
+    std::deque<std::string> writes_;
+    bool open_ = false;
+
+    std::atomic<uint64_t> nextRequestId_{1};
+    mutable std::mutex requestsMutex_;
+    std::unordered_map<uint64_t, std::unique_ptr<Pending>> pending_;
+    // Deadline timer_ is armed for; max() while nothing waits
+    std::chrono::steady_clock::time_point timerDeadline_ = std::chrono::steady_clock::time_point::max();
+    boost::asio::steady_timer timer_;
+    mutable std::shared_mutex latencyMutex_;
+    std::unordered_map<std::string, std::unique_ptr<LatencyHistogram>> latency_;
+};
+
+namespace {
+std::atomic<uint32_t> nextConnectionId{1};
+
+// Gap before the next address is tried while the previous is still
+// connecting (RFC 8305 recommends 250 ms)
+constexpr std::chrono::milliseconds kConnectionAttemptDelay{250};
+
+// Happy Eyeballs: the addresses are tried in order, each starting when the
+// previous one fails or hasn't connected within kConnectionAttemptDelay, with
+// the earlier attempts left running. The first socket to connect wins and
+// the others are closed, so a dead IPv6 route costs 250 ms rather than a
+// full connect timeout.
+class ConnectionRace : public std::enable_shared_from_this<ConnectionRace> {
+public:
+    using Handler = std::function<void(const boost::system::error_code&, boost::asio::ip::tcp::socket)>;
+
+    ConnectionRace(boost::asio::io_context& ioc, std::vector<boost::asio::ip::tcp::endpoint> endpoints,
+                   Handler handler)
+        : strand_(boost::asio::make_strand(ioc)), timer_(strand_), endpoints_(std::move(endpoints)),
+          handler_(std::move(handler)) {}
+
+    void start() {
+        auto self(shared_from_this());
+        boost::asio::dispatch(strand_, [this, self]() {
+            if (endpoints_.empty()) {
+                finish(boost::asio::error::host_not_found, nullptr);
+                return;
+            }
+            attempt();
+        });
+    }
+
+private:
+    void attempt() {
+        const size_t index = sockets_.size();
+        sockets_.push_back(std::make_unique<boost::asio::ip::tcp::socket>(strand_));
+        auto self(shared_from_this());
+        sockets_[index]->async_connect(endpoints_[index], [this, self, index](const boost::system::error_code& ec) {
+            onConnect(index, ec);
+        });
+        if (sockets_.size() < endpoints_.size()) {
+            timer_.expires_after(kConnectionAttemptDelay);
+            timer_.async_wait([this, self, index](const boost::system::error_code& ec) {
+                if (!ec && !done_ && sockets_.size() == index + 1) {
+                    attempt();
+                }
+            });
+        }
+    }
+
+    void onConnect(size_t index, const boost::system::error_code& ec) {
+        if (done_) {
+            return;
+        }
+        if (!ec) {
+            finish(ec, sockets_[index].get());
+            return;
+        }
+        if (++failed_ == endpoints_.size()) {
+            finish(ec, nullptr);
+        } else if (index + 1 == sockets_.size() && sockets_.size() < endpoints_.size()) {
+            // The newest attempt failed, don't wait out the delay
+            attempt();
+        }
+    }
+
+    void finish(const boost::system::error_code& ec, boost::asio::ip::tcp::socket* winner) {
+        done_ = true;
+        timer_.cancel();
+        boost::system::error_code ignored;
+        for (auto& socket : sockets_) {
+            if (socket.get() != winner) {
+                socket->close(ignored);
+            }
+        }
+        handler_(ec, winner ? std::move(*winner) : boost::asio::ip::tcp::socket(strand_));
+    }
+
+    boost::asio::strand<boost::asio::io_context::executor_type> strand_;
+    boost::asio::steady_timer timer_;
+    std::vector<boost::asio::ip::tcp::endpoint> endpoints_;
+    std::vector<std::unique_ptr<boost::asio::ip::tcp::socket>> sockets_;
+    size_t failed_ = 0;
+    bool done_ = false;
+    Handler handler_;
+};
+
+} // namespace
+
 WebSocketClient::WebSocketClient(boost::asio::io_context& ioc, boost::asio::ssl::context& ctx)
-    : ws_(ioc, ctx), resolver_(ioc) {}
+    : impl_(std::make_unique<Impl>(ioc, ctx)),
+      connectionId_(nextConnectionId.fetch_add(1, std::memory_order_relaxed)) {}
 
-WebSocketClient::~WebSocketClient() {
-    close();
-}
+// shared_from_this() is no longer available here, so there is no graceful
+// close handshake; destroying the stream drops the connection.
+WebSocketClient::~WebSocketClient() = default;
 
 void WebSocketClient::connect(const std::string& host, const std::string& port, const std::string& path) {
+    // Checked here, on the caller's thread, rather than in the IO handlers
+    unsigned short portNumber = 0;
+    const char* last = port.data() + port.size();
+    const auto parsed = std::from_chars(port.data(), last, portNumber);
+    if (parsed.ec != std::errc() || parsed.ptr != last || portNumber == 0) {
+        throw BadRequest("invalid WebSocket port '" + port + "' for " + host);
+    }
     auto self(shared_from_this());
-    resolver_.async_resolve(host, port,
-        [this, self](boost::beast::error_code ec, boost::asio::ip::tcp::resolver::results_type results) {
-            if (!ec) {
-                onResolve(ec, results);
+    impl_->host_ = host;
+    impl_->path_ = path.empty() ? "/" : path;
+    // SNI, required by most exchange endpoints behind CDNs
+    SSL_set_tlsext_host_name(impl_->ws_.next_layer().native_handle(), host.c_str());
+    // Reconnects find the name in the shared cache
+    DnsCache::shared().asyncResolve(impl_->ioc_, host, port,
+        [this, self, host, portNumber](const DnsCache::Addresses& addresses, std::exception_ptr error) {
+            if (error) {
+                try {
+                    std::rethrow_exception(error);
+                } catch (const std::exception& e) {
+                    failRequests("could not resolve " + host + ": " + e.what());
+                }
+                return;
+            }
+            impl_->endpoints_.clear();
+            boost::system::error_code ec;
+            for (const auto& address : addresses) {
+                const auto ip = boost::asio::ip::make_address(address, ec);
+                if (!ec) {
+                    impl_->endpoints_.emplace_back(ip, portNumber);
+                }
             }
+            onResolve(boost::system::error_code());
         });
 }
 
-void WebSocketClient::onResolve(boost::beast::error_code ec, boost::asio::ip::tcp::resolver::results_type results) {
+void WebSocketClient::onResolve(const boost::system::error_code& ec) {
     if (ec) return;
     auto self(shared_from_this());
-    boost::asio::async_connect(ws_.next_layer().next_layer(), results.begin(), results.end(),
-        [this, self](const boost::system::error_code& ec, typename boost::asio::ip::tcp::resolver::iterator it) {
-            if (!ec) {
-                onConnect(ec, it->endpoint());
+    auto race = std::make_shared<ConnectionRace>(impl_->ioc_, impl_->endpoints_,
+        [this, self](const boost::system::error_code& ec, boost::asio::ip::tcp::socket socket) {
+            if (ec) {
+                failRequests("connect failed: " + ec.message());
+                return;
             }
+            impl_->ws_.next_layer().next_layer() = std::move(socket);
+            onConnect(ec);
         });
+    race->start();
 }
 
-void WebSocketClient::onConnect(const boost::system::error_code& ec, const boost::asio::ip::tcp::endpoint& endpoint) {
+void WebSocketClient::onConnect(const boost::system::error_code& ec) {
     if (ec) return;
+    // Market data is many small frames; don't let Nagle hold them back
+    boost::system::error_code ignored;
+    impl_->ws_.next_layer().next_layer().set_option(boost::asio::ip::tcp::no_delay(true), ignored);
     auto self(shared_from_this());
-    ws_.next_layer().async_handshake(boost::asio::ssl::stream_base::client,
+    impl_->ws_.next_layer().async_handshake(boost::asio::ssl::stream_base::client,
         [this, self](boost::beast::error_code ec) {
-            if (!ec) {
-                onHandshake(ec);
+            if (ec) {
+                failRequests("TLS handshake failed: " + ec.message());
+                return;
             }
+            onHandshake(ec);
         });
 }
 
-void WebSocketClient::onHandshake(boost::beast::error_code ec) {
+void WebSocketClient::onHandshake(const boost::system::error_code& ec) {
     if (ec) return;
     auto self(shared_from_this());
-    ws_.async_handshake(ws_.next_layer().next_layer().remote_endpoint().address().to_string(), "",
+    impl_->ws_.async_handshake(impl_->host_, impl_->path_,
         [this, self](boost::beast::error_code ec) {
-            if (!ec) {
-                ws_.async_read(buffer_,
-                    [this, self](boost::beast::error_code ec, std::size_t bytes_transferred) {
-                        onRead(ec, bytes_transferred);
-                    });
+            if (ec) {
+                failRequests("WebSocket handshake failed: " + ec.message());
+                return;
+            }
+            impl_->open_ = true;
+            if (!impl_->writes_.empty()) {
+                write();
             }
+            impl_->ws_.async_read(impl_->buffer_,
+                [this, self](boost::beast::error_code ec, std::size_t bytes_transferred) {
+                    onRead(ec, bytes_transferred);
+                });
         });
 }
 
+// Safe from any thread: the message is copied and queued on the IO thread
 void WebSocketClient::send(const std::string& message) {
     auto self(shared_from_this());
-    ws_.async_write(boost::asio::buffer(message),
+    boost::asio::dispatch(impl_->ws_.get_executor(), [this, self, message]() {
+        impl_->writes_.push_back(message);
+        if (impl_->open_ && impl_->writes_.size() == 1) {
+            write();
+        }
+    });
+}
+
+void WebSocketClient::write() {
+    auto self(shared_from_this());
+    impl_->ws_.async_write(boost::asio::buffer(impl_->writes_.front()),
         [this, self](boost::beast::error_code ec, std::size_t bytes_transferred) {
             onWrite(ec, bytes_transferred);
         });
 }
 
-void WebSocketClient::onWrite(boost::beast::error_code ec, std::size_t bytes_transferred) {
-    if (ec) return;
-    // Handle write completion
+void WebSocketClient::onWrite(const boost::system::error_code& ec, std::size_t bytes_transferred) {
+    if (ec) {
+        // The queued requests were never sent; don't leave them to time out
+        impl_->open_ = false;
+        impl_->writes_.clear();
+        failRequests("write failed: " + ec.message());
+        return;
+    }
+    impl_->writes_.pop_front();
+    if (!impl_->writes_.empty()) {
+        write();
+    }
 }
 
-void WebSocketClient::onRead(boost::beast::error_code ec, std::size_t bytes_transferred) {
-    if (ec) return;
-    if (messageHandler_) {
-        messageHandler_(boost::beast::buffers_to_string(buffer_.data()));
+void WebSocketClient::onRead(const boost::system::error_code& ec, std::size_t bytes_transferred) {
+    if (ec) {
+        impl_->open_ = false;
+        failRequests("connection lost: " + ec.message());
+        return;
+    }
+    if (recorder_) {
+        const uint64_t receivedAt = FrameRecorder::now();
+        const auto frame = impl_->buffer_.data();
+        recorder_->record(connectionId_, receivedAt,
+                          std::string_view(static_cast<const char*>(frame.data()), frame.size()));
     }
-    buffer_.consume(bytes_transferred);
+    deliver(boost::beast::buffers_to_string(impl_->buffer_.data()));
+    impl_->buffer_.consume(bytes_transferred);
     auto self(shared_from_this());
-    ws_.async_read(buffer_,
+    impl_->ws_.async_read(impl_->buffer_,
         [this, self](boost::beast::error_code ec, std::size_t bytes_transferred) {
             onRead(ec, bytes_transferred);
         });
@@ -83,11 +299,13 @@ void WebSocketClient::onRead(boost::beast::error_code ec, std::size_t bytes_tran
 
 void WebSocketClient::close() {
     auto self(shared_from_this());
-    ws_.async_close(boost::beast::websocket::close_code::normal,
-        boost::beast::bind_front_handler(&WebSocketClient::onClose, self));
+    impl_->ws_.async_close(boost::beast::websocket::close_code::normal,
+        [this, self](boost::beast::error_code ec) {
+            onClose(ec);
+        });
 }
 
-void WebSocketClient::onClose(boost::beast::error_code ec) {
+void WebSocketClient::onClose(const boost::system::error_code& ec) {
     if (ec) return;
     // Handle close completion
 }
@@ -96,4 +314,169 @@ void WebSocketClient::setMessageHandler(MessageHandler handler) {
     messageHandler_ = handler;
 }
 
+void WebSocketClient::deliver(const std::string& message) {
+    handleMessage(message);
+    if (messageHandler_) {
+        messageHandler_(message);
+    }
+}
+
+void WebSocketClient::setRecorder(std::shared_ptr<FrameRecorder> recorder) {
+    recorder_ = std::move(recorder);
+}
+
+uint64_t WebSocketClient::nextRequestId() {
+    return impl_->nextRequestId_.fetch_add(1, std::memory_order_relaxed);
+}
+
+std::future<std::string> WebSocketClient::request(uint64_t id, const std::string& method, const std::string& message,
+                                                  std::chrono::milliseconds timeout) {
+    auto pending = std::make_unique<Pending>();
+    pending->method = method;
+    {
+        std::shared_lock<std::shared_mutex> lock(impl_->latencyMutex_);
+        auto it = impl_->latency_.find(method);
+        if (it != impl_->latency_.end()) {
+            pending->latency = it->second.get();
+        }
+    }
+    if (!pending->latency) {
+        std::unique_lock<std::shared_mutex> lock(impl_->latencyMutex_);
+        auto& histogram = impl_->latency_[method];
+        if (!histogram) {
+            histogram = std::make_unique<LatencyHistogram>();
+        }
+        pending->latency = histogram.get();
+    }
+    std::future<std::string> response = pending->promise.get_future();
+    bool arm = false;
+    {
+        std::lock_guard<std::mutex> lock(impl_->requestsMutex_);
+        if (impl_->pending_.count(id)) {
+            throw BadRequest("request id " + std::to_string(id) + " is already pending");
+        }
+        pending->sent = std::chrono::steady_clock::now();
+        pending->deadline = pending->sent + timeout;
+        if (pending->deadline < impl_->timerDeadline_) {
+            impl_->timerDeadline_ = pending->deadline;
+            arm = true;
+        }
+        impl_->pending_.emplace(id, std::move(pending));
+    }
+    send(message);
+    if (arm) {
+        armTimer();
+    }
+    return response;
+}
+
+size_t WebSocketClient::pendingRequests() const {
+    std::lock_guard<std::mutex> lock(impl_->requestsMutex_);
+    return impl_->pending_.size();
+}
+
+std::map<std::string, HistogramSummary> WebSocketClient::requestLatency() const {
+    std::map<std::string, HistogramSummary> result;
+    std::shared_lock<std::shared_mutex> lock(impl_->latencyMutex_);
+    for (const auto& [method, histogram] : impl_->latency_) {
+        result[method] = histogram->summary();
+    }
+    return result;
+}
+
+std::unique_ptr<WebSocketClient::Pending> WebSocketClient::take(uint64_t id) {
+    std::lock_guard<std::mutex> lock(impl_->requestsMutex_);
+    auto it = impl_->pending_.find(id);
+    if (it == impl_->pending_.end()) {
+        return nullptr;
+    }
+    std::unique_ptr<Pending> pending = std::move(it->second);
+    impl_->pending_.erase(it);
+    return pending;
+}
+
+bool WebSocketClient::resolve(uint64_t id, const std::string& response) {
+    std::unique_ptr<Pending> pending = take(id);
+    if (!pending) {
+        return false;
+    }
+    pending->latency->record(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now() - pending->sent).count());
+    pending->promise.set_value(response);
+    return true;
+}
+
+bool WebSocketClient::reject(uint64_t id, std::exception_ptr error) {
+    std::unique_ptr<Pending> pending = take(id);
+    if (!pending) {
+        return false;
+    }
+    // An error response is still a full round trip
+    pending->latency->record(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now() - pending->sent).count());
+    pending->promise.set_exception(std::move(error));
+    return true;
+}
+
+void WebSocketClient::armTimer() {
+    auto self(shared_from_this());
+    boost::asio::dispatch(impl_->timer_.get_executor(), [this, self]() {
+        std::chrono::steady_clock::time_point deadline;
+        {
+            std::lock_guard<std::mutex> lock(impl_->requestsMutex_);
+            deadline = impl_->timerDeadline_;
+        }
+        if (deadline == std::chrono::steady_clock::time_point::max()) {
+            return;
+        }
+        // Re-arming cancels the previous wait, whose handler sees operation_aborted
+        impl_->timer_.expires_at(deadline);
+        impl_->timer_.async_wait([this, self](const boost::system::error_code& ec) {
+            if (!ec) {
+                expireRequests();
+            }
+        });
+    });
+}
+
+void WebSocketClient::expireRequests() {
+    const auto now = std::chrono::steady_clock::now();
+    std::vector<std::pair<uint64_t, std::unique_ptr<Pending>>> expired;
+    bool rearm = false;
+    {
+        std::lock_guard<std::mutex> lock(impl_->requestsMutex_);
+        auto next = std::chrono::steady_clock::time_point::max();
+        for (auto it = impl_->pending_.begin(); it != impl_->pending_.end();) {
+            if (it->second->deadline <= now) {
+                expired.emplace_back(it->first, std::move(it->second));
+                it = impl_->pending_.erase(it);
+            } else {
+                next = std::min(next, it->second->deadline);
+                ++it;
+            }
+        }
+        impl_->timerDeadline_ = next;
+        rearm = next != std::chrono::steady_clock::time_point::max();
+    }
+    for (auto& [id, pending] : expired) {
+        pending->promise.set_exception(std::make_exception_ptr(
+            RequestTimeout(pending->method + " request " + std::to_string(id) + " timed out")));
+    }
+    if (rearm) {
+        armTimer();
+    }
+}
+
+void WebSocketClient::failRequests(const std::string& reason) {
+    std::unordered_map<uint64_t, std::unique_ptr<Pending>> failed;
+    {
+        std::lock_guard<std::mutex> lock(impl_->requestsMutex_);
+        failed.swap(impl_->pending_);
+        impl_->timerDeadline_ = std::chrono::steady_clock::time_point::max();
+    }
+    for (auto& [id, pending] : failed) {
+        pending->promise.set_exception(std::make_exception_ptr(NetworkError(reason)));
+    }
+}
+
 } // namespace ccxt
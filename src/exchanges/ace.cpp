@@ -1,4 +1,6 @@
 #include "ccxt/exchanges/ace.h"
+#include "ccxt/base/executor.h"
+#include "ccxt/base/logger.h"
 #include <boost/beast/core.hpp>
 #include <boost/beast/http.hpp>
 #include <boost/beast/ssl.hpp>
@@ -29,16 +31,16 @@ void Ace::fetchMarkets() {
         curl_easy_getinfo(curl, CURLINFO_RESPONSE_CODE, &httpCode);
 
         if(res != CURLE_OK) {
-            std::cerr << "curl_easy_perform() failed: " << curl_easy_strerror(res) << std::endl;
+            CCXT_LOG_ERROR("curl_easy_perform() failed: " << curl_easy_strerror(res));
         } else if (httpCode != 200) {
-            std::cerr << "HTTP request failed with code: " << httpCode << std::endl;
+            CCXT_LOG_ERROR("HTTP request failed with code: " << httpCode);
         } else {
             try {
                 auto jsonResponse = nlohmann::json::parse(readBuffer);
                 // Process the JSON response (e.g., store market data)
-                std::cout << jsonResponse.dump(4) << std::endl; // Pretty print
+                CCXT_LOG_TRACE(jsonResponse.dump());
             } catch (const nlohmann::json::parse_error& e) {
-                std::cerr << "JSON parse error: " << e.what() << std::endl;
+                CCXT_LOG_ERROR("JSON parse error: " << e.what());
             }
         }
         curl_easy_cleanup(curl);
@@ -78,16 +80,16 @@ void Ace::createOrder(const std::string& symbol, const std::string& type, const
         curl_easy_getinfo(curl, CURLINFO_RESPONSE_CODE, &httpCode);
 
         if(res != CURLE_OK) {
-            std::cerr << "curl_easy_perform() failed: " << curl_easy_strerror(res) << std::endl;
+            CCXT_LOG_ERROR("curl_easy_perform() failed: " << curl_easy_strerror(res));
         } else if (httpCode != 200) {
-            std::cerr << "HTTP request failed with code: " << httpCode << std::endl;
+            CCXT_LOG_ERROR("HTTP request failed with code: " << httpCode);
         } else {
             try {
                 auto jsonResponse = nlohmann::json::parse(readBuffer);
                 // Process the JSON response (e.g., check order status)
-                std::cout << jsonResponse.dump(4) << std::endl; // Pretty print
+                CCXT_LOG_TRACE(jsonResponse.dump());
             } catch (const nlohmann::json::parse_error& e) {
-                std::cerr << "JSON parse error: " << e.what() << std::endl;
+                CCXT_LOG_ERROR("JSON parse error: " << e.what());
             }
         }
         curl_easy_cleanup(curl);
@@ -655,47 +657,46 @@ json Ace::fetchOrderTrades(const std::string& id, const std::string& symbol,
 }
 
 // Async Methods using Boost.Coroutine2
-AsyncPullType Ace::fetchMarketsAsync(const json& params) {
-    return AsyncPullType(
-        [this, params](boost::coroutines2::coroutine<json>::push_type& yield) {
+std::future<json> Ace::fetchMarketsAsync(const json& params) {
+    return Executor::shared().submit(
+        [this, params]() {
             try {
                 auto result = this->fetchMarkets(params);
-                yield(result);
+                return result;
             } catch (const std::exception& e) {
                 throw;
             }
         });
 }
 
-AsyncPullType Ace::fetchTickerAsync(const std::string& symbol, const json& params) {
-    return AsyncPullType(
-        [this, symbol, params](boost::coroutines2::coroutine<json>::push_type& yield) {
+std::future<json> Ace::fetchTickerAsync(const std::string& symbol, const json& params) {
+    return Executor::shared().submit(
+        [this, symbol, params]() {
             try {
                 auto result = this->fetchTicker(symbol, params);
-                yield(result);
+                return result;
             } catch (const std::exception& e) {
                 throw;
             }
         });
 }
 
-AsyncPullType Ace::fetchTickersAsync(
+std::future<json> Ace::fetchTickersAsync(
     const std::vector<std::string>& symbols, const json& params) {
-    return AsyncPullType(
-        [this, symbols, params](boost::coroutines2::coroutine<json>::push_type& yield) {
+    return Executor::shared().submit(
+        [this, symbols, params]() {
             try {
                 auto result = this->fetchTickers(symbols, params);
-                yield(result);
+                return result;
             } catch (const std::exception& e) {
                 throw;
             }
         });
 }
 
-AsyncPullType Ace::fetchTickersAsync(
+std::future<json> Ace::fetchTickersAsync(
     const std::vector<std::string>& symbols, const json& params) {
-    return AsyncPullType(
-        [&](boost::coroutines2::coroutine<json>::push_type& yield) {
+    return Executor::shared().submit([=]() {
             this->loadMarkets();
             auto response = this->fetch("/api/v2/spot/tickers", "GET", params);
             auto data = this->safeValue(response, "data", json::array());
@@ -708,17 +709,16 @@ AsyncPullType Ace::fetchTickersAsync(
                 result[symbol] = this->parseTicker(ticker, market);
             }
             
-            yield(this->filterByArray(result, "symbol", symbols));
+            return this->filterByArray(result, "symbol", symbols);
         }
     );
 }
 
-AsyncPullType Ace::fetchMyTradesAsync(const std::string& symbol,
+std::future<json> Ace::fetchMyTradesAsync(const std::string& symbol,
                                                                       const long* since,
                                                                       const long* limit,
                                                                       const json& params) {
-    return AsyncPullType(
-        [&](boost::coroutines2::coroutine<json>::push_type& yield) {
+    return Executor::shared().submit([=]() {
             if (symbol.empty()) {
                 throw ArgumentsRequired("fetchMyTradesAsync() requires a symbol argument");
             }
@@ -737,18 +737,17 @@ AsyncPullType Ace::fetchMyTradesAsync(const std::string& symbol,
             }
             
             auto response = this->fetch("/api/v2/spot/myTrades", "GET", this->extend(request, params));
-            yield(this->parseTrades(response["data"], market, since, limit));
+            return this->parseTrades(response["data"], market, since, limit);
         }
     );
 }
 
-AsyncPullType Ace::fetchOrderTradesAsync(const std::string& id,
+std::future<json> Ace::fetchOrderTradesAsync(const std::string& id,
                                                                          const std::string& symbol,
                                                                          const long* since,
                                                                          const long* limit,
                                                                          const json& params) {
-    return AsyncPullType(
-        [&](boost::coroutines2::coroutine<json>::push_type& yield) {
+    return Executor::shared().submit([=]() {
             if (symbol.empty()) {
                 throw ArgumentsRequired("fetchOrderTradesAsync() requires a symbol argument");
             }
@@ -765,125 +764,124 @@ AsyncPullType Ace::fetchOrderTradesAsync(const std::string& id,
             }
             
             auto response = this->fetch("/api/v2/spot/orderTrades", "GET", this->extend(request, params));
-            yield(this->parseTrades(response["data"], market, since, limit));
+            return this->parseTrades(response["data"], market, since, limit);
         }
     );
 }
 
-AsyncPullType Ace::fetchOrderBookAsync(
+std::future<json> Ace::fetchOrderBookAsync(
     const std::string& symbol, const long* limit, const json& params) {
-    return AsyncPullType(
-        [this, symbol, limit, params](boost::coroutines2::coroutine<json>::push_type& yield) {
+    return Executor::shared().submit(
+        [this, symbol, limit, params]() {
             try {
                 auto result = this->fetchOrderBook(symbol, limit, params);
-                yield(result);
+                return result;
             } catch (const std::exception& e) {
                 throw;
             }
         });
 }
 
-AsyncPullType Ace::fetchOHLCVAsync(
+std::future<json> Ace::fetchOHLCVAsync(
     const std::string& symbol, const std::string& timeframe,
     const long* since, const long* limit,
     const json& params) {
-    return AsyncPullType(
-        [this, symbol, timeframe, since, limit, params](boost::coroutines2::coroutine<json>::push_type& yield) {
+    return Executor::shared().submit(
+        [this, symbol, timeframe, since, limit, params]() {
             try {
                 auto result = this->fetchOHLCV(symbol, timeframe, since, limit, params);
-                yield(result);
+                return result;
             } catch (const std::exception& e) {
                 throw;
             }
         });
 }
 
-AsyncPullType Ace::createOrderAsync(
+std::future<json> Ace::createOrderAsync(
     const std::string& symbol, const std::string& type, const std::string& side,
     const double& amount, const double* price,
     const json& params) {
-    return AsyncPullType(
-        [this, symbol, type, side, amount, price, params](boost::coroutines2::coroutine<json>::push_type& yield) {
+    return Executor::shared().submit(
+        [this, symbol, type, side, amount, price, params]() {
             try {
                 auto result = this->createOrder(symbol, type, side, amount, price, params);
-                yield(result);
+                return result;
             } catch (const std::exception& e) {
                 throw;
             }
         });
 }
 
-AsyncPullType Ace::cancelOrderAsync(
+std::future<json> Ace::cancelOrderAsync(
     const std::string& id, const std::string& symbol, const json& params) {
-    return AsyncPullType(
-        [this, id, symbol, params](boost::coroutines2::coroutine<json>::push_type& yield) {
+    return Executor::shared().submit(
+        [this, id, symbol, params]() {
             try {
                 auto result = this->cancelOrder(id, symbol, params);
-                yield(result);
+                return result;
             } catch (const std::exception& e) {
                 throw;
             }
         });
 }
 
-AsyncPullType Ace::fetchOrderAsync(
+std::future<json> Ace::fetchOrderAsync(
     const std::string& id, const std::string& symbol, const json& params) {
-    return AsyncPullType(
-        [this, id, symbol, params](boost::coroutines2::coroutine<json>::push_type& yield) {
+    return Executor::shared().submit(
+        [this, id, symbol, params]() {
             try {
                 auto result = this->fetchOrder(id, symbol, params);
-                yield(result);
+                return result;
             } catch (const std::exception& e) {
                 throw;
             }
         });
 }
 
-AsyncPullType Ace::fetchOpenOrdersAsync(
+std::future<json> Ace::fetchOpenOrdersAsync(
     const std::string& symbol, const long* since,
     const long* limit, const json& params) {
-    return AsyncPullType(
-        [this, symbol, since, limit, params](boost::coroutines2::coroutine<json>::push_type& yield) {
+    return Executor::shared().submit(
+        [this, symbol, since, limit, params]() {
             try {
                 auto result = this->fetchOpenOrders(symbol, since, limit, params);
-                yield(result);
+                return result;
             } catch (const std::exception& e) {
                 throw;
             }
         });
 }
 
-AsyncPullType Ace::fetchMyTradesAsync(
+std::future<json> Ace::fetchMyTradesAsync(
     const std::string& symbol, const long* since,
     const long* limit, const json& params) {
-    return AsyncPullType(
-        [this, symbol, since, limit, params](boost::coroutines2::coroutine<json>::push_type& yield) {
+    return Executor::shared().submit(
+        [this, symbol, since, limit, params]() {
             try {
                 auto result = this->fetchMyTrades(symbol, since, limit, params);
-                yield(result);
+                return result;
             } catch (const std::exception& e) {
                 throw;
             }
         });
 }
 
-AsyncPullType Ace::fetchBalanceAsync(const json& params) {
-    return AsyncPullType(
-        [this, params](boost::coroutines2::coroutine<json>::push_type& yield) {
+std::future<json> Ace::fetchBalanceAsync(const json& params) {
+    return Executor::shared().submit(
+        [this, params]() {
             try {
                 auto result = this->fetchBalance(params);
-                yield(result);
+                return result;
             } catch (const std::exception& e) {
                 throw;
             }
         });
 }
 
-AsyncPullType Ace::fetchClosedOrdersAsync(
+std::future<json> Ace::fetchClosedOrdersAsync(
     const std::string& symbol, const long* since,
     const long* limit, const json& params) {
-    return AsyncPullType(
-        [&](boost::coroutines2::coroutine<json>::push_type& yield) {
+    return Executor::shared().submit([=]() {
             if (symbol.empty()) {
                 throw ArgumentsRequired("fetchClosedOrdersAsync() requires a symbol argument");
             }
@@ -903,7 +901,7 @@ AsyncPullType Ace::fetchClosedOrdersAsync(
             }
             
             auto response = this->fetch("/api/v2/spot/orders", "GET", this->extend(request, params));
-            yield(this->parseOrders(response["data"], market, since, limit));
+            return this->parseOrders(response["data"], market, since, limit);
         }
     );
 }
@@ -988,11 +986,10 @@ json Ace::fetchDeposits(const std::string& code, const long* since,
     return this->parseTransactions(data, currency["code"], since, limit);
 }
 
-AsyncPullType Ace::fetchDepositsAsync(
+std::future<json> Ace::fetchDepositsAsync(
     const std::string& code, const long* since,
     const long* limit, const json& params) {
-    return AsyncPullType(
-        [&](boost::coroutines2::coroutine<json>::push_type& yield) {
+    return Executor::shared().submit([=]() {
             if (code.empty()) {
                 throw ArgumentsRequired("fetchDepositsAsync() requires a code argument");
             }
@@ -1012,7 +1009,7 @@ AsyncPullType Ace::fetchDepositsAsync(
             
             auto response = this->fetch("/api/v2/account/deposits", "GET", this->extend(request, params));
             auto data = this->safeValue(response, "data", json::array());
-            yield(this->parseTransactions(data, currency["code"], since, limit));
+            return this->parseTransactions(data, currency["code"], since, limit);
         }
     );
 }
@@ -1063,9 +1060,8 @@ json Ace::fetchCurrencies(const json& params) {
     return result;
 }
 
-AsyncPullType Ace::fetchCurrenciesAsync(const json& params) {
-    return AsyncPullType(
-        [&](boost::coroutines2::coroutine<json>::push_type& yield) {
+std::future<json> Ace::fetchCurrenciesAsync(const json& params) {
+    return Executor::shared().submit([=]() {
             auto response = this->fetch("/api/v2/spot/currencies", "GET", params);
             auto data = this->safeValue(response, "data", json::array());
             auto result = json::object();
@@ -1076,7 +1072,7 @@ AsyncPullType Ace::fetchCurrenciesAsync(const json& params) {
                 result[code] = parsed;
             }
             
-            yield(result);
+            return result;
         }
     );
 }
@@ -1107,11 +1103,10 @@ json Ace::fetchWithdrawals(const std::string& code, const long* since,
     });
 }
 
-AsyncPullType Ace::fetchWithdrawalsAsync(
+std::future<json> Ace::fetchWithdrawalsAsync(
     const std::string& code, const long* since,
     const long* limit, const json& params) {
-    return AsyncPullType(
-        [&](boost::coroutines2::coroutine<json>::push_type& yield) {
+    return Executor::shared().submit([=]() {
             if (code.empty()) {
                 throw ArgumentsRequired("fetchWithdrawalsAsync() requires a code argument");
             }
@@ -1131,9 +1126,9 @@ AsyncPullType Ace::fetchWithdrawalsAsync(
             
             auto response = this->fetch("/api/v2/account/withdrawals", "GET", this->extend(request, params));
             auto data = this->safeValue(response, "data", json::array());
-            yield(this->parseTransactions(data, currency["code"], since, limit, {
+            return this->parseTransactions(data, currency["code"], since, limit, {
                 {"type", "withdrawal"}
-            }));
+            });
         }
     );
 }
@@ -1168,8 +1163,7 @@ json Ace::withdraw(const std::string& code, const double& amount, const std::str
 }
 
  {
-    return AsyncPullType(
-        [&](boost::coroutines2::coroutine<json>::push_type& yield) {
+    return Executor::shared().submit([=]() {
             if (code.empty()) {
                 throw ArgumentsRequired("withdrawAsync() requires a code argument");
             }
@@ -1194,7 +1188,7 @@ json Ace::withdraw(const std::string& code, const double& amount, const std::str
             
             auto response = this->fetch("/api/v2/account/withdraw", "POST", this->extend(request, params));
             auto data = this->safeValue(response, "data", json::object());
-            yield(this->parseTransaction(data, currency["code"]));
+            return this->parseTransaction(data, currency["code"]);
         }
     );
 }
@@ -1,10 +1,11 @@
 #include <ccxt/exchanges/binance.h>
+#include <ccxt/base/errors.h>
+#include <ccxt/base/query_builder.h>
+#include <ccxt/base/request_metrics.h>
+#include <algorithm>
 #include <chrono>
 #include <sstream>
 #include <iomanip>
-#include <openssl/hmac.h>
-#include <openssl/evp.h>
-#include <openssl/params.h>
 #include <boost/algorithm/string.hpp>
 
 namespace ccxt {
@@ -12,6 +13,14 @@ Binance::Binance(boost::asio::io_context& context, const Config& config)
     : Exchange(context, config) {
     config_.loadRest("config/binance_rest.json");
     config_.loadWs("config/binance_ws.json");
+    id = config_.json_rest.value("id", std::string("binance"));
+    name = config_.json_rest.value("name", std::string("Binance"));
+    rateLimit = config_.json_rest.value("rateLimit", rateLimit);
+    enableRateLimit = config_.json_rest.value("enableRateLimit", enableRateLimit);
+    maxOHLCVLimit = 1000;
+    if (config_.json_rest.contains("options") && config_.json_rest["options"].is_object()) {
+        recvWindow_ = config_.json_rest["options"].value("recvWindow", 0);
+    }
   
     // Initialize capabilities
     this->has.emplace("CORS", true);
@@ -237,7 +246,7 @@ std::string Binance::getMarketType(const std::string& symbol) const {
 }
 
 std::string Binance::getEndpoint(const std::string& path, const std::string& type) const {
-    return "";  // TODO: Implement
+    return config_.json_rest.at("urls").at("api").value(type, std::string()) + "/" + path;
 }
 
 // Market Data API
@@ -251,11 +260,8 @@ json Binance::fetchMarketsImpl() const {
 
 Market Binance::findMarket(const std::string& symbol) const {
     loadMarkets();
-    try {
-        return markets.at(symbol);
-    } catch (const std::out_of_range& e) {
-        throw std::runtime_error("Market '" + symbol + "' not found");
-    }
+    // market() reads under the lock loadMarkets() swaps under
+    return market(symbol);
 }    
 
 json Binance::fetchTickerImpl(const std::string& symbol) const {
@@ -263,8 +269,7 @@ json Binance::fetchTickerImpl(const std::string& symbol) const {
     Market market = findMarket(symbol);
     json request = json::object();
     request["symbol"] = market.id;
-    json response;// = this->publicGetTicker24hr(request);
-    return this->parseTicker(response, market);
+    return this->parseTicker(sendPublic("ticker/24hr", request), market);
 }
 
 json Binance::fetchTickersImpl(const std::vector<std::string>& symbols) const {
@@ -281,10 +286,7 @@ json Binance::fetchOrderBookImpl(const std::string& symbol, const std::optional<
     if (limit) {
         request["limit"] = *limit;
     }
-    json response;// = this->publicGetDepth(request);
-    json mkt = json::object();
-    mkt["symbol"] = symbol;
-    return this->parseOrderBook(response, symbol, market);
+    return this->parseOrderBook(sendPublic("depth", request), symbol, market);
 }
 
 json Binance::fetchTradesImpl(const std::string& symbol, const std::optional<long long>& since,
@@ -308,8 +310,10 @@ json Binance::fetchOHLCVImpl(const std::string& symbol, const std::string& timef
     
     json request = json::object();
     request["symbol"] = market.id;
-    request["interval"] = this->timeframes.at(timeframe);
-    
+    // Binance's interval names are the unified ones unless timeframes maps them
+    const auto interval = this->timeframes.find(timeframe);
+    request["interval"] = interval != this->timeframes.end() ? interval->second : timeframe;
+
     if (since) {
         request["startTime"] = *since;
     }
@@ -317,8 +321,15 @@ json Binance::fetchOHLCVImpl(const std::string& symbol, const std::string& timef
         request["limit"] = *limit;
     }
     
-    json response;// = this->publicGetKlines(request);
-    return this->parseOHLCV(response, market, timeframe);
+    const json response = sendPublic("klines", request);
+    if (!response.is_array()) {
+        throw BadResponse(id + " fetchOHLCV returned " + response.dump());
+    }
+    json result = json::array();
+    for (const auto& ohlcv : response) {
+        result.push_back(this->parseOHLCV(ohlcv, market, timeframe));
+    }
+    return result;
 }
 
 // Trading API
@@ -331,14 +342,15 @@ json Binance::createOrderImpl(const std::string& symbol, const std::string& type
     request["symbol"] = market.id;
     request["type"] = type;
     request["side"] = side;
-    request["amount"] = amount;
+    request["quantity"] = amount;
     if (price) {
         request["price"] = *price;
         request["timeInForce"] = "GTC";
     }
-    
-    json response;// = this->privatePostOrder(request);
-    return this->parseOrder(response, market);
+
+    std::map<std::string, std::string> headers;
+    const std::string url = sign("order", "private", "POST", request, headers);
+    return this->parseOrder(perform(url, "POST", headers), market);
 }
 
 json Binance::cancelOrderImpl(const std::string& id, const std::string& symbol) {
@@ -348,9 +360,10 @@ json Binance::cancelOrderImpl(const std::string& id, const std::string& symbol)
     json request = json::object();
     request["symbol"] = market.id;
     request["orderId"] = id;
-    
-    json response;// = this->privateDeleteOrder(request);
-    return this->parseOrder(response, market);
+
+    std::map<std::string, std::string> headers;
+    const std::string url = sign("order", "private", "DELETE", request, headers);
+    return this->parseOrder(perform(url, "DELETE", headers), market);
 }
 
 json Binance::fetchOrderImpl(const std::string& id, const std::string& symbol) const {
@@ -360,31 +373,38 @@ json Binance::fetchOrderImpl(const std::string& id, const std::string& symbol) c
     json request = json::object();
     request["symbol"] = market.id;
     request["orderId"] = id;
-    
-    json response;// = this->privateGetOrder(request);
+
+    std::map<std::string, std::string> headers;
+    const std::string url = sign("order", "private", "GET", request, headers);
+    const json response = perform(url, "GET", headers);
+    if (!response.is_object() || !response.contains("orderId")) {
+        throw OrderNotFound(this->id + " fetchOrder " + id + " returned " + response.dump());
+    }
     return this->parseOrder(response, market);
 }
 
 json Binance::loadMarkets() const {
-    if (!markets_loaded) {
+    if (!markets_loaded.load(std::memory_order_acquire)) {
         std::lock_guard<std::mutex> lock(markets_mutex);
-        if (!markets_loaded) {
+        if (!markets_loaded.load(std::memory_order_relaxed)) {
             json response;// = this->publicGetExchangeInfo();
             //this->markets = this->parseMarkets(response["symbols"]);
-            markets_loaded = true;
+            markets_loaded.store(true, std::memory_order_release);
         }
     }
     return json::object();
 }
 
 json Binance::privateGetAccount(const json& params) const {
-    return json::object();  // TODO: Implement
+    std::map<std::string, std::string> headers;
+    const std::string url = sign("account", "private", "GET", params, headers);
+    return perform(url, "GET", headers);
 }
 
 json Binance::fetchBalanceImpl() const {
     loadMarkets();
-    json response = this->privateGetAccount();
-    return this->parseBalance(response);
+    const json response = this->privateGetAccount();
+    return this->parseBalance(response.value("balances", json::array()));
 }
 
 json Binance::parseMarket(const json& market) const {
@@ -419,52 +439,44 @@ json Binance::parseMarket(const json& market) const {
 
 json Binance::parseTicker(const json& ticker, const Market& market) const {
     json result = json::object();
+    const long long timestamp = safeInteger(ticker, "closeTime");
     result["symbol"] = market.symbol;
-    result["timestamp"] = ticker["closeTime"];
-    result["datetime"] = this->iso8601(ticker["closeTime"].get<long long>());
-    result["high"] = ticker["highPrice"];
-    result["low"] = ticker["lowPrice"];
-    result["bid"] = ticker["bidPrice"];
-    result["ask"] = ticker["askPrice"];
-    result["last"] = ticker["lastPrice"];
-    result["baseVolume"] = ticker["volume"];
-    result["quoteVolume"] = ticker["quoteVolume"];
+    result["timestamp"] = timestamp;
+    result["datetime"] = this->iso8601(timestamp);
+    result["high"] = safeNumber(ticker, "highPrice");
+    result["low"] = safeNumber(ticker, "lowPrice");
+    result["bid"] = safeNumber(ticker, "bidPrice");
+    result["ask"] = safeNumber(ticker, "askPrice");
+    result["last"] = safeNumber(ticker, "lastPrice");
+    result["baseVolume"] = safeNumber(ticker, "volume");
+    result["quoteVolume"] = safeNumber(ticker, "quoteVolume");
     result["info"] = ticker;
-    
+
     return result;
 }
 
 json Binance::parseOrderBook(const json& orderbook, const std::string& symbol, const Market& market) const {
     json result = json::object();
-    result["timestamp"] = orderbook["T"];
-    result["datetime"] = this->iso8601(orderbook["T"].get<long long>());
-    result["nonce"] = orderbook["lastUpdateId"];
-    
-    json bids = json::array();
-    json asks = json::array();
-    
-    for (const auto& bid : orderbook["bids"]) {
-        if (bid.is_array() && bid.size() >= 2) {
-            json bidEntry = json::array();
-            bidEntry.push_back(bid[0].get<double>());  // price
-            bidEntry.push_back(bid[1].get<double>());  // amount
-            bids.push_back(bidEntry);
-        }
-    }
-    
-    for (const auto& ask : orderbook["asks"]) {
-        if (ask.is_array() && ask.size() >= 2) {
-            json askEntry = json::array();
-            askEntry.push_back(ask[0].get<double>());  // price
-            askEntry.push_back(ask[1].get<double>());  // amount
-            asks.push_back(askEntry);
+    // Only the futures depth carries a transaction time
+    const long long timestamp = safeInteger(orderbook, "T");
+    result["timestamp"] = timestamp ? json(timestamp) : json();
+    result["datetime"] = timestamp ? json(this->iso8601(timestamp)) : json();
+    result["nonce"] = orderbook.value("lastUpdateId", json());
+
+    // Levels come as ["price", "quantity"] strings
+    auto parseSide = [](const json& levels) {
+        json side = json::array();
+        for (const auto& level : levels) {
+            if (level.is_array() && level.size() >= 2) {
+                side.push_back({std::stod(level[0].get<std::string>()), std::stod(level[1].get<std::string>())});
+            }
         }
-    }
-    
-    result["bids"] = bids;
-    result["asks"] = asks;
+        return side;
+    };
+    result["bids"] = parseSide(orderbook.value("bids", json::array()));
+    result["asks"] = parseSide(orderbook.value("asks", json::array()));
     result["symbol"] = symbol;
-    
+
     return result;
 }
 
@@ -481,25 +493,27 @@ json Binance::parseOHLCV(const json& ohlcv, const Market& market, const std::str
 
 json Binance::parseOrder(const json& order, const Market& market) const {
     json result = json::object();
-    result["id"] = order["orderId"];
-    result["clientOrderId"] = order["clientOrderId"];
-    result["timestamp"] = order["time"];
-    result["datetime"] = this->iso8601(order["time"].get<long long>());
-    result["lastTradeTimestamp"] = order["updateTime"];
+    // Spot orders carry time and cummulativeQuoteQty, futures updateTime and cumQuote
+    const long long timestamp = this->safeInteger(order, "time", this->safeInteger(order, "updateTime"));
+    result["id"] = order.at("orderId");
+    result["clientOrderId"] = order.value("clientOrderId", json());
+    result["timestamp"] = timestamp;
+    result["datetime"] = this->iso8601(timestamp);
+    result["lastTradeTimestamp"] = order.value("updateTime", json());
     result["symbol"] = market.symbol;
-    result["type"] = this->parseOrderType(order["type"].get<std::string>());
-    result["side"] = this->parseOrderSide(order["side"].get<std::string>());
-    result["price"] = order["price"];
-    result["amount"] = order["origQty"];
-    result["cost"] = order["cummulativeQuoteQty"];
-    result["filled"] = order["executedQty"];
+    result["type"] = this->parseOrderType(order.value("type", std::string()));
+    result["side"] = this->parseOrderSide(order.value("side", std::string()));
+    result["price"] = order.value("price", json());
+    result["amount"] = order.value("origQty", json());
+    result["cost"] = order.contains("cumQuote") ? order["cumQuote"] : order.value("cummulativeQuoteQty", json());
+    result["filled"] = order.value("executedQty", json());
     
     // Calculate remaining amount
     double origQty = this->safeNumber(order, "origQty");
     double execQty = this->safeNumber(order, "executedQty");
     result["remaining"] = origQty - execQty;
     
-    result["status"] = this->parseOrderStatus(order["status"].get<std::string>());
+    result["status"] = this->parseOrderStatus(order.value("status", std::string()));
     result["fee"] = this->parseFee(order, market);
     result["trades"] = nullptr;
     result["info"] = order;
@@ -546,8 +560,8 @@ json Binance::parseBalance(const json& response) const {
 json Binance::parseFee(const json& fee, const Market& market) const {
     return json::object({
         {"currency", market.quote},
-        {"cost", fee["commission"]},
-        {"rate", fee["commissionRate"]}
+        {"cost", fee.value("commission", json())},
+        {"rate", fee.value("commissionRate", json())}
     });
 }
 
@@ -641,36 +655,11 @@ json Binance::parseDeposit(const json& deposit, const std::string& currency) con
 
 // Helper methods
 std::string Binance::getTimestamp() const {
-    return std::to_string(milliseconds());
+    return std::to_string(serverMilliseconds());
 }
 
-std::string Binance::createSignature(const std::string& queryString) const {
-    EVP_MAC* mac = EVP_MAC_fetch(nullptr, "HMAC", nullptr);
-    EVP_MAC_CTX* ctx = EVP_MAC_CTX_new(mac);
-    
-    OSSL_PARAM params[] = {
-        OSSL_PARAM_construct_utf8_string("digest", (char*)"sha256", 6),
-        OSSL_PARAM_construct_end()
-    };
-    
-    EVP_MAC_init(ctx, (const unsigned char*)this->config_.secret.c_str(), this->config_.secret.length(), params);
-    EVP_MAC_update(ctx, (const unsigned char*)queryString.c_str(), queryString.length());
-    
-    unsigned char digest[EVP_MAX_MD_SIZE];
-    size_t digestLen = 0;
-    EVP_MAC_final(ctx, digest, &digestLen, sizeof(digest));
-    
-    EVP_MAC_CTX_free(ctx);
-    EVP_MAC_free(mac);
-    
-    std::string result;
-    for (size_t i = 0; i < digestLen; i++) {
-        char hex[3];
-        snprintf(hex, sizeof(hex), "%02x", digest[i]);
-        result += hex;
-    }
-    
-    return result;
+void Binance::createSignature(std::string_view queryString, HmacSigner::Buffer& signature) const {
+    this->signer_.signHex(queryString, signature);
 }
 
 std::string Binance::parseOrderType(const std::string& type) const {
@@ -739,49 +728,52 @@ std::string Binance::sign(const std::string& path, const std::string& api,
                        const std::string& method, const json& params,
                        const std::map<std::string, std::string>& headers,
                        const json& body) const {
+    const auto started = std::chrono::steady_clock::now();
     std::string url = this->getEndpoint(path, api);
-    
-    if (api == "private" || api == "sapi" || api == "fapi") {
+    thread_local QueryBuilder query;
+    query.clear();
+    query.add(params);
+
+    if (api == "private" || api == "sapi" || api == "fapi" || api == "fapiPrivate") {
         //this->checkRequiredCredentials();
-        std::string timestamp = this->getTimestamp();
-        std::string queryString;// = this->extend(params, {{"timestamp", timestamp}}).dump();
-        
-        if (method == "POST" || method == "PUT" || method == "DELETE") {
-            if (!params.empty()) {
-                //body = params;
-            }
-        } else {
-            if (!params.empty()) {
-                url += "?" + this->urlencode(params);
-            }
+        // With ClockSync running this is the server's clock, so a tight
+        // recvWindow holds without -1021 rejections
+        if (recvWindow_ > 0) {
+            query.add("recvWindow", recvWindow_);
         }
-        
-        std::string signature = this->createSignature(queryString);
-        
+        query.add("timestamp", this->serverMilliseconds());
+        HmacSigner::Buffer signature;
+        this->createSignature(query.view(), signature);
+        query.add("signature", signature.view());
         const_cast<std::map<std::string, std::string>&>(headers)["X-MBX-APIKEY"] = this->config_.apiKey;
-        
         if (method == "POST" || method == "PUT" || method == "DELETE") {
             const_cast<std::map<std::string, std::string>&>(headers)["Content-Type"] = "application/json";
         }
-        
-        if (!params.empty()) {
-            url += url.find('?') != std::string::npos ? "&" : "?";
-            url += "signature=" + signature;
-        }
-    } else {
-        if (!params.empty()) {
-            url += "?" + this->urlencode(params);
-        }
     }
-    
+    // Binance accepts the (signed) query string on every method
+    if (!query.empty()) {
+        std::string_view encoded = query.view();
+        url.reserve(url.size() + 1 + encoded.size());
+        url += '?';
+        url += encoded;
+    }
+    RequestMetrics::noteSignTime(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now() - started).count());
     return url;
 }
+
 std::string Binance::urlencode(const json& params) const {
-    return "";  // TODO: Implement
+    thread_local QueryBuilder query;
+    query.clear();
+    query.add(params);
+    return query.str();
 }
 
 json Binance::fetchTimeImpl() const {
-    return json::object();  // TODO: Implement
+    const std::string url = config_.json_rest.at("urls").at("api").value("public", std::string()) + "/time";
+    // Unthrottled, so a limiter wait doesn't count as ClockSync round trip
+    const json response = perform(url, "GET", {}, "", false);
+    return response.at("serverTime");
 }
 
 json Binance::fetchCurrenciesImpl() const {
@@ -862,7 +854,35 @@ json Binance::fetchOrdersImpl(const std::string& symbol, const std::optional<lon
 
 json Binance::fetchOpenOrdersImpl(const std::string& symbol, const std::optional<long long>& since,
                                  const std::optional<int>& limit) const {
-    return json::object();  // TODO: Implement
+    loadMarkets();
+    json request = json::object();
+    Market market;
+    if (!symbol.empty()) {
+        market = findMarket(symbol);
+        request["symbol"] = market.id;
+    }
+    std::map<std::string, std::string> headers;
+    const std::string url = sign("openOrders", "private", "GET", request, headers);
+    const json response = perform(url, "GET", headers);
+    if (!response.is_array()) {
+        throw BadResponse(id + " fetchOpenOrders returned " + response.dump());
+    }
+
+    json result = json::array();
+    for (const auto& order : response) {
+        Market orderMarket = market;
+        if (symbol.empty()) {
+            // Without a symbol Binance lists every market's open orders
+            const std::string marketId = order.value("symbol", std::string());
+            try {
+                orderMarket = this->market(this->symbol(marketId));
+            } catch (const ExchangeError&) {
+                orderMarket.symbol = marketId;
+            }
+        }
+        result.push_back(this->parseOrder(order, orderMarket));
+    }
+    return result;
 }
 
 json Binance::fetchClosedOrdersImpl(const std::string& symbol, const std::optional<long long>& since,
@@ -880,6 +900,136 @@ json Binance::editOrderImpl(const std::string& id, const std::string& symbol, co
     return json::object();  // TODO: Implement
 }
 
+namespace {
+
+// fapi batchOrders limits per request
+constexpr size_t kMaxBatchOrders = 5;
+constexpr size_t kMaxBatchCancels = 10;
+
+} // namespace
+
+bool Binance::hasBatchOrders(const std::string& symbol) const {
+    try {
+        return market(symbol).type == "future";
+    } catch (const ExchangeError&) {
+        return false;
+    }
+}
+
+json Binance::batchOrder(const OrderRequest& order) {
+    Market market = findMarket(order.symbol);
+    json entry = json::object();
+    entry["symbol"] = market.id;
+    entry["side"] = boost::algorithm::to_upper_copy(order.side);
+    entry["quantity"] = amountToPrecision(order.symbol, order.amount);
+    if (!order.id.empty()) {
+        entry["orderId"] = order.id;
+    } else {
+        entry["type"] = boost::algorithm::to_upper_copy(order.type);
+    }
+    if (order.price) {
+        entry["price"] = priceToPrecision(order.symbol, *order.price);
+        if (order.id.empty()) {
+            entry["timeInForce"] = "GTC";
+        }
+    }
+    return entry;
+}
+
+void Binance::parseBatchOrders(const json& response, const std::vector<std::string>& ids,
+                               const std::vector<std::string>& symbols, json& result) const {
+    for (size_t i = 0; i < symbols.size(); ++i) {
+        const std::string id = i < ids.size() ? ids[i] : "";
+        if (!response.is_array() || i >= response.size()) {
+            result.push_back(rejectedOrder(id, symbols[i], "no response for batch entry"));
+        } else if (response[i].contains("code")) {
+            // Failed entries come back in place as {"code": ..., "msg": ...}
+            result.push_back(rejectedOrder(id, symbols[i], response[i].value("msg", std::string())));
+        } else {
+            result.push_back(this->parseOrder(response[i], findMarket(symbols[i])));
+        }
+    }
+}
+
+json Binance::sendPublic(const std::string& path, const json& request) const {
+    return perform(sign(path, "public", "GET", request, {}), "GET");
+}
+
+json Binance::sendBatch(const std::string& method, const json& request) const {
+    std::map<std::string, std::string> headers;
+    const std::string url = sign("batchOrders", "fapiPrivate", method, request, headers);
+    return perform(url, method, headers);
+}
+
+json Binance::createOrdersImpl(const std::vector<OrderRequest>& orders) {
+    loadMarkets();
+    for (const auto& order : orders) {
+        if (!hasBatchOrders(order.symbol)) {
+            return Exchange::createOrdersImpl(orders);
+        }
+    }
+    json result = json::array();
+    for (size_t start = 0; start < orders.size(); start += kMaxBatchOrders) {
+        const size_t end = std::min(orders.size(), start + kMaxBatchOrders);
+        json batch = json::array();
+        std::vector<std::string> symbols;
+        for (size_t i = start; i < end; ++i) {
+            batch.push_back(batchOrder(orders[i]));
+            symbols.push_back(orders[i].symbol);
+        }
+        json request = json::object();
+        request["batchOrders"] = batch.dump();
+        const json response = sendBatch("POST", request);
+        parseBatchOrders(response, {}, symbols, result);
+    }
+    return result;
+}
+
+json Binance::cancelOrdersImpl(const std::vector<std::string>& ids, const std::string& symbol) {
+    loadMarkets();
+    if (!hasBatchOrders(symbol)) {
+        return Exchange::cancelOrdersImpl(ids, symbol);
+    }
+    Market market = findMarket(symbol);
+    json result = json::array();
+    for (size_t start = 0; start < ids.size(); start += kMaxBatchCancels) {
+        const std::vector<std::string> chunk(ids.begin() + start,
+                                             ids.begin() + std::min(ids.size(), start + kMaxBatchCancels));
+        json request = json::object();
+        request["symbol"] = market.id;
+        request["orderIdList"] = json(chunk).dump();
+        const json response = sendBatch("DELETE", request);
+        parseBatchOrders(response, chunk, std::vector<std::string>(chunk.size(), symbol), result);
+    }
+    return result;
+}
+
+json Binance::editOrdersImpl(const std::vector<OrderRequest>& orders) {
+    loadMarkets();
+    for (const auto& order : orders) {
+        if (!hasBatchOrders(order.symbol)) {
+            return Exchange::editOrdersImpl(orders);
+        }
+    }
+    json result = json::array();
+    for (size_t start = 0; start < orders.size(); start += kMaxBatchOrders) {
+        const size_t end = std::min(orders.size(), start + kMaxBatchOrders);
+        json batch = json::array();
+        std::vector<std::string> ids;
+        std::vector<std::string> symbols;
+        for (size_t i = start; i < end; ++i) {
+            batch.push_back(batchOrder(orders[i]));
+            ids.push_back(orders[i].id);
+            symbols.push_back(orders[i].symbol);
+        }
+        json request = json::object();
+        request["batchOrders"] = batch.dump();
+        const json response = sendBatch("PUT", request);
+        parseBatchOrders(response, ids, symbols, result);
+    }
+    return result;
+}
+
 json Binance::setLeverageImpl(int leverage, const std::string& symbol) {
     return json::object();  // TODO: Implement
 }
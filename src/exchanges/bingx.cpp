@@ -1,4 +1,5 @@
 #include "ccxt/exchanges/bingx.h"
+#include "ccxt/base/executor.h"
 #include <boost/beast/http.hpp>
 #include <boost/beast/core.hpp>
 #include <boost/beast/ssl.hpp>
@@ -149,20 +150,19 @@ json BingX::fetchMarkets(const json& params) {
     return parseMarkets(response);
 }
 
-// Example of an async implementation using boost::future
-boost::future<json> BingX::fetchMarketsAsync(const json& params) {
-    return makeAsyncRequest("market/contracts", "public", "GET", params)
-        .then([this](json response) {
-            return parseMarkets(response);
-        });
+// Example of an async implementation on the shared executor
+std::future<json> BingX::fetchMarketsAsync(const json& params) {
+    return Executor::shared().submit([this, params]() {
+        return parseMarkets(request("market/contracts", "public", "GET", params));
+    });
 }
 
 // Helper function to make async requests
-boost::future<json> BingX::makeAsyncRequest(const std::string& path, const std::string& api,
+std::future<json> BingX::makeAsyncRequest(const std::string& path, const std::string& api,
                                           const std::string& method, const json& params,
                                           const std::map<std::string, std::string>& headers,
                                           const json& body) {
-    return boost::async([=]() {
+    return Executor::shared().submit([=]() {
         return request(path, api, method, params, headers, body);
     });
 }
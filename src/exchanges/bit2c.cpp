@@ -3,7 +3,7 @@
 #include <sstream>
 #include <iomanip>
 #include <openssl/hmac.h>
-#include <boost/thread/future.hpp>
+#include "ccxt/base/executor.h"
 
 namespace ccxt {
 
@@ -198,18 +198,18 @@ std::string Bit2c::createSignature(const std::string& timestamp, const std::stri
 }
 
 // Async Market Data API
-boost::future<nlohmann::json> Bit2c::fetchMarketsAsync(const nlohmann::json& params) {
+std::future<nlohmann::json> Bit2c::fetchMarketsAsync(const nlohmann::json& params) {
     return requestAsync("Exchanges/pairs", "public", "GET", params);
 }
 
-boost::future<nlohmann::json> Bit2c::fetchTickerAsync(const std::string& symbol, const nlohmann::json& params) {
+std::future<nlohmann::json> Bit2c::fetchTickerAsync(const std::string& symbol, const nlohmann::json& params) {
     std::string market = getBit2cSymbol(symbol);
     std::string path = "Exchanges/" + market + "/Ticker";
     return requestAsync(path, "public", "GET", params);
 }
 
-boost::future<nlohmann::json> Bit2c::fetchTickersAsync(const std::vector<std::string>& symbols, const nlohmann::json& params) {
-    return boost::async(boost::launch::async, [this, symbols, params]() {
+std::future<nlohmann::json> Bit2c::fetchTickersAsync(const std::vector<std::string>& symbols, const nlohmann::json& params) {
+    return Executor::shared().submit([this, symbols, params]() {
         nlohmann::json result = nlohmann::json::object();
         for (const auto& symbol : symbols) {
             result[symbol] = this->fetchTicker(symbol, params);
@@ -218,28 +218,28 @@ boost::future<nlohmann::json> Bit2c::fetchTickersAsync(const std::vector<std::st
     });
 }
 
-boost::future<nlohmann::json> Bit2c::fetchOrderBookAsync(const std::string& symbol, int limit, const nlohmann::json& params) {
+std::future<nlohmann::json> Bit2c::fetchOrderBookAsync(const std::string& symbol, int limit, const nlohmann::json& params) {
     std::string market = getBit2cSymbol(symbol);
     std::string path = "Exchanges/" + market + "/orderbook";
     return requestAsync(path, "public", "GET", params);
 }
 
-boost::future<nlohmann::json> Bit2c::fetchTradesAsync(const std::string& symbol, int since, int limit, const nlohmann::json& params) {
+std::future<nlohmann::json> Bit2c::fetchTradesAsync(const std::string& symbol, int since, int limit, const nlohmann::json& params) {
     std::string market = getBit2cSymbol(symbol);
     std::string path = "Exchanges/" + market + "/trades";
     return requestAsync(path, "public", "GET", params);
 }
 
-boost::future<nlohmann::json> Bit2c::fetchTradingFeesAsync(const nlohmann::json& params) {
+std::future<nlohmann::json> Bit2c::fetchTradingFeesAsync(const nlohmann::json& params) {
     return requestAsync("Account/Balance", "private", "GET", params);
 }
 
 // Async Trading API
-boost::future<nlohmann::json> Bit2c::fetchBalanceAsync(const nlohmann::json& params) {
+std::future<nlohmann::json> Bit2c::fetchBalanceAsync(const nlohmann::json& params) {
     return requestAsync("Account/Balance", "private", "GET", params);
 }
 
-boost::future<nlohmann::json> Bit2c::createOrderAsync(const std::string& symbol, const std::string& type, const std::string& side,
+std::future<nlohmann::json> Bit2c::createOrderAsync(const std::string& symbol, const std::string& type, const std::string& side,
                                                    double amount, double price, const nlohmann::json& params) {
     nlohmann::json request = {
         {"Amount", amount},
@@ -255,26 +255,26 @@ boost::future<nlohmann::json> Bit2c::createOrderAsync(const std::string& symbol,
     return requestAsync(path, "private", "POST", request);
 }
 
-boost::future<nlohmann::json> Bit2c::cancelOrderAsync(const std::string& id, const std::string& symbol, const nlohmann::json& params) {
+std::future<nlohmann::json> Bit2c::cancelOrderAsync(const std::string& id, const std::string& symbol, const nlohmann::json& params) {
     nlohmann::json request = {{"id", id}};
     return requestAsync("Order/CancelOrder", "private", "POST", request);
 }
 
-boost::future<nlohmann::json> Bit2c::fetchOrderAsync(const std::string& id, const std::string& symbol, const nlohmann::json& params) {
+std::future<nlohmann::json> Bit2c::fetchOrderAsync(const std::string& id, const std::string& symbol, const nlohmann::json& params) {
     nlohmann::json request = {{"id", id}};
     return requestAsync("Order/GetById", "private", "GET", request);
 }
 
-boost::future<nlohmann::json> Bit2c::fetchOpenOrdersAsync(const std::string& symbol, int since, int limit, const nlohmann::json& params) {
+std::future<nlohmann::json> Bit2c::fetchOpenOrdersAsync(const std::string& symbol, int since, int limit, const nlohmann::json& params) {
     return requestAsync("Order/MyOrders", "private", "GET", params);
 }
 
-boost::future<nlohmann::json> Bit2c::fetchMyTradesAsync(const std::string& symbol, int since, int limit, const nlohmann::json& params) {
+std::future<nlohmann::json> Bit2c::fetchMyTradesAsync(const std::string& symbol, int since, int limit, const nlohmann::json& params) {
     return requestAsync("Order/OrderHistory", "private", "GET", params);
 }
 
 // Async Account API
-boost::future<nlohmann::json> Bit2c::fetchDepositAddressAsync(const std::string& code, const nlohmann::json& params) {
+std::future<nlohmann::json> Bit2c::fetchDepositAddressAsync(const std::string& code, const nlohmann::json& params) {
     return requestAsync("Funds/AddCoinFundsRequest", "private", "POST", params);
 }
 
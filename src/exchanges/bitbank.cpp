@@ -2,7 +2,7 @@
 #include <openssl/hmac.h>
 #include <iomanip>
 #include <sstream>
-#include <boost/thread/future.hpp>
+#include "ccxt/base/executor.h"
 
 namespace ccxt {
 
@@ -242,29 +242,29 @@ std::string Bitbank::createSignature(const std::string& nonce, const std::string
 }
 
 // Async Market Data API
-boost::future<json> Bitbank::fetchMarketsAsync(const json& params) {
+std::future<json> Bitbank::fetchMarketsAsync(const json& params) {
     return requestAsync("", "public", "GET", params);
 }
 
-boost::future<json> Bitbank::fetchTickerAsync(const std::string& symbol, const json& params) {
+std::future<json> Bitbank::fetchTickerAsync(const std::string& symbol, const json& params) {
     std::string market = getBitbankSymbol(symbol);
     std::string path = market + "/ticker";
     return requestAsync(path, "public", "GET", params);
 }
 
-boost::future<json> Bitbank::fetchOrderBookAsync(const std::string& symbol, int limit, const json& params) {
+std::future<json> Bitbank::fetchOrderBookAsync(const std::string& symbol, int limit, const json& params) {
     std::string market = getBitbankSymbol(symbol);
     std::string path = market + "/depth";
     return requestAsync(path, "public", "GET", params);
 }
 
-boost::future<json> Bitbank::fetchTradesAsync(const std::string& symbol, int since, int limit, const json& params) {
+std::future<json> Bitbank::fetchTradesAsync(const std::string& symbol, int since, int limit, const json& params) {
     std::string market = getBitbankSymbol(symbol);
     std::string path = market + "/transactions";
     return requestAsync(path, "public", "GET", params);
 }
 
-boost::future<json> Bitbank::fetchOHLCVAsync(const std::string& symbol, const std::string& timeframe, int since, int limit, const json& params) {
+std::future<json> Bitbank::fetchOHLCVAsync(const std::string& symbol, const std::string& timeframe, long long since, int limit, const json& params) {
     std::string market = getBitbankSymbol(symbol);
     std::string candleType = timeframes[timeframe];
     std::string date = getYYYYMMDD(since);
@@ -272,16 +272,16 @@ boost::future<json> Bitbank::fetchOHLCVAsync(const std::string& symbol, const st
     return requestAsync(path, "public", "GET", params);
 }
 
-boost::future<json> Bitbank::fetchTradingFeesAsync(const json& params) {
+std::future<json> Bitbank::fetchTradingFeesAsync(const json& params) {
     return requestAsync("user/spot/trade_history", "private", "GET", params);
 }
 
 // Async Trading API
-boost::future<json> Bitbank::fetchBalanceAsync(const json& params) {
+std::future<json> Bitbank::fetchBalanceAsync(const json& params) {
     return requestAsync("user/assets", "private", "GET", params);
 }
 
-boost::future<json> Bitbank::createOrderAsync(const std::string& symbol, const std::string& type, const std::string& side,
+std::future<json> Bitbank::createOrderAsync(const std::string& symbol, const std::string& type, const std::string& side,
                                           double amount, double price, const json& params) {
     json request = {
         {"pair", getBitbankSymbol(symbol)},
@@ -297,7 +297,7 @@ boost::future<json> Bitbank::createOrderAsync(const std::string& symbol, const s
     return requestAsync("user/spot/order", "private", "POST", request);
 }
 
-boost::future<json> Bitbank::cancelOrderAsync(const std::string& id, const std::string& symbol, const json& params) {
+std::future<json> Bitbank::cancelOrderAsync(const std::string& id, const std::string& symbol, const json& params) {
     json request = {
         {"pair", getBitbankSymbol(symbol)},
         {"order_id", id}
@@ -305,7 +305,7 @@ boost::future<json> Bitbank::cancelOrderAsync(const std::string& id, const std::
     return requestAsync("user/spot/cancel_order", "private", "POST", request);
 }
 
-boost::future<json> Bitbank::fetchOrderAsync(const std::string& id, const std::string& symbol, const json& params) {
+std::future<json> Bitbank::fetchOrderAsync(const std::string& id, const std::string& symbol, const json& params) {
     json request = {
         {"pair", getBitbankSymbol(symbol)},
         {"order_id", id}
@@ -313,22 +313,22 @@ boost::future<json> Bitbank::fetchOrderAsync(const std::string& id, const std::s
     return requestAsync("user/spot/order", "private", "GET", request);
 }
 
-boost::future<json> Bitbank::fetchOpenOrdersAsync(const std::string& symbol, int since, int limit, const json& params) {
+std::future<json> Bitbank::fetchOpenOrdersAsync(const std::string& symbol, int since, int limit, const json& params) {
     json request = {{"pair", getBitbankSymbol(symbol)}};
     return requestAsync("user/spot/active_orders", "private", "GET", request);
 }
 
-boost::future<json> Bitbank::fetchMyTradesAsync(const std::string& symbol, int since, int limit, const json& params) {
+std::future<json> Bitbank::fetchMyTradesAsync(const std::string& symbol, int since, int limit, const json& params) {
     json request = {{"pair", getBitbankSymbol(symbol)}};
     return requestAsync("user/spot/trade_history", "private", "GET", request);
 }
 
 // Async Account API
-boost::future<json> Bitbank::fetchDepositAddressAsync(const std::string& code, const json& params) {
+std::future<json> Bitbank::fetchDepositAddressAsync(const std::string& code, const json& params) {
     return requestAsync("user/withdrawal_account", "private", "GET", params);
 }
 
-boost::future<json> Bitbank::withdrawAsync(const std::string& code, double amount, const std::string& address,
+std::future<json> Bitbank::withdrawAsync(const std::string& code, double amount, const std::string& address,
                                        const std::string& tag, const json& params) {
     json request = {
         {"asset", code.toLower()},
@@ -7,7 +7,7 @@
 #include <sstream>
 #include <iomanip>
 #include <chrono>
-#include <boost/thread/future.hpp>
+#include "ccxt/base/executor.h"
 
 namespace ccxt {
 
@@ -417,87 +417,87 @@ json bitbay::public_get(const std::string& path,
 }
 
 // Async API implementations
-boost::future<json> bitbay::fetch_markets_async() {
-    return boost::async([this] { return fetch_markets(); });
+std::future<json> bitbay::fetch_markets_async() {
+    return Executor::shared().submit([this] { return fetch_markets(); });
 }
 
-boost::future<json> bitbay::fetch_ticker_async(const std::string& symbol) {
-    return boost::async([this, symbol] { return fetch_ticker(symbol); });
+std::future<json> bitbay::fetch_ticker_async(const std::string& symbol) {
+    return Executor::shared().submit([this, symbol] { return fetch_ticker(symbol); });
 }
 
-boost::future<json> bitbay::fetch_tickers_async(const std::vector<std::string>& symbols) {
-    return boost::async([this, symbols] { return fetch_tickers(symbols); });
+std::future<json> bitbay::fetch_tickers_async(const std::vector<std::string>& symbols) {
+    return Executor::shared().submit([this, symbols] { return fetch_tickers(symbols); });
 }
 
-boost::future<json> bitbay::fetch_order_book_async(const std::string& symbol, int limit) {
-    return boost::async([this, symbol, limit] { return fetch_order_book(symbol, limit); });
+std::future<json> bitbay::fetch_order_book_async(const std::string& symbol, int limit) {
+    return Executor::shared().submit([this, symbol, limit] { return fetch_order_book(symbol, limit); });
 }
 
-boost::future<json> bitbay::fetch_trades_async(const std::string& symbol, int limit) {
-    return boost::async([this, symbol, limit] { return fetch_trades(symbol, limit); });
+std::future<json> bitbay::fetch_trades_async(const std::string& symbol, int limit) {
+    return Executor::shared().submit([this, symbol, limit] { return fetch_trades(symbol, limit); });
 }
 
-boost::future<json> bitbay::fetch_ohlcv_async(const std::string& symbol, const std::string& timeframe,
+std::future<json> bitbay::fetch_ohlcv_async(const std::string& symbol, const std::string& timeframe,
                                          long since, int limit) {
-    return boost::async([this, symbol, timeframe, since, limit] { return fetch_ohlcv(symbol, timeframe, since, limit); });
+    return Executor::shared().submit([this, symbol, timeframe, since, limit] { return fetch_ohlcv(symbol, timeframe, since, limit); });
 }
 
-boost::future<json> bitbay::fetch_trading_fees_async(const std::string& symbol) {
-    return boost::async([this, symbol] { return fetch_trading_fees(symbol); });
+std::future<json> bitbay::fetch_trading_fees_async(const std::string& symbol) {
+    return Executor::shared().submit([this, symbol] { return fetch_trading_fees(symbol); });
 }
 
-boost::future<json> bitbay::create_order_async(const std::string& symbol, const std::string& type,
+std::future<json> bitbay::create_order_async(const std::string& symbol, const std::string& type,
                                          const std::string& side, double amount, double price,
                                          const std::map<std::string, std::string>& params) {
-    return boost::async([this, symbol, type, side, amount, price, params] { return create_order(symbol, type, side, amount, price, params); });
+    return Executor::shared().submit([this, symbol, type, side, amount, price, params] { return create_order(symbol, type, side, amount, price, params); });
 }
 
-boost::future<json> bitbay::cancel_order_async(const std::string& id, const std::string& symbol) {
-    return boost::async([this, id, symbol] { return cancel_order(id, symbol); });
+std::future<json> bitbay::cancel_order_async(const std::string& id, const std::string& symbol) {
+    return Executor::shared().submit([this, id, symbol] { return cancel_order(id, symbol); });
 }
 
-boost::future<json> bitbay::cancel_all_orders_async(const std::string& symbol) {
-    return boost::async([this, symbol] { return cancel_all_orders(symbol); });
+std::future<json> bitbay::cancel_all_orders_async(const std::string& symbol) {
+    return Executor::shared().submit([this, symbol] { return cancel_all_orders(symbol); });
 }
 
-boost::future<json> bitbay::edit_order_async(const std::string& id, const std::string& symbol,
+std::future<json> bitbay::edit_order_async(const std::string& id, const std::string& symbol,
                                          const std::string& type, const std::string& side,
                                          double amount, double price,
                                          const std::map<std::string, std::string>& params) {
-    return boost::async([this, id, symbol, type, side, amount, price, params] { return edit_order(id, symbol, type, side, amount, price, params); });
+    return Executor::shared().submit([this, id, symbol, type, side, amount, price, params] { return edit_order(id, symbol, type, side, amount, price, params); });
 }
 
-boost::future<json> bitbay::fetch_balance_async() {
-    return boost::async([this] { return fetch_balance(); });
+std::future<json> bitbay::fetch_balance_async() {
+    return Executor::shared().submit([this] { return fetch_balance(); });
 }
 
-boost::future<json> bitbay::fetch_open_orders_async(const std::string& symbol) {
-    return boost::async([this, symbol] { return fetch_open_orders(symbol); });
+std::future<json> bitbay::fetch_open_orders_async(const std::string& symbol) {
+    return Executor::shared().submit([this, symbol] { return fetch_open_orders(symbol); });
 }
 
-boost::future<json> bitbay::fetch_closed_orders_async(const std::string& symbol, long since, int limit) {
-    return boost::async([this, symbol, since, limit] { return fetch_closed_orders(symbol, since, limit); });
+std::future<json> bitbay::fetch_closed_orders_async(const std::string& symbol, long since, int limit) {
+    return Executor::shared().submit([this, symbol, since, limit] { return fetch_closed_orders(symbol, since, limit); });
 }
 
-boost::future<json> bitbay::fetch_order_async(const std::string& id, const std::string& symbol) {
-    return boost::async([this, id, symbol] { return fetch_order(id, symbol); });
+std::future<json> bitbay::fetch_order_async(const std::string& id, const std::string& symbol) {
+    return Executor::shared().submit([this, id, symbol] { return fetch_order(id, symbol); });
 }
 
-boost::future<json> bitbay::fetch_orders_async(const std::string& symbol, long since, int limit) {
-    return boost::async([this, symbol, since, limit] { return fetch_orders(symbol, since, limit); });
+std::future<json> bitbay::fetch_orders_async(const std::string& symbol, long since, int limit) {
+    return Executor::shared().submit([this, symbol, since, limit] { return fetch_orders(symbol, since, limit); });
 }
 
-boost::future<json> bitbay::fetch_my_trades_async(const std::string& symbol, long since, int limit) {
-    return boost::async([this, symbol, since, limit] { return fetch_my_trades(symbol, since, limit); });
+std::future<json> bitbay::fetch_my_trades_async(const std::string& symbol, long since, int limit) {
+    return Executor::shared().submit([this, symbol, since, limit] { return fetch_my_trades(symbol, since, limit); });
 }
 
-boost::future<json> bitbay::fetch_deposit_address_async(const std::string& code) {
-    return boost::async([this, code] { return fetch_deposit_address(code); });
+std::future<json> bitbay::fetch_deposit_address_async(const std::string& code) {
+    return Executor::shared().submit([this, code] { return fetch_deposit_address(code); });
 }
 
-boost::future<json> bitbay::withdraw_async(const std::string& code, double amount,
+std::future<json> bitbay::withdraw_async(const std::string& code, double amount,
                                       const std::string& address, const std::string& tag) {
-    return boost::async([this, code, amount, address, tag] { return withdraw(code, amount, address, tag); });
+    return Executor::shared().submit([this, code, amount, address, tag] { return withdraw(code, amount, address, tag); });
 }
 
 } // namespace ccxt
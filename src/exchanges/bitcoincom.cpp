@@ -1,4 +1,5 @@
 #include "ccxt/exchanges/bitcoincom.h"
+#include "ccxt/base/executor.h"
 #include "ccxt/error.h"
 #include <openssl/hmac.h>
 #include <sstream>
@@ -381,157 +382,157 @@ json bitcoincom::withdraw(const std::string& code, double amount,
 }
 
 // Async Market Data Methods
-boost::future<json> bitcoincom::fetch_markets_async(const json& params) {
-    return boost::async([this, params]() {
+std::future<json> bitcoincom::fetch_markets_async(const json& params) {
+    return Executor::shared().submit([this, params]() {
         return this->fetch_markets();
     });
 }
 
-boost::future<json> bitcoincom::fetch_currencies_async(const json& params) {
-    return boost::async([this, params]() {
+std::future<json> bitcoincom::fetch_currencies_async(const json& params) {
+    return Executor::shared().submit([this, params]() {
         return this->fetch_currencies();
     });
 }
 
-boost::future<json> bitcoincom::fetch_ticker_async(const std::string& symbol, const json& params) {
-    return boost::async([this, symbol]() {
+std::future<json> bitcoincom::fetch_ticker_async(const std::string& symbol, const json& params) {
+    return Executor::shared().submit([this, symbol]() {
         return this->fetch_ticker(symbol);
     });
 }
 
-boost::future<json> bitcoincom::fetch_tickers_async(const std::vector<std::string>& symbols, const json& params) {
-    return boost::async([this, symbols]() {
+std::future<json> bitcoincom::fetch_tickers_async(const std::vector<std::string>& symbols, const json& params) {
+    return Executor::shared().submit([this, symbols]() {
         return this->fetch_tickers(symbols);
     });
 }
 
-boost::future<json> bitcoincom::fetch_order_book_async(const std::string& symbol, int limit, const json& params) {
-    return boost::async([this, symbol, limit]() {
+std::future<json> bitcoincom::fetch_order_book_async(const std::string& symbol, int limit, const json& params) {
+    return Executor::shared().submit([this, symbol, limit]() {
         return this->fetch_order_book(symbol, limit);
     });
 }
 
-boost::future<json> bitcoincom::fetch_trades_async(const std::string& symbol, int limit, const json& params) {
-    return boost::async([this, symbol, limit]() {
+std::future<json> bitcoincom::fetch_trades_async(const std::string& symbol, int limit, const json& params) {
+    return Executor::shared().submit([this, symbol, limit]() {
         return this->fetch_trades(symbol, limit);
     });
 }
 
-boost::future<json> bitcoincom::fetch_ohlcv_async(const std::string& symbol, const std::string& timeframe,
+std::future<json> bitcoincom::fetch_ohlcv_async(const std::string& symbol, const std::string& timeframe,
                                                long since, int limit, const json& params) {
-    return boost::async([this, symbol, timeframe, since, limit]() {
+    return Executor::shared().submit([this, symbol, timeframe, since, limit]() {
         return this->fetch_ohlcv(symbol, timeframe, since, limit);
     });
 }
 
-boost::future<json> bitcoincom::fetch_trading_fees_async(const std::string& symbol, const json& params) {
-    return boost::async([this, symbol]() {
+std::future<json> bitcoincom::fetch_trading_fees_async(const std::string& symbol, const json& params) {
+    return Executor::shared().submit([this, symbol]() {
         return this->fetch_trading_fees(symbol);
     });
 }
 
 // Async Trading Methods
-boost::future<json> bitcoincom::create_order_async(const std::string& symbol, const std::string& type,
+std::future<json> bitcoincom::create_order_async(const std::string& symbol, const std::string& type,
                                                const std::string& side, double amount, double price,
                                                const json& params) {
-    return boost::async([this, symbol, type, side, amount, price]() {
+    return Executor::shared().submit([this, symbol, type, side, amount, price]() {
         return this->create_order(symbol, type, side, amount, price);
     });
 }
 
-boost::future<json> bitcoincom::cancel_order_async(const std::string& id, const std::string& symbol,
+std::future<json> bitcoincom::cancel_order_async(const std::string& id, const std::string& symbol,
                                                const json& params) {
-    return boost::async([this, id, symbol]() {
+    return Executor::shared().submit([this, id, symbol]() {
         return this->cancel_order(id, symbol);
     });
 }
 
-boost::future<json> bitcoincom::cancel_all_orders_async(const std::string& symbol, const json& params) {
-    return boost::async([this, symbol]() {
+std::future<json> bitcoincom::cancel_all_orders_async(const std::string& symbol, const json& params) {
+    return Executor::shared().submit([this, symbol]() {
         return this->cancel_all_orders(symbol);
     });
 }
 
-boost::future<json> bitcoincom::edit_order_async(const std::string& id, const std::string& symbol,
+std::future<json> bitcoincom::edit_order_async(const std::string& id, const std::string& symbol,
                                              const std::string& type, const std::string& side,
                                              double amount, double price, const json& params) {
-    return boost::async([this, id, symbol, type, side, amount, price]() {
+    return Executor::shared().submit([this, id, symbol, type, side, amount, price]() {
         return this->edit_order(id, symbol, type, side, amount, price);
     });
 }
 
 // Async Account/Balance Methods
-boost::future<json> bitcoincom::fetch_balance_async(const json& params) {
-    return boost::async([this]() {
+std::future<json> bitcoincom::fetch_balance_async(const json& params) {
+    return Executor::shared().submit([this]() {
         return this->fetch_balance();
     });
 }
 
-boost::future<json> bitcoincom::fetch_open_orders_async(const std::string& symbol, const json& params) {
-    return boost::async([this, symbol]() {
+std::future<json> bitcoincom::fetch_open_orders_async(const std::string& symbol, const json& params) {
+    return Executor::shared().submit([this, symbol]() {
         return this->fetch_open_orders(symbol);
     });
 }
 
-boost::future<json> bitcoincom::fetch_closed_orders_async(const std::string& symbol, long since,
+std::future<json> bitcoincom::fetch_closed_orders_async(const std::string& symbol, long since,
                                                       int limit, const json& params) {
-    return boost::async([this, symbol, since, limit]() {
+    return Executor::shared().submit([this, symbol, since, limit]() {
         return this->fetch_closed_orders(symbol, since, limit);
     });
 }
 
-boost::future<json> bitcoincom::fetch_order_async(const std::string& id, const std::string& symbol,
+std::future<json> bitcoincom::fetch_order_async(const std::string& id, const std::string& symbol,
                                               const json& params) {
-    return boost::async([this, id, symbol]() {
+    return Executor::shared().submit([this, id, symbol]() {
         return this->fetch_order(id, symbol);
     });
 }
 
-boost::future<json> bitcoincom::fetch_orders_async(const std::string& symbol, long since,
+std::future<json> bitcoincom::fetch_orders_async(const std::string& symbol, long since,
                                                int limit, const json& params) {
-    return boost::async([this, symbol, since, limit]() {
+    return Executor::shared().submit([this, symbol, since, limit]() {
         return this->fetch_orders(symbol, since, limit);
     });
 }
 
-boost::future<json> bitcoincom::fetch_my_trades_async(const std::string& symbol, long since,
+std::future<json> bitcoincom::fetch_my_trades_async(const std::string& symbol, long since,
                                                   int limit, const json& params) {
-    return boost::async([this, symbol, since, limit]() {
+    return Executor::shared().submit([this, symbol, since, limit]() {
         return this->fetch_my_trades(symbol, since, limit);
     });
 }
 
-boost::future<json> bitcoincom::fetch_trading_fee_async(const std::string& symbol, const json& params) {
-    return boost::async([this, symbol]() {
+std::future<json> bitcoincom::fetch_trading_fee_async(const std::string& symbol, const json& params) {
+    return Executor::shared().submit([this, symbol]() {
         return this->fetch_trading_fee(symbol);
     });
 }
 
 // Async Account Management Methods
-boost::future<json> bitcoincom::fetch_deposit_address_async(const std::string& code, const json& params) {
-    return boost::async([this, code]() {
+std::future<json> bitcoincom::fetch_deposit_address_async(const std::string& code, const json& params) {
+    return Executor::shared().submit([this, code]() {
         return this->fetch_deposit_address(code);
     });
 }
 
-boost::future<json> bitcoincom::fetch_deposits_async(const std::string& code, long since,
+std::future<json> bitcoincom::fetch_deposits_async(const std::string& code, long since,
                                                  int limit, const json& params) {
-    return boost::async([this, code, since, limit]() {
+    return Executor::shared().submit([this, code, since, limit]() {
         return this->fetch_deposits(code, since, limit);
     });
 }
 
-boost::future<json> bitcoincom::fetch_withdrawals_async(const std::string& code, long since,
+std::future<json> bitcoincom::fetch_withdrawals_async(const std::string& code, long since,
                                                     int limit, const json& params) {
-    return boost::async([this, code, since, limit]() {
+    return Executor::shared().submit([this, code, since, limit]() {
         return this->fetch_withdrawals(code, since, limit);
     });
 }
 
-boost::future<json> bitcoincom::withdraw_async(const std::string& code, double amount,
+std::future<json> bitcoincom::withdraw_async(const std::string& code, double amount,
                                            const std::string& address, const std::string& tag,
                                            const json& params) {
-    return boost::async([this, code, amount, address, tag]() {
+    return Executor::shared().submit([this, code, amount, address, tag]() {
         return this->withdraw(code, amount, address, tag);
     });
 }
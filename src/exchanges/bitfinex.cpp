@@ -1,4 +1,5 @@
 #include "bitfinex.h"
+#include "ccxt/base/executor.h"
 #include <chrono>
 #include <sstream>
 #include <iomanip>
@@ -349,127 +350,127 @@ json Bitfinex::parseOrder(const json& order, const Market& market) {
 }
 
 // Market Data API - Async Methods
-boost::future<json> Bitfinex::fetchMarketsAsync(const json& params) {
-    return boost::async([this, params]() {
+std::future<json> Bitfinex::fetchMarketsAsync(const json& params) {
+    return Executor::shared().submit([this, params]() {
         return this->fetchMarkets(params);
     });
 }
 
-boost::future<json> Bitfinex::fetchTickerAsync(const std::string& symbol, const json& params) {
-    return boost::async([this, symbol, params]() {
+std::future<json> Bitfinex::fetchTickerAsync(const std::string& symbol, const json& params) {
+    return Executor::shared().submit([this, symbol, params]() {
         return this->fetchTicker(symbol, params);
     });
 }
 
-boost::future<json> Bitfinex::fetchTickersAsync(const std::vector<std::string>& symbols, const json& params) {
-    return boost::async([this, symbols, params]() {
+std::future<json> Bitfinex::fetchTickersAsync(const std::vector<std::string>& symbols, const json& params) {
+    return Executor::shared().submit([this, symbols, params]() {
         return this->fetchTickers(symbols, params);
     });
 }
 
-boost::future<json> Bitfinex::fetchOrderBookAsync(const std::string& symbol, int limit, const json& params) {
-    return boost::async([this, symbol, limit, params]() {
+std::future<json> Bitfinex::fetchOrderBookAsync(const std::string& symbol, int limit, const json& params) {
+    return Executor::shared().submit([this, symbol, limit, params]() {
         return this->fetchOrderBook(symbol, limit, params);
     });
 }
 
-boost::future<json> Bitfinex::fetchTradesAsync(const std::string& symbol, int since, int limit, const json& params) {
-    return boost::async([this, symbol, since, limit, params]() {
+std::future<json> Bitfinex::fetchTradesAsync(const std::string& symbol, int since, int limit, const json& params) {
+    return Executor::shared().submit([this, symbol, since, limit, params]() {
         return this->fetchTrades(symbol, since, limit, params);
     });
 }
 
-boost::future<json> Bitfinex::fetchOHLCVAsync(const std::string& symbol, const std::string& timeframe,
-                                           int since, int limit, const json& params) {
-    return boost::async([this, symbol, timeframe, since, limit, params]() {
+std::future<json> Bitfinex::fetchOHLCVAsync(const std::string& symbol, const std::string& timeframe,
+                                           long long since, int limit, const json& params) {
+    return Executor::shared().submit([this, symbol, timeframe, since, limit, params]() {
         return this->fetchOHLCV(symbol, timeframe, since, limit, params);
     });
 }
 
 // Trading API - Async Methods
-boost::future<json> Bitfinex::fetchBalanceAsync(const json& params) {
-    return boost::async([this, params]() {
+std::future<json> Bitfinex::fetchBalanceAsync(const json& params) {
+    return Executor::shared().submit([this, params]() {
         return this->fetchBalance(params);
     });
 }
 
-boost::future<json> Bitfinex::createOrderAsync(const std::string& symbol, const std::string& type,
+std::future<json> Bitfinex::createOrderAsync(const std::string& symbol, const std::string& type,
                                            const std::string& side, double amount,
                                            double price, const json& params) {
-    return boost::async([this, symbol, type, side, amount, price, params]() {
+    return Executor::shared().submit([this, symbol, type, side, amount, price, params]() {
         return this->createOrder(symbol, type, side, amount, price, params);
     });
 }
 
-boost::future<json> Bitfinex::cancelOrderAsync(const std::string& id, const std::string& symbol, const json& params) {
-    return boost::async([this, id, symbol, params]() {
+std::future<json> Bitfinex::cancelOrderAsync(const std::string& id, const std::string& symbol, const json& params) {
+    return Executor::shared().submit([this, id, symbol, params]() {
         return this->cancelOrder(id, symbol, params);
     });
 }
 
-boost::future<json> Bitfinex::fetchOrderAsync(const std::string& id, const std::string& symbol, const json& params) {
-    return boost::async([this, id, symbol, params]() {
+std::future<json> Bitfinex::fetchOrderAsync(const std::string& id, const std::string& symbol, const json& params) {
+    return Executor::shared().submit([this, id, symbol, params]() {
         return this->fetchOrder(id, symbol, params);
     });
 }
 
-boost::future<json> Bitfinex::fetchOrdersAsync(const std::string& symbol, int since, int limit, const json& params) {
-    return boost::async([this, symbol, since, limit, params]() {
+std::future<json> Bitfinex::fetchOrdersAsync(const std::string& symbol, int since, int limit, const json& params) {
+    return Executor::shared().submit([this, symbol, since, limit, params]() {
         return this->fetchOrders(symbol, since, limit, params);
     });
 }
 
-boost::future<json> Bitfinex::fetchOpenOrdersAsync(const std::string& symbol, int since, int limit, const json& params) {
-    return boost::async([this, symbol, since, limit, params]() {
+std::future<json> Bitfinex::fetchOpenOrdersAsync(const std::string& symbol, int since, int limit, const json& params) {
+    return Executor::shared().submit([this, symbol, since, limit, params]() {
         return this->fetchOpenOrders(symbol, since, limit, params);
     });
 }
 
-boost::future<json> Bitfinex::fetchClosedOrdersAsync(const std::string& symbol, int since, int limit, const json& params) {
-    return boost::async([this, symbol, since, limit, params]() {
+std::future<json> Bitfinex::fetchClosedOrdersAsync(const std::string& symbol, int since, int limit, const json& params) {
+    return Executor::shared().submit([this, symbol, since, limit, params]() {
         return this->fetchClosedOrders(symbol, since, limit, params);
     });
 }
 
 // Bitfinex specific methods - Async
-boost::future<json> Bitfinex::fetchPositionsAsync(const std::string& symbol, const json& params) {
-    return boost::async([this, symbol, params]() {
+std::future<json> Bitfinex::fetchPositionsAsync(const std::string& symbol, const json& params) {
+    return Executor::shared().submit([this, symbol, params]() {
         return this->fetchPositions(symbol, params);
     });
 }
 
-boost::future<json> Bitfinex::fetchMyTradesAsync(const std::string& symbol, int since, int limit, const json& params) {
-    return boost::async([this, symbol, since, limit, params]() {
+std::future<json> Bitfinex::fetchMyTradesAsync(const std::string& symbol, int since, int limit, const json& params) {
+    return Executor::shared().submit([this, symbol, since, limit, params]() {
         return this->fetchMyTrades(symbol, since, limit, params);
     });
 }
 
-boost::future<json> Bitfinex::fetchLedgerAsync(const std::string& code, int since, int limit, const json& params) {
-    return boost::async([this, code, since, limit, params]() {
+std::future<json> Bitfinex::fetchLedgerAsync(const std::string& code, int since, int limit, const json& params) {
+    return Executor::shared().submit([this, code, since, limit, params]() {
         return this->fetchLedger(code, since, limit, params);
     });
 }
 
-boost::future<json> Bitfinex::fetchFundingRatesAsync(const std::vector<std::string>& symbols, const json& params) {
-    return boost::async([this, symbols, params]() {
+std::future<json> Bitfinex::fetchFundingRatesAsync(const std::vector<std::string>& symbols, const json& params) {
+    return Executor::shared().submit([this, symbols, params]() {
         return this->fetchFundingRates(symbols, params);
     });
 }
 
-boost::future<json> Bitfinex::setLeverageAsync(const std::string& symbol, double leverage, const json& params) {
-    return boost::async([this, symbol, leverage, params]() {
+std::future<json> Bitfinex::setLeverageAsync(const std::string& symbol, double leverage, const json& params) {
+    return Executor::shared().submit([this, symbol, leverage, params]() {
         return this->setLeverage(symbol, leverage, params);
     });
 }
 
-boost::future<json> Bitfinex::fetchDepositsAsync(const std::string& code, int since, int limit, const json& params) {
-    return boost::async([this, code, since, limit, params]() {
+std::future<json> Bitfinex::fetchDepositsAsync(const std::string& code, int since, int limit, const json& params) {
+    return Executor::shared().submit([this, code, since, limit, params]() {
         return this->fetchDeposits(code, since, limit, params);
     });
 }
 
-boost::future<json> Bitfinex::fetchWithdrawalsAsync(const std::string& code, int since, int limit, const json& params) {
-    return boost::async([this, code, since, limit, params]() {
+std::future<json> Bitfinex::fetchWithdrawalsAsync(const std::string& code, int since, int limit, const json& params) {
+    return Executor::shared().submit([this, code, since, limit, params]() {
         return this->fetchWithdrawals(code, since, limit, params);
     });
 }
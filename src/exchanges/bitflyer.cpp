@@ -1,4 +1,5 @@
 #include "ccxt/exchanges/bitflyer.h"
+#include "ccxt/base/executor.h"
 
 namespace ccxt {
 
@@ -218,29 +219,31 @@ Json bitflyer::withdrawImpl(const std::string& code, double amount, const std::s
 }
 
 // Async Implementation
-boost::future<Json> bitflyer::fetchAsync(const std::string& path, const std::string& api,
+std::future<Json> bitflyer::fetchAsync(const std::string& path, const std::string& api,
                                       const std::string& method, const Json& params,
                                       const std::map<std::string, std::string>& headers) const {
-    return Exchange::fetchAsync(path, api, method, params, headers);
+    return Executor::shared().submit([this, path, api, method, params, headers]() {
+        return this->fetch(path, api, method, params, headers);
+    });
 }
 
-boost::future<Json> bitflyer::fetchMarketsAsync() const {
+std::future<Json> bitflyer::fetchMarketsAsync() const {
     return this->fetchAsync("/v1/getmarkets");
 }
 
-boost::future<Json> bitflyer::fetchTickerAsync(const std::string& symbol) const {
+std::future<Json> bitflyer::fetchTickerAsync(const std::string& symbol) const {
     auto market = this->market(symbol);
     return this->fetchAsync("/v1/getticker?product_code=" + market["id"].get<std::string>());
 }
 
-boost::future<Json> bitflyer::fetchOrderBookAsync(const std::string& symbol,
+std::future<Json> bitflyer::fetchOrderBookAsync(const std::string& symbol,
                                                const std::optional<int>& limit) const {
     auto market = this->market(symbol);
     auto request = "/v1/getboard?product_code=" + market["id"].get<std::string>();
     return this->fetchAsync(request);
 }
 
-boost::future<Json> bitflyer::fetchTradesAsync(const std::string& symbol,
+std::future<Json> bitflyer::fetchTradesAsync(const std::string& symbol,
                                             const std::optional<long long>& since,
                                             const std::optional<int>& limit) const {
     auto market = this->market(symbol);
@@ -251,7 +254,7 @@ boost::future<Json> bitflyer::fetchTradesAsync(const std::string& symbol,
     return this->fetchAsync(request);
 }
 
-boost::future<Json> bitflyer::createOrderAsync(const std::string& symbol, const std::string& type,
+std::future<Json> bitflyer::createOrderAsync(const std::string& symbol, const std::string& type,
                                            const std::string& side, double amount,
                                            const std::optional<double>& price) {
     auto market = this->market(symbol);
@@ -267,7 +270,7 @@ boost::future<Json> bitflyer::createOrderAsync(const std::string& symbol, const
     return this->fetchAsync("/v1/me/sendchildorder", "private", "POST", request);
 }
 
-boost::future<Json> bitflyer::cancelOrderAsync(const std::string& id, const std::string& symbol) {
+std::future<Json> bitflyer::cancelOrderAsync(const std::string& id, const std::string& symbol) {
     auto market = this->market(symbol);
     auto request = Json::object({
         {"product_code", market["id"]},
@@ -276,7 +279,7 @@ boost::future<Json> bitflyer::cancelOrderAsync(const std::string& id, const std:
     return this->fetchAsync("/v1/me/cancelchildorder", "private", "POST", request);
 }
 
-boost::future<Json> bitflyer::fetchOrderAsync(const std::string& id, const std::string& symbol) const {
+std::future<Json> bitflyer::fetchOrderAsync(const std::string& id, const std::string& symbol) const {
     auto market = this->market(symbol);
     auto request = Json::object({
         {"product_code", market["id"]},
@@ -285,7 +288,7 @@ boost::future<Json> bitflyer::fetchOrderAsync(const std::string& id, const std::
     return this->fetchAsync("/v1/me/getchildorders", "private", "GET", request);
 }
 
-boost::future<Json> bitflyer::fetchOrdersAsync(const std::string& symbol,
+std::future<Json> bitflyer::fetchOrdersAsync(const std::string& symbol,
                                            const std::optional<long long>& since,
                                            const std::optional<int>& limit) const {
     auto market = this->market(symbol);
@@ -299,7 +302,7 @@ boost::future<Json> bitflyer::fetchOrdersAsync(const std::string& symbol,
     return this->fetchAsync("/v1/me/getchildorders", "private", "GET", request);
 }
 
-boost::future<Json> bitflyer::fetchOpenOrdersAsync(const std::string& symbol,
+std::future<Json> bitflyer::fetchOpenOrdersAsync(const std::string& symbol,
                                                const std::optional<long long>& since,
                                                const std::optional<int>& limit) const {
     auto market = this->market(symbol);
@@ -316,7 +319,7 @@ boost::future<Json> bitflyer::fetchOpenOrdersAsync(const std::string& symbol,
     return this->fetchAsync("/v1/me/getchildorders", "private", "GET", request);
 }
 
-boost::future<Json> bitflyer::fetchClosedOrdersAsync(const std::string& symbol,
+std::future<Json> bitflyer::fetchClosedOrdersAsync(const std::string& symbol,
                                                  const std::optional<long long>& since,
                                                  const std::optional<int>& limit) const {
     auto market = this->market(symbol);
@@ -333,17 +336,17 @@ boost::future<Json> bitflyer::fetchClosedOrdersAsync(const std::string& symbol,
     return this->fetchAsync("/v1/me/getchildorders", "private", "GET", request);
 }
 
-boost::future<Json> bitflyer::fetchBalanceAsync() const {
+std::future<Json> bitflyer::fetchBalanceAsync() const {
     return this->fetchAsync("/v1/me/getbalance", "private", "GET");
 }
 
-boost::future<Json> bitflyer::fetchPositionsAsync(const std::string& symbols,
+std::future<Json> bitflyer::fetchPositionsAsync(const std::string& symbols,
                                               const std::optional<long long>& since,
                                               const std::optional<int>& limit) const {
     return this->fetchAsync("/v1/me/getpositions", "private", "GET");
 }
 
-boost::future<Json> bitflyer::fetchMyTradesAsync(const std::string& symbol,
+std::future<Json> bitflyer::fetchMyTradesAsync(const std::string& symbol,
                                              const std::optional<long long>& since,
                                              const std::optional<int>& limit) const {
     auto market = this->market(symbol);
@@ -357,19 +360,19 @@ boost::future<Json> bitflyer::fetchMyTradesAsync(const std::string& symbol,
     return this->fetchAsync("/v1/me/getexecutions", "private", "GET", request);
 }
 
-boost::future<Json> bitflyer::fetchDepositsAsync(const std::string& code,
+std::future<Json> bitflyer::fetchDepositsAsync(const std::string& code,
                                              const std::optional<long long>& since,
                                              const std::optional<int>& limit) const {
     return this->fetchAsync("/v1/me/getdeposits", "private", "GET");
 }
 
-boost::future<Json> bitflyer::fetchWithdrawalsAsync(const std::string& code,
+std::future<Json> bitflyer::fetchWithdrawalsAsync(const std::string& code,
                                                 const std::optional<long long>& since,
                                                 const std::optional<int>& limit) const {
     return this->fetchAsync("/v1/me/getwithdrawals", "private", "GET");
 }
 
-boost::future<Json> bitflyer::withdrawAsync(const std::string& code, double amount,
+std::future<Json> bitflyer::withdrawAsync(const std::string& code, double amount,
                                         const std::string& address, const std::string& tag,
                                         const Json& params) {
     auto request = Json::object({
@@ -1,4 +1,5 @@
 #include "ccxt/exchanges/bithumb.h"
+#include "ccxt/base/executor.h"
 
 namespace ccxt {
 
@@ -218,35 +219,37 @@ Json bithumb::withdrawImpl(const std::string& code, double amount, const std::st
 }
 
 // Async Implementation
-boost::future<Json> bithumb::fetchAsync(const std::string& path, const std::string& api,
+std::future<Json> bithumb::fetchAsync(const std::string& path, const std::string& api,
                                      const std::string& method, const Json& params,
                                      const std::map<std::string, std::string>& headers) const {
-    return Exchange::fetchAsync(path, api, method, params, headers);
+    return Executor::shared().submit([this, path, api, method, params, headers]() {
+        return this->fetch(path, api, method, params, headers);
+    });
 }
 
-boost::future<Json> bithumb::fetchMarketsAsync() const {
+std::future<Json> bithumb::fetchMarketsAsync() const {
     return this->fetchAsync("/ticker/all");
 }
 
-boost::future<Json> bithumb::fetchTickerAsync(const std::string& symbol) const {
+std::future<Json> bithumb::fetchTickerAsync(const std::string& symbol) const {
     auto market = this->market(symbol);
     return this->fetchAsync("/ticker/" + market["id"].get<std::string>());
 }
 
-boost::future<Json> bithumb::fetchOrderBookAsync(const std::string& symbol,
+std::future<Json> bithumb::fetchOrderBookAsync(const std::string& symbol,
                                               const std::optional<int>& limit) const {
     auto market = this->market(symbol);
     return this->fetchAsync("/orderbook/" + market["id"].get<std::string>());
 }
 
-boost::future<Json> bithumb::fetchTradesAsync(const std::string& symbol,
+std::future<Json> bithumb::fetchTradesAsync(const std::string& symbol,
                                            const std::optional<long long>& since,
                                            const std::optional<int>& limit) const {
     auto market = this->market(symbol);
     return this->fetchAsync("/transaction_history/" + market["id"].get<std::string>());
 }
 
-boost::future<Json> bithumb::fetchOHLCVAsync(const std::string& symbol,
+std::future<Json> bithumb::fetchOHLCVAsync(const std::string& symbol,
                                           const std::string& timeframe,
                                           const std::optional<long long>& since,
                                           const std::optional<int>& limit) const {
@@ -254,7 +257,7 @@ boost::future<Json> bithumb::fetchOHLCVAsync(const std::string& symbol,
     return this->fetchAsync("/candlestick/" + market["id"].get<std::string>() + "/" + timeframe);
 }
 
-boost::future<Json> bithumb::createOrderAsync(const std::string& symbol, const std::string& type,
+std::future<Json> bithumb::createOrderAsync(const std::string& symbol, const std::string& type,
                                           const std::string& side, double amount,
                                           const std::optional<double>& price) {
     auto market = this->market(symbol);
@@ -269,7 +272,7 @@ boost::future<Json> bithumb::createOrderAsync(const std::string& symbol, const s
     return this->fetchAsync("/trade/place", "private", "POST", request);
 }
 
-boost::future<Json> bithumb::cancelOrderAsync(const std::string& id, const std::string& symbol) {
+std::future<Json> bithumb::cancelOrderAsync(const std::string& id, const std::string& symbol) {
     auto market = this->market(symbol);
     auto request = Json::object({
         {"order_id", id},
@@ -278,7 +281,7 @@ boost::future<Json> bithumb::cancelOrderAsync(const std::string& id, const std::
     return this->fetchAsync("/trade/cancel", "private", "POST", request);
 }
 
-boost::future<Json> bithumb::fetchOrderAsync(const std::string& id, const std::string& symbol) const {
+std::future<Json> bithumb::fetchOrderAsync(const std::string& id, const std::string& symbol) const {
     auto market = this->market(symbol);
     auto request = Json::object({
         {"order_id", id},
@@ -287,7 +290,7 @@ boost::future<Json> bithumb::fetchOrderAsync(const std::string& id, const std::s
     return this->fetchAsync("/trade/order_detail", "private", "POST", request);
 }
 
-boost::future<Json> bithumb::fetchOrdersAsync(const std::string& symbol,
+std::future<Json> bithumb::fetchOrdersAsync(const std::string& symbol,
                                           const std::optional<long long>& since,
                                           const std::optional<int>& limit) const {
     auto market = this->market(symbol);
@@ -295,7 +298,7 @@ boost::future<Json> bithumb::fetchOrdersAsync(const std::string& symbol,
     return this->fetchAsync("/trade/orders", "private", "POST", request);
 }
 
-boost::future<Json> bithumb::fetchOpenOrdersAsync(const std::string& symbol,
+std::future<Json> bithumb::fetchOpenOrdersAsync(const std::string& symbol,
                                               const std::optional<long long>& since,
                                               const std::optional<int>& limit) const {
     auto market = this->market(symbol);
@@ -306,7 +309,7 @@ boost::future<Json> bithumb::fetchOpenOrdersAsync(const std::string& symbol,
     return this->fetchAsync("/trade/orders", "private", "POST", request);
 }
 
-boost::future<Json> bithumb::fetchClosedOrdersAsync(const std::string& symbol,
+std::future<Json> bithumb::fetchClosedOrdersAsync(const std::string& symbol,
                                                 const std::optional<long long>& since,
                                                 const std::optional<int>& limit) const {
     auto market = this->market(symbol);
@@ -317,11 +320,11 @@ boost::future<Json> bithumb::fetchClosedOrdersAsync(const std::string& symbol,
     return this->fetchAsync("/trade/orders", "private", "POST", request);
 }
 
-boost::future<Json> bithumb::fetchBalanceAsync() const {
+std::future<Json> bithumb::fetchBalanceAsync() const {
     return this->fetchAsync("/info/balance", "private", "POST");
 }
 
-boost::future<Json> bithumb::fetchMyTradesAsync(const std::string& symbol,
+std::future<Json> bithumb::fetchMyTradesAsync(const std::string& symbol,
                                             const std::optional<long long>& since,
                                             const std::optional<int>& limit) const {
     auto market = this->market(symbol);
@@ -329,21 +332,21 @@ boost::future<Json> bithumb::fetchMyTradesAsync(const std::string& symbol,
     return this->fetchAsync("/trade/history", "private", "POST", request);
 }
 
-boost::future<Json> bithumb::fetchDepositsAsync(const std::string& code,
+std::future<Json> bithumb::fetchDepositsAsync(const std::string& code,
                                             const std::optional<long long>& since,
                                             const std::optional<int>& limit) const {
     auto request = Json::object({{"currency", code}});
     return this->fetchAsync("/info/user_transactions", "private", "POST", request);
 }
 
-boost::future<Json> bithumb::fetchWithdrawalsAsync(const std::string& code,
+std::future<Json> bithumb::fetchWithdrawalsAsync(const std::string& code,
                                                const std::optional<long long>& since,
                                                const std::optional<int>& limit) const {
     auto request = Json::object({{"currency", code}});
     return this->fetchAsync("/trade/withdraw_detail", "private", "POST", request);
 }
 
-boost::future<Json> bithumb::withdrawAsync(const std::string& code, double amount,
+std::future<Json> bithumb::withdrawAsync(const std::string& code, double amount,
                                        const std::string& address, const std::string& tag,
                                        const Json& params) {
     auto request = Json::object({
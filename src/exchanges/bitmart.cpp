@@ -1,4 +1,5 @@
 #include "bitmart.h"
+#include "ccxt/base/executor.h"
 #include <chrono>
 #include <sstream>
 #include <iomanip>
@@ -263,22 +264,24 @@ Json Bitmart::fetchMyTradesImpl(const std::string& symbol, const std::optional<l
 }
 
 // Async Implementation
-boost::future<Json> Bitmart::fetchAsync(const std::string& path, const std::string& api,
+std::future<Json> Bitmart::fetchAsync(const std::string& path, const std::string& api,
                                     const std::string& method, const Json& params,
                                     const std::map<std::string, std::string>& headers) const {
-    return Exchange::fetchAsync(path, api, method, params, headers);
+    return Executor::shared().submit([this, path, api, method, params, headers]() {
+        return this->fetch(path, api, method, params, headers);
+    });
 }
 
-boost::future<Json> Bitmart::fetchMarketsAsync() const {
+std::future<Json> Bitmart::fetchMarketsAsync() const {
     return this->fetchAsync("/spot/v1/symbols");
 }
 
-boost::future<Json> Bitmart::fetchTickerAsync(const std::string& symbol) const {
+std::future<Json> Bitmart::fetchTickerAsync(const std::string& symbol) const {
     auto market = this->market(symbol);
     return this->fetchAsync("/spot/quotation/v3/ticker?symbol=" + market["id"].get<std::string>());
 }
 
-boost::future<Json> Bitmart::fetchOrderBookAsync(const std::string& symbol,
+std::future<Json> Bitmart::fetchOrderBookAsync(const std::string& symbol,
                                              const std::optional<int>& limit) const {
     auto market = this->market(symbol);
     auto request = Json::object({{"symbol", market["id"]}});
@@ -288,7 +291,7 @@ boost::future<Json> Bitmart::fetchOrderBookAsync(const std::string& symbol,
     return this->fetchAsync("/spot/quotation/v3/books?" + this->urlencode(request));
 }
 
-boost::future<Json> Bitmart::fetchTradesAsync(const std::string& symbol,
+std::future<Json> Bitmart::fetchTradesAsync(const std::string& symbol,
                                           const std::optional<long long>& since,
                                           const std::optional<int>& limit) const {
     auto market = this->market(symbol);
@@ -299,7 +302,7 @@ boost::future<Json> Bitmart::fetchTradesAsync(const std::string& symbol,
     return this->fetchAsync("/spot/quotation/v3/trades?" + this->urlencode(request));
 }
 
-boost::future<Json> Bitmart::fetchOHLCVAsync(const std::string& symbol,
+std::future<Json> Bitmart::fetchOHLCVAsync(const std::string& symbol,
                                          const std::string& timeframe,
                                          const std::optional<long long>& since,
                                          const std::optional<int>& limit) const {
@@ -317,7 +320,7 @@ boost::future<Json> Bitmart::fetchOHLCVAsync(const std::string& symbol,
     return this->fetchAsync("/spot/quotation/v3/klines?" + this->urlencode(request));
 }
 
-boost::future<Json> Bitmart::createOrderAsync(const std::string& symbol,
+std::future<Json> Bitmart::createOrderAsync(const std::string& symbol,
                                          const std::string& type,
                                          const std::string& side,
                                          double amount,
@@ -335,7 +338,7 @@ boost::future<Json> Bitmart::createOrderAsync(const std::string& symbol,
     return this->fetchAsync("/spot/v1/submit_order", "private", "POST", request);
 }
 
-boost::future<Json> Bitmart::cancelOrderAsync(const std::string& id,
+std::future<Json> Bitmart::cancelOrderAsync(const std::string& id,
                                          const std::string& symbol) {
     auto market = this->market(symbol);
     auto request = Json::object({
@@ -345,7 +348,7 @@ boost::future<Json> Bitmart::cancelOrderAsync(const std::string& id,
     return this->fetchAsync("/spot/v2/cancel_order", "private", "POST", request);
 }
 
-boost::future<Json> Bitmart::fetchOrderAsync(const std::string& id,
+std::future<Json> Bitmart::fetchOrderAsync(const std::string& id,
                                         const std::string& symbol) const {
     auto market = this->market(symbol);
     auto request = Json::object({
@@ -355,7 +358,7 @@ boost::future<Json> Bitmart::fetchOrderAsync(const std::string& id,
     return this->fetchAsync("/spot/v2/orders?" + this->urlencode(request), "private");
 }
 
-boost::future<Json> Bitmart::fetchOrdersAsync(const std::string& symbol,
+std::future<Json> Bitmart::fetchOrdersAsync(const std::string& symbol,
                                          const std::optional<long long>& since,
                                          const std::optional<int>& limit) const {
     auto market = this->market(symbol);
@@ -369,7 +372,7 @@ boost::future<Json> Bitmart::fetchOrdersAsync(const std::string& symbol,
     return this->fetchAsync("/spot/v2/orders?" + this->urlencode(request), "private");
 }
 
-boost::future<Json> Bitmart::fetchOpenOrdersAsync(const std::string& symbol,
+std::future<Json> Bitmart::fetchOpenOrdersAsync(const std::string& symbol,
                                              const std::optional<long long>& since,
                                              const std::optional<int>& limit) const {
     auto market = this->market(symbol);
@@ -386,7 +389,7 @@ boost::future<Json> Bitmart::fetchOpenOrdersAsync(const std::string& symbol,
     return this->fetchAsync("/spot/v2/orders?" + this->urlencode(request), "private");
 }
 
-boost::future<Json> Bitmart::fetchClosedOrdersAsync(const std::string& symbol,
+std::future<Json> Bitmart::fetchClosedOrdersAsync(const std::string& symbol,
                                                const std::optional<long long>& since,
                                                const std::optional<int>& limit) const {
     auto market = this->market(symbol);
@@ -403,11 +406,11 @@ boost::future<Json> Bitmart::fetchClosedOrdersAsync(const std::string& symbol,
     return this->fetchAsync("/spot/v2/orders?" + this->urlencode(request), "private");
 }
 
-boost::future<Json> Bitmart::fetchBalanceAsync() const {
+std::future<Json> Bitmart::fetchBalanceAsync() const {
     return this->fetchAsync("/spot/v1/wallet", "private");
 }
 
-boost::future<Json> Bitmart::fetchMyTradesAsync(const std::string& symbol,
+std::future<Json> Bitmart::fetchMyTradesAsync(const std::string& symbol,
                                            const std::optional<long long>& since,
                                            const std::optional<int>& limit) const {
     auto market = this->market(symbol);
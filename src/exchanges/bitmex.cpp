@@ -1,4 +1,5 @@
 #include "bitmex.h"
+#include "ccxt/base/executor.h"
 #include <boost/beast/core.hpp>
 #include <boost/beast/http.hpp>
 #include <boost/beast/ssl.hpp>
@@ -315,23 +316,25 @@ Json BitMEX::fetchPositionsImpl(const std::string& symbol) const {
 }
 
 // Async Implementation
-boost::future<Json> BitMEX::fetchAsync(const std::string& path, const std::string& api,
+std::future<Json> BitMEX::fetchAsync(const std::string& path, const std::string& api,
                                    const std::string& method, const Json& params,
                                    const std::map<std::string, std::string>& headers) const {
-    return Exchange::fetchAsync(path, api, method, params, headers);
+    return Executor::shared().submit([this, path, api, method, params, headers]() {
+        return this->fetch(path, api, method, params, headers);
+    });
 }
 
-boost::future<Json> BitMEX::fetchMarketsAsync() const {
+std::future<Json> BitMEX::fetchMarketsAsync() const {
     return this->fetchAsync("/instrument/active");
 }
 
-boost::future<Json> BitMEX::fetchTickerAsync(const std::string& symbol) const {
+std::future<Json> BitMEX::fetchTickerAsync(const std::string& symbol) const {
     auto market = this->market(symbol);
     auto request = Json::object({{"symbol", market["id"]}});
     return this->fetchAsync("/instrument?" + this->urlencode(request));
 }
 
-boost::future<Json> BitMEX::fetchOrderBookAsync(const std::string& symbol,
+std::future<Json> BitMEX::fetchOrderBookAsync(const std::string& symbol,
                                             const std::optional<int>& limit) const {
     auto market = this->market(symbol);
     auto request = Json::object({{"symbol", market["id"]}});
@@ -341,7 +344,7 @@ boost::future<Json> BitMEX::fetchOrderBookAsync(const std::string& symbol,
     return this->fetchAsync("/orderBook/L2?" + this->urlencode(request));
 }
 
-boost::future<Json> BitMEX::fetchTradesAsync(const std::string& symbol,
+std::future<Json> BitMEX::fetchTradesAsync(const std::string& symbol,
                                          const std::optional<long long>& since,
                                          const std::optional<int>& limit) const {
     auto market = this->market(symbol);
@@ -355,7 +358,7 @@ boost::future<Json> BitMEX::fetchTradesAsync(const std::string& symbol,
     return this->fetchAsync("/trade?" + this->urlencode(request));
 }
 
-boost::future<Json> BitMEX::fetchOHLCVAsync(const std::string& symbol,
+std::future<Json> BitMEX::fetchOHLCVAsync(const std::string& symbol,
                                         const std::string& timeframe,
                                         const std::optional<long long>& since,
                                         const std::optional<int>& limit) const {
@@ -374,7 +377,7 @@ boost::future<Json> BitMEX::fetchOHLCVAsync(const std::string& symbol,
     return this->fetchAsync("/trade/bucketed?" + this->urlencode(request));
 }
 
-boost::future<Json> BitMEX::createOrderAsync(const std::string& symbol,
+std::future<Json> BitMEX::createOrderAsync(const std::string& symbol,
                                         const std::string& type,
                                         const std::string& side,
                                         double amount,
@@ -392,7 +395,7 @@ boost::future<Json> BitMEX::createOrderAsync(const std::string& symbol,
     return this->fetchAsync("/order", "private", "POST", request);
 }
 
-boost::future<Json> BitMEX::cancelOrderAsync(const std::string& id,
+std::future<Json> BitMEX::cancelOrderAsync(const std::string& id,
                                         const std::string& symbol) {
     auto request = Json::object({{"orderID", id}});
     if (!symbol.empty()) {
@@ -402,7 +405,7 @@ boost::future<Json> BitMEX::cancelOrderAsync(const std::string& id,
     return this->fetchAsync("/order", "private", "DELETE", request);
 }
 
-boost::future<Json> BitMEX::fetchOrderAsync(const std::string& id,
+std::future<Json> BitMEX::fetchOrderAsync(const std::string& id,
                                        const std::string& symbol) const {
     auto request = Json::object({{"orderID", id}});
     if (!symbol.empty()) {
@@ -412,7 +415,7 @@ boost::future<Json> BitMEX::fetchOrderAsync(const std::string& id,
     return this->fetchAsync("/order?" + this->urlencode(request), "private");
 }
 
-boost::future<Json> BitMEX::fetchOrdersAsync(const std::string& symbol,
+std::future<Json> BitMEX::fetchOrdersAsync(const std::string& symbol,
                                         const std::optional<long long>& since,
                                         const std::optional<int>& limit) const {
     auto request = Json::object();
@@ -429,7 +432,7 @@ boost::future<Json> BitMEX::fetchOrdersAsync(const std::string& symbol,
     return this->fetchAsync("/order?" + this->urlencode(request), "private");
 }
 
-boost::future<Json> BitMEX::fetchOpenOrdersAsync(const std::string& symbol,
+std::future<Json> BitMEX::fetchOpenOrdersAsync(const std::string& symbol,
                                              const std::optional<long long>& since,
                                              const std::optional<int>& limit) const {
     auto request = Json::object({{"filter", {{"open", true}}}});
@@ -446,7 +449,7 @@ boost::future<Json> BitMEX::fetchOpenOrdersAsync(const std::string& symbol,
     return this->fetchAsync("/order?" + this->urlencode(request), "private");
 }
 
-boost::future<Json> BitMEX::fetchClosedOrdersAsync(const std::string& symbol,
+std::future<Json> BitMEX::fetchClosedOrdersAsync(const std::string& symbol,
                                                const std::optional<long long>& since,
                                                const std::optional<int>& limit) const {
     auto request = Json::object({{"filter", {{"open", false}}}});
@@ -463,11 +466,11 @@ boost::future<Json> BitMEX::fetchClosedOrdersAsync(const std::string& symbol,
     return this->fetchAsync("/order?" + this->urlencode(request), "private");
 }
 
-boost::future<Json> BitMEX::fetchBalanceAsync() const {
+std::future<Json> BitMEX::fetchBalanceAsync() const {
     return this->fetchAsync("/user/margin", "private");
 }
 
-boost::future<Json> BitMEX::fetchPositionsAsync(const std::string& symbol) const {
+std::future<Json> BitMEX::fetchPositionsAsync(const std::string& symbol) const {
     auto request = Json::object();
     if (!symbol.empty()) {
         auto market = this->market(symbol);
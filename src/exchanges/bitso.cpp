@@ -396,7 +396,7 @@ json Bitso::parseTicker(const json& ticker, const Market& market) {
     };
 }
 
-json Bitso::fetchOHLCV(const std::string& symbol, const std::string& timeframe, int since, int limit, const json& params) {
+json Bitso::fetchOHLCV(const std::string& symbol, const std::string& timeframe, long long since, int limit, const json& params) {
     this->loadMarkets();
     auto market = this->market(symbol);
     auto request = {
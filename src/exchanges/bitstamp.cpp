@@ -5,7 +5,7 @@
 #include <openssl/hmac.h>
 #include <boost/asio.hpp>
 #include <boost/thread.hpp>
-#include <boost/future.hpp>
+#include "ccxt/base/executor.h"
 
 namespace ccxt {
 
@@ -86,65 +86,65 @@ json Bitstamp::fetchTickers(const std::vector<std::string>& symbols, const json&
 // ... 其他同步方法实现 ...
 
 // Asynchronous REST API Implementation
-boost::future<json> Bitstamp::fetchMarketsAsync(const json& params) {
-    return boost::async([this, params]() {
+std::future<json> Bitstamp::fetchMarketsAsync(const json& params) {
+    return Executor::shared().submit([this, params]() {
         return this->fetchMarkets(params);
     });
 }
 
-boost::future<json> Bitstamp::fetchTickerAsync(const std::string& symbol, const json& params) {
-    return boost::async([this, symbol, params]() {
+std::future<json> Bitstamp::fetchTickerAsync(const std::string& symbol, const json& params) {
+    return Executor::shared().submit([this, symbol, params]() {
         return this->fetchTicker(symbol, params);
     });
 }
 
-boost::future<json> Bitstamp::fetchTickersAsync(const std::vector<std::string>& symbols, const json& params) {
-    return boost::async([this, symbols, params]() {
+std::future<json> Bitstamp::fetchTickersAsync(const std::vector<std::string>& symbols, const json& params) {
+    return Executor::shared().submit([this, symbols, params]() {
         return this->fetchTickers(symbols, params);
     });
 }
 
-boost::future<json> Bitstamp::fetchOrderBookAsync(const std::string& symbol, int limit, const json& params) {
-    return boost::async([this, symbol, limit, params]() {
+std::future<json> Bitstamp::fetchOrderBookAsync(const std::string& symbol, int limit, const json& params) {
+    return Executor::shared().submit([this, symbol, limit, params]() {
         return this->fetchOrderBook(symbol, limit, params);
     });
 }
 
-boost::future<json> Bitstamp::fetchTradesAsync(const std::string& symbol, int since, int limit, const json& params) {
-    return boost::async([this, symbol, since, limit, params]() {
+std::future<json> Bitstamp::fetchTradesAsync(const std::string& symbol, int since, int limit, const json& params) {
+    return Executor::shared().submit([this, symbol, since, limit, params]() {
         return this->fetchTrades(symbol, since, limit, params);
     });
 }
 
-boost::future<json> Bitstamp::fetchOHLCVAsync(const std::string& symbol, const std::string& timeframe,
-                                             int since, int limit, const json& params) {
-    return boost::async([this, symbol, timeframe, since, limit, params]() {
+std::future<json> Bitstamp::fetchOHLCVAsync(const std::string& symbol, const std::string& timeframe,
+                                             long long since, int limit, const json& params) {
+    return Executor::shared().submit([this, symbol, timeframe, since, limit, params]() {
         return this->fetchOHLCV(symbol, timeframe, since, limit, params);
     });
 }
 
-boost::future<json> Bitstamp::fetchBalanceAsync(const json& params) {
-    return boost::async([this, params]() {
+std::future<json> Bitstamp::fetchBalanceAsync(const json& params) {
+    return Executor::shared().submit([this, params]() {
         return this->fetchBalance(params);
     });
 }
 
-boost::future<json> Bitstamp::createOrderAsync(const std::string& symbol, const std::string& type,
+std::future<json> Bitstamp::createOrderAsync(const std::string& symbol, const std::string& type,
                                              const std::string& side, double amount,
                                              double price, const json& params) {
-    return boost::async([this, symbol, type, side, amount, price, params]() {
+    return Executor::shared().submit([this, symbol, type, side, amount, price, params]() {
         return this->createOrder(symbol, type, side, amount, price, params);
     });
 }
 
-boost::future<json> Bitstamp::cancelOrderAsync(const std::string& id, const std::string& symbol, const json& params) {
-    return boost::async([this, id, symbol, params]() {
+std::future<json> Bitstamp::cancelOrderAsync(const std::string& id, const std::string& symbol, const json& params) {
+    return Executor::shared().submit([this, id, symbol, params]() {
         return this->cancelOrder(id, symbol, params);
     });
 }
 
-boost::future<json> Bitstamp::fetchOrderAsync(const std::string& id, const std::string& symbol, const json& params) {
-    return boost::async([this, id, symbol, params]() {
+std::future<json> Bitstamp::fetchOrderAsync(const std::string& id, const std::string& symbol, const json& params) {
+    return Executor::shared().submit([this, id, symbol, params]() {
         return this->fetchOrder(id, symbol, params);
     });
 }
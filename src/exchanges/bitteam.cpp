@@ -1,4 +1,5 @@
 #include "ccxt/exchanges/bitteam.h"
+#include "ccxt/base/executor.h"
 #include <chrono>
 #include <sstream>
 #include <iomanip>
@@ -133,40 +134,40 @@ Json bitteam::createOrder(const std::string& symbol, const std::string& type, co
 }
 
 // Asynchronous REST API Implementation
-boost::future<Json> bitteam::fetchMarketsAsync(const json& params) {
-    return boost::async([this, params]() {
+std::future<Json> bitteam::fetchMarketsAsync(const json& params) {
+    return Executor::shared().submit([this, params]() {
         return this->fetchMarkets(params);
     });
 }
 
-boost::future<Json> bitteam::fetchTickerAsync(const std::string& symbol, const json& params) {
-    return boost::async([this, symbol, params]() {
+std::future<Json> bitteam::fetchTickerAsync(const std::string& symbol, const json& params) {
+    return Executor::shared().submit([this, symbol, params]() {
         return this->fetchTicker(symbol, params);
     });
 }
 
-boost::future<Json> bitteam::fetchOrderBookAsync(const std::string& symbol, int limit, const json& params) {
-    return boost::async([this, symbol, limit, params]() {
+std::future<Json> bitteam::fetchOrderBookAsync(const std::string& symbol, int limit, const json& params) {
+    return Executor::shared().submit([this, symbol, limit, params]() {
         return this->fetchOrderBook(symbol, limit, params);
     });
 }
 
-boost::future<Json> bitteam::fetchTradesAsync(const std::string& symbol, int since, int limit, const json& params) {
-    return boost::async([this, symbol, since, limit, params]() {
+std::future<Json> bitteam::fetchTradesAsync(const std::string& symbol, int since, int limit, const json& params) {
+    return Executor::shared().submit([this, symbol, since, limit, params]() {
         return this->fetchTrades(symbol, since, limit, params);
     });
 }
 
-boost::future<Json> bitteam::fetchBalanceAsync(const json& params) {
-    return boost::async([this, params]() {
+std::future<Json> bitteam::fetchBalanceAsync(const json& params) {
+    return Executor::shared().submit([this, params]() {
         return this->fetchBalance(params);
     });
 }
 
-boost::future<Json> bitteam::createOrderAsync(const std::string& symbol, const std::string& type,
+std::future<Json> bitteam::createOrderAsync(const std::string& symbol, const std::string& type,
                                             const std::string& side, double amount,
                                             double price, const json& params) {
-    return boost::async([this, symbol, type, side, amount, price, params]() {
+    return Executor::shared().submit([this, symbol, type, side, amount, price, params]() {
         return this->createOrder(symbol, type, side, amount, price, params);
     });
 }
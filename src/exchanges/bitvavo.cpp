@@ -1,4 +1,5 @@
 #include "ccxt/exchanges/bitvavo.h"
+#include "ccxt/base/executor.h"
 #include <chrono>
 #include <sstream>
 #include <iomanip>
@@ -130,22 +131,22 @@ json Bitvavo::createOrder(const std::string& symbol, const std::string& type, co
 }
 
 // Async API Methods
-boost::future<json> Bitvavo::fetchMarketsAsync(const json& params) {
-    return boost::async(boost::launch::async, [this, params]() {
+std::future<json> Bitvavo::fetchMarketsAsync(const json& params) {
+    return Executor::shared().submit([this, params]() {
         return this->fetchMarkets(params);
     });
 }
 
-boost::future<json> Bitvavo::fetchBalanceAsync(const json& params) {
-    return boost::async(boost::launch::async, [this, params]() {
+std::future<json> Bitvavo::fetchBalanceAsync(const json& params) {
+    return Executor::shared().submit([this, params]() {
         return this->fetchBalance(params);
     });
 }
 
-boost::future<json> Bitvavo::createOrderAsync(const std::string& symbol, const std::string& type,
+std::future<json> Bitvavo::createOrderAsync(const std::string& symbol, const std::string& type,
                                             const std::string& side, double amount,
                                             double price, const json& params) {
-    return boost::async(boost::launch::async, [this, symbol, type, side, amount, price, params]() {
+    return Executor::shared().submit([this, symbol, type, side, amount, price, params]() {
         return this->createOrder(symbol, type, side, amount, price, params);
     });
 }
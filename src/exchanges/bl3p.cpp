@@ -1,4 +1,5 @@
 #include "ccxt/exchanges/bl3p.h"
+#include "ccxt/base/executor.h"
 #include "ccxt/base/json_helper.h"
 #include <openssl/hmac.h>
 #include <sstream>
@@ -256,56 +257,56 @@ Json bl3p::parseFees(const Json& response) const {
 }
 
 // Async Market Data implementations
-boost::future<Json> bl3p::fetchTickerAsync(const std::string& symbol) const {
-    return boost::async(boost::launch::async, [this, symbol]() {
+std::future<Json> bl3p::fetchTickerAsync(const std::string& symbol) const {
+    return Executor::shared().submit([this, symbol]() {
         return this->fetchTickerImpl(symbol);
     });
 }
 
-boost::future<Json> bl3p::fetchOrderBookAsync(const std::string& symbol, const std::optional<int>& limit) const {
-    return boost::async(boost::launch::async, [this, symbol, limit]() {
+std::future<Json> bl3p::fetchOrderBookAsync(const std::string& symbol, const std::optional<int>& limit) const {
+    return Executor::shared().submit([this, symbol, limit]() {
         return this->fetchOrderBookImpl(symbol, limit);
     });
 }
 
-boost::future<Json> bl3p::fetchTradesAsync(const std::string& symbol, const std::optional<long long>& since,
+std::future<Json> bl3p::fetchTradesAsync(const std::string& symbol, const std::optional<long long>& since,
                                          const std::optional<int>& limit) const {
-    return boost::async(boost::launch::async, [this, symbol, since, limit]() {
+    return Executor::shared().submit([this, symbol, since, limit]() {
         return this->fetchTradesImpl(symbol, since, limit);
     });
 }
 
-boost::future<Json> bl3p::fetchTradingFeesAsync() const {
-    return boost::async(boost::launch::async, [this]() {
+std::future<Json> bl3p::fetchTradingFeesAsync() const {
+    return Executor::shared().submit([this]() {
         return this->fetchTradingFeesImpl();
     });
 }
 
 // Async Trading implementations
-boost::future<Json> bl3p::createOrderAsync(const std::string& symbol, const std::string& type,
+std::future<Json> bl3p::createOrderAsync(const std::string& symbol, const std::string& type,
                                          const std::string& side, double amount,
                                          const std::optional<double>& price) {
-    return boost::async(boost::launch::async, [this, symbol, type, side, amount, price]() {
+    return Executor::shared().submit([this, symbol, type, side, amount, price]() {
         return this->createOrderImpl(symbol, type, side, amount, price);
     });
 }
 
-boost::future<Json> bl3p::cancelOrderAsync(const std::string& id, const std::string& symbol) {
-    return boost::async(boost::launch::async, [this, id, symbol]() {
+std::future<Json> bl3p::cancelOrderAsync(const std::string& id, const std::string& symbol) {
+    return Executor::shared().submit([this, id, symbol]() {
         return this->cancelOrderImpl(id, symbol);
     });
 }
 
-boost::future<Json> bl3p::createDepositAddressAsync(const std::string& code,
+std::future<Json> bl3p::createDepositAddressAsync(const std::string& code,
                                                    const std::optional<std::string>& network) {
-    return boost::async(boost::launch::async, [this, code, network]() {
+    return Executor::shared().submit([this, code, network]() {
         return this->createDepositAddressImpl(code, network);
     });
 }
 
 // Async Account implementations
-boost::future<Json> bl3p::fetchBalanceAsync() const {
-    return boost::async(boost::launch::async, [this]() {
+std::future<Json> bl3p::fetchBalanceAsync() const {
+    return Executor::shared().submit([this]() {
         return this->fetchBalanceImpl();
     });
 }
@@ -325,7 +325,7 @@ json Btcturk::fetchTrades(const std::string& symbol, int since, int limit, const
     return this->parseTrades(trades, market, since, limit);
 }
 
-json Btcturk::fetchOHLCV(const std::string& symbol, const std::string& timeframe, int since, int limit, const json& params) {
+json Btcturk::fetchOHLCV(const std::string& symbol, const std::string& timeframe, long long since, int limit, const json& params) {
     this->loadMarkets();
     Market market = this->market(symbol);
     json request = {
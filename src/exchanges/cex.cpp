@@ -1,4 +1,5 @@
 #include "ccxt/exchanges/cex.h"
+#include "ccxt/base/executor.h"
 #include <chrono>
 #include <iomanip>
 #include <sstream>
@@ -290,103 +291,103 @@ std::string cex::sign(const std::string& path, const std::string& api, const std
 }
 
 // Async Market Data Functions
-boost::future<Json> cex::fetchMarketsAsync(const Json& params) const {
-    return boost::async(boost::launch::async, [this, params]() {
+std::future<Json> cex::fetchMarketsAsync(const Json& params) const {
+    return Executor::shared().submit([this, params]() {
         return this->fetchMarkets(params);
     });
 }
 
-boost::future<Json> cex::fetchTickerAsync(const std::string& symbol, const Json& params) const {
-    return boost::async(boost::launch::async, [this, symbol, params]() {
+std::future<Json> cex::fetchTickerAsync(const std::string& symbol, const Json& params) const {
+    return Executor::shared().submit([this, symbol, params]() {
         return this->fetchTicker(symbol, params);
     });
 }
 
-boost::future<Json> cex::fetchTickersAsync(const std::vector<std::string>& symbols, const Json& params) const {
-    return boost::async(boost::launch::async, [this, symbols, params]() {
+std::future<Json> cex::fetchTickersAsync(const std::vector<std::string>& symbols, const Json& params) const {
+    return Executor::shared().submit([this, symbols, params]() {
         return this->fetchTickers(symbols, params);
     });
 }
 
-boost::future<Json> cex::fetchOrderBookAsync(const std::string& symbol, const std::optional<int>& limit, const Json& params) const {
-    return boost::async(boost::launch::async, [this, symbol, limit, params]() {
+std::future<Json> cex::fetchOrderBookAsync(const std::string& symbol, const std::optional<int>& limit, const Json& params) const {
+    return Executor::shared().submit([this, symbol, limit, params]() {
         return this->fetchOrderBook(symbol, limit, params);
     });
 }
 
-boost::future<Json> cex::fetchTradesAsync(const std::string& symbol, const std::optional<long long>& since, 
+std::future<Json> cex::fetchTradesAsync(const std::string& symbol, const std::optional<long long>& since, 
                                         const std::optional<int>& limit, const Json& params) const {
-    return boost::async(boost::launch::async, [this, symbol, since, limit, params]() {
+    return Executor::shared().submit([this, symbol, since, limit, params]() {
         return this->fetchTrades(symbol, since, limit, params);
     });
 }
 
-boost::future<Json> cex::fetchOHLCVAsync(const std::string& symbol, const std::string& timeframe,
+std::future<Json> cex::fetchOHLCVAsync(const std::string& symbol, const std::string& timeframe,
                                        const std::optional<long long>& since, const std::optional<int>& limit,
                                        const Json& params) const {
-    return boost::async(boost::launch::async, [this, symbol, timeframe, since, limit, params]() {
+    return Executor::shared().submit([this, symbol, timeframe, since, limit, params]() {
         return this->fetchOHLCV(symbol, timeframe, since, limit, params);
     });
 }
 
 // Async Trading Functions
-boost::future<Json> cex::createOrderAsync(const std::string& symbol, const std::string& type, const std::string& side,
+std::future<Json> cex::createOrderAsync(const std::string& symbol, const std::string& type, const std::string& side,
                                        double amount, const std::optional<double>& price, const Json& params) {
-    return boost::async(boost::launch::async, [this, symbol, type, side, amount, price, params]() {
+    return Executor::shared().submit([this, symbol, type, side, amount, price, params]() {
         return this->createOrder(symbol, type, side, amount, price, params);
     });
 }
 
-boost::future<Json> cex::cancelOrderAsync(const std::string& id, const std::string& symbol, const Json& params) {
-    return boost::async(boost::launch::async, [this, id, symbol, params]() {
+std::future<Json> cex::cancelOrderAsync(const std::string& id, const std::string& symbol, const Json& params) {
+    return Executor::shared().submit([this, id, symbol, params]() {
         return this->cancelOrder(id, symbol, params);
     });
 }
 
-boost::future<Json> cex::fetchOrderAsync(const std::string& id, const std::string& symbol, const Json& params) const {
-    return boost::async(boost::launch::async, [this, id, symbol, params]() {
+std::future<Json> cex::fetchOrderAsync(const std::string& id, const std::string& symbol, const Json& params) const {
+    return Executor::shared().submit([this, id, symbol, params]() {
         return this->fetchOrder(id, symbol, params);
     });
 }
 
-boost::future<Json> cex::fetchOpenOrdersAsync(const std::optional<std::string>& symbol,
+std::future<Json> cex::fetchOpenOrdersAsync(const std::optional<std::string>& symbol,
                                            const std::optional<long long>& since,
                                            const std::optional<int>& limit,
                                            const Json& params) const {
-    return boost::async(boost::launch::async, [this, symbol, since, limit, params]() {
+    return Executor::shared().submit([this, symbol, since, limit, params]() {
         return this->fetchOpenOrders(symbol, since, limit, params);
     });
 }
 
-boost::future<Json> cex::fetchClosedOrdersAsync(const std::optional<std::string>& symbol,
+std::future<Json> cex::fetchClosedOrdersAsync(const std::optional<std::string>& symbol,
                                              const std::optional<long long>& since,
                                              const std::optional<int>& limit,
                                              const Json& params) const {
-    return boost::async(boost::launch::async, [this, symbol, since, limit, params]() {
+    return Executor::shared().submit([this, symbol, since, limit, params]() {
         return this->fetchClosedOrders(symbol, since, limit, params);
     });
 }
 
 // Async Account Functions
-boost::future<Json> cex::fetchBalanceAsync(const Json& params) const {
-    return boost::async(boost::launch::async, [this, params]() {
+std::future<Json> cex::fetchBalanceAsync(const Json& params) const {
+    return Executor::shared().submit([this, params]() {
         return this->fetchBalance(params);
     });
 }
 
-boost::future<Json> cex::fetchDepositAddressAsync(const std::string& code,
+std::future<Json> cex::fetchDepositAddressAsync(const std::string& code,
                                                const std::optional<std::string>& network,
                                                const Json& params) const {
-    return boost::async(boost::launch::async, [this, code, network, params]() {
+    return Executor::shared().submit([this, code, network, params]() {
         return this->fetchDepositAddress(code, network, params);
     });
 }
 
-boost::future<Json> cex::fetchTransactionsAsync(const std::optional<std::string>& code,
+std::future<Json> cex::fetchTransactionsAsync(const std::optional<std::string>& code,
                                              const std::optional<long long>& since,
                                              const std::optional<int>& limit,
                                              const Json& params) const {
-    return boost::async(boost::launch::async, [this, code, since, limit, params]() {
+    return Executor::shared().submit([this, code, since, limit, params]() {
         return this->fetchTransactions(code, since, limit, params);
     });
 }
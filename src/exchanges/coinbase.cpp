@@ -1,4 +1,5 @@
 #include "ccxt/exchanges/coinbase.h"
+#include "ccxt/base/executor.h"
 #include <chrono>
 #include <sstream>
 #include <iomanip>
@@ -263,84 +264,84 @@ std::map<std::string, std::string> Coinbase::getAuthHeaders(const std::string& m
 }
 
 // Async Market Data API Implementation
-boost::future<json> Coinbase::fetchMarketsAsync(const json& params) const {
-    return boost::async(boost::launch::async, [this, params]() {
+std::future<json> Coinbase::fetchMarketsAsync(const json& params) const {
+    return Executor::shared().submit([this, params]() {
         return this->fetchMarkets(params);
     });
 }
 
-boost::future<json> Coinbase::fetchTickerAsync(const std::string& symbol, const json& params) const {
-    return boost::async(boost::launch::async, [this, symbol, params]() {
+std::future<json> Coinbase::fetchTickerAsync(const std::string& symbol, const json& params) const {
+    return Executor::shared().submit([this, symbol, params]() {
         return this->fetchTicker(symbol, params);
     });
 }
 
-boost::future<json> Coinbase::fetchTickersAsync(const std::vector<std::string>& symbols, const json& params) const {
-    return boost::async(boost::launch::async, [this, symbols, params]() {
+std::future<json> Coinbase::fetchTickersAsync(const std::vector<std::string>& symbols, const json& params) const {
+    return Executor::shared().submit([this, symbols, params]() {
         return this->fetchTickers(symbols, params);
     });
 }
 
-boost::future<json> Coinbase::fetchOrderBookAsync(const std::string& symbol, int limit, const json& params) const {
-    return boost::async(boost::launch::async, [this, symbol, limit, params]() {
+std::future<json> Coinbase::fetchOrderBookAsync(const std::string& symbol, int limit, const json& params) const {
+    return Executor::shared().submit([this, symbol, limit, params]() {
         return this->fetchOrderBook(symbol, limit, params);
     });
 }
 
-boost::future<json> Coinbase::fetchTradesAsync(const std::string& symbol, int since, int limit, const json& params) const {
-    return boost::async(boost::launch::async, [this, symbol, since, limit, params]() {
+std::future<json> Coinbase::fetchTradesAsync(const std::string& symbol, int since, int limit, const json& params) const {
+    return Executor::shared().submit([this, symbol, since, limit, params]() {
         return this->fetchTrades(symbol, since, limit, params);
     });
 }
 
-boost::future<json> Coinbase::fetchOHLCVAsync(const std::string& symbol, const std::string& timeframe,
-                                           int since, int limit, const json& params) const {
-    return boost::async(boost::launch::async, [this, symbol, timeframe, since, limit, params]() {
+std::future<json> Coinbase::fetchOHLCVAsync(const std::string& symbol, const std::string& timeframe,
+                                           long long since, int limit, const json& params) const {
+    return Executor::shared().submit([this, symbol, timeframe, since, limit, params]() {
         return this->fetchOHLCV(symbol, timeframe, since, limit, params);
     });
 }
 
 // Async Trading API Implementation
-boost::future<json> Coinbase::fetchBalanceAsync(const json& params) const {
-    return boost::async(boost::launch::async, [this, params]() {
+std::future<json> Coinbase::fetchBalanceAsync(const json& params) const {
+    return Executor::shared().submit([this, params]() {
         return this->fetchBalance(params);
     });
 }
 
-boost::future<json> Coinbase::createOrderAsync(const std::string& symbol, const std::string& type,
+std::future<json> Coinbase::createOrderAsync(const std::string& symbol, const std::string& type,
                                            const std::string& side, double amount,
                                            double price, const json& params) {
-    return boost::async(boost::launch::async, [this, symbol, type, side, amount, price, params]() {
+    return Executor::shared().submit([this, symbol, type, side, amount, price, params]() {
         return this->createOrder(symbol, type, side, amount, price, params);
     });
 }
 
-boost::future<json> Coinbase::cancelOrderAsync(const std::string& id, const std::string& symbol, const json& params) {
-    return boost::async(boost::launch::async, [this, id, symbol, params]() {
+std::future<json> Coinbase::cancelOrderAsync(const std::string& id, const std::string& symbol, const json& params) {
+    return Executor::shared().submit([this, id, symbol, params]() {
         return this->cancelOrder(id, symbol, params);
     });
 }
 
-boost::future<json> Coinbase::fetchOrderAsync(const std::string& id, const std::string& symbol, const json& params) const {
-    return boost::async(boost::launch::async, [this, id, symbol, params]() {
+std::future<json> Coinbase::fetchOrderAsync(const std::string& id, const std::string& symbol, const json& params) const {
+    return Executor::shared().submit([this, id, symbol, params]() {
         return this->fetchOrder(id, symbol, params);
     });
 }
 
-boost::future<json> Coinbase::fetchOrdersAsync(const std::string& symbol, int since, int limit, const json& params) const {
-    return boost::async(boost::launch::async, [this, symbol, since, limit, params]() {
+std::future<json> Coinbase::fetchOrdersAsync(const std::string& symbol, int since, int limit, const json& params) const {
+    return Executor::shared().submit([this, symbol, since, limit, params]() {
         return this->fetchOrders(symbol, since, limit, params);
     });
 }
 
-boost::future<json> Coinbase::fetchOpenOrdersAsync(const std::string& symbol, int since, int limit, const json& params) const {
-    return boost::async(boost::launch::async, [this, symbol, since, limit, params]() {
+std::future<json> Coinbase::fetchOpenOrdersAsync(const std::string& symbol, int since, int limit, const json& params) const {
+    return Executor::shared().submit([this, symbol, since, limit, params]() {
         return this->fetchOpenOrders(symbol, since, limit, params);
     });
 }
 
-boost::future<json> Coinbase::fetchClosedOrdersAsync(const std::string& symbol, int since, int limit, const json& params) const {
-    return boost::async(boost::launch::async, [this, symbol, since, limit, params]() {
+std::future<json> Coinbase::fetchClosedOrdersAsync(const std::string& symbol, int since, int limit, const json& params) const {
+    return Executor::shared().submit([this, symbol, since, limit, params]() {
         return this->fetchClosedOrders(symbol, since, limit, params);
     });
 }
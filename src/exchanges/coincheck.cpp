@@ -3,7 +3,7 @@
 #include <sstream>
 #include <iomanip>
 #include <openssl/hmac.h>
-#include <boost/thread/future.hpp>
+#include "ccxt/base/executor.h"
 
 namespace ccxt {
 
@@ -290,146 +290,146 @@ json Coincheck::parseOrder(const json& order, const Market& market) {
 }
 
 // Async Market Data API
-boost::future<json> Coincheck::fetchMarketsAsync(const json& params) {
-    return boost::async(boost::launch::async, [this, params]() {
+std::future<json> Coincheck::fetchMarketsAsync(const json& params) {
+    return Executor::shared().submit([this, params]() {
         return this->fetchMarkets(params);
     });
 }
 
-boost::future<json> Coincheck::fetchTickerAsync(const std::string& symbol, const json& params) {
-    return boost::async(boost::launch::async, [this, symbol, params]() {
+std::future<json> Coincheck::fetchTickerAsync(const std::string& symbol, const json& params) {
+    return Executor::shared().submit([this, symbol, params]() {
         return this->fetchTicker(symbol, params);
     });
 }
 
-boost::future<json> Coincheck::fetchTickersAsync(const std::vector<std::string>& symbols, const json& params) {
-    return boost::async(boost::launch::async, [this, symbols, params]() {
+std::future<json> Coincheck::fetchTickersAsync(const std::vector<std::string>& symbols, const json& params) {
+    return Executor::shared().submit([this, symbols, params]() {
         return this->fetchTickers(symbols, params);
     });
 }
 
-boost::future<json> Coincheck::fetchOrderBookAsync(const std::string& symbol, int limit, const json& params) {
-    return boost::async(boost::launch::async, [this, symbol, limit, params]() {
+std::future<json> Coincheck::fetchOrderBookAsync(const std::string& symbol, int limit, const json& params) {
+    return Executor::shared().submit([this, symbol, limit, params]() {
         return this->fetchOrderBook(symbol, limit, params);
     });
 }
 
-boost::future<json> Coincheck::fetchTradesAsync(const std::string& symbol, int since, int limit, const json& params) {
-    return boost::async(boost::launch::async, [this, symbol, since, limit, params]() {
+std::future<json> Coincheck::fetchTradesAsync(const std::string& symbol, int since, int limit, const json& params) {
+    return Executor::shared().submit([this, symbol, since, limit, params]() {
         return this->fetchTrades(symbol, since, limit, params);
     });
 }
 
-boost::future<json> Coincheck::fetchOHLCVAsync(const std::string& symbol, const std::string& timeframe,
-                                             int since, int limit, const json& params) {
-    return boost::async(boost::launch::async, [this, symbol, timeframe, since, limit, params]() {
+std::future<json> Coincheck::fetchOHLCVAsync(const std::string& symbol, const std::string& timeframe,
+                                             long long since, int limit, const json& params) {
+    return Executor::shared().submit([this, symbol, timeframe, since, limit, params]() {
         return this->fetchOHLCV(symbol, timeframe, since, limit, params);
     });
 }
 
 // Async Trading API
-boost::future<json> Coincheck::fetchBalanceAsync(const json& params) {
-    return boost::async(boost::launch::async, [this, params]() {
+std::future<json> Coincheck::fetchBalanceAsync(const json& params) {
+    return Executor::shared().submit([this, params]() {
         return this->fetchBalance(params);
     });
 }
 
-boost::future<json> Coincheck::createOrderAsync(const std::string& symbol, const std::string& type, const std::string& side,
+std::future<json> Coincheck::createOrderAsync(const std::string& symbol, const std::string& type, const std::string& side,
                                               double amount, double price, const json& params) {
-    return boost::async(boost::launch::async, [this, symbol, type, side, amount, price, params]() {
+    return Executor::shared().submit([this, symbol, type, side, amount, price, params]() {
         return this->createOrder(symbol, type, side, amount, price, params);
     });
 }
 
-boost::future<json> Coincheck::cancelOrderAsync(const std::string& id, const std::string& symbol, const json& params) {
-    return boost::async(boost::launch::async, [this, id, symbol, params]() {
+std::future<json> Coincheck::cancelOrderAsync(const std::string& id, const std::string& symbol, const json& params) {
+    return Executor::shared().submit([this, id, symbol, params]() {
         return this->cancelOrder(id, symbol, params);
     });
 }
 
-boost::future<json> Coincheck::fetchOrderAsync(const std::string& id, const std::string& symbol, const json& params) {
-    return boost::async(boost::launch::async, [this, id, symbol, params]() {
+std::future<json> Coincheck::fetchOrderAsync(const std::string& id, const std::string& symbol, const json& params) {
+    return Executor::shared().submit([this, id, symbol, params]() {
         return this->fetchOrder(id, symbol, params);
     });
 }
 
-boost::future<json> Coincheck::fetchOrdersAsync(const std::string& symbol, int since, int limit, const json& params) {
-    return boost::async(boost::launch::async, [this, symbol, since, limit, params]() {
+std::future<json> Coincheck::fetchOrdersAsync(const std::string& symbol, int since, int limit, const json& params) {
+    return Executor::shared().submit([this, symbol, since, limit, params]() {
         return this->fetchOrders(symbol, since, limit, params);
     });
 }
 
-boost::future<json> Coincheck::fetchOpenOrdersAsync(const std::string& symbol, int since, int limit, const json& params) {
-    return boost::async(boost::launch::async, [this, symbol, since, limit, params]() {
+std::future<json> Coincheck::fetchOpenOrdersAsync(const std::string& symbol, int since, int limit, const json& params) {
+    return Executor::shared().submit([this, symbol, since, limit, params]() {
         return this->fetchOpenOrders(symbol, since, limit, params);
     });
 }
 
-boost::future<json> Coincheck::fetchClosedOrdersAsync(const std::string& symbol, int since, int limit, const json& params) {
-    return boost::async(boost::launch::async, [this, symbol, since, limit, params]() {
+std::future<json> Coincheck::fetchClosedOrdersAsync(const std::string& symbol, int since, int limit, const json& params) {
+    return Executor::shared().submit([this, symbol, since, limit, params]() {
         return this->fetchClosedOrders(symbol, since, limit, params);
     });
 }
 
 // Async Account API
-boost::future<json> Coincheck::fetchMyTradesAsync(const std::string& symbol, int since, int limit, const json& params) {
-    return boost::async(boost::launch::async, [this, symbol, since, limit, params]() {
+std::future<json> Coincheck::fetchMyTradesAsync(const std::string& symbol, int since, int limit, const json& params) {
+    return Executor::shared().submit([this, symbol, since, limit, params]() {
         return this->fetchMyTrades(symbol, since, limit, params);
     });
 }
 
-boost::future<json> Coincheck::fetchDepositsAsync(const std::string& code, int since, int limit, const json& params) {
-    return boost::async(boost::launch::async, [this, code, since, limit, params]() {
+std::future<json> Coincheck::fetchDepositsAsync(const std::string& code, int since, int limit, const json& params) {
+    return Executor::shared().submit([this, code, since, limit, params]() {
         return this->fetchDeposits(code, since, limit, params);
     });
 }
 
-boost::future<json> Coincheck::fetchWithdrawalsAsync(const std::string& code, int since, int limit, const json& params) {
-    return boost::async(boost::launch::async, [this, code, since, limit, params]() {
+std::future<json> Coincheck::fetchWithdrawalsAsync(const std::string& code, int since, int limit, const json& params) {
+    return Executor::shared().submit([this, code, since, limit, params]() {
         return this->fetchWithdrawals(code, since, limit, params);
     });
 }
 
-boost::future<json> Coincheck::fetchDepositAddressAsync(const std::string& code, const json& params) {
-    return boost::async(boost::launch::async, [this, code, params]() {
+std::future<json> Coincheck::fetchDepositAddressAsync(const std::string& code, const json& params) {
+    return Executor::shared().submit([this, code, params]() {
         return this->fetchDepositAddress(code, params);
     });
 }
 
-boost::future<json> Coincheck::withdrawAsync(const std::string& code, double amount, const std::string& address, const std::string& tag, const json& params) {
-    return boost::async(boost::launch::async, [this, code, amount, address, tag, params]() {
+std::future<json> Coincheck::withdrawAsync(const std::string& code, double amount, const std::string& address, const std::string& tag, const json& params) {
+    return Executor::shared().submit([this, code, amount, address, tag, params]() {
         return this->withdraw(code, amount, address, tag, params);
     });
 }
 
 // Async Leverage Trading API
-boost::future<json> Coincheck::fetchLeverageBalanceAsync(const json& params) {
-    return boost::async(boost::launch::async, [this, params]() {
+std::future<json> Coincheck::fetchLeverageBalanceAsync(const json& params) {
+    return Executor::shared().submit([this, params]() {
         return this->fetchLeverageBalance(params);
     });
 }
 
-boost::future<json> Coincheck::createLeverageOrderAsync(const std::string& symbol, const std::string& type, const std::string& side,
+std::future<json> Coincheck::createLeverageOrderAsync(const std::string& symbol, const std::string& type, const std::string& side,
                                                       double amount, double price, const json& params) {
-    return boost::async(boost::launch::async, [this, symbol, type, side, amount, price, params]() {
+    return Executor::shared().submit([this, symbol, type, side, amount, price, params]() {
         return this->createLeverageOrder(symbol, type, side, amount, price, params);
     });
 }
 
-boost::future<json> Coincheck::cancelLeverageOrderAsync(const std::string& id, const std::string& symbol, const json& params) {
-    return boost::async(boost::launch::async, [this, id, symbol, params]() {
+std::future<json> Coincheck::cancelLeverageOrderAsync(const std::string& id, const std::string& symbol, const json& params) {
+    return Executor::shared().submit([this, id, symbol, params]() {
         return this->cancelLeverageOrder(id, symbol, params);
     });
 }
 
-boost::future<json> Coincheck::fetchLeveragePositionsAsync(const json& params) {
-    return boost::async(boost::launch::async, [this, params]() {
+std::future<json> Coincheck::fetchLeveragePositionsAsync(const json& params) {
+    return Executor::shared().submit([this, params]() {
         return this->fetchLeveragePositions(params);
     });
 }
 
-boost::future<json> Coincheck::fetchLeverageOrdersAsync(const std::string& symbol, int since, int limit, const json& params) {
-    return boost::async(boost::launch::async, [this, symbol, since, limit, params]() {
+std::future<json> Coincheck::fetchLeverageOrdersAsync(const std::string& symbol, int since, int limit, const json& params) {
+    return Executor::shared().submit([this, symbol, since, limit, params]() {
         return this->fetchLeverageOrders(symbol, since, limit, params);
     });
 }
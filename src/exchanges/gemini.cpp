@@ -1,4 +1,5 @@
 #include "gemini.h"
+#include "ccxt/base/executor.h"
 #include <chrono>
 #include <sstream>
 #include <iomanip>
@@ -297,114 +298,114 @@ json Gemini::parseOrderStatus(const std::string& status) {
 }
 
 // Async Market Data API
-AsyncPullType Gemini::fetchMarketsAsync(const json& params) {
-    return std::async(std::launch::async, [this, params]() {
+std::future<json> Gemini::fetchMarketsAsync(const json& params) {
+    return Executor::shared().submit([this, params]() {
         return this->fetchMarkets(params);
     });
 }
 
-AsyncPullType Gemini::fetchTickerAsync(const std::string& symbol, const json& params) {
-    return std::async(std::launch::async, [this, symbol, params]() {
+std::future<json> Gemini::fetchTickerAsync(const std::string& symbol, const json& params) {
+    return Executor::shared().submit([this, symbol, params]() {
         return this->fetchTicker(symbol, params);
     });
 }
 
-AsyncPullType Gemini::fetchOrderBookAsync(const std::string& symbol, int limit, const json& params) {
-    return std::async(std::launch::async, [this, symbol, limit, params]() {
+std::future<json> Gemini::fetchOrderBookAsync(const std::string& symbol, int limit, const json& params) {
+    return Executor::shared().submit([this, symbol, limit, params]() {
         return this->fetchOrderBook(symbol, limit, params);
     });
 }
 
-AsyncPullType Gemini::fetchTradesAsync(const std::string& symbol, int since, int limit, const json& params) {
-    return std::async(std::launch::async, [this, symbol, since, limit, params]() {
+std::future<json> Gemini::fetchTradesAsync(const std::string& symbol, int since, int limit, const json& params) {
+    return Executor::shared().submit([this, symbol, since, limit, params]() {
         return this->fetchTrades(symbol, since, limit, params);
     });
 }
 
-AsyncPullType Gemini::fetchOHLCVAsync(const std::string& symbol, const std::string& timeframe, int since, int limit, const json& params) {
-    return std::async(std::launch::async, [this, symbol, timeframe, since, limit, params]() {
+std::future<json> Gemini::fetchOHLCVAsync(const std::string& symbol, const std::string& timeframe, long long since, int limit, const json& params) {
+    return Executor::shared().submit([this, symbol, timeframe, since, limit, params]() {
         return this->fetchOHLCV(symbol, timeframe, since, limit, params);
     });
 }
 
 // Async Trading API
-AsyncPullType Gemini::fetchBalanceAsync(const json& params) {
-    return std::async(std::launch::async, [this, params]() {
+std::future<json> Gemini::fetchBalanceAsync(const json& params) {
+    return Executor::shared().submit([this, params]() {
         return this->fetchBalance(params);
     });
 }
 
-AsyncPullType Gemini::createOrderAsync(const std::string& symbol, const std::string& type, const std::string& side,
+std::future<json> Gemini::createOrderAsync(const std::string& symbol, const std::string& type, const std::string& side,
                                          double amount, double price, const json& params) {
-    return std::async(std::launch::async, [this, symbol, type, side, amount, price, params]() {
+    return Executor::shared().submit([this, symbol, type, side, amount, price, params]() {
         return this->createOrder(symbol, type, side, amount, price, params);
     });
 }
 
-AsyncPullType Gemini::cancelOrderAsync(const std::string& id, const std::string& symbol, const json& params) {
-    return std::async(std::launch::async, [this, id, symbol, params]() {
+std::future<json> Gemini::cancelOrderAsync(const std::string& id, const std::string& symbol, const json& params) {
+    return Executor::shared().submit([this, id, symbol, params]() {
         return this->cancelOrder(id, symbol, params);
     });
 }
 
-AsyncPullType Gemini::fetchOrderAsync(const std::string& id, const std::string& symbol, const json& params) {
-    return std::async(std::launch::async, [this, id, symbol, params]() {
+std::future<json> Gemini::fetchOrderAsync(const std::string& id, const std::string& symbol, const json& params) {
+    return Executor::shared().submit([this, id, symbol, params]() {
         return this->fetchOrder(id, symbol, params);
     });
 }
 
-AsyncPullType Gemini::fetchOrdersAsync(const std::string& symbol, int since, int limit, const json& params) {
-    return std::async(std::launch::async, [this, symbol, since, limit, params]() {
+std::future<json> Gemini::fetchOrdersAsync(const std::string& symbol, int since, int limit, const json& params) {
+    return Executor::shared().submit([this, symbol, since, limit, params]() {
         return this->fetchOrders(symbol, since, limit, params);
     });
 }
 
-AsyncPullType Gemini::fetchOpenOrdersAsync(const std::string& symbol, int since, int limit, const json& params) {
-    return std::async(std::launch::async, [this, symbol, since, limit, params]() {
+std::future<json> Gemini::fetchOpenOrdersAsync(const std::string& symbol, int since, int limit, const json& params) {
+    return Executor::shared().submit([this, symbol, since, limit, params]() {
         return this->fetchOpenOrders(symbol, since, limit, params);
     });
 }
 
-AsyncPullType Gemini::fetchClosedOrdersAsync(const std::string& symbol, int since, int limit, const json& params) {
-    return std::async(std::launch::async, [this, symbol, since, limit, params]() {
+std::future<json> Gemini::fetchClosedOrdersAsync(const std::string& symbol, int since, int limit, const json& params) {
+    return Executor::shared().submit([this, symbol, since, limit, params]() {
         return this->fetchClosedOrders(symbol, since, limit, params);
     });
 }
 
 // Async Gemini specific methods
-AsyncPullType Gemini::fetchMyTradesAsync(const std::string& symbol, int since, int limit, const json& params) {
-    return std::async(std::launch::async, [this, symbol, since, limit, params]() {
+std::future<json> Gemini::fetchMyTradesAsync(const std::string& symbol, int since, int limit, const json& params) {
+    return Executor::shared().submit([this, symbol, since, limit, params]() {
         return this->fetchMyTrades(symbol, since, limit, params);
     });
 }
 
-AsyncPullType Gemini::fetchDepositsAsync(const std::string& code, int since, int limit, const json& params) {
-    return std::async(std::launch::async, [this, code, since, limit, params]() {
+std::future<json> Gemini::fetchDepositsAsync(const std::string& code, int since, int limit, const json& params) {
+    return Executor::shared().submit([this, code, since, limit, params]() {
         return this->fetchDeposits(code, since, limit, params);
     });
 }
 
-AsyncPullType Gemini::fetchWithdrawalsAsync(const std::string& code, int since, int limit, const json& params) {
-    return std::async(std::launch::async, [this, code, since, limit, params]() {
+std::future<json> Gemini::fetchWithdrawalsAsync(const std::string& code, int since, int limit, const json& params) {
+    return Executor::shared().submit([this, code, since, limit, params]() {
         return this->fetchWithdrawals(code, since, limit, params);
     });
 }
 
-AsyncPullType Gemini::fetchTransfersAsync(const std::string& code, int since, int limit, const json& params) {
-    return std::async(std::launch::async, [this, code, since, limit, params]() {
+std::future<json> Gemini::fetchTransfersAsync(const std::string& code, int since, int limit, const json& params) {
+    return Executor::shared().submit([this, code, since, limit, params]() {
         return this->fetchTransfers(code, since, limit, params);
     });
 }
 
-AsyncPullType Gemini::transferAsync(const std::string& code, double amount, const std::string& fromAccount,
+std::future<json> Gemini::transferAsync(const std::string& code, double amount, const std::string& fromAccount,
                                       const std::string& toAccount, const json& params) {
-    return std::async(std::launch::async, [this, code, amount, fromAccount, toAccount, params]() {
+    return Executor::shared().submit([this, code, amount, fromAccount, toAccount, params]() {
         return this->transfer(code, amount, fromAccount, toAccount, params);
     });
 }
 
-AsyncPullType Gemini::fetchDepositAddressAsync(const std::string& code, const json& params) {
-    return std::async(std::launch::async, [this, code, params]() {
+std::future<json> Gemini::fetchDepositAddressAsync(const std::string& code, const json& params) {
+    return Executor::shared().submit([this, code, params]() {
         return this->fetchDepositAddress(code, params);
     });
 }
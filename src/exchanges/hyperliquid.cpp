@@ -1,4 +1,5 @@
 #include "ccxt/exchanges/hyperliquid.h"
+#include "ccxt/base/executor.h"
 #include <chrono>
 #include <sstream>
 #include <iomanip>
@@ -139,89 +140,89 @@ void hyperliquid::handleErrors(const std::string& code, const std::string& reaso
 }
 
 // Async implementations
-AsyncPullType hyperliquid::fetchMarketsAsync(const Json& params) {
-    return std::async(std::launch::async, [this, params]() {
+std::future<Json> hyperliquid::fetchMarketsAsync(const Json& params) {
+    return Executor::shared().submit([this, params]() {
         return this->fetchMarkets(params);
     });
 }
 
-AsyncPullType hyperliquid::fetchTickerAsync(const std::string& symbol, const Json& params) {
-    return std::async(std::launch::async, [this, symbol, params]() {
+std::future<Json> hyperliquid::fetchTickerAsync(const std::string& symbol, const Json& params) {
+    return Executor::shared().submit([this, symbol, params]() {
         return this->fetchTicker(symbol, params);
     });
 }
 
-AsyncPullType hyperliquid::fetchTickersAsync(const std::vector<std::string>& symbols, const Json& params) {
-    return std::async(std::launch::async, [this, symbols, params]() {
+std::future<Json> hyperliquid::fetchTickersAsync(const std::vector<std::string>& symbols, const Json& params) {
+    return Executor::shared().submit([this, symbols, params]() {
         return this->fetchTickers(symbols, params);
     });
 }
 
-AsyncPullType hyperliquid::fetchOrderBookAsync(const std::string& symbol, int limit, const Json& params) {
-    return std::async(std::launch::async, [this, symbol, limit, params]() {
+std::future<Json> hyperliquid::fetchOrderBookAsync(const std::string& symbol, int limit, const Json& params) {
+    return Executor::shared().submit([this, symbol, limit, params]() {
         return this->fetchOrderBook(symbol, limit, params);
     });
 }
 
-AsyncPullType hyperliquid::fetchTradesAsync(const std::string& symbol, int since, int limit, const Json& params) {
-    return std::async(std::launch::async, [this, symbol, since, limit, params]() {
+std::future<Json> hyperliquid::fetchTradesAsync(const std::string& symbol, int since, int limit, const Json& params) {
+    return Executor::shared().submit([this, symbol, since, limit, params]() {
         return this->fetchTrades(symbol, since, limit, params);
     });
 }
 
-AsyncPullType hyperliquid::fetchOHLCVAsync(const std::string& symbol, const std::string& timeframe,
-                                              int since, int limit, const Json& params) {
-    return std::async(std::launch::async, [this, symbol, timeframe, since, limit, params]() {
+std::future<Json> hyperliquid::fetchOHLCVAsync(const std::string& symbol, const std::string& timeframe,
+                                              long long since, int limit, const Json& params) {
+    return Executor::shared().submit([this, symbol, timeframe, since, limit, params]() {
         return this->fetchOHLCV(symbol, timeframe, since, limit, params);
     });
 }
 
-AsyncPullType hyperliquid::fetchBalanceAsync(const Json& params) {
-    return std::async(std::launch::async, [this, params]() {
+std::future<Json> hyperliquid::fetchBalanceAsync(const Json& params) {
+    return Executor::shared().submit([this, params]() {
         return this->fetchBalance(params);
     });
 }
 
-AsyncPullType hyperliquid::createOrderAsync(const std::string& symbol, const std::string& type,
+std::future<Json> hyperliquid::createOrderAsync(const std::string& symbol, const std::string& type,
                                               const std::string& side, double amount,
                                               double price, const Json& params) {
-    return std::async(std::launch::async, [this, symbol, type, side, amount, price, params]() {
+    return Executor::shared().submit([this, symbol, type, side, amount, price, params]() {
         return this->createOrder(symbol, type, side, amount, price, params);
     });
 }
 
-AsyncPullType hyperliquid::cancelOrderAsync(const std::string& id, const std::string& symbol, const Json& params) {
-    return std::async(std::launch::async, [this, id, symbol, params]() {
+std::future<Json> hyperliquid::cancelOrderAsync(const std::string& id, const std::string& symbol, const Json& params) {
+    return Executor::shared().submit([this, id, symbol, params]() {
         return this->cancelOrder(id, symbol, params);
     });
 }
 
-AsyncPullType hyperliquid::fetchOrderAsync(const std::string& id, const std::string& symbol, const Json& params) {
-    return std::async(std::launch::async, [this, id, symbol, params]() {
+std::future<Json> hyperliquid::fetchOrderAsync(const std::string& id, const std::string& symbol, const Json& params) {
+    return Executor::shared().submit([this, id, symbol, params]() {
         return this->fetchOrder(id, symbol, params);
     });
 }
 
-AsyncPullType hyperliquid::fetchOrdersAsync(const std::string& symbol, int since, int limit, const Json& params) {
-    return std::async(std::launch::async, [this, symbol, since, limit, params]() {
+std::future<Json> hyperliquid::fetchOrdersAsync(const std::string& symbol, int since, int limit, const Json& params) {
+    return Executor::shared().submit([this, symbol, since, limit, params]() {
         return this->fetchOrders(symbol, since, limit, params);
     });
 }
 
-AsyncPullType hyperliquid::fetchOpenOrdersAsync(const std::string& symbol, int since, int limit, const Json& params) {
-    return std::async(std::launch::async, [this, symbol, since, limit, params]() {
+std::future<Json> hyperliquid::fetchOpenOrdersAsync(const std::string& symbol, int since, int limit, const Json& params) {
+    return Executor::shared().submit([this, symbol, since, limit, params]() {
         return this->fetchOpenOrders(symbol, since, limit, params);
     });
 }
 
-AsyncPullType hyperliquid::fetchClosedOrdersAsync(const std::string& symbol, int since, int limit, const Json& params) {
-    return std::async(std::launch::async, [this, symbol, since, limit, params]() {
+std::future<Json> hyperliquid::fetchClosedOrdersAsync(const std::string& symbol, int since, int limit, const Json& params) {
+    return Executor::shared().submit([this, symbol, since, limit, params]() {
         return this->fetchClosedOrders(symbol, since, limit, params);
     });
 }
 
-AsyncPullType hyperliquid::fetchMyTradesAsync(const std::string& symbol, int since, int limit, const Json& params) {
-    return std::async(std::launch::async, [this, symbol, since, limit, params]() {
+std::future<json> hyperliquid::fetchMyTradesAsync(const std::string& symbol, int since, int limit, const Json& params) {
+    return Executor::shared().submit([this, symbol, since, limit, params]() {
         return this->fetchMyTrades(symbol, since, limit, params);
     });
 }
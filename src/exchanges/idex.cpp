@@ -1,4 +1,5 @@
 #include "../../include/ccxt/exchanges/idex.h"
+#include "ccxt/base/executor.h"
 #include "../../include/ccxt/exchange_registry.h"
 #include <future>
 
@@ -85,114 +86,114 @@ Json idex::describeImpl() const {
 }
 
 // Async Market Data Methods
-AsyncPullType idex::fetchMarketsAsync() const {
-    return std::async(std::launch::async, [this]() {
+std::future<Json> idex::fetchMarketsAsync() const {
+    return Executor::shared().submit([this]() {
         return this->fetchMarketsImpl();
     });
 }
 
-AsyncPullType idex::fetchCurrenciesAsync() const {
-    return std::async(std::launch::async, [this]() {
+std::future<Json> idex::fetchCurrenciesAsync() const {
+    return Executor::shared().submit([this]() {
         return this->fetchCurrenciesImpl();
     });
 }
 
-AsyncPullType idex::fetchTickerAsync(const std::string& symbol) const {
-    return std::async(std::launch::async, [this, symbol]() {
+std::future<Json> idex::fetchTickerAsync(const std::string& symbol) const {
+    return Executor::shared().submit([this, symbol]() {
         return this->fetchTickerImpl(symbol);
     });
 }
 
-AsyncPullType idex::fetchTickersAsync(const std::vector<std::string>& symbols) const {
-    return std::async(std::launch::async, [this, symbols]() {
+std::future<Json> idex::fetchTickersAsync(const std::vector<std::string>& symbols) const {
+    return Executor::shared().submit([this, symbols]() {
         return this->fetchTickersImpl(symbols);
     });
 }
 
-AsyncPullType idex::fetchOrderBookAsync(const std::string& symbol, const std::optional<int>& limit) const {
-    return std::async(std::launch::async, [this, symbol, limit]() {
+std::future<Json> idex::fetchOrderBookAsync(const std::string& symbol, const std::optional<int>& limit) const {
+    return Executor::shared().submit([this, symbol, limit]() {
         return this->fetchOrderBookImpl(symbol, limit);
     });
 }
 
-AsyncPullType idex::fetchOHLCVAsync(const std::string& symbol, const std::string& timeframe,
+std::future<Json> idex::fetchOHLCVAsync(const std::string& symbol, const std::string& timeframe,
                                       const std::optional<long long>& since, const std::optional<int>& limit) const {
-    return std::async(std::launch::async, [this, symbol, timeframe, since, limit]() {
+    return Executor::shared().submit([this, symbol, timeframe, since, limit]() {
         return this->fetchOHLCVImpl(symbol, timeframe, since, limit);
     });
 }
 
-AsyncPullType idex::fetchTradesAsync(const std::string& symbol, const std::optional<long long>& since,
+std::future<Json> idex::fetchTradesAsync(const std::string& symbol, const std::optional<long long>& since,
                                        const std::optional<int>& limit) const {
-    return std::async(std::launch::async, [this, symbol, since, limit]() {
+    return Executor::shared().submit([this, symbol, since, limit]() {
         return this->fetchTradesImpl(symbol, since, limit);
     });
 }
 
 // Async Trading Methods
-AsyncPullType idex::createOrderAsync(const std::string& symbol, const std::string& type,
+std::future<Json> idex::createOrderAsync(const std::string& symbol, const std::string& type,
                                        const std::string& side, double amount, const std::optional<double>& price) {
-    return std::async(std::launch::async, [this, symbol, type, side, amount, price]() {
+    return Executor::shared().submit([this, symbol, type, side, amount, price]() {
         return this->createOrderImpl(symbol, type, side, amount, price);
     });
 }
 
-AsyncPullType idex::cancelOrderAsync(const std::string& id, const std::string& symbol) {
-    return std::async(std::launch::async, [this, id, symbol]() {
+std::future<Json> idex::cancelOrderAsync(const std::string& id, const std::string& symbol) {
+    return Executor::shared().submit([this, id, symbol]() {
         return this->cancelOrderImpl(id, symbol);
     });
 }
 
-AsyncPullType idex::fetchOrderAsync(const std::string& id, const std::string& symbol) const {
-    return std::async(std::launch::async, [this, id, symbol]() {
+std::future<Json> idex::fetchOrderAsync(const std::string& id, const std::string& symbol) const {
+    return Executor::shared().submit([this, id, symbol]() {
         return this->fetchOrderImpl(id, symbol);
     });
 }
 
-AsyncPullType idex::fetchOpenOrdersAsync(const std::string& symbol, const std::optional<long long>& since,
+std::future<Json> idex::fetchOpenOrdersAsync(const std::string& symbol, const std::optional<long long>& since,
                                            const std::optional<int>& limit) const {
-    return std::async(std::launch::async, [this, symbol, since, limit]() {
+    return Executor::shared().submit([this, symbol, since, limit]() {
         return this->fetchOpenOrdersImpl(symbol, since, limit);
     });
 }
 
-AsyncPullType idex::fetchClosedOrdersAsync(const std::string& symbol, const std::optional<long long>& since,
+std::future<Json> idex::fetchClosedOrdersAsync(const std::string& symbol, const std::optional<long long>& since,
                                              const std::optional<int>& limit) const {
-    return std::async(std::launch::async, [this, symbol, since, limit]() {
+    return Executor::shared().submit([this, symbol, since, limit]() {
         return this->fetchClosedOrdersImpl(symbol, since, limit);
     });
 }
 
-AsyncPullType idex::fetchMyTradesAsync(const std::string& symbol, const std::optional<long long>& since,
+std::future<Json> idex::fetchMyTradesAsync(const std::string& symbol, const std::optional<long long>& since,
                                          const std::optional<int>& limit) const {
-    return std::async(std::launch::async, [this, symbol, since, limit]() {
+    return Executor::shared().submit([this, symbol, since, limit]() {
         return this->fetchMyTradesImpl(symbol, since, limit);
     });
 }
 
 // Async Account Methods
-AsyncPullType idex::fetchBalanceAsync() const {
-    return std::async(std::launch::async, [this]() {
+std::future<Json> idex::fetchBalanceAsync() const {
+    return Executor::shared().submit([this]() {
         return this->fetchBalanceImpl();
     });
 }
 
-AsyncPullType idex::fetchDepositAddressAsync(const std::string& code, const std::optional<std::string>& network) const {
-    return std::async(std::launch::async, [this, code, network]() {
+std::future<Json> idex::fetchDepositAddressAsync(const std::string& code, const std::optional<std::string>& network) const {
+    return Executor::shared().submit([this, code, network]() {
         return this->fetchDepositAddressImpl(code, network);
     });
 }
 
-AsyncPullType idex::fetchDepositsAsync(const std::optional<std::string>& code, const std::optional<long long>& since,
+std::future<Json> idex::fetchDepositsAsync(const std::optional<std::string>& code, const std::optional<long long>& since,
                                          const std::optional<int>& limit) const {
-    return std::async(std::launch::async, [this, code, since, limit]() {
+    return Executor::shared().submit([this, code, since, limit]() {
         return this->fetchDepositsImpl(code, since, limit);
     });
 }
 
-AsyncPullType idex::fetchWithdrawalsAsync(const std::optional<std::string>& code, const std::optional<long long>& since,
+std::future<Json> idex::fetchWithdrawalsAsync(const std::optional<std::string>& code, const std::optional<long long>& since,
                                            const std::optional<int>& limit) const {
-    return std::async(std::launch::async, [this, code, since, limit]() {
+    return Executor::shared().submit([this, code, since, limit]() {
         return this->fetchWithdrawalsImpl(code, since, limit);
     });
 }
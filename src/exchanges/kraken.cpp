@@ -1,4 +1,5 @@
 #include "kraken.h"
+#include "ccxt/base/executor.h"
 #include <chrono>
 #include <sstream>
 #include <iomanip>
@@ -63,117 +64,117 @@ void Kraken::initializeApiEndpoints() {
 }
 
 // Async Market Data Methods
-AsyncPullType Kraken::fetchMarketsAsync(const Json& params) const {
-    return std::async(std::launch::async, [this, params]() {
+std::future<Json> Kraken::fetchMarketsAsync(const Json& params) const {
+    return Executor::shared().submit([this, params]() {
         return this->fetchMarketsImpl(params);
     });
 }
 
-AsyncPullType Kraken::fetchCurrenciesAsync(const Json& params) const {
-    return std::async(std::launch::async, [this, params]() {
+std::future<Json> Kraken::fetchCurrenciesAsync(const Json& params) const {
+    return Executor::shared().submit([this, params]() {
         return this->fetchCurrenciesImpl(params);
     });
 }
 
-AsyncPullType Kraken::fetchTickerAsync(const std::string& symbol, const Json& params) const {
-    return std::async(std::launch::async, [this, symbol, params]() {
+std::future<Json> Kraken::fetchTickerAsync(const std::string& symbol, const Json& params) const {
+    return Executor::shared().submit([this, symbol, params]() {
         return this->fetchTickerImpl(symbol, params);
     });
 }
 
-AsyncPullType Kraken::fetchTickersAsync(const std::vector<std::string>& symbols, const Json& params) const {
-    return std::async(std::launch::async, [this, symbols, params]() {
+std::future<Json> Kraken::fetchTickersAsync(const std::vector<std::string>& symbols, const Json& params) const {
+    return Executor::shared().submit([this, symbols, params]() {
         return this->fetchTickersImpl(symbols, params);
     });
 }
 
-AsyncPullType Kraken::fetchOrderBookAsync(const std::string& symbol, const std::optional<int>& limit, const Json& params) const {
-    return std::async(std::launch::async, [this, symbol, limit, params]() {
+std::future<Json> Kraken::fetchOrderBookAsync(const std::string& symbol, const std::optional<int>& limit, const Json& params) const {
+    return Executor::shared().submit([this, symbol, limit, params]() {
         return this->fetchOrderBookImpl(symbol, limit, params);
     });
 }
 
-AsyncPullType Kraken::fetchOHLCVAsync(const std::string& symbol, const std::string& timeframe,
+std::future<Json> Kraken::fetchOHLCVAsync(const std::string& symbol, const std::string& timeframe,
                                         const std::optional<long long>& since, const std::optional<int>& limit,
                                         const Json& params) const {
-    return std::async(std::launch::async, [this, symbol, timeframe, since, limit, params]() {
+    return Executor::shared().submit([this, symbol, timeframe, since, limit, params]() {
         return this->fetchOHLCVImpl(symbol, timeframe, since, limit, params);
     });
 }
 
-AsyncPullType Kraken::fetchTradesAsync(const std::string& symbol, const std::optional<long long>& since,
+std::future<Json> Kraken::fetchTradesAsync(const std::string& symbol, const std::optional<long long>& since,
                                          const std::optional<int>& limit, const Json& params) const {
-    return std::async(std::launch::async, [this, symbol, since, limit, params]() {
+    return Executor::shared().submit([this, symbol, since, limit, params]() {
         return this->fetchTradesImpl(symbol, since, limit, params);
     });
 }
 
 // Async Trading Methods
-AsyncPullType Kraken::createOrderAsync(const std::string& symbol, const std::string& type,
+std::future<Json> Kraken::createOrderAsync(const std::string& symbol, const std::string& type,
                                          const std::string& side, double amount,
                                          const std::optional<double>& price, const Json& params) {
-    return std::async(std::launch::async, [this, symbol, type, side, amount, price, params]() {
+    return Executor::shared().submit([this, symbol, type, side, amount, price, params]() {
         return this->createOrderImpl(symbol, type, side, amount, price, params);
     });
 }
 
-AsyncPullType Kraken::cancelOrderAsync(const std::string& id, const std::string& symbol, const Json& params) {
-    return std::async(std::launch::async, [this, id, symbol, params]() {
+std::future<Json> Kraken::cancelOrderAsync(const std::string& id, const std::string& symbol, const Json& params) {
+    return Executor::shared().submit([this, id, symbol, params]() {
         return this->cancelOrderImpl(id, symbol, params);
     });
 }
 
-AsyncPullType Kraken::fetchOrderAsync(const std::string& id, const std::string& symbol, const Json& params) const {
-    return std::async(std::launch::async, [this, id, symbol, params]() {
+std::future<Json> Kraken::fetchOrderAsync(const std::string& id, const std::string& symbol, const Json& params) const {
+    return Executor::shared().submit([this, id, symbol, params]() {
         return this->fetchOrderImpl(id, symbol, params);
     });
 }
 
-AsyncPullType Kraken::fetchOpenOrdersAsync(const std::string& symbol, const std::optional<long long>& since,
+std::future<Json> Kraken::fetchOpenOrdersAsync(const std::string& symbol, const std::optional<long long>& since,
                                              const std::optional<int>& limit, const Json& params) const {
-    return std::async(std::launch::async, [this, symbol, since, limit, params]() {
+    return Executor::shared().submit([this, symbol, since, limit, params]() {
         return this->fetchOpenOrdersImpl(symbol, since, limit, params);
     });
 }
 
-AsyncPullType Kraken::fetchClosedOrdersAsync(const std::string& symbol, const std::optional<long long>& since,
+std::future<Json> Kraken::fetchClosedOrdersAsync(const std::string& symbol, const std::optional<long long>& since,
                                                const std::optional<int>& limit, const Json& params) const {
-    return std::async(std::launch::async, [this, symbol, since, limit, params]() {
+    return Executor::shared().submit([this, symbol, since, limit, params]() {
         return this->fetchClosedOrdersImpl(symbol, since, limit, params);
     });
 }
 
-AsyncPullType Kraken::fetchMyTradesAsync(const std::string& symbol, const std::optional<long long>& since,
+std::future<Json> Kraken::fetchMyTradesAsync(const std::string& symbol, const std::optional<long long>& since,
                                            const std::optional<int>& limit, const Json& params) const {
-    return std::async(std::launch::async, [this, symbol, since, limit, params]() {
+    return Executor::shared().submit([this, symbol, since, limit, params]() {
         return this->fetchMyTradesImpl(symbol, since, limit, params);
     });
 }
 
 // Async Account Methods
-AsyncPullType Kraken::fetchBalanceAsync(const Json& params) const {
-    return std::async(std::launch::async, [this, params]() {
+std::future<Json> Kraken::fetchBalanceAsync(const Json& params) const {
+    return Executor::shared().submit([this, params]() {
         return this->fetchBalanceImpl(params);
     });
 }
 
-AsyncPullType Kraken::fetchDepositAddressAsync(const std::string& code, const std::optional<std::string>& network,
+std::future<Json> Kraken::fetchDepositAddressAsync(const std::string& code, const std::optional<std::string>& network,
                                                  const Json& params) const {
-    return std::async(std::launch::async, [this, code, network, params]() {
+    return Executor::shared().submit([this, code, network, params]() {
         return this->fetchDepositAddressImpl(code, network, params);
     });
 }
 
-AsyncPullType Kraken::fetchDepositsAsync(const std::optional<std::string>& code, const std::optional<long long>& since,
+std::future<Json> Kraken::fetchDepositsAsync(const std::optional<std::string>& code, const std::optional<long long>& since,
                                            const std::optional<int>& limit, const Json& params) const {
-    return std::async(std::launch::async, [this, code, since, limit, params]() {
+    return Executor::shared().submit([this, code, since, limit, params]() {
         return this->fetchDepositsImpl(code, since, limit, params);
     });
 }
 
-AsyncPullType Kraken::fetchWithdrawalsAsync(const std::optional<std::string>& code, const std::optional<long long>& since,
+std::future<Json> Kraken::fetchWithdrawalsAsync(const std::optional<std::string>& code, const std::optional<long long>& since,
                                              const std::optional<int>& limit, const Json& params) const {
-    return std::async(std::launch::async, [this, code, since, limit, params]() {
+    return Executor::shared().submit([this, code, since, limit, params]() {
         return this->fetchWithdrawalsImpl(code, since, limit, params);
     });
 }
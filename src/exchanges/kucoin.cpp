@@ -1,4 +1,5 @@
 #include "ccxt/exchanges/kucoin.h"
+#include "ccxt/base/executor.h"
 #include <chrono>
 #include <sstream>
 #include <iomanip>
@@ -13,6 +14,7 @@ KuCoin::KuCoin(const ExchangeConfig& config) : Exchange(config) {
     name = "KuCoin";
     version = "v2";
     rateLimit = 100;
+    maxOHLCVLimit = 1500;
     
     baseUrl = "https://api.kucoin.com";
     
@@ -91,19 +93,19 @@ Ticker KuCoin::fetchTicker(const std::string& symbol, const Params& params) {
 // Asynchronous Methods Implementation
 
 std::future<std::vector<Market>> KuCoin::fetchMarketsAsync(const Params& params) {
-    return std::async(std::launch::async, [this, params]() {
+    return Executor::shared().submit([this, params]() {
         return fetchMarkets(params);
     });
 }
 
 std::future<OrderBook> KuCoin::fetchOrderBookAsync(const std::string& symbol, int limit, const Params& params) {
-    return std::async(std::launch::async, [this, symbol, limit, params]() {
+    return Executor::shared().submit([this, symbol, limit, params]() {
         return fetchOrderBook(symbol, limit, params);
     });
 }
 
 std::future<Ticker> KuCoin::fetchTickerAsync(const std::string& symbol, const Params& params) {
-    return std::async(std::launch::async, [this, symbol, params]() {
+    return Executor::shared().submit([this, symbol, params]() {
         return fetchTicker(symbol, params);
     });
 }
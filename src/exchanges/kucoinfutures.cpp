@@ -1,4 +1,5 @@
 #include "ccxt/exchanges/kucoinfutures.h"
+#include "ccxt/base/executor.h"
 #include <chrono>
 #include <sstream>
 #include <iomanip>
@@ -214,44 +215,44 @@ MarginModification KuCoinFutures::setLeverage(int leverage, const std::string& s
 // Asynchronous Methods Implementation
 
 std::future<std::vector<Market>> KuCoinFutures::fetchMarketsAsync(const Params& params) {
-    return std::async(std::launch::async, [this, params]() {
+    return Executor::shared().submit([this, params]() {
         return fetchMarkets(params);
     });
 }
 
 std::future<OrderBook> KuCoinFutures::fetchOrderBookAsync(const std::string& symbol, int limit, const Params& params) {
-    return std::async(std::launch::async, [this, symbol, limit, params]() {
+    return Executor::shared().submit([this, symbol, limit, params]() {
         return fetchOrderBook(symbol, limit, params);
     });
 }
 
 std::future<Ticker> KuCoinFutures::fetchTickerAsync(const std::string& symbol, const Params& params) {
-    return std::async(std::launch::async, [this, symbol, params]() {
+    return Executor::shared().submit([this, symbol, params]() {
         return fetchTicker(symbol, params);
     });
 }
 
 std::future<std::vector<Trade>> KuCoinFutures::fetchTradesAsync(const std::string& symbol, int since, int limit, const Params& params) {
-    return std::async(std::launch::async, [this, symbol, since, limit, params]() {
+    return Executor::shared().submit([this, symbol, since, limit, params]() {
         return fetchTrades(symbol, since, limit, params);
     });
 }
 
 std::future<FundingRate> KuCoinFutures::fetchFundingRateAsync(const std::string& symbol, const Params& params) {
-    return std::async(std::launch::async, [this, symbol, params]() {
+    return Executor::shared().submit([this, symbol, params]() {
         return fetchFundingRate(symbol, params);
     });
 }
 
 std::future<Order> KuCoinFutures::createOrderAsync(const std::string& symbol, const std::string& type, const std::string& side,
                                                   double amount, double price, const Params& params) {
-    return std::async(std::launch::async, [this, symbol, type, side, amount, price, params]() {
+    return Executor::shared().submit([this, symbol, type, side, amount, price, params]() {
         return createOrder(symbol, type, side, amount, price, params);
     });
 }
 
 std::future<Balance> KuCoinFutures::fetchBalanceAsync(const Params& params) {
-    return std::async(std::launch::async, [this, params]() {
+    return Executor::shared().submit([this, params]() {
         return fetchBalance(params);
     });
 }
@@ -1,4 +1,5 @@
 #include "lbank.h"
+#include "ccxt/base/executor.h"
 #include <chrono>
 #include <sstream>
 #include <iomanip>
@@ -362,7 +363,7 @@ json Lbank::fetchTrades(const std::string& symbol, int since, int limit, const j
     return parseTrades(response, market, since, limit);
 }
 
-json Lbank::fetchOHLCV(const std::string& symbol, const std::string& timeframe, int since, int limit, const json& params) {
+json Lbank::fetchOHLCV(const std::string& symbol, const std::string& timeframe, long long since, int limit, const json& params) {
     auto market = loadMarket(symbol);
     auto request = {
         {"symbol", market["id"]},
@@ -377,38 +378,38 @@ json Lbank::fetchOHLCV(const std::string& symbol, const std::string& timeframe,
 }
 
 // Async Market Data API Implementation
-AsyncPullType Lbank::asyncFetchMarkets(const json& params) {
-    return std::async(std::launch::async, [this, params]() {
+std::future<json> Lbank::asyncFetchMarkets(const json& params) {
+    return Executor::shared().submit([this, params]() {
         return fetchMarkets(params);
     });
 }
 
-AsyncPullType Lbank::asyncFetchTicker(const std::string& symbol, const json& params) {
-    return std::async(std::launch::async, [this, symbol, params]() {
+std::future<json> Lbank::asyncFetchTicker(const std::string& symbol, const json& params) {
+    return Executor::shared().submit([this, symbol, params]() {
         return fetchTicker(symbol, params);
     });
 }
 
-AsyncPullType Lbank::asyncFetchTickers(const std::vector<std::string>& symbols, const json& params) {
-    return std::async(std::launch::async, [this, symbols, params]() {
+std::future<json> Lbank::asyncFetchTickers(const std::vector<std::string>& symbols, const json& params) {
+    return Executor::shared().submit([this, symbols, params]() {
         return fetchTickers(symbols, params);
     });
 }
 
-AsyncPullType Lbank::asyncFetchOrderBook(const std::string& symbol, int limit, const json& params) {
-    return std::async(std::launch::async, [this, symbol, limit, params]() {
+std::future<json> Lbank::asyncFetchOrderBook(const std::string& symbol, int limit, const json& params) {
+    return Executor::shared().submit([this, symbol, limit, params]() {
         return fetchOrderBook(symbol, limit, params);
     });
 }
 
-AsyncPullType Lbank::asyncFetchTrades(const std::string& symbol, int since, int limit, const json& params) {
-    return std::async(std::launch::async, [this, symbol, since, limit, params]() {
+std::future<json> Lbank::asyncFetchTrades(const std::string& symbol, int since, int limit, const json& params) {
+    return Executor::shared().submit([this, symbol, since, limit, params]() {
         return fetchTrades(symbol, since, limit, params);
     });
 }
 
-AsyncPullType Lbank::asyncFetchOHLCV(const std::string& symbol, const std::string& timeframe, int since, int limit, const json& params) {
-    return std::async(std::launch::async, [this, symbol, timeframe, since, limit, params]() {
+std::future<json> Lbank::asyncFetchOHLCV(const std::string& symbol, const std::string& timeframe, int since, int limit, const json& params) {
+    return Executor::shared().submit([this, symbol, timeframe, since, limit, params]() {
         return fetchOHLCV(symbol, timeframe, since, limit, params);
     });
 }
@@ -494,45 +495,45 @@ json Lbank::fetchClosedOrders(const std::string& symbol, int since, int limit, c
 }
 
 // Async Trading API Implementation
-AsyncPullType Lbank::asyncFetchBalance(const json& params) {
-    return std::async(std::launch::async, [this, params]() {
+std::future<json> Lbank::asyncFetchBalance(const json& params) {
+    return Executor::shared().submit([this, params]() {
         return fetchBalance(params);
     });
 }
 
-AsyncPullType Lbank::asyncCreateOrder(const std::string& symbol, const std::string& type, const std::string& side,
+std::future<json> Lbank::asyncCreateOrder(const std::string& symbol, const std::string& type, const std::string& side,
                                       double amount, double price, const json& params) {
-    return std::async(std::launch::async, [this, symbol, type, side, amount, price, params]() {
+    return Executor::shared().submit([this, symbol, type, side, amount, price, params]() {
         return createOrder(symbol, type, side, amount, price, params);
     });
 }
 
-AsyncPullType Lbank::asyncCancelOrder(const std::string& id, const std::string& symbol, const json& params) {
-    return std::async(std::launch::async, [this, id, symbol, params]() {
+std::future<json> Lbank::asyncCancelOrder(const std::string& id, const std::string& symbol, const json& params) {
+    return Executor::shared().submit([this, id, symbol, params]() {
         return cancelOrder(id, symbol, params);
     });
 }
 
-AsyncPullType Lbank::asyncFetchOrder(const std::string& id, const std::string& symbol, const json& params) {
-    return std::async(std::launch::async, [this, id, symbol, params]() {
+std::future<json> Lbank::asyncFetchOrder(const std::string& id, const std::string& symbol, const json& params) {
+    return Executor::shared().submit([this, id, symbol, params]() {
         return fetchOrder(id, symbol, params);
     });
 }
 
-AsyncPullType Lbank::asyncFetchOrders(const std::string& symbol, int since, int limit, const json& params) {
-    return std::async(std::launch::async, [this, symbol, since, limit, params]() {
+std::future<json> Lbank::asyncFetchOrders(const std::string& symbol, int since, int limit, const json& params) {
+    return Executor::shared().submit([this, symbol, since, limit, params]() {
         return fetchOrders(symbol, since, limit, params);
     });
 }
 
-AsyncPullType Lbank::asyncFetchOpenOrders(const std::string& symbol, int since, int limit, const json& params) {
-    return std::async(std::launch::async, [this, symbol, since, limit, params]() {
+std::future<json> Lbank::asyncFetchOpenOrders(const std::string& symbol, int since, int limit, const json& params) {
+    return Executor::shared().submit([this, symbol, since, limit, params]() {
         return fetchOpenOrders(symbol, since, limit, params);
     });
 }
 
-AsyncPullType Lbank::asyncFetchClosedOrders(const std::string& symbol, int since, int limit, const json& params) {
-    return std::async(std::launch::async, [this, symbol, since, limit, params]() {
+std::future<json> Lbank::asyncFetchClosedOrders(const std::string& symbol, int since, int limit, const json& params) {
+    return Executor::shared().submit([this, symbol, since, limit, params]() {
         return fetchClosedOrders(symbol, since, limit, params);
     });
 }
@@ -622,32 +623,32 @@ json Lbank::withdraw(const std::string& code, double amount, const std::string&
 }
 
 // Async Account API Implementation
-AsyncPullType Lbank::asyncFetchMyTrades(const std::string& symbol, int since, int limit, const json& params) {
-    return std::async(std::launch::async, [this, symbol, since, limit, params]() {
+std::future<json> Lbank::asyncFetchMyTrades(const std::string& symbol, int since, int limit, const json& params) {
+    return Executor::shared().submit([this, symbol, since, limit, params]() {
         return fetchMyTrades(symbol, since, limit, params);
     });
 }
 
-AsyncPullType Lbank::asyncFetchDeposits(const std::string& code, int since, int limit, const json& params) {
-    return std::async(std::launch::async, [this, code, since, limit, params]() {
+std::future<json> Lbank::asyncFetchDeposits(const std::string& code, int since, int limit, const json& params) {
+    return Executor::shared().submit([this, code, since, limit, params]() {
         return fetchDeposits(code, since, limit, params);
     });
 }
 
-AsyncPullType Lbank::asyncFetchWithdrawals(const std::string& code, int since, int limit, const json& params) {
-    return std::async(std::launch::async, [this, code, since, limit, params]() {
+std::future<json> Lbank::asyncFetchWithdrawals(const std::string& code, int since, int limit, const json& params) {
+    return Executor::shared().submit([this, code, since, limit, params]() {
         return fetchWithdrawals(code, since, limit, params);
     });
 }
 
-AsyncPullType Lbank::asyncFetchDepositAddress(const std::string& code, const json& params) {
-    return std::async(std::launch::async, [this, code, params]() {
+std::future<json> Lbank::asyncFetchDepositAddress(const std::string& code, const json& params) {
+    return Executor::shared().submit([this, code, params]() {
         return fetchDepositAddress(code, params);
     });
 }
 
-AsyncPullType Lbank::asyncWithdraw(const std::string& code, double amount, const std::string& address, const std::string& tag, const json& params) {
-    return std::async(std::launch::async, [this, code, amount, address, tag, params]() {
+std::future<json> Lbank::asyncWithdraw(const std::string& code, double amount, const std::string& address, const std::string& tag, const json& params) {
+    return Executor::shared().submit([this, code, amount, address, tag, params]() {
         return withdraw(code, amount, address, tag, params);
     });
 }
@@ -686,38 +687,38 @@ json Lbank::fetchTime(const json& params) {
 }
 
 // Async Additional Features Implementation
-AsyncPullType Lbank::asyncFetchCurrencies(const json& params) {
-    return std::async(std::launch::async, [this, params]() {
+std::future<json> Lbank::asyncFetchCurrencies(const json& params) {
+    return Executor::shared().submit([this, params]() {
         return fetchCurrencies(params);
     });
 }
 
-AsyncPullType Lbank::asyncFetchTradingFees(const json& params) {
-    return std::async(std::launch::async, [this, params]() {
+std::future<json> Lbank::asyncFetchTradingFees(const json& params) {
+    return Executor::shared().submit([this, params]() {
         return fetchTradingFees(params);
     });
 }
 
-AsyncPullType Lbank::asyncFetchFundingFees(const json& params) {
-    return std::async(std::launch::async, [this, params]() {
+std::future<json> Lbank::asyncFetchFundingFees(const json& params) {
+    return Executor::shared().submit([this, params]() {
         return fetchFundingFees(params);
     });
 }
 
-AsyncPullType Lbank::asyncFetchTransactionFees(const json& params) {
-    return std::async(std::launch::async, [this, params]() {
+std::future<json> Lbank::asyncFetchTransactionFees(const json& params) {
+    return Executor::shared().submit([this, params]() {
         return fetchTransactionFees(params);
     });
 }
 
-AsyncPullType Lbank::asyncFetchSystemStatus(const json& params) {
-    return std::async(std::launch::async, [this, params]() {
+std::future<json> Lbank::asyncFetchSystemStatus(const json& params) {
+    return Executor::shared().submit([this, params]() {
         return fetchSystemStatus(params);
     });
 }
 
-AsyncPullType Lbank::asyncFetchTime(const json& params) {
-    return std::async(std::launch::async, [this, params]() {
+std::future<json> Lbank::asyncFetchTime(const json& params) {
+    return Executor::shared().submit([this, params]() {
         return fetchTime(params);
     });
 }
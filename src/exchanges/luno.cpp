@@ -1,4 +1,5 @@
 #include "ccxt/exchanges/luno.h"
+#include "ccxt/base/executor.h"
 #include <chrono>
 #include <sstream>
 #include <iomanip>
@@ -192,7 +193,7 @@ json Luno::fetchTrades(const std::string& symbol, int since, int limit, const js
     return parseTrades(response["trades"], market, since, limit);
 }
 
-json Luno::fetchOHLCV(const std::string& symbol, const std::string& timeframe, int since, int limit, const json& params) {
+json Luno::fetchOHLCV(const std::string& symbol, const std::string& timeframe, long long since, int limit, const json& params) {
     auto market = loadMarket(symbol);
     auto request = {
         {"pair", market["id"]},
@@ -209,38 +210,38 @@ json Luno::fetchOHLCV(const std::string& symbol, const std::string& timeframe, i
 }
 
 // Async Market Data API Implementation
-AsyncPullType Luno::asyncFetchMarkets(const json& params) {
-    return std::async(std::launch::async, [this, params]() {
+std::future<json> Luno::asyncFetchMarkets(const json& params) {
+    return Executor::shared().submit([this, params]() {
         return fetchMarkets(params);
     });
 }
 
-AsyncPullType Luno::asyncFetchTicker(const std::string& symbol, const json& params) {
-    return std::async(std::launch::async, [this, symbol, params]() {
+std::future<json> Luno::asyncFetchTicker(const std::string& symbol, const json& params) {
+    return Executor::shared().submit([this, symbol, params]() {
         return fetchTicker(symbol, params);
     });
 }
 
-AsyncPullType Luno::asyncFetchTickers(const std::vector<std::string>& symbols, const json& params) {
-    return std::async(std::launch::async, [this, symbols, params]() {
+std::future<json> Luno::asyncFetchTickers(const std::vector<std::string>& symbols, const json& params) {
+    return Executor::shared().submit([this, symbols, params]() {
         return fetchTickers(symbols, params);
     });
 }
 
-AsyncPullType Luno::asyncFetchOrderBook(const std::string& symbol, int limit, const json& params) {
-    return std::async(std::launch::async, [this, symbol, limit, params]() {
+std::future<json> Luno::asyncFetchOrderBook(const std::string& symbol, int limit, const json& params) {
+    return Executor::shared().submit([this, symbol, limit, params]() {
         return fetchOrderBook(symbol, limit, params);
     });
 }
 
-AsyncPullType Luno::asyncFetchTrades(const std::string& symbol, int since, int limit, const json& params) {
-    return std::async(std::launch::async, [this, symbol, since, limit, params]() {
+std::future<json> Luno::asyncFetchTrades(const std::string& symbol, int since, int limit, const json& params) {
+    return Executor::shared().submit([this, symbol, since, limit, params]() {
         return fetchTrades(symbol, since, limit, params);
     });
 }
 
-AsyncPullType Luno::asyncFetchOHLCV(const std::string& symbol, const std::string& timeframe, int since, int limit, const json& params) {
-    return std::async(std::launch::async, [this, symbol, timeframe, since, limit, params]() {
+std::future<json> Luno::asyncFetchOHLCV(const std::string& symbol, const std::string& timeframe, int since, int limit, const json& params) {
+    return Executor::shared().submit([this, symbol, timeframe, since, limit, params]() {
         return fetchOHLCV(symbol, timeframe, since, limit, params);
     });
 }
@@ -582,70 +583,70 @@ std::string Luno::getAccountId(const std::string& type, const std::string& curre
 }
 
 // Async Account API Implementation
-AsyncPullType Luno::asyncFetchAccounts(const json& params) {
-    return std::async(std::launch::async, [this, params]() {
+std::future<json> Luno::asyncFetchAccounts(const json& params) {
+    return Executor::shared().submit([this, params]() {
         return fetchAccounts(params);
     });
 }
 
-AsyncPullType Luno::asyncFetchLedger(const std::string& code, int since, int limit, const json& params) {
-    return std::async(std::launch::async, [this, code, since, limit, params]() {
+std::future<json> Luno::asyncFetchLedger(const std::string& code, int since, int limit, const json& params) {
+    return Executor::shared().submit([this, code, since, limit, params]() {
         return fetchLedger(code, since, limit, params);
     });
 }
 
-AsyncPullType Luno::asyncFetchTradingFee(const std::string& symbol, const json& params) {
-    return std::async(std::launch::async, [this, symbol, params]() {
+std::future<json> Luno::asyncFetchTradingFee(const std::string& symbol, const json& params) {
+    return Executor::shared().submit([this, symbol, params]() {
         return fetchTradingFee(symbol, params);
     });
 }
 
 // Async Trading API Implementation
-AsyncPullType Luno::asyncFetchBalance(const json& params) {
-    return std::async(std::launch::async, [this, params]() {
+std::future<json> Luno::asyncFetchBalance(const json& params) {
+    return Executor::shared().submit([this, params]() {
         return fetchBalance(params);
     });
 }
 
-AsyncPullType Luno::asyncCreateOrder(const std::string& symbol, const std::string& type, const std::string& side,
+std::future<json> Luno::asyncCreateOrder(const std::string& symbol, const std::string& type, const std::string& side,
                                        double amount, double price, const json& params) {
-    return std::async(std::launch::async, [this, symbol, type, side, amount, price, params]() {
+    return Executor::shared().submit([this, symbol, type, side, amount, price, params]() {
         return createOrder(symbol, type, side, amount, price, params);
     });
 }
 
-AsyncPullType Luno::asyncCancelOrder(const std::string& id, const std::string& symbol, const json& params) {
-    return std::async(std::launch::async, [this, id, symbol, params]() {
+std::future<json> Luno::asyncCancelOrder(const std::string& id, const std::string& symbol, const json& params) {
+    return Executor::shared().submit([this, id, symbol, params]() {
         return cancelOrder(id, symbol, params);
     });
 }
 
-AsyncPullType Luno::asyncFetchOrder(const std::string& id, const std::string& symbol, const json& params) {
-    return std::async(std::launch::async, [this, id, symbol, params]() {
+std::future<json> Luno::asyncFetchOrder(const std::string& id, const std::string& symbol, const json& params) {
+    return Executor::shared().submit([this, id, symbol, params]() {
         return fetchOrder(id, symbol, params);
     });
 }
 
-AsyncPullType Luno::asyncFetchOrders(const std::string& symbol, int since, int limit, const json& params) {
-    return std::async(std::launch::async, [this, symbol, since, limit, params]() {
+std::future<json> Luno::asyncFetchOrders(const std::string& symbol, int since, int limit, const json& params) {
+    return Executor::shared().submit([this, symbol, since, limit, params]() {
         return fetchOrders(symbol, since, limit, params);
     });
 }
 
-AsyncPullType Luno::asyncFetchOpenOrders(const std::string& symbol, int since, int limit, const json& params) {
-    return std::async(std::launch::async, [this, symbol, since, limit, params]() {
+std::future<json> Luno::asyncFetchOpenOrders(const std::string& symbol, int since, int limit, const json& params) {
+    return Executor::shared().submit([this, symbol, since, limit, params]() {
         return fetchOpenOrders(symbol, since, limit, params);
     });
 }
 
-AsyncPullType Luno::asyncFetchClosedOrders(const std::string& symbol, int since, int limit, const json& params) {
-    return std::async(std::launch::async, [this, symbol, since, limit, params]() {
+std::future<json> Luno::asyncFetchClosedOrders(const std::string& symbol, int since, int limit, const json& params) {
+    return Executor::shared().submit([this, symbol, since, limit, params]() {
         return fetchClosedOrders(symbol, since, limit, params);
     });
 }
 
-AsyncPullType Luno::asyncFetchMyTrades(const std::string& symbol, int since, int limit, const json& params) {
-    return std::async(std::launch::async, [this, symbol, since, limit, params]() {
+std::future<json> Luno::asyncFetchMyTrades(const std::string& symbol, int since, int limit, const json& params) {
+    return Executor::shared().submit([this, symbol, since, limit, params]() {
         return fetchMyTrades(symbol, since, limit, params);
     });
 }
@@ -343,7 +343,7 @@ json Mexc::fetchTrades(const std::string& symbol, int since, int limit, const js
 }
 
 json Mexc::fetchOHLCV(const std::string& symbol, const std::string& timeframe,
-                     int since, int limit, const json& params) {
+                     long long since, int limit, const json& params) {
     this->loadMarkets();
     Market market = this->market(symbol);
     json request = {
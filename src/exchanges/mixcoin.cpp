@@ -1,4 +1,5 @@
 #include "ccxt/exchanges/mixcoin.h"
+#include "ccxt/base/executor.h"
 #include <chrono>
 #include <thread>
 
@@ -147,7 +148,7 @@ json MixCoin::fetchTrades(const std::string& symbol, int since, int limit, const
     return parseTrades(response, market, since, limit);
 }
 
-json MixCoin::fetchOHLCV(const std::string& symbol, const std::string& timeframe, int since, int limit, const json& params) {
+json MixCoin::fetchOHLCV(const std::string& symbol, const std::string& timeframe, long long since, int limit, const json& params) {
     auto market = loadMarket(symbol);
     auto request = params;
     request["period"] = timeframe;
@@ -414,29 +415,27 @@ std::string MixCoin::sign(const std::string& path, const std::string& api,
 }
 
 // Async Methods Implementation
-#define IMPLEMENT_ASYNC_METHOD(name, ...) \
-    AsyncPullType MixCoin::async##name(__VA_ARGS__) { \
-        return std::async(std::launch::async, [this](auto... params) { \
-            return this->name(params...); \
-        }, __VA_ARGS__); \
+#define IMPLEMENT_ASYNC_METHOD(name, method, params, args) \
+    std::future<json> MixCoin::async##name params { \
+        return Executor::shared().submit([=]() { return this->method args; }); \
     }
 
-IMPLEMENT_ASYNC_METHOD(FetchMarkets, const json& params)
-IMPLEMENT_ASYNC_METHOD(FetchTicker, const std::string& symbol, const json& params)
-IMPLEMENT_ASYNC_METHOD(FetchTickers, const std::vector<std::string>& symbols, const json& params)
-IMPLEMENT_ASYNC_METHOD(FetchOrderBook, const std::string& symbol, int limit, const json& params)
-IMPLEMENT_ASYNC_METHOD(FetchTrades, const std::string& symbol, int since, int limit, const json& params)
-IMPLEMENT_ASYNC_METHOD(FetchOHLCV, const std::string& symbol, const std::string& timeframe, int since, int limit, const json& params)
-IMPLEMENT_ASYNC_METHOD(FetchBalance, const json& params)
-IMPLEMENT_ASYNC_METHOD(CreateOrder, const std::string& symbol, const std::string& type, const std::string& side, double amount, double price, const json& params)
-IMPLEMENT_ASYNC_METHOD(CancelOrder, const std::string& id, const std::string& symbol, const json& params)
-IMPLEMENT_ASYNC_METHOD(FetchOrder, const std::string& id, const std::string& symbol, const json& params)
-IMPLEMENT_ASYNC_METHOD(FetchOrders, const std::string& symbol, int since, int limit, const json& params)
-IMPLEMENT_ASYNC_METHOD(FetchOpenOrders, const std::string& symbol, int since, int limit, const json& params)
-IMPLEMENT_ASYNC_METHOD(FetchClosedOrders, const std::string& symbol, int since, int limit, const json& params)
-IMPLEMENT_ASYNC_METHOD(FetchMyTrades, const std::string& symbol, int since, int limit, const json& params)
-IMPLEMENT_ASYNC_METHOD(FetchAccounts, const json& params)
-IMPLEMENT_ASYNC_METHOD(FetchLedger, const std::string& code, int since, int limit, const json& params)
-IMPLEMENT_ASYNC_METHOD(FetchTradingFee, const std::string& symbol, const json& params)
+IMPLEMENT_ASYNC_METHOD(FetchMarkets, fetchMarkets, (const json& params), (params))
+IMPLEMENT_ASYNC_METHOD(FetchTicker, fetchTicker, (const std::string& symbol, const json& params), (symbol, params))
+IMPLEMENT_ASYNC_METHOD(FetchTickers, fetchTickers, (const std::vector<std::string>& symbols, const json& params), (symbols, params))
+IMPLEMENT_ASYNC_METHOD(FetchOrderBook, fetchOrderBook, (const std::string& symbol, int limit, const json& params), (symbol, limit, params))
+IMPLEMENT_ASYNC_METHOD(FetchTrades, fetchTrades, (const std::string& symbol, int since, int limit, const json& params), (symbol, since, limit, params))
+IMPLEMENT_ASYNC_METHOD(FetchOHLCV, fetchOHLCV, (const std::string& symbol, const std::string& timeframe, int since, int limit, const json& params), (symbol, timeframe, since, limit, params))
+IMPLEMENT_ASYNC_METHOD(FetchBalance, fetchBalance, (const json& params), (params))
+IMPLEMENT_ASYNC_METHOD(CreateOrder, createOrder, (const std::string& symbol, const std::string& type, const std::string& side, double amount, double price, const json& params), (symbol, type, side, amount, price, params))
+IMPLEMENT_ASYNC_METHOD(CancelOrder, cancelOrder, (const std::string& id, const std::string& symbol, const json& params), (id, symbol, params))
+IMPLEMENT_ASYNC_METHOD(FetchOrder, fetchOrder, (const std::string& id, const std::string& symbol, const json& params), (id, symbol, params))
+IMPLEMENT_ASYNC_METHOD(FetchOrders, fetchOrders, (const std::string& symbol, int since, int limit, const json& params), (symbol, since, limit, params))
+IMPLEMENT_ASYNC_METHOD(FetchOpenOrders, fetchOpenOrders, (const std::string& symbol, int since, int limit, const json& params), (symbol, since, limit, params))
+IMPLEMENT_ASYNC_METHOD(FetchClosedOrders, fetchClosedOrders, (const std::string& symbol, int since, int limit, const json& params), (symbol, since, limit, params))
+IMPLEMENT_ASYNC_METHOD(FetchMyTrades, fetchMyTrades, (const std::string& symbol, int since, int limit, const json& params), (symbol, since, limit, params))
+IMPLEMENT_ASYNC_METHOD(FetchAccounts, fetchAccounts, (const json& params), (params))
+IMPLEMENT_ASYNC_METHOD(FetchLedger, fetchLedger, (const std::string& code, int since, int limit, const json& params), (code, since, limit, params))
+IMPLEMENT_ASYNC_METHOD(FetchTradingFee, fetchTradingFee, (const std::string& symbol, const json& params), (symbol, params))
 
 } // namespace ccxt
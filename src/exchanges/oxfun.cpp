@@ -1,4 +1,5 @@
 #include "../../include/ccxt/exchanges/oxfun.h"
+#include "ccxt/base/executor.h"
 #include "../../include/ccxt/exchange_registry.h"
 
 namespace ccxt {
@@ -185,98 +186,98 @@ void oxfun::handleErrors(const std::string& code, const std::string& reason, con
     // Implementation for handling errors
 }
 
-AsyncPullType oxfun::fetchMarketsAsync() const {
-    return std::async(std::launch::async, [this]() {
+std::future<Json> oxfun::fetchMarketsAsync() const {
+    return Executor::shared().submit([this]() {
         return this->fetchMarketsImpl();
     });
 }
 
-AsyncPullType oxfun::fetchCurrenciesAsync() const {
-    return std::async(std::launch::async, [this]() {
+std::future<Json> oxfun::fetchCurrenciesAsync() const {
+    return Executor::shared().submit([this]() {
         return this->fetchCurrenciesImpl();
     });
 }
 
-AsyncPullType oxfun::fetchTickerAsync(const std::string& symbol) const {
-    return std::async(std::launch::async, [this, symbol]() {
+std::future<Json> oxfun::fetchTickerAsync(const std::string& symbol) const {
+    return Executor::shared().submit([this, symbol]() {
         return this->fetchTickerImpl(symbol);
     });
 }
 
-AsyncPullType oxfun::fetchTickersAsync(const std::vector<std::string>& symbols) const {
-    return std::async(std::launch::async, [this, symbols]() {
+std::future<Json> oxfun::fetchTickersAsync(const std::vector<std::string>& symbols) const {
+    return Executor::shared().submit([this, symbols]() {
         return this->fetchTickersImpl(symbols);
     });
 }
 
-AsyncPullType oxfun::fetchOrderBookAsync(const std::string& symbol, const std::optional<int>& limit) const {
-    return std::async(std::launch::async, [this, symbol, limit]() {
+std::future<Json> oxfun::fetchOrderBookAsync(const std::string& symbol, const std::optional<int>& limit) const {
+    return Executor::shared().submit([this, symbol, limit]() {
         return this->fetchOrderBookImpl(symbol, limit);
     });
 }
 
-AsyncPullType oxfun::fetchOHLCVAsync(const std::string& symbol, const std::string& timeframe, const std::optional<long long>& since, const std::optional<int>& limit) const {
-    return std::async(std::launch::async, [this, symbol, timeframe, since, limit]() {
+std::future<Json> oxfun::fetchOHLCVAsync(const std::string& symbol, const std::string& timeframe, const std::optional<long long>& since, const std::optional<int>& limit) const {
+    return Executor::shared().submit([this, symbol, timeframe, since, limit]() {
         return this->fetchOHLCVImpl(symbol, timeframe, since, limit);
     });
 }
 
-AsyncPullType oxfun::createOrderAsync(const std::string& symbol, const std::string& type, const std::string& side, double amount, const std::optional<double>& price) {
-    return std::async(std::launch::async, [this, symbol, type, side, amount, price]() {
+std::future<Json> oxfun::createOrderAsync(const std::string& symbol, const std::string& type, const std::string& side, double amount, const std::optional<double>& price) {
+    return Executor::shared().submit([this, symbol, type, side, amount, price]() {
         return this->createOrderImpl(symbol, type, side, amount, price);
     });
 }
 
-AsyncPullType oxfun::cancelOrderAsync(const std::string& id, const std::string& symbol) {
-    return std::async(std::launch::async, [this, id, symbol]() {
+std::future<Json> oxfun::cancelOrderAsync(const std::string& id, const std::string& symbol) {
+    return Executor::shared().submit([this, id, symbol]() {
         return this->cancelOrderImpl(id, symbol);
     });
 }
 
-AsyncPullType oxfun::fetchOrderAsync(const std::string& id, const std::string& symbol) const {
-    return std::async(std::launch::async, [this, id, symbol]() {
+std::future<Json> oxfun::fetchOrderAsync(const std::string& id, const std::string& symbol) const {
+    return Executor::shared().submit([this, id, symbol]() {
         return this->fetchOrderImpl(id, symbol);
     });
 }
 
-AsyncPullType oxfun::fetchOpenOrdersAsync(const std::string& symbol, const std::optional<long long>& since, const std::optional<int>& limit) const {
-    return std::async(std::launch::async, [this, symbol, since, limit]() {
+std::future<Json> oxfun::fetchOpenOrdersAsync(const std::string& symbol, const std::optional<long long>& since, const std::optional<int>& limit) const {
+    return Executor::shared().submit([this, symbol, since, limit]() {
         return this->fetchOpenOrdersImpl(symbol, since, limit);
     });
 }
 
-AsyncPullType oxfun::fetchClosedOrdersAsync(const std::string& symbol, const std::optional<long long>& since, const std::optional<int>& limit) const {
-    return std::async(std::launch::async, [this, symbol, since, limit]() {
+std::future<Json> oxfun::fetchClosedOrdersAsync(const std::string& symbol, const std::optional<long long>& since, const std::optional<int>& limit) const {
+    return Executor::shared().submit([this, symbol, since, limit]() {
         return this->fetchClosedOrdersImpl(symbol, since, limit);
     });
 }
 
-AsyncPullType oxfun::fetchMyTradesAsync(const std::string& symbol, const std::optional<long long>& since, const std::optional<int>& limit) const {
-    return std::async(std::launch::async, [this, symbol, since, limit]() {
+std::future<Json> oxfun::fetchMyTradesAsync(const std::string& symbol, const std::optional<long long>& since, const std::optional<int>& limit) const {
+    return Executor::shared().submit([this, symbol, since, limit]() {
         return this->fetchMyTradesImpl(symbol, since, limit);
     });
 }
 
-AsyncPullType oxfun::fetchBalanceAsync() const {
-    return std::async(std::launch::async, [this]() {
+std::future<Json> oxfun::fetchBalanceAsync() const {
+    return Executor::shared().submit([this]() {
         return this->fetchBalanceImpl();
     });
 }
 
-AsyncPullType oxfun::fetchDepositAddressAsync(const std::string& code, const std::optional<std::string>& network) const {
-    return std::async(std::launch::async, [this, code, network]() {
+std::future<Json> oxfun::fetchDepositAddressAsync(const std::string& code, const std::optional<std::string>& network) const {
+    return Executor::shared().submit([this, code, network]() {
         return this->fetchDepositAddressImpl(code, network);
     });
 }
 
-AsyncPullType oxfun::fetchDepositsAsync(const std::optional<std::string>& code, const std::optional<long long>& since, const std::optional<int>& limit) const {
-    return std::async(std::launch::async, [this, code, since, limit]() {
+std::future<Json> oxfun::fetchDepositsAsync(const std::optional<std::string>& code, const std::optional<long long>& since, const std::optional<int>& limit) const {
+    return Executor::shared().submit([this, code, since, limit]() {
         return this->fetchDepositsImpl(code, since, limit);
     });
 }
 
-AsyncPullType oxfun::fetchWithdrawalsAsync(const std::optional<std::string>& code, const std::optional<long long>& since, const std::optional<int>& limit) const {
-    return std::async(std::launch::async, [this, code, since, limit]() {
+std::future<Json> oxfun::fetchWithdrawalsAsync(const std::optional<std::string>& code, const std::optional<long long>& since, const std::optional<int>& limit) const {
+    return Executor::shared().submit([this, code, since, limit]() {
         return this->fetchWithdrawalsImpl(code, since, limit);
     });
 }
@@ -1,4 +1,5 @@
 #include "poloniex.h"
+#include "ccxt/base/executor.h"
 #include <chrono>
 #include <sstream>
 #include <iomanip>
@@ -684,13 +685,12 @@ Json poloniex::parseTrade(const Json& trade, const Json& market) const {
 }
 
 // Async implementations for trading API
-AsyncPullType poloniex::createOrderAsync(const std::string& symbol,
+std::future<json> poloniex::createOrderAsync(const std::string& symbol,
                                            const std::string& type,
                                            const std::string& side,
                                            double amount,
                                            const std::optional<double>& price) {
-    return std::async(std::launch::async,
-                     [this, symbol, type, side, amount, price]() {
+    return Executor::shared().submit([this, symbol, type, side, amount, price]() {
                          return createOrderImpl(symbol, type, side, amount, price);
                      });
 }
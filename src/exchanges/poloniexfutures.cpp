@@ -1,4 +1,5 @@
 #include "ccxt/exchanges/poloniexfutures.h"
+#include "ccxt/base/executor.h"
 #include <chrono>
 #include <iomanip>
 #include <sstream>
@@ -487,43 +488,40 @@ void poloniexfutures::handleErrors(const std::string& code, const std::string& r
 }
 
 // Async implementations for market data
-AsyncPullType poloniexfutures::fetchMarketsAsync() const {
-    return std::async(std::launch::async, [this]() { return fetchMarketsImpl(); });
+std::future<Json> poloniexfutures::fetchMarketsAsync() const {
+    return Executor::shared().submit([this]() { return fetchMarketsImpl(); });
 }
 
-AsyncPullType poloniexfutures::fetchTimeAsync() const {
-    return std::async(std::launch::async, [this]() { return fetchTimeImpl(); });
+std::future<Json> poloniexfutures::fetchTimeAsync() const {
+    return Executor::shared().submit([this]() { return fetchTimeImpl(); });
 }
 
-AsyncPullType poloniexfutures::fetchTickerAsync(const std::string& symbol) const {
-    return std::async(std::launch::async, [this, symbol]() { return fetchTickerImpl(symbol); });
+std::future<Json> poloniexfutures::fetchTickerAsync(const std::string& symbol) const {
+    return Executor::shared().submit([this, symbol]() { return fetchTickerImpl(symbol); });
 }
 
-AsyncPullType poloniexfutures::fetchTickersAsync(const std::vector<std::string>& symbols) const {
-    return std::async(std::launch::async, [this, symbols]() { return fetchTickersImpl(symbols); });
+std::future<Json> poloniexfutures::fetchTickersAsync(const std::vector<std::string>& symbols) const {
+    return Executor::shared().submit([this, symbols]() { return fetchTickersImpl(symbols); });
 }
 
-AsyncPullType poloniexfutures::fetchOrderBookAsync(const std::string& symbol,
+std::future<Json> poloniexfutures::fetchOrderBookAsync(const std::string& symbol,
                                                      const std::optional<int>& limit) const {
-    return std::async(std::launch::async,
-                     [this, symbol, limit]() { return fetchOrderBookImpl(symbol, limit); });
+    return Executor::shared().submit([this, symbol, limit]() { return fetchOrderBookImpl(symbol, limit); });
 }
 
-AsyncPullType poloniexfutures::fetchOHLCVAsync(const std::string& symbol,
+std::future<Json> poloniexfutures::fetchOHLCVAsync(const std::string& symbol,
                                                   const std::string& timeframe,
                                                   const std::optional<long long>& since,
                                                   const std::optional<int>& limit) const {
-    return std::async(std::launch::async,
-                     [this, symbol, timeframe, since, limit]() {
+    return Executor::shared().submit([this, symbol, timeframe, since, limit]() {
                          return fetchOHLCVImpl(symbol, timeframe, since, limit);
                      });
 }
 
-AsyncPullType poloniexfutures::fetchTradesAsync(const std::string& symbol,
+std::future<Json> poloniexfutures::fetchTradesAsync(const std::string& symbol,
                                                    const std::optional<int>& limit,
                                                    const std::optional<long long>& since) const {
-    return std::async(std::launch::async,
-                     [this, symbol, limit, since]() {
+    return Executor::shared().submit([this, symbol, limit, since]() {
                          return fetchTradesImpl(symbol, limit, since);
                      });
 }
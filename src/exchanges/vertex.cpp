@@ -236,7 +236,7 @@ json Vertex::fetchOrderBook(const std::string& symbol, int limit, const json& pa
 }
 
 json Vertex::fetchOHLCV(const std::string& symbol, const std::string& timeframe,
-                       int since, int limit, const json& params) {
+                       long long since, int limit, const json& params) {
     auto market = loadMarket(symbol);
     json requestParams = params;
     requestParams["symbol"] = market["id"];
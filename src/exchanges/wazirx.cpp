@@ -214,7 +214,7 @@ json WazirX::fetchOrderBook(const std::string& symbol, int limit, const json& pa
 }
 
 json WazirX::fetchOHLCV(const std::string& symbol, const std::string& timeframe,
-                       int since, int limit, const json& params) {
+                       long long since, int limit, const json& params) {
     auto market = loadMarket(symbol);
     json requestParams = {
         {"symbol", market["id"]},
@@ -1,4 +1,5 @@
 #include "ccxt/exchanges/woo.h"
+#include "ccxt/base/executor.h"
 #include "ccxt/error.h"
 #include <algorithm>
 
@@ -320,32 +321,42 @@ json Woo::fetchTrades(const std::string& symbol, int since, int limit, const jso
 }
 
 // Market Data Methods - Async
-AsyncPullType Woo::fetchMarketsAsync(const json& params) {
-    return async(&Woo::fetchMarkets, params);
+std::future<json> Woo::fetchMarketsAsync(const json& params) {
+    return Executor::shared().submit([this, params]() {
+        return fetchMarkets(params);
+    });
 }
 
-AsyncPullType Woo::fetchCurrenciesAsync(const json& params) {
+std::future<json> Woo::fetchCurrenciesAsync(const json& params) {
     return async(&Woo::fetchCurrencies, params);
 }
 
-AsyncPullType Woo::fetchTimeAsync(const json& params) {
+std::future<json> Woo::fetchTimeAsync(const json& params) {
     return async(&Woo::fetchTime, params);
 }
 
-AsyncPullType Woo::fetchTickerAsync(const std::string& symbol, const json& params) {
-    return async(&Woo::fetchTicker, symbol, params);
+std::future<json> Woo::fetchTickerAsync(const std::string& symbol, const json& params) {
+    return Executor::shared().submit([this, symbol, params]() {
+        return fetchTicker(symbol, params);
+    });
 }
 
-AsyncPullType Woo::fetchTickersAsync(const std::vector<std::string>& symbols, const json& params) {
-    return async(&Woo::fetchTickers, symbols, params);
+std::future<json> Woo::fetchTickersAsync(const std::vector<std::string>& symbols, const json& params) {
+    return Executor::shared().submit([this, symbols, params]() {
+        return fetchTickers(symbols, params);
+    });
 }
 
-AsyncPullType Woo::fetchOrderBookAsync(const std::string& symbol, int limit, const json& params) {
-    return async(&Woo::fetchOrderBook, symbol, limit, params);
+std::future<json> Woo::fetchOrderBookAsync(const std::string& symbol, int limit, const json& params) {
+    return Executor::shared().submit([this, symbol, limit, params]() {
+        return fetchOrderBook(symbol, limit, params);
+    });
 }
 
-AsyncPullType Woo::fetchTradesAsync(const std::string& symbol, int since, int limit, const json& params) {
-    return async(&Woo::fetchTrades, symbol, since, limit, params);
+std::future<json> Woo::fetchTradesAsync(const std::string& symbol, int since, int limit, const json& params) {
+    return Executor::shared().submit([this, symbol, since, limit, params]() {
+        return fetchTrades(symbol, since, limit, params);
+    });
 }
 
 // Account Methods - Sync
@@ -436,29 +447,31 @@ json Woo::fetchWithdrawals(const std::string& code, int since, int limit, const
 }
 
 // Account Methods - Async
-AsyncPullType Woo::fetchAccountsAsync(const json& params) {
+std::future<json> Woo::fetchAccountsAsync(const json& params) {
     return async(&Woo::fetchAccounts, params);
 }
 
-AsyncPullType Woo::fetchBalanceAsync(const json& params) {
-    return async(&Woo::fetchBalance, params);
+std::future<json> Woo::fetchBalanceAsync(const json& params) {
+    return Executor::shared().submit([this, params]() {
+        return fetchBalance(params);
+    });
 }
 
-AsyncPullType Woo::fetchLedgerAsync(const std::string& code, int since, int limit,
+std::future<json> Woo::fetchLedgerAsync(const std::string& code, int since, int limit,
                                       const json& params) {
     return async(&Woo::fetchLedger, code, since, limit, params);
 }
 
-AsyncPullType Woo::fetchDepositAddressAsync(const std::string& code, const json& params) {
+std::future<json> Woo::fetchDepositAddressAsync(const std::string& code, const json& params) {
     return async(&Woo::fetchDepositAddress, code, params);
 }
 
-AsyncPullType Woo::fetchDepositsAsync(const std::string& code, int since, int limit,
+std::future<json> Woo::fetchDepositsAsync(const std::string& code, int since, int limit,
                                         const json& params) {
     return async(&Woo::fetchDeposits, code, since, limit, params);
 }
 
-AsyncPullType Woo::fetchWithdrawalsAsync(const std::string& code, int since, int limit,
+std::future<json> Woo::fetchWithdrawalsAsync(const std::string& code, int since, int limit,
                                            const json& params) {
     return async(&Woo::fetchWithdrawals, code, since, limit, params);
 }
@@ -1,4 +1,5 @@
 #include "ccxt/exchanges/woofipro.h"
+#include "ccxt/base/executor.h"
 #include "ccxt/error.h"
 #include <algorithm>
 
@@ -301,32 +302,42 @@ json WooFiPro::fetchTrades(const std::string& symbol, int since, int limit, cons
 }
 
 // Market Data Methods - Async
-AsyncPullType WooFiPro::fetchMarketsAsync(const json& params) {
-    return async(&WooFiPro::fetchMarkets, params);
+std::future<json> WooFiPro::fetchMarketsAsync(const json& params) {
+    return Executor::shared().submit([this, params]() {
+        return fetchMarkets(params);
+    });
 }
 
-AsyncPullType WooFiPro::fetchCurrenciesAsync(const json& params) {
+std::future<json> WooFiPro::fetchCurrenciesAsync(const json& params) {
     return async(&WooFiPro::fetchCurrencies, params);
 }
 
-AsyncPullType WooFiPro::fetchTimeAsync(const json& params) {
+std::future<json> WooFiPro::fetchTimeAsync(const json& params) {
     return async(&WooFiPro::fetchTime, params);
 }
 
-AsyncPullType WooFiPro::fetchTickerAsync(const std::string& symbol, const json& params) {
-    return async(&WooFiPro::fetchTicker, symbol, params);
+std::future<json> WooFiPro::fetchTickerAsync(const std::string& symbol, const json& params) {
+    return Executor::shared().submit([this, symbol, params]() {
+        return fetchTicker(symbol, params);
+    });
 }
 
-AsyncPullType WooFiPro::fetchTickersAsync(const std::vector<std::string>& symbols, const json& params) {
-    return async(&WooFiPro::fetchTickers, symbols, params);
+std::future<json> WooFiPro::fetchTickersAsync(const std::vector<std::string>& symbols, const json& params) {
+    return Executor::shared().submit([this, symbols, params]() {
+        return fetchTickers(symbols, params);
+    });
 }
 
-AsyncPullType WooFiPro::fetchOrderBookAsync(const std::string& symbol, int limit, const json& params) {
-    return async(&WooFiPro::fetchOrderBook, symbol, limit, params);
+std::future<json> WooFiPro::fetchOrderBookAsync(const std::string& symbol, int limit, const json& params) {
+    return Executor::shared().submit([this, symbol, limit, params]() {
+        return fetchOrderBook(symbol, limit, params);
+    });
 }
 
-AsyncPullType WooFiPro::fetchTradesAsync(const std::string& symbol, int since, int limit, const json& params) {
-    return async(&WooFiPro::fetchTrades, symbol, since, limit, params);
+std::future<json> WooFiPro::fetchTradesAsync(const std::string& symbol, int since, int limit, const json& params) {
+    return Executor::shared().submit([this, symbol, since, limit, params]() {
+        return fetchTrades(symbol, since, limit, params);
+    });
 }
 
 // Trading Methods - Sync
@@ -408,39 +419,51 @@ json WooFiPro::fetchOrders(const std::string& symbol, int since, int limit, cons
 }
 
 // Trading Methods - Async
-AsyncPullType WooFiPro::createOrderAsync(const std::string& symbol, const std::string& type,
+std::future<json> WooFiPro::createOrderAsync(const std::string& symbol, const std::string& type,
                                            const std::string& side, double amount, double price,
                                            const json& params) {
-    return async(&WooFiPro::createOrder, symbol, type, side, amount, price, params);
+    return Executor::shared().submit([this, symbol, type, side, amount, price, params]() {
+        return createOrder(symbol, type, side, amount, price, params);
+    });
 }
 
-AsyncPullType WooFiPro::cancelOrderAsync(const std::string& id, const std::string& symbol,
+std::future<json> WooFiPro::cancelOrderAsync(const std::string& id, const std::string& symbol,
                                            const json& params) {
-    return async(&WooFiPro::cancelOrder, id, symbol, params);
+    return Executor::shared().submit([this, id, symbol, params]() {
+        return cancelOrder(id, symbol, params);
+    });
 }
 
-AsyncPullType WooFiPro::cancelAllOrdersAsync(const std::string& symbol, const json& params) {
+std::future<json> WooFiPro::cancelAllOrdersAsync(const std::string& symbol, const json& params) {
     return async(&WooFiPro::cancelAllOrders, symbol, params);
 }
 
-AsyncPullType WooFiPro::fetchOrderAsync(const std::string& id, const std::string& symbol,
+std::future<json> WooFiPro::fetchOrderAsync(const std::string& id, const std::string& symbol,
                                           const json& params) {
-    return async(&WooFiPro::fetchOrder, id, symbol, params);
+    return Executor::shared().submit([this, id, symbol, params]() {
+        return fetchOrder(id, symbol, params);
+    });
 }
 
-AsyncPullType WooFiPro::fetchOrdersAsync(const std::string& symbol, int since, int limit,
+std::future<json> WooFiPro::fetchOrdersAsync(const std::string& symbol, int since, int limit,
                                            const json& params) {
-    return async(&WooFiPro::fetchOrders, symbol, since, limit, params);
+    return Executor::shared().submit([this, symbol, since, limit, params]() {
+        return fetchOrders(symbol, since, limit, params);
+    });
 }
 
-AsyncPullType WooFiPro::fetchOpenOrdersAsync(const std::string& symbol, int since, int limit,
+std::future<json> WooFiPro::fetchOpenOrdersAsync(const std::string& symbol, int since, int limit,
                                                const json& params) {
-    return async(&WooFiPro::fetchOpenOrders, symbol, since, limit, params);
+    return Executor::shared().submit([this, symbol, since, limit, params]() {
+        return fetchOpenOrders(symbol, since, limit, params);
+    });
 }
 
-AsyncPullType WooFiPro::fetchClosedOrdersAsync(const std::string& symbol, int since, int limit,
+std::future<json> WooFiPro::fetchClosedOrdersAsync(const std::string& symbol, int since, int limit,
                                                  const json& params) {
-    return async(&WooFiPro::fetchClosedOrders, symbol, since, limit, params);
+    return Executor::shared().submit([this, symbol, since, limit, params]() {
+        return fetchClosedOrders(symbol, since, limit, params);
+    });
 }
 
 // Account Methods - Sync
@@ -487,16 +510,18 @@ json WooFiPro::fetchWithdrawals(const std::string& code, int since, int limit, c
 }
 
 // Account Methods - Async
-AsyncPullType WooFiPro::fetchBalanceAsync(const json& params) {
-    return async(&WooFiPro::fetchBalance, params);
+std::future<json> WooFiPro::fetchBalanceAsync(const json& params) {
+    return Executor::shared().submit([this, params]() {
+        return fetchBalance(params);
+    });
 }
 
-AsyncPullType WooFiPro::fetchDepositsAsync(const std::string& code, int since, int limit,
+std::future<json> WooFiPro::fetchDepositsAsync(const std::string& code, int since, int limit,
                                              const json& params) {
     return async(&WooFiPro::fetchDeposits, code, since, limit, params);
 }
 
-AsyncPullType WooFiPro::fetchWithdrawalsAsync(const std::string& code, int since, int limit,
+std::future<json> WooFiPro::fetchWithdrawalsAsync(const std::string& code, int since, int limit,
                                                 const json& params) {
     return async(&WooFiPro::fetchWithdrawals, code, since, limit, params);
 }
@@ -513,7 +538,7 @@ json WooFiPro::setLeverage(int leverage, const std::string& symbol, const json&
 }
 
 // Margin Trading Methods - Async
-AsyncPullType WooFiPro::setLeverageAsync(int leverage, const std::string& symbol,
+std::future<json> WooFiPro::setLeverageAsync(int leverage, const std::string& symbol,
                                            const json& params) {
     return async(&WooFiPro::setLeverage, leverage, symbol, params);
 }
@@ -804,7 +829,7 @@ json WooFiPro::parseCurrency(const json& currency) {
 }
 
 json WooFiPro::fetchOHLCV(const std::string& symbol, const std::string& timeframe,
-                         int since, int limit, const json& params) {
+                         long long since, int limit, const json& params) {
     this->loadMarkets();
     auto market = this->market(symbol);
     auto request = {
@@ -833,9 +858,11 @@ json WooFiPro::parseOHLCV(const json& ohlcv, const Market& market) {
 }
 
 // OHLCV - Async
-AsyncPullType WooFiPro::fetchOHLCVAsync(const std::string& symbol, const std::string& timeframe,
-                                          int since, int limit, const json& params) {
-    return async(&WooFiPro::fetchOHLCV, symbol, timeframe, since, limit, params);
+std::future<json> WooFiPro::fetchOHLCVAsync(const std::string& symbol, const std::string& timeframe,
+                                          long long since, int limit, const json& params) {
+    return Executor::shared().submit([this, symbol, timeframe, since, limit, params]() {
+        return fetchOHLCV(symbol, timeframe, since, limit, params);
+    });
 }
 
 } // namespace ccxt
@@ -1,6 +1,10 @@
 #include <ccxt/exchanges/ws/binance_ws.h>
+#include <ccxt/base/errors.h>
+#include <ccxt/base/logger.h>
+#include <ccxt/base/order_tracker.h>
+#include <ccxt/base/query_builder.h>
 #include <nlohmann/json.hpp>
-#include <iostream>
+#include <cctype>
 #include <sstream>
 #include <chrono>
 #include <boost/crc.hpp>
@@ -36,12 +40,77 @@ BinanceWS::BinanceWS(boost::asio::io_context& ioc, boost::asio::ssl::context& ct
             {"checksum", true}
         }}
     };
+    orders_ = ArrayCacheById<Order>(limit("ordersLimit"));
+    myTrades_ = ArrayCache<MyTrade>(limit("tradesLimit"));
+}
+
+size_t BinanceWS::limit(const std::string& option) const {
+    auto it = options_.find(option);
+    return it != options_.end() && it->second.is_number_integer() ? it->second.get<size_t>() : 1000;
+}
+
+const ArrayCache<Trade>* BinanceWS::trades(const std::string& marketId) const {
+    auto it = trades_.find(marketId);
+    return it == trades_.end() ? nullptr : &it->second;
+}
+
+const ArrayCacheByTimestamp<OHLCV>* BinanceWS::ohlcv(const std::string& marketId, const std::string& timeframe) const {
+    auto symbol = ohlcvs_.find(marketId);
+    if (symbol == ohlcvs_.end()) {
+        return nullptr;
+    }
+    auto it = symbol->second.find(timeframe);
+    return it == symbol->second.end() ? nullptr : &it->second;
 }
 
 std::string BinanceWS::getEndpoint() {
     return "wss://stream.binance.com:9443/ws";
 }
 
+std::string BinanceWS::getApiEndpoint() {
+    return "wss://ws-api.binance.com:443/ws-api/v3";
+}
+
+std::future<std::string> BinanceWS::createOrderWs(const std::string& symbol, const std::string& type,
+                                                  const std::string& side, double amount,
+                                                  const std::optional<double>& price) {
+    const Market market = exchange_.findMarket(symbol);
+    nlohmann::json params = {
+        {"symbol", market.id},
+        {"side", boost::algorithm::to_upper_copy(side)},
+        {"type", boost::algorithm::to_upper_copy(type)},
+        {"quantity", exchange_.amountToPrecision(symbol, amount)}
+    };
+    if (price) {
+        params["price"] = exchange_.priceToPrecision(symbol, *price);
+        params["timeInForce"] = "GTC";
+    }
+    return signedRequest("order.place", std::move(params));
+}
+
+std::future<std::string> BinanceWS::cancelOrderWs(const std::string& id, const std::string& symbol) {
+    const Market market = exchange_.findMarket(symbol);
+    return signedRequest("order.cancel", {{"symbol", market.id}, {"orderId", id}});
+}
+
+std::future<std::string> BinanceWS::signedRequest(const std::string& method, nlohmann::json params) {
+    params["apiKey"] = exchange_.config_.apiKey;
+    if (exchange_.recvWindow_ > 0) {
+        params["recvWindow"] = exchange_.recvWindow_;
+    }
+    params["timestamp"] = exchange_.serverMilliseconds();
+    // The payload is every parameter sorted by name, which is how json objects iterate
+    thread_local QueryBuilder query;
+    query.clear();
+    query.add(params);
+    HmacSigner::Buffer signature;
+    exchange_.createSignature(query.view(), signature);
+    params["signature"] = std::string(signature.view());
+    const uint64_t id = nextRequestId();
+    const nlohmann::json message = {{"id", id}, {"method", method}, {"params", std::move(params)}};
+    return request(id, method, message.dump());
+}
+
 void BinanceWS::authenticate() {
     // Get listen key from REST API
     auto listenKey = "";//exchange_.getListenKey();
@@ -49,60 +118,65 @@ void BinanceWS::authenticate() {
     nlohmann::json request = {
         {"method", "SUBSCRIBE"},
         {"params", {listenKey}},
-        {"id", nextRequestId_++}
+        {"id", nextRequestId()}
     };
     
     send(request.dump());
 }
 
 void BinanceWS::watchTicker(const std::string& symbol) {
-    auto market = exchange_.markets[symbol];
+    auto market = exchange_.market(symbol);
     std::string stream = boost::algorithm::to_lower_copy(market.id) + "@ticker";
     
     nlohmann::json request = {
         {"method", "SUBSCRIBE"},
         {"params", {stream}},
-        {"id", nextRequestId_++}
+        {"id", nextRequestId()}
     };
     
     send(request.dump());
 }
 
 void BinanceWS::watchOrderBook(const std::string& symbol, const std::string& limit) {
-    auto market = exchange_.markets[symbol];
-    std::string stream = boost::algorithm::to_lower_copy(market.id) + "@depth" + (limit.empty() ? "" : limit);
+    const std::string levels = limit.empty() ? "20" : limit;
+    if (levels != "5" && levels != "10" && levels != "20") {
+        throw BadRequest(exchange_.id + " watchOrderBook() limit must be 5, 10 or 20");
+    }
+    auto market = exchange_.market(symbol);
+    std::string stream = boost::algorithm::to_lower_copy(market.id) + "@depth" + levels + "@100ms";
     
     nlohmann::json request = {
         {"method", "SUBSCRIBE"},
         {"params", {stream}},
-        {"id", nextRequestId_++}
+        {"id", nextRequestId()}
     };
     
     send(request.dump());
 }
 
 void BinanceWS::watchTrades(const std::string& symbol) {
-    auto market = exchange_.markets[symbol];
+    auto market = exchange_.market(symbol);
     std::string stream = boost::algorithm::to_lower_copy(market.id) + "@trade";
     
     nlohmann::json request = {
         {"method", "SUBSCRIBE"},
         {"params", {stream}},
-        {"id", nextRequestId_++}
+        {"id", nextRequestId()}
     };
     
     send(request.dump());
 }
 
 void BinanceWS::watchOHLCV(const std::string& symbol, const std::string& timeframe) {
-    auto market = exchange_.markets[symbol];
-    std::string interval = "1m";//exchange_.timeframes[timeframe];
+    auto market = exchange_.market(symbol);
+    // Binance's kline intervals are the unified timeframe strings
+    const std::string& interval = timeframe;
     std::string stream = boost::algorithm::to_lower_copy(market.id) + "@kline_" + interval;
     
     nlohmann::json request = {
         {"method", "SUBSCRIBE"},
         {"params", {stream}},
-        {"id", nextRequestId_++}
+        {"id", nextRequestId()}
     };
     
     send(request.dump());
@@ -136,13 +210,13 @@ void BinanceWS::watchMyTrades() {
 }
 
 void BinanceWS::watchMarkPrice(const std::string& symbol) {
-    auto market = exchange_.markets[symbol];
+    auto market = exchange_.market(symbol);
     std::string stream = boost::algorithm::to_lower_copy(market.id) + "@markPrice";
     
     nlohmann::json request = {
         {"method", "SUBSCRIBE"},
         {"params", {stream}},
-        {"id", nextRequestId_++}
+        {"id", nextRequestId()}
     };
     
     send(request.dump());
@@ -160,13 +234,26 @@ void BinanceWS::watchPositions() {
 void BinanceWS::handleMessage(const std::string& message) {
     try {
         auto j = nlohmann::json::parse(message);
-        
+
+        // Answers to request(); ws-api errors carry a status and an error object
+        if (j.contains("id") && j["id"].is_number_unsigned()) {
+            const uint64_t id = j["id"].get<uint64_t>();
+            if (j.contains("error") || j.value("status", 200) >= 400) {
+                const std::string error = j.contains("error") ? j["error"].dump() : message;
+                if (reject(id, std::make_exception_ptr(ExchangeError(error)))) {
+                    return;
+                }
+            } else if (resolve(id, message)) {
+                return;
+            }
+        }
+
         // Handle subscription responses
         if (j.contains("result") && j.contains("id")) {
             if (j["result"].is_null()) {
-                std::cout << "Successfully subscribed to stream" << std::endl;
+                CCXT_LOG_DEBUG("Successfully subscribed to stream");
             } else {
-                std::cerr << "Subscription failed: " << j["result"] << std::endl;
+                CCXT_LOG_ERROR("Subscription failed: " << j["result"]);
             }
             return;
         }
@@ -178,8 +265,8 @@ void BinanceWS::handleMessage(const std::string& message) {
             
             if (stream.find("@ticker") != std::string::npos) {
                 handleTicker(data);
-            } else if (stream.find("@depth") != std::string::npos) {
-                handleOrderBook(data);
+            } else if (isPartialDepth(stream)) {
+                handleOrderBook(stream, data);
             } else if (stream.find("@trade") != std::string::npos) {
                 handleTrade(data);
             } else if (stream.find("@kline") != std::string::npos) {
@@ -204,56 +291,89 @@ void BinanceWS::handleMessage(const std::string& message) {
             }
         }
     } catch (const std::exception& e) {
-        std::cerr << "Error handling message: " << e.what() << std::endl;
+        CCXT_LOG_ERROR("Error handling message: " << e.what());
+    }
+}
+
+TopicId BinanceWS::topicId(const std::string& name) {
+    auto it = topicIds_.find(name);
+    if (it == topicIds_.end()) {
+        it = topicIds_.emplace(name, topicsBus_->topic(name)).first;
     }
+    return it->second;
+}
+
+template <typename T>
+void BinanceWS::emit(const std::string& topic, const T& event) {
+    std::shared_ptr<EventBus> bus = exchange_.eventBus();
+    if (bus != topicsBus_) {
+        topicsBus_ = std::move(bus);
+        topicIds_.clear();
+        sourceId_ = topicsBus_->topic(exchange_.id);
+    }
+    topicsBus_->publish(sourceId_, topicId(topic), event);
 }
 
 void BinanceWS::handleTicker(const nlohmann::json& data) {
-    Ticker ticker;
+    Ticker ticker{};
     ticker.symbol = data["s"].get<std::string>();
     ticker.high = std::stod(data["h"].get<std::string>());
     ticker.low = std::stod(data["l"].get<std::string>());
     ticker.bid = std::stod(data["b"].get<std::string>());
+    ticker.bidVolume = std::stod(data["B"].get<std::string>());
     ticker.ask = std::stod(data["a"].get<std::string>());
+    ticker.askVolume = std::stod(data["A"].get<std::string>());
     ticker.last = std::stod(data["c"].get<std::string>());
     ticker.volume = std::stod(data["v"].get<std::string>());
     ticker.timestamp = data["E"].get<uint64_t>();
 
-    //exchange_.emitTicker(ticker);
+    emit(ticker.symbol, ticker);
+}
+
+bool BinanceWS::isPartialDepth(const std::string& stream) {
+    const size_t depth = stream.find("@depth");
+    return depth != std::string::npos && depth + 6 < stream.size() &&
+           std::isdigit(static_cast<unsigned char>(stream[depth + 6]));
 }
 
-void BinanceWS::handleOrderBook(const nlohmann::json& data) {
-    OrderBook orderBook;
-    orderBook.symbol = data["s"].get<std::string>();
-    orderBook.timestamp = data["E"].get<uint64_t>();
+void BinanceWS::handleOrderBook(const std::string& stream, const nlohmann::json& data) {
+    OrderBook orderBook{};
+    // Spot snapshots carry neither the symbol nor an event time
+    orderBook.symbol = data.contains("s") ? data["s"].get<std::string>()
+                                          : boost::algorithm::to_upper_copy(stream.substr(0, stream.find('@')));
+    orderBook.timestamp = data.value("E", 0LL);
 
-    // Process bids
-    for (const auto& bid : data["b"]) {
+    // Spot names the sides bids/asks, futures b/a
+    for (const auto& bid : data.contains("bids") ? data["bids"] : data["b"]) {
         double price = std::stod(bid[0].get<std::string>());
         double amount = std::stod(bid[1].get<std::string>());
-        orderBook.bids.emplace_back(price, amount);
+        orderBook.bids.push_back({price, amount});
     }
 
-    // Process asks
-    for (const auto& ask : data["a"]) {
+    for (const auto& ask : data.contains("asks") ? data["asks"] : data["a"]) {
         double price = std::stod(ask[0].get<std::string>());
         double amount = std::stod(ask[1].get<std::string>());
-        orderBook.asks.emplace_back(price, amount);
+        orderBook.asks.push_back({price, amount});
     }
 
-    //exchange_.emitOrderBook(orderBook);
+    emit(orderBook.symbol, orderBook);
 }
 
 void BinanceWS::handleTrade(const nlohmann::json& data) {
     Trade trade;
     trade.symbol = data["s"].get<std::string>();
-    trade.id = data["t"].get<std::string>();
+    trade.id = std::to_string(data["t"].get<long long>());
     trade.price = std::stod(data["p"].get<std::string>());
     trade.amount = std::stod(data["q"].get<std::string>());
-    trade.timestamp = data["E"].get<uint64_t>();
+    trade.timestamp = data["T"].get<uint64_t>();
     trade.side = data["m"].get<bool>() ? "sell" : "buy";
 
-    //exchange_.emitTrade(trade);
+    auto cache = trades_.find(trade.symbol);
+    if (cache == trades_.end()) {
+        cache = trades_.emplace(trade.symbol, ArrayCache<Trade>(limit("tradesLimit"))).first;
+    }
+    cache->second.append(trade);
+    emit(trade.symbol, trade);
 }
 
 void BinanceWS::handleOHLCV(const nlohmann::json& data) {
@@ -267,7 +387,16 @@ void BinanceWS::handleOHLCV(const nlohmann::json& data) {
     ohlcv.close = std::stod(k["c"].get<std::string>());
     ohlcv.volume = std::stod(k["v"].get<std::string>());
 
-    //exchange_.emitOHLCV(ohlcv);
+    const std::string& marketId = data["s"].get_ref<const std::string&>();
+    auto& byInterval = ohlcvs_[marketId];
+    const std::string& interval = k["i"].get_ref<const std::string&>();
+    auto cache = byInterval.find(interval);
+    if (cache == byInterval.end()) {
+        cache = byInterval.emplace(interval, ArrayCacheByTimestamp<OHLCV>(limit("OHLCVLimit"))).first;
+    }
+    cache->second.append(ohlcv);
+    // One stream per interval, so candles get the interval in their topic
+    emit(marketId + "@" + interval, ohlcv);
 }
 
 void BinanceWS::handleMarkPrice(const nlohmann::json& data) {
@@ -279,9 +408,9 @@ void BinanceWS::handleMarkPrice(const nlohmann::json& data) {
         markPrice.fundingRate = data.contains("r") ? std::stod(data["r"].get<std::string>()) : 0.0;
         markPrice.nextFundingTime = data.contains("T") ? data["T"].get<uint64_t>() : 0;
 
-        //exchange_.emitMarkPrice(markPrice);
+        emit(markPrice.symbol, markPrice);
     } catch (const std::exception& e) {
-        std::cerr << "Error handling mark price: " << e.what() << std::endl;
+        CCXT_LOG_ERROR("Error handling mark price: " << e.what());
     }
 }
 
@@ -294,17 +423,19 @@ void BinanceWS::handleBalance(const nlohmann::json& data) {
         balance.total = balance.free + balance.used;
         balance.timestamp = data["E"].get<uint64_t>();
 
-        //exchange_.emitBalance(balance);
+        emit(balance.currency, balance);
     } catch (const std::exception& e) {
-        std::cerr << "Error handling balance: " << e.what() << std::endl;
+        CCXT_LOG_ERROR("Error handling balance: " << e.what());
     }
 }
 
 void BinanceWS::handleOrder(const nlohmann::json& data) {
     try {
         Order order;
-        order.id = data["i"].get<std::string>();
-        order.clientOrderId = data["c"].get<std::string>();
+        order.id = std::to_string(data["i"].get<long long>());
+        // On a cancel "c" is the cancel request's id and "C" the order's own
+        const bool canceled = data.contains("C") && data["C"].is_string() && !data["C"].get_ref<const std::string&>().empty();
+        order.clientOrderId = data[canceled ? "C" : "c"].get<std::string>();
         order.symbol = data["s"].get<std::string>();
         order.side = data["S"].get<std::string>();
         order.type = data["o"].get<std::string>();
@@ -315,17 +446,27 @@ void BinanceWS::handleOrder(const nlohmann::json& data) {
         order.status = data["X"].get<std::string>();
         order.timestamp = data["E"].get<uint64_t>();
 
-        //exchange_.emitOrder(order);
+        orders_.append(order);
+        emit(order.symbol, order);
+
+        // The tracker is keyed by unified symbol, like the REST snapshots
+        Order tracked = order;
+        try {
+            tracked.symbol = exchange_.symbol(order.symbol);
+        } catch (const ExchangeError&) {
+            // Markets not loaded yet: keep the market id
+        }
+        exchange_.orders().apply(tracked);
     } catch (const std::exception& e) {
-        std::cerr << "Error handling order: " << e.what() << std::endl;
+        CCXT_LOG_ERROR("Error handling order: " << e.what());
     }
 }
 
 void BinanceWS::handleMyTrade(const nlohmann::json& data) {
     try {
-        Trade trade;
-        trade.id = data["t"].get<std::string>();
-        trade.orderId = data["i"].get<std::string>();
+        MyTrade trade;
+        trade.id = std::to_string(data["t"].get<long long>());
+        trade.orderId = std::to_string(data["i"].get<long long>());
         trade.symbol = data["s"].get<std::string>();
         trade.side = data["S"].get<std::string>();
         trade.price = std::stod(data["p"].get<std::string>());
@@ -335,9 +476,10 @@ void BinanceWS::handleMyTrade(const nlohmann::json& data) {
         trade.feeCurrency = data["N"].get<std::string>();
         trade.timestamp = data["E"].get<uint64_t>();
 
-        //exchange_.emitMyTrade(trade);
+        myTrades_.append(trade);
+        emit(trade.symbol, trade);
     } catch (const std::exception& e) {
-        std::cerr << "Error handling my trade: " << e.what() << std::endl;
+        CCXT_LOG_ERROR("Error handling my trade: " << e.what());
     }
 }
 
@@ -353,9 +495,9 @@ void BinanceWS::handlePosition(const nlohmann::json& data) {
         position.marginType = data["mt"].get<std::string>();
         position.timestamp = data["E"].get<uint64_t>();
 
-        //exchange_.emitPosition(position);
+        emit(position.symbol, position);
     } catch (const std::exception& e) {
-        std::cerr << "Error handling position: " << e.what() << std::endl;
+        CCXT_LOG_ERROR("Error handling position: " << e.what());
     }
 }
 
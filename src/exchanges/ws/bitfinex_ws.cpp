@@ -1,4 +1,5 @@
 #include "../../../include/ccxt/exchanges/ws/bitfinex_ws.h"
+#include "../../../include/ccxt/base/logger.h"
 #include <nlohmann/json.hpp>
 #include <iostream>
 #include <sstream>
@@ -186,9 +187,9 @@ void BitfinexWS::handleMessage(const std::string& message) {
                 } else if (event == "auth") {
                     if (j["status"] == "OK") {
                         authenticated_ = true;
-                        std::cout << "Successfully authenticated" << std::endl;
+                        CCXT_LOG_DEBUG("Successfully authenticated");
                     } else {
-                        std::cerr << "Authentication failed: " << j["message"] << std::endl;
+                        CCXT_LOG_ERROR("Authentication failed: " << j["message"]);
                     }
                 } else if (event == "error") {
                     handleError(j);
@@ -222,7 +223,7 @@ void BitfinexWS::handleMessage(const std::string& message) {
             }
         }
     } catch (const std::exception& e) {
-        std::cerr << "Error handling message: " << e.what() << std::endl;
+        CCXT_LOG_ERROR("Error handling message: " << e.what());
     }
 }
 
@@ -247,7 +248,7 @@ void BitfinexWS::handleTicker(int channelId, const nlohmann::json& data) {
         
         exchange_.emitTicker(ticker);
     } catch (const std::exception& e) {
-        std::cerr << "Error handling ticker: " << e.what() << std::endl;
+        CCXT_LOG_ERROR("Error handling ticker: " << e.what());
     }
 }
 
@@ -285,7 +286,7 @@ void BitfinexWS::handleOrderBook(int channelId, const nlohmann::json& data) {
         
         exchange_.emitOrderBook(orderBook);
     } catch (const std::exception& e) {
-        std::cerr << "Error handling order book: " << e.what() << std::endl;
+        CCXT_LOG_ERROR("Error handling order book: " << e.what());
     }
 }
 
@@ -305,7 +306,7 @@ void BitfinexWS::handleTrade(int channelId, const nlohmann::json& data) {
             exchange_.emitTrade(trade);
         }
     } catch (const std::exception& e) {
-        std::cerr << "Error handling trade: " << e.what() << std::endl;
+        CCXT_LOG_ERROR("Error handling trade: " << e.what());
     }
 }
 
@@ -324,7 +325,7 @@ void BitfinexWS::handleBalance(int channelId, const nlohmann::json& data) {
             exchange_.emitBalance(balance);
         }
     } catch (const std::exception& e) {
-        std::cerr << "Error handling balance: " << e.what() << std::endl;
+        CCXT_LOG_ERROR("Error handling balance: " << e.what());
     }
 }
 
@@ -346,7 +347,7 @@ void BitfinexWS::handleOrder(int channelId, const nlohmann::json& data) {
             exchange_.emitOrder(order);
         }
     } catch (const std::exception& e) {
-        std::cerr << "Error handling order: " << e.what() << std::endl;
+        CCXT_LOG_ERROR("Error handling order: " << e.what());
     }
 }
 
@@ -369,7 +370,7 @@ void BitfinexWS::handleMyTrade(int channelId, const nlohmann::json& data) {
             exchange_.emitMyTrade(trade);
         }
     } catch (const std::exception& e) {
-        std::cerr << "Error handling my trade: " << e.what() << std::endl;
+        CCXT_LOG_ERROR("Error handling my trade: " << e.what());
     }
 }
 
@@ -386,14 +387,14 @@ void BitfinexWS::handleSubscribed(const nlohmann::json& data) {
         std::string channel = data["channel"];
         channelMap_[channelId] = channel;
         
-        std::cout << "Successfully subscribed to " << channel << " (Channel ID: " << channelId << ")" << std::endl;
+        CCXT_LOG_DEBUG("Successfully subscribed to " << channel << " (Channel ID: " << channelId << ")");
     } catch (const std::exception& e) {
-        std::cerr << "Error handling subscription: " << e.what() << std::endl;
+        CCXT_LOG_ERROR("Error handling subscription: " << e.what());
     }
 }
 
 void BitfinexWS::handleError(const nlohmann::json& data) {
-    std::cerr << "Error: " << data["msg"] << std::endl;
+    CCXT_LOG_ERROR("Error: " << data["msg"]);
 }
 
 } // namespace ccxt
@@ -1,4 +1,5 @@
 #include "../../../include/ccxt/exchanges/ws/bybit_ws.h"
+#include "../../../include/ccxt/base/logger.h"
 #include <nlohmann/json.hpp>
 #include <iostream>
 #include <sstream>
@@ -173,9 +174,9 @@ void BybitWS::handleMessage(const std::string& message) {
         // Handle subscription responses
         if (j.contains("success")) {
             if (j["success"].get<bool>()) {
-                std::cout << "Successfully subscribed to topic" << std::endl;
+                CCXT_LOG_DEBUG("Successfully subscribed to topic");
             } else {
-                std::cerr << "Subscription failed: " << j["ret_msg"] << std::endl;
+                CCXT_LOG_ERROR("Subscription failed: " << j["ret_msg"]);
             }
             return;
         }
@@ -204,7 +205,7 @@ void BybitWS::handleMessage(const std::string& message) {
             }
         }
     } catch (const std::exception& e) {
-        std::cerr << "Error handling message: " << e.what() << std::endl;
+        CCXT_LOG_ERROR("Error handling message: " << e.what());
     }
 }
 
@@ -282,7 +283,7 @@ void BybitWS::handleBalance(const nlohmann::json& data) {
         
         exchange_.emitBalance(balance);
     } catch (const std::exception& e) {
-        std::cerr << "Error handling balance: " << e.what() << std::endl;
+        CCXT_LOG_ERROR("Error handling balance: " << e.what());
     }
 }
 
@@ -302,7 +303,7 @@ void BybitWS::handleOrder(const nlohmann::json& data) {
         
         exchange_.emitOrder(order);
     } catch (const std::exception& e) {
-        std::cerr << "Error handling order: " << e.what() << std::endl;
+        CCXT_LOG_ERROR("Error handling order: " << e.what());
     }
 }
 
@@ -322,7 +323,7 @@ void BybitWS::handleMyTrade(const nlohmann::json& data) {
         
         exchange_.emitMyTrade(trade);
     } catch (const std::exception& e) {
-        std::cerr << "Error handling my trade: " << e.what() << std::endl;
+        CCXT_LOG_ERROR("Error handling my trade: " << e.what());
     }
 }
 
@@ -340,7 +341,7 @@ void BybitWS::handlePosition(const nlohmann::json& data) {
         
         exchange_.emitPosition(position);
     } catch (const std::exception& e) {
-        std::cerr << "Error handling position: " << e.what() << std::endl;
+        CCXT_LOG_ERROR("Error handling position: " << e.what());
     }
 }
 
@@ -1,4 +1,5 @@
 #include "ccxt/exchanges/ws/coinbase_ws.h"
+#include "ccxt/base/logger.h"
 #include "ccxt/base/json.hpp"
 #include <boost/beast/core.hpp>
 #include <boost/beast/ssl.hpp>
@@ -121,7 +122,7 @@ void CoinbaseWS::handleMessage(const std::string& message) {
             }
         }
     } catch (const std::exception& e) {
-        std::cerr << "Error handling message: " << e.what() << std::endl;
+        CCXT_LOG_ERROR("Error handling message: " << e.what());
     }
 }
 
@@ -1,4 +1,5 @@
 #include "ccxt/exchanges/ws/gate_ws.h"
+#include "ccxt/base/logger.h"
 #include "ccxt/base/json.hpp"
 #include <boost/beast/core.hpp>
 #include <boost/beast/ssl.hpp>
@@ -239,7 +240,7 @@ void GateWS::handleMessage(const std::string& message) {
             }
         }
     } catch (const std::exception& e) {
-        std::cerr << "Error handling message: " << e.what() << std::endl;
+        CCXT_LOG_ERROR("Error handling message: " << e.what());
     }
 }
 
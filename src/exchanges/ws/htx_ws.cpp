@@ -1,4 +1,5 @@
 #include "../../../include/ccxt/exchanges/ws/htx_ws.h"
+#include "../../../include/ccxt/base/logger.h"
 #include <nlohmann/json.hpp>
 #include <iostream>
 #include <sstream>
@@ -176,9 +177,9 @@ void HTXWS::handleMessage(const std::string& message) {
         if (j.contains("action") && j["action"] == "req" && j.contains("ch") && j["ch"] == "auth") {
             if (j["code"].get<int>() == 200) {
                 authenticated_ = true;
-                std::cout << "Successfully authenticated" << std::endl;
+                CCXT_LOG_DEBUG("Successfully authenticated");
             } else {
-                std::cerr << "Authentication failed: " << j["message"] << std::endl;
+                CCXT_LOG_ERROR("Authentication failed: " << j["message"]);
             }
             return;
         }
@@ -186,9 +187,9 @@ void HTXWS::handleMessage(const std::string& message) {
         // Handle subscription responses
         if (j.contains("subbed")) {
             if (j.contains("status") && j["status"] == "ok") {
-                std::cout << "Successfully subscribed to " << j["subbed"] << std::endl;
+                CCXT_LOG_DEBUG("Successfully subscribed to " << j["subbed"]);
             } else {
-                std::cerr << "Subscription failed: " << j["subbed"] << std::endl;
+                CCXT_LOG_ERROR("Subscription failed: " << j["subbed"]);
             }
             return;
         }
@@ -217,7 +218,7 @@ void HTXWS::handleMessage(const std::string& message) {
             }
         }
     } catch (const std::exception& e) {
-        std::cerr << "Error handling message: " << e.what() << std::endl;
+        CCXT_LOG_ERROR("Error handling message: " << e.what());
     }
 }
 
@@ -302,7 +303,7 @@ void HTXWS::handleBalance(const nlohmann::json& data) {
         
         exchange_.emitBalance(balance);
     } catch (const std::exception& e) {
-        std::cerr << "Error handling balance: " << e.what() << std::endl;
+        CCXT_LOG_ERROR("Error handling balance: " << e.what());
     }
 }
 
@@ -322,7 +323,7 @@ void HTXWS::handleOrder(const nlohmann::json& data) {
         
         exchange_.emitOrder(order);
     } catch (const std::exception& e) {
-        std::cerr << "Error handling order: " << e.what() << std::endl;
+        CCXT_LOG_ERROR("Error handling order: " << e.what());
     }
 }
 
@@ -342,7 +343,7 @@ void HTXWS::handleMyTrade(const nlohmann::json& data) {
         
         exchange_.emitMyTrade(trade);
     } catch (const std::exception& e) {
-        std::cerr << "Error handling my trade: " << e.what() << std::endl;
+        CCXT_LOG_ERROR("Error handling my trade: " << e.what());
     }
 }
 
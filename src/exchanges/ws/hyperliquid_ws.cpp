@@ -1,4 +1,5 @@
 #include "../../../include/ccxt/exchanges/ws/hyperliquid_ws.h"
+#include "../../../include/ccxt/base/logger.h"
 #include <nlohmann/json.hpp>
 #include <iostream>
 #include <sstream>
@@ -186,9 +187,9 @@ void HyperliquidWS::handleMessage(const std::string& message) {
         if (j.contains("op") && j["op"] == "auth") {
             if (j["success"].get<bool>()) {
                 authenticated_ = true;
-                std::cout << "Successfully authenticated" << std::endl;
+                CCXT_LOG_DEBUG("Successfully authenticated");
             } else {
-                std::cerr << "Authentication failed: " << j["message"] << std::endl;
+                CCXT_LOG_ERROR("Authentication failed: " << j["message"]);
             }
             return;
         }
@@ -196,9 +197,9 @@ void HyperliquidWS::handleMessage(const std::string& message) {
         // Handle subscription responses
         if (j.contains("op") && j["op"] == "subscribe") {
             if (j["success"].get<bool>()) {
-                std::cout << "Successfully subscribed to " << j["channel"] << std::endl;
+                CCXT_LOG_DEBUG("Successfully subscribed to " << j["channel"]);
             } else {
-                std::cerr << "Subscription failed: " << j["message"] << std::endl;
+                CCXT_LOG_ERROR("Subscription failed: " << j["message"]);
             }
             return;
         }
@@ -231,7 +232,7 @@ void HyperliquidWS::handleMessage(const std::string& message) {
             }
         }
     } catch (const std::exception& e) {
-        std::cerr << "Error handling message: " << e.what() << std::endl;
+        CCXT_LOG_ERROR("Error handling message: " << e.what());
     }
 }
 
@@ -249,7 +250,7 @@ void HyperliquidWS::handleTicker(const nlohmann::json& data) {
         
         exchange_.emitTicker(ticker);
     } catch (const std::exception& e) {
-        std::cerr << "Error handling ticker: " << e.what() << std::endl;
+        CCXT_LOG_ERROR("Error handling ticker: " << e.what());
     }
 }
 
@@ -278,7 +279,7 @@ void HyperliquidWS::handleOrderBook(const nlohmann::json& data) {
         
         exchange_.emitOrderBook(orderBook);
     } catch (const std::exception& e) {
-        std::cerr << "Error handling order book: " << e.what() << std::endl;
+        CCXT_LOG_ERROR("Error handling order book: " << e.what());
     }
 }
 
@@ -294,7 +295,7 @@ void HyperliquidWS::handleTrade(const nlohmann::json& data) {
         
         exchange_.emitTrade(trade);
     } catch (const std::exception& e) {
-        std::cerr << "Error handling trade: " << e.what() << std::endl;
+        CCXT_LOG_ERROR("Error handling trade: " << e.what());
     }
 }
 
@@ -310,7 +311,7 @@ void HyperliquidWS::handleOHLCV(const nlohmann::json& data) {
         
         exchange_.emitOHLCV(ohlcv);
     } catch (const std::exception& e) {
-        std::cerr << "Error handling OHLCV: " << e.what() << std::endl;
+        CCXT_LOG_ERROR("Error handling OHLCV: " << e.what());
     }
 }
 
@@ -319,7 +320,7 @@ void HyperliquidWS::handleMarkPrice(const nlohmann::json& data) {
         // Implementation depends on exchange-specific data structure
         // Emit mark price update event
     } catch (const std::exception& e) {
-        std::cerr << "Error handling mark price: " << e.what() << std::endl;
+        CCXT_LOG_ERROR("Error handling mark price: " << e.what());
     }
 }
 
@@ -328,7 +329,7 @@ void HyperliquidWS::handleFundingRate(const nlohmann::json& data) {
         // Implementation depends on exchange-specific data structure
         // Emit funding rate update event
     } catch (const std::exception& e) {
-        std::cerr << "Error handling funding rate: " << e.what() << std::endl;
+        CCXT_LOG_ERROR("Error handling funding rate: " << e.what());
     }
 }
 
@@ -343,7 +344,7 @@ void HyperliquidWS::handleBalance(const nlohmann::json& data) {
         
         exchange_.emitBalance(balance);
     } catch (const std::exception& e) {
-        std::cerr << "Error handling balance: " << e.what() << std::endl;
+        CCXT_LOG_ERROR("Error handling balance: " << e.what());
     }
 }
 
@@ -363,7 +364,7 @@ void HyperliquidWS::handleOrder(const nlohmann::json& data) {
         
         exchange_.emitOrder(order);
     } catch (const std::exception& e) {
-        std::cerr << "Error handling order: " << e.what() << std::endl;
+        CCXT_LOG_ERROR("Error handling order: " << e.what());
     }
 }
 
@@ -372,7 +373,7 @@ void HyperliquidWS::handlePosition(const nlohmann::json& data) {
         // Implementation depends on exchange-specific data structure
         // Emit position update event
     } catch (const std::exception& e) {
-        std::cerr << "Error handling position: " << e.what() << std::endl;
+        CCXT_LOG_ERROR("Error handling position: " << e.what());
     }
 }
 
@@ -381,7 +382,7 @@ void HyperliquidWS::handleLeverage(const nlohmann::json& data) {
         // Implementation depends on exchange-specific data structure
         // Emit leverage update event
     } catch (const std::exception& e) {
-        std::cerr << "Error handling leverage: " << e.what() << std::endl;
+        CCXT_LOG_ERROR("Error handling leverage: " << e.what());
     }
 }
 
@@ -1,4 +1,5 @@
 #include "../../../include/ccxt/exchanges/ws/idex_ws.h"
+#include "../../../include/ccxt/base/logger.h"
 #include <nlohmann/json.hpp>
 #include <iostream>
 #include <sstream>
@@ -194,9 +195,9 @@ void IDEXWS::handleMessage(const std::string& message) {
         if (j.contains("method") && j["method"] == "authenticate") {
             if (j["result"] == "success") {
                 authenticated_ = true;
-                std::cout << "Successfully authenticated" << std::endl;
+                CCXT_LOG_DEBUG("Successfully authenticated");
             } else {
-                std::cerr << "Authentication failed: " << j["error"]["message"] << std::endl;
+                CCXT_LOG_ERROR("Authentication failed: " << j["error"]["message"]);
             }
             return;
         }
@@ -204,9 +205,9 @@ void IDEXWS::handleMessage(const std::string& message) {
         // Handle subscription responses
         if (j.contains("method") && j["method"] == "subscribe") {
             if (j["result"] == "success") {
-                std::cout << "Successfully subscribed to " << j["params"]["channel"] << std::endl;
+                CCXT_LOG_DEBUG("Successfully subscribed to " << j["params"]["channel"]);
             } else {
-                std::cerr << "Subscription failed: " << j["error"]["message"] << std::endl;
+                CCXT_LOG_ERROR("Subscription failed: " << j["error"]["message"]);
             }
             return;
         }
@@ -237,7 +238,7 @@ void IDEXWS::handleMessage(const std::string& message) {
             }
         }
     } catch (const std::exception& e) {
-        std::cerr << "Error handling message: " << e.what() << std::endl;
+        CCXT_LOG_ERROR("Error handling message: " << e.what());
     }
 }
 
@@ -256,7 +257,7 @@ void IDEXWS::handleTicker(const nlohmann::json& data) {
         
         exchange_.emitTicker(ticker);
     } catch (const std::exception& e) {
-        std::cerr << "Error handling ticker: " << e.what() << std::endl;
+        CCXT_LOG_ERROR("Error handling ticker: " << e.what());
     }
 }
 
@@ -289,7 +290,7 @@ void IDEXWS::handleOrderBook(const nlohmann::json& data) {
         
         exchange_.emitOrderBook(orderBook);
     } catch (const std::exception& e) {
-        std::cerr << "Error handling order book: " << e.what() << std::endl;
+        CCXT_LOG_ERROR("Error handling order book: " << e.what());
     }
 }
 
@@ -313,7 +314,7 @@ void IDEXWS::handleTrade(const nlohmann::json& data) {
         
         exchange_.emitTrade(trade);
     } catch (const std::exception& e) {
-        std::cerr << "Error handling trade: " << e.what() << std::endl;
+        CCXT_LOG_ERROR("Error handling trade: " << e.what());
     }
 }
 
@@ -329,25 +330,25 @@ void IDEXWS::handleOHLCV(const nlohmann::json& data) {
         
         exchange_.emitOHLCV(ohlcv);
     } catch (const std::exception& e) {
-        std::cerr << "Error handling OHLCV: " << e.what() << std::endl;
+        CCXT_LOG_ERROR("Error handling OHLCV: " << e.what());
     }
 }
 
 void IDEXWS::handleStatus(const nlohmann::json& data) {
     try {
         // Handle exchange status updates
-        std::cout << "Exchange status: " << data["status"].get<std::string>() << std::endl;
+        CCXT_LOG_DEBUG("Exchange status: " << data["status"].get<std::string>());
     } catch (const std::exception& e) {
-        std::cerr << "Error handling status: " << e.what() << std::endl;
+        CCXT_LOG_ERROR("Error handling status: " << e.what());
     }
 }
 
 void IDEXWS::handleTime(const nlohmann::json& data) {
     try {
         // Handle server time updates
-        std::cout << "Server time: " << data["timestamp"].get<uint64_t>() << std::endl;
+        CCXT_LOG_DEBUG("Server time: " << data["timestamp"].get<uint64_t>());
     } catch (const std::exception& e) {
-        std::cerr << "Error handling time: " << e.what() << std::endl;
+        CCXT_LOG_ERROR("Error handling time: " << e.what());
     }
 }
 
@@ -362,7 +363,7 @@ void IDEXWS::handleBalance(const nlohmann::json& data) {
         
         exchange_.emitBalance(balance);
     } catch (const std::exception& e) {
-        std::cerr << "Error handling balance: " << e.what() << std::endl;
+        CCXT_LOG_ERROR("Error handling balance: " << e.what());
     }
 }
 
@@ -390,7 +391,7 @@ void IDEXWS::handleOrder(const nlohmann::json& data) {
         
         exchange_.emitOrder(order);
     } catch (const std::exception& e) {
-        std::cerr << "Error handling order: " << e.what() << std::endl;
+        CCXT_LOG_ERROR("Error handling order: " << e.what());
     }
 }
 
@@ -416,7 +417,7 @@ void IDEXWS::handleMyTrade(const nlohmann::json& data) {
         
         exchange_.emitMyTrade(trade);
     } catch (const std::exception& e) {
-        std::cerr << "Error handling my trade: " << e.what() << std::endl;
+        CCXT_LOG_ERROR("Error handling my trade: " << e.what());
     }
 }
 
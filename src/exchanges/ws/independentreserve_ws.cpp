@@ -1,4 +1,5 @@
 #include "../../../include/ccxt/exchanges/ws/independentreserve_ws.h"
+#include "../../../include/ccxt/base/logger.h"
 #include <nlohmann/json.hpp>
 #include <iostream>
 #include <sstream>
@@ -208,7 +209,7 @@ void IndependentReserveWS::handleMessage(const std::string& message) {
             }
         }
     } catch (const std::exception& e) {
-        std::cerr << "Error handling message: " << e.what() << std::endl;
+        CCXT_LOG_ERROR("Error handling message: " << e.what());
     }
 }
 
@@ -221,18 +222,18 @@ void IndependentReserveWS::handleHeartbeat() {
 
 void IndependentReserveWS::handleSubscriptionResponse(const nlohmann::json& data) {
     if (data["success"].get<bool>()) {
-        std::cout << "Successfully subscribed to " << data["data"]["channel"] << std::endl;
+        CCXT_LOG_DEBUG("Successfully subscribed to " << data["data"]["channel"]);
     } else {
-        std::cerr << "Subscription failed: " << data["error"]["message"] << std::endl;
+        CCXT_LOG_ERROR("Subscription failed: " << data["error"]["message"]);
     }
 }
 
 void IndependentReserveWS::handleAuthenticationResponse(const nlohmann::json& data) {
     if (data["success"].get<bool>()) {
         authenticated_ = true;
-        std::cout << "Successfully authenticated" << std::endl;
+        CCXT_LOG_DEBUG("Successfully authenticated");
     } else {
-        std::cerr << "Authentication failed: " << data["error"]["message"] << std::endl;
+        CCXT_LOG_ERROR("Authentication failed: " << data["error"]["message"]);
     }
 }
 
@@ -248,7 +249,7 @@ void IndependentReserveWS::handleTicker(const nlohmann::json& data) {
         
         exchange_.emitTicker(ticker);
     } catch (const std::exception& e) {
-        std::cerr << "Error handling ticker: " << e.what() << std::endl;
+        CCXT_LOG_ERROR("Error handling ticker: " << e.what());
     }
 }
 
@@ -277,7 +278,7 @@ void IndependentReserveWS::handleOrderBook(const nlohmann::json& data) {
         
         exchange_.emitOrderBook(orderBook);
     } catch (const std::exception& e) {
-        std::cerr << "Error handling order book: " << e.what() << std::endl;
+        CCXT_LOG_ERROR("Error handling order book: " << e.what());
     }
 }
 
@@ -301,15 +302,15 @@ void IndependentReserveWS::handleTrade(const nlohmann::json& data) {
         
         exchange_.emitTrade(trade);
     } catch (const std::exception& e) {
-        std::cerr << "Error handling trade: " << e.what() << std::endl;
+        CCXT_LOG_ERROR("Error handling trade: " << e.what());
     }
 }
 
 void IndependentReserveWS::handleStatus(const nlohmann::json& data) {
     try {
-        std::cout << "Exchange status: " << data["status"].get<std::string>() << std::endl;
+        CCXT_LOG_DEBUG("Exchange status: " << data["status"].get<std::string>());
     } catch (const std::exception& e) {
-        std::cerr << "Error handling status: " << e.what() << std::endl;
+        CCXT_LOG_ERROR("Error handling status: " << e.what());
     }
 }
 
@@ -324,7 +325,7 @@ void IndependentReserveWS::handleBalance(const nlohmann::json& data) {
         
         exchange_.emitBalance(balance);
     } catch (const std::exception& e) {
-        std::cerr << "Error handling balance: " << e.what() << std::endl;
+        CCXT_LOG_ERROR("Error handling balance: " << e.what());
     }
 }
 
@@ -351,7 +352,7 @@ void IndependentReserveWS::handleOrder(const nlohmann::json& data) {
         
         exchange_.emitOrder(order);
     } catch (const std::exception& e) {
-        std::cerr << "Error handling order: " << e.what() << std::endl;
+        CCXT_LOG_ERROR("Error handling order: " << e.what());
     }
 }
 
@@ -1,4 +1,5 @@
 #include "../../../include/ccxt/exchanges/ws/kraken_ws.h"
+#include "../../../include/ccxt/base/logger.h"
 #include <nlohmann/json.hpp>
 #include <iostream>
 #include <sstream>
@@ -233,9 +234,9 @@ void KrakenWS::handleMessage(const std::string& message) {
             
             if (event == "subscriptionStatus") {
                 if (j["status"] == "subscribed") {
-                    std::cout << "Successfully subscribed to " << j["subscription"]["name"] << std::endl;
+                    CCXT_LOG_DEBUG("Successfully subscribed to " << j["subscription"]["name"]);
                 } else {
-                    std::cerr << "Subscription failed: " << j["errorMessage"] << std::endl;
+                    CCXT_LOG_ERROR("Subscription failed: " << j["errorMessage"]);
                 }
                 return;
             } else if (event == "addOrderStatus") {
@@ -273,7 +274,7 @@ void KrakenWS::handleMessage(const std::string& message) {
             }
         }
     } catch (const std::exception& e) {
-        std::cerr << "Error handling message: " << e.what() << std::endl;
+        CCXT_LOG_ERROR("Error handling message: " << e.what());
     }
 }
 
@@ -292,7 +293,7 @@ void KrakenWS::handleTicker(const nlohmann::json& data) {
         
         exchange_.emitTicker(ticker);
     } catch (const std::exception& e) {
-        std::cerr << "Error handling ticker: " << e.what() << std::endl;
+        CCXT_LOG_ERROR("Error handling ticker: " << e.what());
     }
 }
 
@@ -321,7 +322,7 @@ void KrakenWS::handleOrderBook(const nlohmann::json& data) {
         
         exchange_.emitOrderBook(orderBook);
     } catch (const std::exception& e) {
-        std::cerr << "Error handling order book: " << e.what() << std::endl;
+        CCXT_LOG_ERROR("Error handling order book: " << e.what());
     }
 }
 
@@ -339,7 +340,7 @@ void KrakenWS::handleTrade(const nlohmann::json& data) {
             exchange_.emitTrade(trade);
         }
     } catch (const std::exception& e) {
-        std::cerr << "Error handling trade: " << e.what() << std::endl;
+        CCXT_LOG_ERROR("Error handling trade: " << e.what());
     }
 }
 
@@ -355,7 +356,7 @@ void KrakenWS::handleOHLCV(const nlohmann::json& data) {
         
         exchange_.emitOHLCV(ohlcv);
     } catch (const std::exception& e) {
-        std::cerr << "Error handling OHLCV: " << e.what() << std::endl;
+        CCXT_LOG_ERROR("Error handling OHLCV: " << e.what());
     }
 }
 
@@ -372,7 +373,7 @@ void KrakenWS::handleBalance(const nlohmann::json& data) {
             exchange_.emitBalance(balance);
         }
     } catch (const std::exception& e) {
-        std::cerr << "Error handling balance: " << e.what() << std::endl;
+        CCXT_LOG_ERROR("Error handling balance: " << e.what());
     }
 }
 
@@ -394,7 +395,7 @@ void KrakenWS::handleOrder(const nlohmann::json& data) {
             exchange_.emitOrder(order);
         }
     } catch (const std::exception& e) {
-        std::cerr << "Error handling order: " << e.what() << std::endl;
+        CCXT_LOG_ERROR("Error handling order: " << e.what());
     }
 }
 
@@ -416,19 +417,19 @@ void KrakenWS::handleMyTrade(const nlohmann::json& data) {
             exchange_.emitMyTrade(trade);
         }
     } catch (const std::exception& e) {
-        std::cerr << "Error handling my trade: " << e.what() << std::endl;
+        CCXT_LOG_ERROR("Error handling my trade: " << e.what());
     }
 }
 
 void KrakenWS::handleOrderResponse(const nlohmann::json& data) {
     try {
         if (data["status"] == "ok") {
-            std::cout << "Order operation successful: " << data["txid"][0] << std::endl;
+            CCXT_LOG_DEBUG("Order operation successful: " << data["txid"][0]);
         } else {
-            std::cerr << "Order operation failed: " << data["errorMessage"] << std::endl;
+            CCXT_LOG_ERROR("Order operation failed: " << data["errorMessage"]);
         }
     } catch (const std::exception& e) {
-        std::cerr << "Error handling order response: " << e.what() << std::endl;
+        CCXT_LOG_ERROR("Error handling order response: " << e.what());
     }
 }
 
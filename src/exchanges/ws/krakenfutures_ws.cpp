@@ -1,4 +1,5 @@
 #include "../../../include/ccxt/exchanges/ws/krakenfutures_ws.h"
+#include "../../../include/ccxt/base/logger.h"
 #include <nlohmann/json.hpp>
 #include <iostream>
 #include <sstream>
@@ -257,16 +258,16 @@ void KrakenFuturesWS::handleMessage(const std::string& message) {
         if (j.contains("event") && j["event"] == "auth") {
             if (j["success"].get<bool>()) {
                 authenticated_ = true;
-                std::cout << "Successfully authenticated" << std::endl;
+                CCXT_LOG_DEBUG("Successfully authenticated");
             } else {
-                std::cerr << "Authentication failed: " << j["message"] << std::endl;
+                CCXT_LOG_ERROR("Authentication failed: " << j["message"]);
             }
             return;
         }
 
         // Handle subscription responses
         if (j.contains("event") && j["event"] == "subscribed") {
-            std::cout << "Successfully subscribed to " << j["feed"] << std::endl;
+            CCXT_LOG_DEBUG("Successfully subscribed to " << j["feed"]);
             return;
         }
 
@@ -297,7 +298,7 @@ void KrakenFuturesWS::handleMessage(const std::string& message) {
             }
         }
     } catch (const std::exception& e) {
-        std::cerr << "Error handling message: " << e.what() << std::endl;
+        CCXT_LOG_ERROR("Error handling message: " << e.what());
     }
 }
 
@@ -315,7 +316,7 @@ void KrakenFuturesWS::handleTicker(const nlohmann::json& data) {
 
         exchange_.emitTicker(ticker);
     } catch (const std::exception& e) {
-        std::cerr << "Error handling ticker: " << e.what() << std::endl;
+        CCXT_LOG_ERROR("Error handling ticker: " << e.what());
     }
 }
 
@@ -345,7 +346,7 @@ void KrakenFuturesWS::handleOrderBook(const nlohmann::json& data) {
 
         exchange_.emitOrderBook(orderBook);
     } catch (const std::exception& e) {
-        std::cerr << "Error handling order book: " << e.what() << std::endl;
+        CCXT_LOG_ERROR("Error handling order book: " << e.what());
     }
 }
 
@@ -362,7 +363,7 @@ void KrakenFuturesWS::handleTrade(const nlohmann::json& data) {
 
         exchange_.emitTrade(trade);
     } catch (const std::exception& e) {
-        std::cerr << "Error handling trade: " << e.what() << std::endl;
+        CCXT_LOG_ERROR("Error handling trade: " << e.what());
     }
 }
 
@@ -378,7 +379,7 @@ void KrakenFuturesWS::handleOHLCV(const nlohmann::json& data) {
 
         exchange_.emitOHLCV(ohlcv);
     } catch (const std::exception& e) {
-        std::cerr << "Error handling OHLCV: " << e.what() << std::endl;
+        CCXT_LOG_ERROR("Error handling OHLCV: " << e.what());
     }
 }
 
@@ -391,7 +392,7 @@ void KrakenFuturesWS::handleMarkPrice(const nlohmann::json& data) {
 
         exchange_.emitMarkPrice(markPrice);
     } catch (const std::exception& e) {
-        std::cerr << "Error handling mark price: " << e.what() << std::endl;
+        CCXT_LOG_ERROR("Error handling mark price: " << e.what());
     }
 }
 
@@ -405,7 +406,7 @@ void KrakenFuturesWS::handleFundingRate(const nlohmann::json& data) {
 
         exchange_.emitFundingRate(fundingRate);
     } catch (const std::exception& e) {
-        std::cerr << "Error handling funding rate: " << e.what() << std::endl;
+        CCXT_LOG_ERROR("Error handling funding rate: " << e.what());
     }
 }
 
@@ -422,7 +423,7 @@ void KrakenFuturesWS::handleBalance(const nlohmann::json& data) {
             exchange_.emitBalance(balance);
         }
     } catch (const std::exception& e) {
-        std::cerr << "Error handling balance: " << e.what() << std::endl;
+        CCXT_LOG_ERROR("Error handling balance: " << e.what());
     }
 }
 
@@ -449,7 +450,7 @@ void KrakenFuturesWS::handleOrder(const nlohmann::json& data) {
 
         exchange_.emitOrder(order);
     } catch (const std::exception& e) {
-        std::cerr << "Error handling order: " << e.what() << std::endl;
+        CCXT_LOG_ERROR("Error handling order: " << e.what());
     }
 }
 
@@ -475,7 +476,7 @@ void KrakenFuturesWS::handleMyTrade(const nlohmann::json& data) {
 
         exchange_.emitMyTrade(trade);
     } catch (const std::exception& e) {
-        std::cerr << "Error handling my trade: " << e.what() << std::endl;
+        CCXT_LOG_ERROR("Error handling my trade: " << e.what());
     }
 }
 
@@ -495,19 +496,19 @@ void KrakenFuturesWS::handlePosition(const nlohmann::json& data) {
 
         exchange_.emitPosition(position);
     } catch (const std::exception& e) {
-        std::cerr << "Error handling position: " << e.what() << std::endl;
+        CCXT_LOG_ERROR("Error handling position: " << e.what());
     }
 }
 
 void KrakenFuturesWS::handleOrderResponse(const nlohmann::json& data) {
     try {
         if (data["status"] == "success") {
-            std::cout << "Order operation successful: " << data["message"] << std::endl;
+            CCXT_LOG_DEBUG("Order operation successful: " << data["message"]);
         } else {
-            std::cerr << "Order operation failed: " << data["message"] << std::endl;
+            CCXT_LOG_ERROR("Order operation failed: " << data["message"]);
         }
     } catch (const std::exception& e) {
-        std::cerr << "Error handling order response: " << e.what() << std::endl;
+        CCXT_LOG_ERROR("Error handling order response: " << e.what());
     }
 }
 
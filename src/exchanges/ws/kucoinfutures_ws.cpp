@@ -1,4 +1,5 @@
 #include "../../../include/ccxt/exchanges/ws/kucoinfutures_ws.h"
+#include "../../../include/ccxt/base/logger.h"
 #include <nlohmann/json.hpp>
 #include <iostream>
 #include <sstream>
@@ -40,7 +41,7 @@ void KuCoinFuturesWS::negotiate(bool privateChannel) {
             }
         }
     } catch (const std::exception& e) {
-        std::cerr << "Error in negotiate: " << e.what() << std::endl;
+        CCXT_LOG_ERROR("Error in negotiate: " << e.what());
     }
 }
 
@@ -1,4 +1,5 @@
 #include "ccxt/exchanges/ws/mexc_ws.h"
+#include "ccxt/base/logger.h"
 #include "ccxt/base/json.hpp"
 #include <boost/beast/core.hpp>
 #include <boost/beast/ssl.hpp>
@@ -187,7 +188,7 @@ void MexcWS::handleMessage(const std::string& message) {
             return;
         }
     } catch (const std::exception& e) {
-        std::cerr << "Error handling message: " << e.what() << std::endl;
+        CCXT_LOG_ERROR("Error handling message: " << e.what());
     }
 }
 
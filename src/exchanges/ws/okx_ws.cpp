@@ -1,4 +1,5 @@
 #include "../../../include/ccxt/exchanges/ws/okx_ws.h"
+#include "../../../include/ccxt/base/logger.h"
 #include <nlohmann/json.hpp>
 #include <iostream>
 #include <sstream>
@@ -566,8 +567,7 @@ void OKXWS::handleOrderBook(const nlohmann::json& data, const std::string& symbo
             uint32_t receivedChecksum = book["checksum"].get<uint32_t>();
             
             if (calculatedChecksum != receivedChecksum) {
-                std::cerr << "Orderbook checksum mismatch for " << symbol << ". Expected: " 
-                         << receivedChecksum << ", Got: " << calculatedChecksum << std::endl;
+                CCXT_LOG_WARN("Orderbook checksum mismatch for " << symbol << ". Expected: " << receivedChecksum << ", Got: " << calculatedChecksum);
                 // Resubscribe to get a fresh snapshot
                 watchOrderBook(symbol, channel);
                 return;
@@ -1,11 +1,10 @@
 #include "../../include/ccxt/exchanges/zonda_ws.h"
+#include "../../include/ccxt/base/logger.h"
 
 namespace ccxt {
 
 ZondaWS::ZondaWS(boost::asio::io_context& ioc, boost::asio::ssl::context& ctx, Zonda& exchange)
-    : WebSocketClient(ioc, ctx), exchange_(exchange) {
-    setMessageHandler(std::bind(&ZondaWS::handleMessage, this, std::placeholders::_1));
-}
+    : WebSocketClient(ioc, ctx), exchange_(exchange) {}
 
 void ZondaWS::subscribeTicker(const std::string& symbol) {
     std::string message = "{\"action\": \"subscribe\", \"channel\": \"ticker\", \"symbol\": \"" + symbol + "\"}";
@@ -32,23 +31,23 @@ void ZondaWS::handleMessage(const std::string& message) {
     if (channel == "ticker") {
         // Handle ticker updates
         auto ticker = jsonMessage["data"];
-        std::cout << "Ticker update: " << ticker.dump() << std::endl;
+        CCXT_LOG_TRACE("Ticker update: " << ticker.dump());
         // Update exchange's ticker data
         exchange_.updateTicker(ticker);
     } else if (channel == "orderBook") {
         // Handle order book updates
         auto orderBook = jsonMessage["data"];
-        std::cout << "Order book update: " << orderBook.dump() << std::endl;
+        CCXT_LOG_TRACE("Order book update: " << orderBook.dump());
         // Update exchange's order book data
         exchange_.updateOrderBook(orderBook);
     } else if (channel == "trades") {
         // Handle trade updates
         auto trades = jsonMessage["data"];
-        std::cout << "Trade update: " << trades.dump() << std::endl;
+        CCXT_LOG_TRACE("Trade update: " << trades.dump());
         // Update exchange's trade data
         exchange_.updateTrades(trades);
     } else {
-        std::cout << "Unknown channel: " << channel << std::endl;
+        CCXT_LOG_DEBUG("Unknown channel: " << channel);
     }
 }
 
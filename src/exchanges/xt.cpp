@@ -1,4 +1,5 @@
 #include "ccxt/exchanges/xt.h"
+#include "ccxt/base/executor.h"
 #include "ccxt/error.h"
 #include <algorithm>
 
@@ -268,34 +269,34 @@ json Xt::fetchWithdrawals(const Nullable<std::string>& code, const long* since,
 }
 
 // Async Methods
-AsyncPullType Xt::createOrderAsync(const std::string& symbol, const std::string& type, const std::string& side,
+std::future<json> Xt::createOrderAsync(const std::string& symbol, const std::string& type, const std::string& side,
                                      const double& amount, const double& price, const json& params) {
-    return std::async(std::launch::async, [this, symbol, type, side, amount, price, params]() {
+    return Executor::shared().submit([this, symbol, type, side, amount, price, params]() {
         return this->createOrder(symbol, type, side, amount, price, params);
     });
 }
 
-AsyncPullType Xt::cancelOrderAsync(const std::string& id, const std::string& symbol, const json& params) {
-    return std::async(std::launch::async, [this, id, symbol, params]() {
+std::future<json> Xt::cancelOrderAsync(const std::string& id, const std::string& symbol, const json& params) {
+    return Executor::shared().submit([this, id, symbol, params]() {
         return this->cancelOrder(id, symbol, params);
     });
 }
 
-AsyncPullType Xt::fetchOrderAsync(const std::string& id, const std::string& symbol, const json& params) {
-    return std::async(std::launch::async, [this, id, symbol, params]() {
+std::future<json> Xt::fetchOrderAsync(const std::string& id, const std::string& symbol, const json& params) {
+    return Executor::shared().submit([this, id, symbol, params]() {
         return this->fetchOrder(id, symbol, params);
     });
 }
 
-AsyncPullType Xt::fetchOrdersAsync(const std::string& symbol, const long* since,
+std::future<json> Xt::fetchOrdersAsync(const std::string& symbol, const long* since,
                                      const long* limit, const json& params) {
-    return std::async(std::launch::async, [this, symbol, since, limit, params]() {
+    return Executor::shared().submit([this, symbol, since, limit, params]() {
         return this->fetchOrders(symbol, since, limit, params);
     });
 }
 
-AsyncPullType Xt::fetchBalanceAsync(const json& params) {
-    return std::async(std::launch::async, [this, params]() {
+std::future<json> Xt::fetchBalanceAsync(const json& params) {
+    return Executor::shared().submit([this, params]() {
         return this->fetchBalance(params);
     });
 }
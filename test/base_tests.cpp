@@ -1,7 +1,45 @@
 #include <gtest/gtest.h>
+#include <boost/asio/io_context.hpp>
 #include <ccxt/base/exchange.h>
 #include <ccxt/base/config.h>
+#include <ccxt/base/errors.h>
 #include <ccxt/exchanges/binance.h>
+#include <ccxt/base/path_template.h>
+#include <ccxt/base/query_builder.h>
+#include <ccxt/base/hmac_signer.h>
+#include <ccxt/base/datetime.h>
+#include <ccxt/base/dns_cache.h>
+#include <ccxt/base/executor.h>
+#include <ccxt/base/event_bus.h>
+#include <ccxt/base/array_cache.h>
+#include <ccxt/base/backfill.h>
+#include <ccxt/base/bbo_aggregator.h>
+#include <ccxt/base/candle_builder.h>
+#include <ccxt/base/clock_sync.h>
+#include <ccxt/base/market_store.h>
+#include <ccxt/base/offload.h>
+#include <ccxt/base/order_tracker.h>
+#include <ccxt/base/frame_recorder.h>
+#include <ccxt/base/frame_replay.h>
+#include <ccxt/base/histogram.h>
+#include <ccxt/base/logger.h>
+#include <ccxt/base/websocket_client.h>
+#include <boost/asio/ssl/context.hpp>
+#include <ccxt/base/rate_limiter.h>
+#include <ccxt/base/request_metrics.h>
+#include <boost/asio/bind_executor.hpp>
+#include <boost/asio/use_future.hpp>
+#if defined(BOOST_ASIO_HAS_CO_AWAIT)
+#include <boost/asio/co_spawn.hpp>
+#include <boost/asio/detached.hpp>
+#include <boost/asio/use_awaitable.hpp>
+#endif
+#include <atomic>
+#include <cstdio>
+#include <filesystem>
+#include <mutex>
+#include <set>
+#include <thread>
 
 class BaseTest : public ::testing::Test {
 protected:
@@ -62,6 +100,952 @@ TEST_F(BaseTest, TradingMethods) {
     */
 }
 
+TEST(PathTemplateTest, RendersPlaceholders) {
+    ccxt::PathTemplate path("api/v3/order/{symbol}/{id}");
+    EXPECT_EQ(path.params(), (std::vector<std::string>{"symbol", "id"}));
+    EXPECT_EQ(path.render({{"symbol", "BTCUSDT"}, {"id", 42}}), "api/v3/order/BTCUSDT/42");
+    EXPECT_EQ(path.render({{"symbol", "BTCUSDT"}}), "api/v3/order/BTCUSDT/{id}");
+
+    std::string buffer = "https://api.binance.com/";
+    path.render({{"symbol", "ETHUSDT"}, {"id", "7"}}, buffer);
+    EXPECT_EQ(buffer, "https://api.binance.com/api/v3/order/ETHUSDT/7");
+}
+
+TEST(PathTemplateTest, LiteralOnlyPath) {
+    ccxt::PathTemplate path("ticker/24hr");
+    EXPECT_FALSE(path.hasParams());
+    EXPECT_EQ(path.render(json::object()), "ticker/24hr");
+}
+
+TEST(QueryBuilderTest, EncodesReservedCharacters) {
+    EXPECT_EQ(ccxt::QueryBuilder::encode("abcXYZ019-_.~"), "abcXYZ019-_.~");
+    EXPECT_EQ(ccxt::QueryBuilder::encode("a b&c=d/e"), "a%20b%26c%3Dd%2Fe");
+    // Long enough to exercise the vectorised run scan on both sides of the escape
+    EXPECT_EQ(ccxt::QueryBuilder::encode("BTCUSDTBTCUSDTBTCUSDT:ETHUSDTETHUSDTETHUSDT"),
+              "BTCUSDTBTCUSDTBTCUSDT%3AETHUSDTETHUSDTETHUSDT");
+    EXPECT_EQ(ccxt::QueryBuilder::encode("\xc3\xa9"), "%C3%A9");
+}
+
+TEST(QueryBuilderTest, BuildsQueryInInsertionOrder) {
+    ccxt::QueryBuilder query;
+    query.add("symbol", "BTCUSDT").add("quantity", 0.0001).add("timestamp", 1700000000000LL).add("test", true);
+    EXPECT_EQ(query.str(), "symbol=BTCUSDT&quantity=0.0001&timestamp=1700000000000&test=true");
+
+    query.clear();
+    EXPECT_TRUE(query.empty());
+    query.add(json{{"b", "2"}, {"a", 1}});
+    EXPECT_EQ(query.str(), "a=1&b=2");
+}
+
+TEST(QueryBuilderTest, SortedKeys) {
+    ccxt::QueryBuilder query(true);
+    query.add("side", "BUY").add("price", "100").add("amount", "1");
+    EXPECT_EQ(query.view(), "amount=1&price=100&side=BUY");
+    query.add("nonce", 5);
+    EXPECT_EQ(query.view(), "amount=1&nonce=5&price=100&side=BUY");
+}
+
+TEST(HmacSignerTest, KnownDigests) {
+    const std::string message = "The quick brown fox jumps over the lazy dog";
+    ccxt::HmacSigner sha256("key");
+    EXPECT_EQ(sha256.hex(message), "f7bc83f430538424b13298e6aa6fb143ef4d59a14946175997479dbc2d1a3cd8");
+    EXPECT_EQ(sha256.base64(message), "97yD9DBThCSxMpjmqm+xQ+9NWaFJRhdZl0edvC0aPNg=");
+    // The template context must survive repeated use
+    EXPECT_EQ(sha256.hex(message), "f7bc83f430538424b13298e6aa6fb143ef4d59a14946175997479dbc2d1a3cd8");
+
+    ccxt::HmacSigner sha384("key", ccxt::HmacSigner::Algorithm::SHA384);
+    EXPECT_EQ(sha384.base64(message), "1/RyfiwLOa4PHkDMlvYCQtW3gBhBzqb8WSxdPhrlBwBYKpbPNeHlVJlf5OAzgcI3");
+
+    ccxt::HmacSigner::Buffer buffer;
+    ccxt::HmacSigner sha512("key", ccxt::HmacSigner::Algorithm::SHA512);
+    sha512.signBase64(message, buffer);
+    EXPECT_EQ(buffer.view(), "tCrwkFe6weLUFwjkipAuCbX/fxKrQopP6GZTxz3SSPuC+UilSfe3kaW0GRXuTR7Dk1NX5OIxclDQNyr6Lr7rOg==");
+}
+
+TEST(HmacSignerTest, Base64Padding) {
+    char out[8];
+    EXPECT_EQ(std::string(out, ccxt::base64Encode(reinterpret_cast<const unsigned char*>("f"), 1, out)), "Zg==");
+    EXPECT_EQ(std::string(out, ccxt::base64Encode(reinterpret_cast<const unsigned char*>("fo"), 2, out)), "Zm8=");
+    EXPECT_EQ(std::string(out, ccxt::base64Encode(reinterpret_cast<const unsigned char*>("foo"), 3, out)), "Zm9v");
+}
+
+TEST(HmacSignerTest, ExchangeHmac) {
+    boost::asio::io_context context;
+    ccxt::Config config;
+    config.secret = "key";
+    ccxt::Binance exchange(context, config);
+    const std::string message = "The quick brown fox jumps over the lazy dog";
+    EXPECT_EQ(exchange.hmac(message, "key", "sha256", "hex"),
+              "f7bc83f430538424b13298e6aa6fb143ef4d59a14946175997479dbc2d1a3cd8");
+    EXPECT_EQ(exchange.hmac(message, "key", "sha512", "hex"),
+              "b42af09057bac1e2d41708e48a902e09b5ff7f12ab428a4fe86653c73dd248fb82f948a549f7b791a5b41915ee4d1ec3935357e4e2317250d0372afa2ebeeb3a");
+    EXPECT_THROW(exchange.hmac(message, "key", "md5", "hex"), ccxt::NotSupported);
+}
+
+TEST(DatetimeTest, FormatIso8601) {
+    EXPECT_EQ(ccxt::formatIso8601(0), "1970-01-01T00:00:00.000Z");
+    EXPECT_EQ(ccxt::formatIso8601(1700000000123LL), "2023-11-14T22:13:20.123Z");
+    // Same second again goes through the cached prefix
+    EXPECT_EQ(ccxt::formatIso8601(1700000000999LL), "2023-11-14T22:13:20.999Z");
+    EXPECT_EQ(ccxt::formatIso8601(951782400000LL), "2000-02-29T00:00:00.000Z");
+    EXPECT_EQ(ccxt::formatIso8601(-1), "1969-12-31T23:59:59.999Z");
+}
+
+TEST(DatetimeTest, ParseIso8601) {
+    EXPECT_EQ(ccxt::parseIso8601("2023-11-14T22:13:20.123Z"), 1700000000123LL);
+    EXPECT_EQ(ccxt::parseIso8601("2023-11-14T22:13:20Z"), 1700000000000LL);
+    EXPECT_EQ(ccxt::parseIso8601("2023-11-14 22:13:20.123456"), 1700000000123LL);
+    EXPECT_EQ(ccxt::parseIso8601("2023-11-15T00:13:20.5+02:00"), 1700000000500LL);
+    EXPECT_EQ(ccxt::parseIso8601("2023-11-14T17:13:20-0500"), 1700000000000LL);
+    EXPECT_EQ(ccxt::parseIso8601("2023-11-14"), 1699920000000LL);
+    EXPECT_FALSE(ccxt::parseIso8601("2023-13-14T00:00:00Z").has_value());
+    EXPECT_FALSE(ccxt::parseIso8601("not a date").has_value());
+    EXPECT_FALSE(ccxt::parseIso8601("2023-11-14T22:13:20Zjunk").has_value());
+}
+
+TEST(ExecutorTest, RunsTasksOnBoundedPool) {
+    ccxt::Executor executor(2);
+    std::mutex mutex;
+    std::set<std::thread::id> threads;
+    std::vector<std::future<int>> results;
+    for (int i = 0; i < 100; ++i) {
+        results.push_back(executor.submit([i, &mutex, &threads]() {
+            std::lock_guard<std::mutex> lock(mutex);
+            threads.insert(std::this_thread::get_id());
+            return i * i;
+        }));
+    }
+    for (int i = 0; i < 100; ++i) {
+        EXPECT_EQ(results[i].get(), i * i);
+    }
+    EXPECT_LE(threads.size(), 2u);
+
+    executor.shutdown();
+    EXPECT_THROW(executor.submit([]() { return 0; }), ccxt::ExchangeError);
+}
+
+TEST(ExecutorTest, PropagatesExceptions) {
+    auto result = ccxt::Executor::shared().submit([]() -> json {
+        throw ccxt::NetworkError("boom");
+    });
+    EXPECT_THROW(result.get(), ccxt::NetworkError);
+}
+
+TEST(OffloadTest, CompletionTokens) {
+    boost::asio::io_context context;
+
+    bool called = false;
+    // Bound to the io_context, the callback runs inside context.run()
+    ccxt::offload::run([]() { return json{{"symbol", "BTC/USDT"}}; }, boost::asio::bind_executor(context,
+        [&called](std::exception_ptr error, json ticker) {
+            EXPECT_FALSE(error);
+            EXPECT_EQ(ticker["symbol"], "BTC/USDT");
+            called = true;
+        }));
+    context.run();
+    EXPECT_TRUE(called);
+
+    auto future = ccxt::offload::run([]() -> json { throw ccxt::RequestTimeout("slow"); },
+                                     boost::asio::use_future);
+    EXPECT_THROW(future.get(), ccxt::RequestTimeout);
+}
+
+#if defined(BOOST_ASIO_HAS_CO_AWAIT)
+TEST(OffloadTest, Awaitable) {
+    boost::asio::io_context context;
+    json balance;
+    boost::asio::co_spawn(context, [&]() -> boost::asio::awaitable<void> {
+        balance = co_await ccxt::offload::run([]() { return json{{"USDT", {{"free", 1.0}}}}; },
+                                              boost::asio::use_awaitable);
+    }, boost::asio::detached);
+    context.run();
+    EXPECT_EQ(balance["USDT"]["free"], 1.0);
+}
+#endif
+
+TEST_F(BaseTest, ConcurrentUse) {
+    boost::asio::io_context context;
+    ccxt::Binance exchange(context, config);
+    std::vector<std::thread> threads;
+    std::vector<std::set<std::string>> ids(4);
+    std::atomic<int> mismatches{0};
+    for (int t = 0; t < 4; ++t) {
+        threads.emplace_back([&, t]() {
+            for (int i = 0; i < 500; ++i) {
+                std::string path = "order/{id}/" + std::to_string(i % 50);
+                if (exchange.implodeParams(path, {{"id", t}}) != "order/" + std::to_string(t) + "/" + std::to_string(i % 50)) {
+                    ++mismatches;
+                }
+                ids[t].insert(exchange.uuid());
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    EXPECT_EQ(mismatches.load(), 0);
+    std::set<std::string> all;
+    for (const auto& perThread : ids) {
+        all.insert(perThread.begin(), perThread.end());
+    }
+    EXPECT_EQ(all.size(), 2000u);
+    const std::string id = *all.begin();
+    ASSERT_EQ(id.size(), 36u);
+    EXPECT_EQ(id[14], '4');
+    EXPECT_NE(std::string("89ab").find(id[19]), std::string::npos);
+}
+
+TEST(DatetimeTest, ParseTimeframe) {
+    EXPECT_EQ(ccxt::parseTimeframe("1m"), 60000);
+    EXPECT_EQ(ccxt::parseTimeframe("4h"), 4 * 3600000LL);
+    EXPECT_EQ(ccxt::parseTimeframe("1M"), 30 * 86400000LL);
+    EXPECT_FALSE(ccxt::parseTimeframe("m"));
+    EXPECT_FALSE(ccxt::parseTimeframe("0m"));
+    EXPECT_FALSE(ccxt::parseTimeframe("5x"));
+}
+
+TEST(RateLimiterTest, SpacesReservations) {
+    ccxt::RateLimiter limiter(10);
+    EXPECT_EQ(limiter.reserve().count(), 0);
+    EXPECT_GT(limiter.reserve().count(), 5000000);
+    EXPECT_GT(limiter.reserve(2).count(), 15000000);
+    limiter.setInterval(0);
+    EXPECT_EQ(limiter.reserve().count(), 0);
+}
+
+namespace {
+
+// Serves 1m candles from a fixed history, overlapping the next page by one
+std::vector<ccxt::OHLCV> fakeCandles(long long since, int limit, long long listed) {
+    std::vector<ccxt::OHLCV> page;
+    for (long long t = std::max(since, listed); t < since + (limit + 1) * 60000LL; t += 60000) {
+        page.push_back({t, 1, 2, 0.5, 1.5, 10});
+    }
+    return page;
+}
+
+} // namespace
+
+TEST(BackfillTest, ConcurrentPagesAreContiguous) {
+    std::atomic<int> calls{0};
+    ccxt::BackfillOptions options;
+    options.limit = 100;
+    options.concurrency = 8;
+    ccxt::OHLCVBackfill backfill([&](const std::string& symbol, const std::string&, long long since, int limit) {
+        ++calls;
+        return fakeCandles(since, limit, symbol == "ETH/USDT" ? 60000LL * 500 : 0);
+    }, options);
+    auto result = backfill.run({"BTC/USDT", "ETH/USDT"}, "1m", 0, 60000LL * 1050);
+    EXPECT_EQ(calls.load(), 22);
+    ASSERT_EQ(result["BTC/USDT"].size(), 1050u);
+    ASSERT_EQ(result["ETH/USDT"].size(), 550u);
+    for (size_t i = 0; i < result["BTC/USDT"].size(); ++i) {
+        EXPECT_EQ(result["BTC/USDT"][i].timestamp, static_cast<long long>(i) * 60000);
+    }
+}
+
+TEST(BackfillTest, ResumesFromCheckpoint) {
+    const std::string path = ::testing::TempDir() + "backfill_checkpoint.json";
+    std::remove(path.c_str());
+    ccxt::BackfillOptions options;
+    options.limit = 10;
+    options.concurrency = 1;
+    options.maxRetries = 1;
+    options.checkpointFile = path;
+    std::atomic<int> calls{0};
+    auto fetcher = [&](const std::string&, const std::string&, long long since, int limit) {
+        if (++calls == 4) {
+            throw ccxt::ExchangeNotAvailable("down");
+        }
+        return fakeCandles(since, limit, 0);
+    };
+    EXPECT_THROW(ccxt::OHLCVBackfill(fetcher, options).run({"BTC/USDT"}, "1m", 0, 60000LL * 50),
+                 ccxt::ExchangeNotAvailable);
+
+    auto result = ccxt::OHLCVBackfill(fetcher, options).run({"BTC/USDT"}, "1m", 0, 60000LL * 50);
+    ASSERT_EQ(result["BTC/USDT"].size(), 20u);
+    EXPECT_EQ(result["BTC/USDT"].front().timestamp, 60000LL * 30);
+    EXPECT_EQ(calls.load(), 6);
+    std::remove(path.c_str());
+}
+
+TEST(BackfillTest, ParsesCandleShapes) {
+    auto candles = ccxt::OHLCVBackfill::parseCandles(json::parse(
+        R"([[1000, "1.5", "2", "1", "1.75", "10"], {"timestamp": 2000, "open": 1, "high": 2, "low": 0.5, "close": 1, "volume": 3}])"));
+    ASSERT_EQ(candles.size(), 2u);
+    EXPECT_EQ(candles[0].timestamp, 1000);
+    EXPECT_DOUBLE_EQ(candles[0].close, 1.75);
+    EXPECT_EQ(candles[1].timestamp, 2000);
+    EXPECT_DOUBLE_EQ(candles[1].volume, 3);
+}
+
+TEST(MarketStoreTest, AppendsAndReadsRanges) {
+    const std::string root = ::testing::TempDir() + "ccxt_store_test";
+    std::filesystem::remove_all(root);
+    {
+        ccxt::MarketStore store(root, 1 << 16);
+        auto& series = store.ohlcv("binance", "BTC/USDT", "1m");
+        std::vector<ccxt::OHLCV> candles;
+        for (long long i = 9999; i >= 0; --i) {
+            candles.push_back({i * 60000, 1.0 * i, 2.0 * i, 0.5 * i, 1.5 * i, 10.0});
+        }
+        EXPECT_EQ(series.append(candles), 10000u);
+        EXPECT_EQ(series.append({{60000 * 9999, 0, 0, 0, 0, 0}, {60000 * 10000, 1, 1, 1, 1, 1}}), 1u);
+        auto spans = series.closes();
+        EXPECT_EQ(spans.size(), 10001u);
+        EXPECT_DOUBLE_EQ(spans[42], 63.0);
+
+        auto& trades = store.trades("binance", "BTC/USDT");
+        ccxt::Trade buy{};
+        buy.timestamp = 5;
+        buy.price = 100;
+        buy.amount = 1;
+        buy.side = "buy";
+        ccxt::Trade sell = buy;
+        sell.side = "sell";
+        EXPECT_EQ(trades.append({buy, sell}), 2u);
+        EXPECT_EQ(trades.sides()[1], -1);
+    }
+
+    ccxt::MarketStore reopened(root, 1 << 16);
+    auto& series = reopened.ohlcv("binance", "BTC/USDT", "1m");
+    ASSERT_EQ(series.size(), 10001u);
+    auto [first, last] = series.range(60000 * 100, 60000 * 200);
+    EXPECT_EQ(first, 100u);
+    EXPECT_EQ(last, 200u);
+    auto candles = series.read(60000 * 100 + 1, 60000 * 103);
+    ASSERT_EQ(candles.size(), 2u);
+    EXPECT_EQ(candles[0].timestamp, 60000 * 101);
+    EXPECT_EQ(series.lastTimestamp(), 60000 * 10000);
+    EXPECT_EQ(reopened.trades("binance", "BTC/USDT").size(), 2u);
+    EXPECT_TRUE(std::filesystem::exists(root + "/binance/BTC%2FUSDT/ohlcv-1m/close.col"));
+    std::filesystem::remove_all(root);
+}
+
+TEST(FrameRecorderTest, RoundTripsFrames) {
+    for (bool compress : {false, true}) {
+        const std::string path = ::testing::TempDir() + "frames.log";
+        ccxt::FrameRecorder::Options options;
+        options.compress = compress;
+        options.blockSize = 4096;
+        options.queueCapacity = 1 << 12;
+        {
+            ccxt::FrameRecorder recorder(path, options);
+            std::vector<std::thread> threads;
+            for (uint32_t connection = 1; connection <= 2; ++connection) {
+                threads.emplace_back([&recorder, connection]() {
+                    for (int i = 0; i < 1000; ++i) {
+                        while (!recorder.record(connection, 1000 + i, R"({"e":"trade","i":)" + std::to_string(i) + "}")) {
+                            std::this_thread::yield();
+                        }
+                    }
+                });
+            }
+            for (auto& thread : threads) {
+                thread.join();
+            }
+            recorder.flush();
+            EXPECT_EQ(recorder.recorded(), 2000u);
+        }
+
+        ccxt::FrameReader reader(path);
+        ccxt::RecordedFrame frame;
+        std::map<uint32_t, int> next;
+        while (reader.next(frame)) {
+            const int i = next[frame.connectionId]++;
+            EXPECT_EQ(frame.receivedAt, 1000u + i);
+            EXPECT_EQ(frame.payload, R"({"e":"trade","i":)" + std::to_string(i) + "}");
+        }
+        EXPECT_EQ(next[1], 1000);
+        EXPECT_EQ(next[2], 1000);
+        std::remove(path.c_str());
+    }
+}
+
+TEST(HistogramTest, Percentiles) {
+    ccxt::LatencyHistogram histogram;
+    for (uint64_t v = 1; v <= 10000; ++v) {
+        histogram.record(v * 1000);
+    }
+    EXPECT_EQ(histogram.count(), 10000u);
+    EXPECT_EQ(histogram.min(), 1000u);
+    EXPECT_EQ(histogram.max(), 10000000u);
+    EXPECT_NEAR(histogram.percentile(0.5), 5000000.0, 5000000 * 0.035);
+    EXPECT_NEAR(histogram.percentile(0.99), 9900000.0, 9900000 * 0.035);
+    EXPECT_EQ(ccxt::LatencyHistogram::bucketIndex(~uint64_t(0)), ccxt::LatencyHistogram::kBuckets - 1);
+    for (uint64_t v : {0ull, 63ull, 64ull, 65ull, 1000ull, 123456789ull}) {
+        const size_t index = ccxt::LatencyHistogram::bucketIndex(v);
+        EXPECT_LE(ccxt::LatencyHistogram::bucketLow(index), v);
+        EXPECT_GE(ccxt::LatencyHistogram::bucketHigh(index), v);
+    }
+}
+
+namespace {
+
+class CountingClient : public ccxt::WebSocketClient {
+public:
+    using WebSocketClient::WebSocketClient;
+    std::vector<std::string> messages;
+
+protected:
+    void handleMessage(const std::string& message) override {
+        if (message == "bad") {
+            throw std::runtime_error("parse error");
+        }
+        messages.push_back(message);
+    }
+};
+
+} // namespace
+
+TEST(FrameReplayTest, DrivesHandleMessage) {
+    const std::string path = ::testing::TempDir() + "replay.log";
+    {
+        ccxt::FrameRecorder recorder(path);
+        const uint64_t start = 1700000000000000000ull;
+        for (int i = 0; i < 20; ++i) {
+            recorder.record(i % 2 ? 7 : 8, start + i * 1000000ull, i == 5 ? "bad" : "frame" + std::to_string(i));
+        }
+    }
+    boost::asio::io_context context;
+    boost::asio::ssl::context ssl(boost::asio::ssl::context::tlsv12_client);
+    auto client = std::make_shared<CountingClient>(context, ssl);
+    std::vector<std::string> handled;
+    client->setMessageHandler([&handled](const std::string& message) { handled.push_back(message); });
+
+    ccxt::ReplayOptions options;
+    options.connectionId = 7;
+    auto report = ccxt::FrameReplayer(path, options).run(*client);
+    EXPECT_EQ(report.messages, 10u);
+    EXPECT_EQ(report.failures, 1u);
+    ASSERT_EQ(client->messages.size(), 9u);
+    EXPECT_EQ(client->messages.front(), "frame1");
+    EXPECT_EQ(handled.size(), 9u);
+    EXPECT_EQ(report.latency.count, 10u);
+
+    options.connectionId.reset();
+    options.pacing = ccxt::ReplayOptions::Pacing::Original;
+    client->messages.clear();
+    report = ccxt::FrameReplayer(path, options).run(*client);
+    EXPECT_EQ(report.messages, 20u);
+    // 19 ms of recorded spacing
+    EXPECT_GE(report.seconds, 0.018);
+    EXPECT_EQ(report.lag.count, 20u);
+    std::remove(path.c_str());
+}
+
+TEST(RequestMetricsTest, KeysAndPhases) {
+    EXPECT_EQ(ccxt::RequestMetrics::endpointKey("GET", "https://api.binance.com/api/v3/depth?symbol=BTCUSDT"),
+              "GET /api/v3/depth");
+    EXPECT_EQ(ccxt::RequestMetrics::endpointKey("POST", "https://api.binance.com"), "POST /");
+
+    ccxt::RequestMetrics metrics;
+    ccxt::RequestTiming timing;
+    timing[ccxt::RequestPhase::Total] = 1000;
+    metrics.record("GET /a", timing);
+    metrics.record("GET /a", timing, true);
+    auto snapshot = metrics.snapshot();
+    EXPECT_EQ(snapshot.endpoints["GET /a"].requests, 2u);
+    EXPECT_EQ(snapshot.endpoints["GET /a"].errors, 1u);
+    EXPECT_EQ(snapshot.endpoints["GET /a"][ccxt::RequestPhase::Total].count, 2u);
+    EXPECT_EQ(snapshot.endpoints["GET /a"][ccxt::RequestPhase::Dns].count, 0u);
+
+    ccxt::RequestMetrics::noteSignTime(42);
+    EXPECT_EQ(ccxt::RequestMetrics::takeSignTime(), 42);
+    EXPECT_EQ(ccxt::RequestMetrics::takeSignTime(), -1);
+}
+
+TEST(LoggerTest, DeliversOnWriterThread) {
+    ccxt::Logger logger(16);
+    std::vector<ccxt::LogRecord> records;
+    std::thread::id writer;
+    logger.setSink([&](const ccxt::LogRecord& record) {
+        records.push_back(record);
+        writer = std::this_thread::get_id();
+    });
+    logger.setLevel(ccxt::LogLevel::Warn);
+    EXPECT_FALSE(logger.enabled(ccxt::LogLevel::Info));
+    EXPECT_TRUE(logger.log(ccxt::LogLevel::Error, "boom"));
+    logger.flush();
+    ASSERT_EQ(records.size(), 1u);
+    EXPECT_EQ(records[0].message, "boom");
+    EXPECT_NE(writer, std::this_thread::get_id());
+    EXPECT_NE(ccxt::Logger::format(records[0]).find(" ERROR ["), std::string::npos);
+
+    // Nothing drains while the sink is held up, so the ring fills
+    std::atomic<bool> release{false};
+    logger.setSink([&](const ccxt::LogRecord&) {
+        while (!release.load()) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    });
+    for (int i = 0; i < 64; ++i) {
+        logger.log(ccxt::LogLevel::Error, "x");
+    }
+    EXPECT_GT(logger.dropped(), 0u);
+    release = true;
+    logger.flush();
+}
+
+TEST(LoggerTest, MacrosElideDisabledLevels) {
+    ccxt::Logger& logger = ccxt::Logger::instance();
+    std::vector<std::string> messages;
+    logger.setSink([&](const ccxt::LogRecord& record) { messages.push_back(record.message); });
+    logger.setLevel(ccxt::LogLevel::Trace);
+    int formatted = 0;
+    auto count = [&formatted]() { return ++formatted; };
+    CCXT_LOG_TRACE("trace " << count());
+    CCXT_LOG_INFO("info " << count() << " of " << 2);
+    logger.flush();
+    logger.setLevel(ccxt::LogLevel::Info);
+    logger.setSink([](const ccxt::LogRecord&) {});
+#if CCXT_LOG_MIN_LEVEL > 0
+    EXPECT_EQ(formatted, 1);
+    ASSERT_EQ(messages.size(), 1u);
+    EXPECT_EQ(messages[0], "info 1 of 2");
+#else
+    EXPECT_EQ(formatted, 2);
+    EXPECT_EQ(messages.size(), 2u);
+#endif
+}
+
+TEST(EventBusTest, RoutesByTypeAndTopic) {
+    ccxt::EventBus bus;
+    const ccxt::TopicId btc = bus.topic("BTC/USDT");
+    const ccxt::TopicId eth = bus.topic("ETH/USDT");
+    EXPECT_NE(btc, eth);
+    EXPECT_EQ(bus.topic("BTC/USDT"), btc);
+    EXPECT_EQ(bus.topicName(eth), "ETH/USDT");
+
+    auto btcTickers = bus.subscribe<ccxt::Ticker>(btc);
+    auto allTickers = bus.subscribe<ccxt::Ticker>();
+    auto small = bus.subscribe<ccxt::Trade>(ccxt::kAllTopics, 2);
+    ccxt::Ticker ticker{};
+    ticker.last = 1;
+    EXPECT_EQ(bus.publish(1, btc, ticker), 2u);
+    ticker.last = 2;
+    EXPECT_EQ(bus.publish(1, eth, ticker), 1u);
+    for (int i = 0; i < 3; ++i) {
+        bus.publish(1, btc, ccxt::Trade{});
+    }
+    EXPECT_EQ(small.dropped(), 1u);
+
+    ccxt::Event<ccxt::Ticker> event;
+    ASSERT_TRUE(btcTickers.poll(event));
+    EXPECT_EQ(event.topic, btc);
+    EXPECT_EQ(event.data.last, 1);
+    EXPECT_FALSE(btcTickers.poll(event));
+    std::vector<double> seen;
+    allTickers.drain([&seen](const ccxt::Event<ccxt::Ticker>& e) { seen.push_back(e.data.last); });
+    EXPECT_EQ(seen, (std::vector<double>{1, 2}));
+
+    btcTickers.cancel();
+    EXPECT_EQ(bus.publish(1, btc, ticker), 1u);
+}
+
+TEST(EventBusTest, ManyPublishersOneConsumer) {
+    ccxt::EventBus bus;
+    auto candles = bus.subscribe<ccxt::OHLCV>(ccxt::kAllTopics, 1 << 16);
+    std::vector<std::thread> publishers;
+    for (int p = 0; p < 4; ++p) {
+        publishers.emplace_back([&bus, p]() {
+            for (int i = 0; i < 5000; ++i) {
+                bus.publish(static_cast<ccxt::TopicId>(p + 1), 1, ccxt::OHLCV{i, 0, 0, 0, 0, 0});
+            }
+        });
+    }
+    std::map<ccxt::TopicId, long long> next;
+    size_t received = 0;
+    while (received < 20000) {
+        received += candles.drain([&next](const ccxt::Event<ccxt::OHLCV>& e) {
+            EXPECT_EQ(e.data.timestamp, next[e.source]++);
+        });
+    }
+    for (auto& publisher : publishers) {
+        publisher.join();
+    }
+    EXPECT_EQ(candles.dropped(), 0u);
+}
+
+TEST(EventBusTest, SubscribingWhilePublishing) {
+    ccxt::EventBus bus;
+    auto steady = bus.subscribe<ccxt::Ticker>(ccxt::kAllTopics, 1 << 16);
+    std::atomic<bool> done{false};
+    std::vector<std::thread> publishers;
+    for (int p = 0; p < 2; ++p) {
+        publishers.emplace_back([&bus, &done]() {
+            while (!done.load()) {
+                bus.publish(1, 1, ccxt::Ticker{});
+            }
+        });
+    }
+    // Every replaced subscriber list is freed once no publisher reads it
+    for (int i = 0; i < 2000; ++i) {
+        auto churn = bus.subscribe<ccxt::Ticker>(1, 4);
+    }
+    done = true;
+    for (auto& publisher : publishers) {
+        publisher.join();
+    }
+    EXPECT_GT(steady.drain([](const ccxt::Event<ccxt::Ticker>&) {}), 0u);
+}
+
+namespace {
+
+ccxt::Ticker quote(double bid, double bidVolume, double ask, double askVolume) {
+    ccxt::Ticker ticker{};
+    ticker.bid = bid;
+    ticker.bidVolume = bidVolume;
+    ticker.ask = ask;
+    ticker.askVolume = askVolume;
+    return ticker;
+}
+
+} // namespace
+
+TEST(BboAggregatorTest, ConsolidatesVenues) {
+    ccxt::EventBus binance;
+    ccxt::EventBus kraken;
+    ccxt::BboAggregator::Options options;
+    options.mergedDepth = true;
+    options.staleAfter = 1000;
+    ccxt::BboAggregator bbo(options);
+    const uint8_t a = bbo.addVenue("binance", binance, [](const std::string& id) {
+        return id == "BTCUSDT" ? std::string("BTC/USDT") : id;
+    });
+    const uint8_t b = bbo.addVenue("kraken", kraken, [](const std::string& id) {
+        return id == "XBT/USDT" ? std::string("BTC/USDT") : id;
+    });
+
+    binance.publish(1, binance.topic("BTCUSDT"), quote(100, 1, 101, 2), 10);
+    kraken.publish(1, kraken.topic("XBT/USDT"), quote(100.5, 3, 101.5, 4), 11);
+    binance.publish(1, binance.topic("ETHUSDT"), quote(10, 1, 11, 1), 12);
+    EXPECT_EQ(bbo.poll(), 3u);
+    EXPECT_EQ(bbo.instruments(), 2u);
+
+    ccxt::TopOfBook top;
+    ASSERT_TRUE(bbo.read("BTC/USDT", top));
+    EXPECT_EQ(top.bid, 100.5);
+    EXPECT_EQ(top.bidSize, 3);
+    EXPECT_EQ(top.bidVenue, b);
+    EXPECT_EQ(top.ask, 101);
+    EXPECT_EQ(top.askVenue, a);
+    EXPECT_EQ(bbo.venueName(top.askVenue), "binance");
+    const uint32_t version = top.version;
+
+    // The same quote again changes nothing
+    binance.publish(1, binance.topic("BTCUSDT"), quote(100, 1, 101, 2), 13);
+    bbo.poll();
+    ASSERT_TRUE(bbo.read("BTC/USDT", top));
+    EXPECT_EQ(top.version, version);
+
+    // Kraken's quote is more than staleAfter older than the new tick
+    ccxt::OrderBook book{};
+    book.bids = {{99, 1}, {98, 2}};
+    book.asks = {{102, 1}};
+    binance.publish(1, binance.topic("BTCUSDT"), book, 2000);
+    bbo.poll();
+    ASSERT_TRUE(bbo.read("BTC/USDT", top));
+    EXPECT_EQ(top.bid, 99);
+    EXPECT_EQ(top.bidVenue, a);
+    EXPECT_EQ(top.ask, 102);
+
+    const ccxt::MergedDepth depth = bbo.depth("BTC/USDT", 5);
+    ASSERT_EQ(depth.bids.size(), 2u);
+    EXPECT_EQ(depth.bids[0].price, 99);
+    EXPECT_EQ(depth.bids[1].price, 98);
+    EXPECT_FALSE(bbo.read("DOGE/USDT", top));
+}
+
+TEST(BboAggregatorTest, ReadersSeeConsistentBooks) {
+    ccxt::EventBus bus;
+    ccxt::BboAggregator bbo;
+    bbo.addVenue("venue", bus);
+    const ccxt::TopicId topic = bus.topic("X");
+    bus.publish(1, topic, quote(1, 1, 2, 1));
+    bbo.poll();
+    const auto id = bbo.instrument("X");
+    ASSERT_NE(id, ccxt::BboAggregator::kUnknownInstrument);
+
+    std::atomic<bool> done{false};
+    std::thread writer([&]() {
+        for (int i = 2; i < 20000; ++i) {
+            bus.publish(1, topic, quote(i, i, i + 1, i));
+            bbo.poll();
+        }
+        done = true;
+    });
+    uint64_t reads = 0;
+    ccxt::TopOfBook top;
+    while (!done.load()) {
+        ASSERT_TRUE(bbo.read(id, top));
+        // Every field of one read comes from the same update
+        ASSERT_EQ(top.ask, top.bid + 1);
+        ASSERT_EQ(top.bidSize, top.bid);
+        ++reads;
+    }
+    writer.join();
+    EXPECT_GT(reads, 0u);
+}
+
+TEST(CandleBuilderTest, BuildsTimeframesFromTrades) {
+    std::vector<std::pair<size_t, ccxt::OHLCV>> closed;
+    ccxt::CandleBuilder builder({"1s", "1m"}, [&closed](ccxt::CandleBuilder::SymbolId, size_t timeframe,
+                                                       const ccxt::OHLCV& bar) {
+        closed.emplace_back(timeframe, bar);
+    });
+    EXPECT_THROW(ccxt::CandleBuilder({"7q"}, nullptr), ccxt::NotSupported);
+    const auto btc = builder.addSymbol("BTC/USDT");
+    EXPECT_EQ(builder.addSymbol("BTC/USDT"), btc);
+
+    builder.update(btc, 60000, 10, 1);
+    builder.update(btc, 60500, 12, 2);
+    builder.update(btc, 60900, 9, 1);
+    builder.update(btc, 61200, 11, 1);   // closes the first second
+    builder.update(btc, 60950, 50, 1);   // late for 1s, still inside the forming minute
+    ASSERT_EQ(closed.size(), 1u);
+    EXPECT_EQ(closed[0].first, 0u);
+    EXPECT_EQ(closed[0].second.timestamp, 60000);
+    EXPECT_EQ(closed[0].second.open, 10);
+    EXPECT_EQ(closed[0].second.high, 12);
+    EXPECT_EQ(closed[0].second.low, 9);
+    EXPECT_EQ(closed[0].second.close, 9);
+    EXPECT_EQ(closed[0].second.volume, 4);
+    EXPECT_EQ(builder.lateTrades(), 1u);
+
+    ccxt::OHLCV minute;
+    ASSERT_TRUE(builder.current(btc, 1, minute));
+    EXPECT_EQ(minute.volume, 6);
+
+    builder.update(btc, 125000, 13, 1);  // skips the empty 62s..124s and 2nd minute
+    ASSERT_EQ(closed.size(), 3u);
+    EXPECT_EQ(closed[1].second.timestamp, 61000);
+    EXPECT_EQ(closed[2].first, 1u);
+    EXPECT_EQ(closed[2].second.timestamp, 60000);
+    EXPECT_EQ(closed[2].second.close, 50);
+
+    EXPECT_EQ(builder.flush(180000), 2u);
+    EXPECT_EQ(builder.flush(180000), 0u);
+    builder.update(btc, 125500, 1, 1);  // its windows were flushed already
+    EXPECT_EQ(closed.size(), 5u);
+}
+
+TEST(CandleBuilderTest, SeedsFromHistoryAndEventBus) {
+    std::vector<ccxt::OHLCV> closed;
+    ccxt::CandleBuilder builder({"1m"}, [&closed](ccxt::CandleBuilder::SymbolId, size_t, const ccxt::OHLCV& bar) {
+        closed.push_back(bar);
+    });
+    const auto eth = builder.addSymbol("ETHUSDT");
+    builder.seed(eth, "1m", {{0, 1, 1, 1, 1, 1}, {60000, 5, 6, 4, 5, 10}});
+    builder.update(eth, 30000, 100, 1);  // before the seeded bar
+    EXPECT_EQ(builder.lateTrades(), 1u);
+
+    ccxt::EventBus bus;
+    auto trades = bus.subscribe<ccxt::Trade>();
+    ccxt::Trade trade{};
+    trade.timestamp = 61000;
+    trade.price = 7;
+    trade.amount = 2;
+    bus.publish(1, bus.topic("ETHUSDT"), trade);
+    trade.timestamp = 120000;
+    bus.publish(1, bus.topic("ETHUSDT"), trade);
+    EXPECT_EQ(builder.drain(trades, bus), 2u);
+    ASSERT_EQ(closed.size(), 1u);
+    EXPECT_EQ(closed[0].timestamp, 60000);
+    EXPECT_EQ(closed[0].high, 7);
+    EXPECT_EQ(closed[0].close, 7);
+    EXPECT_EQ(closed[0].volume, 12);
+}
+
+TEST(ArrayCacheTest, KeepsNewestAndReadsSinceCursor) {
+    ccxt::ArrayCache<ccxt::Trade> trades(3);
+    uint64_t cursor = 0;
+    for (int i = 1; i <= 2; ++i) {
+        ccxt::Trade trade;
+        trade.id = std::to_string(i);
+        trades.append(trade);
+    }
+    auto fresh = trades.since(cursor);
+    ASSERT_EQ(fresh.size(), 2u);
+    EXPECT_EQ(fresh[0].id, "1");
+    EXPECT_TRUE(trades.since(cursor).empty());
+
+    for (int i = 3; i <= 6; ++i) {
+        ccxt::Trade trade;
+        trade.id = std::to_string(i);
+        trades.append(trade);
+    }
+    ASSERT_EQ(trades.size(), 3u);
+    EXPECT_EQ(trades[0].id, "4");
+    EXPECT_EQ(trades.back().id, "6");
+    // 3 was evicted before it was read
+    std::vector<std::string> ids;
+    EXPECT_EQ(trades.since(cursor, [&ids](const ccxt::Trade& trade) { ids.push_back(trade.id); }), 3u);
+    EXPECT_EQ(ids, (std::vector<std::string>{"4", "5", "6"}));
+
+    ccxt::ArrayCacheByTimestamp<ccxt::OHLCV> candles(2);
+    cursor = 0;
+    EXPECT_TRUE(candles.append({60000, 1, 1, 1, 1, 1}));
+    candles.since(cursor);
+    EXPECT_TRUE(candles.append({60000, 1, 2, 1, 2, 3}));
+    EXPECT_FALSE(candles.append({0, 1, 1, 1, 1, 1}));
+    ASSERT_EQ(candles.size(), 1u);
+    auto updated = candles.since(cursor);
+    ASSERT_EQ(updated.size(), 1u);
+    EXPECT_DOUBLE_EQ(updated[0].close, 2);
+    candles.append({120000, 2, 2, 2, 2, 1});
+    candles.append({180000, 3, 3, 3, 3, 1});
+    EXPECT_EQ(candles[0].timestamp, 120000);
+}
+
+TEST(ArrayCacheTest, OrdersUpdateInPlaceById) {
+    ccxt::ArrayCacheById<ccxt::Order> orders(2);
+    uint64_t cursor = 0;
+    ccxt::Order order;
+    order.id = "a";
+    order.status = "NEW";
+    orders.append(order);
+    order.id = "b";
+    orders.append(order);
+    EXPECT_EQ(orders.since(cursor).size(), 2u);
+
+    order.id = "a";
+    order.status = "FILLED";
+    orders.append(order);
+    ASSERT_EQ(orders.size(), 2u);
+    auto changed = orders.since(cursor);
+    ASSERT_EQ(changed.size(), 1u);
+    EXPECT_EQ(changed[0].status, "FILLED");
+    EXPECT_EQ(orders.find("a")->status, "FILLED");
+
+    order.id = "c";
+    orders.append(order);  // evicts a, the oldest slot
+    EXPECT_EQ(orders.find("a"), nullptr);
+    ASSERT_NE(orders.find("c"), nullptr);
+    EXPECT_EQ(orders.since(cursor).size(), 1u);
+}
+
+TEST(OrderTrackerTest, OrdersUpdatesAndReconciles) {
+    ccxt::OrderTracker tracker(1);
+    ccxt::Order order{};
+    order.id = "1";
+    order.clientOrderId = "mine-1";
+    order.symbol = "BTC/USDT";
+    order.status = "NEW";
+    order.amount = 2;
+    order.timestamp = 100;
+    EXPECT_TRUE(tracker.apply(order));
+
+    order.status = "PARTIALLY_FILLED";
+    order.filled = 1;
+    order.timestamp = 200;
+    EXPECT_TRUE(tracker.apply(order));
+    // An older report arriving late doesn't undo the fill
+    order.status = "NEW";
+    order.filled = 0;
+    order.timestamp = 150;
+    EXPECT_FALSE(tracker.apply(order));
+    EXPECT_EQ(tracker.byClientOrderId("mine-1")->status, "PARTIALLY_FILLED");
+    EXPECT_EQ(tracker.stale(), 1u);
+
+    ccxt::Order other{};
+    other.id = "2";
+    other.symbol = "BTC/USDT";
+    other.status = "open";
+    other.timestamp = 300;
+    tracker.apply(other);
+    EXPECT_EQ(tracker.open("BTC/USDT").size(), 2u);
+    EXPECT_TRUE(tracker.open("ETH/USDT").empty());
+
+    // The snapshot lists only order 2; order 1 closed without a report
+    auto vanished = tracker.reconcile({ccxt::OrderTracker::fromJson(
+                                          {{"id", 2}, {"symbol", "BTC/USDT"}, {"status", "open"}, {"filled", "0.5"}})},
+                                      "BTC/USDT", 1000);
+    EXPECT_EQ(vanished, (std::vector<std::string>{"1"}));
+    EXPECT_DOUBLE_EQ(tracker.byId("2")->filled, 0.5);
+
+    order.status = "FILLED";
+    order.filled = 2;
+    order.timestamp = 1100;
+    EXPECT_TRUE(tracker.apply(order));
+    order.status = "PARTIALLY_FILLED";
+    order.timestamp = 1200;
+    EXPECT_FALSE(tracker.apply(order));  // never reopens
+    EXPECT_EQ(tracker.open().size(), 1u);
+
+    other.status = "canceled";
+    other.filled = 0.5;
+    other.timestamp = 1300;
+    tracker.apply(other);
+    // Only one closed order is kept
+    EXPECT_FALSE(tracker.byId("1").has_value());
+    EXPECT_FALSE(tracker.byClientOrderId("mine-1").has_value());
+    EXPECT_EQ(tracker.byId("2")->status, "canceled");
+}
+
+TEST(ClockSyncTest, EstimatesOffsetFromRoundTripMidpoint) {
+    const long long skew = 5000;
+    int calls = 0;
+    // 4 ms each way, except the first sample which is slow on the way back
+    // and would put the midpoint 10 ms late
+    auto server = [&]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(4));
+        const long long now = std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::system_clock::now().time_since_epoch()).count() + skew;
+        std::this_thread::sleep_for(std::chrono::milliseconds(calls++ == 0 ? 24 : 4));
+        return now;
+    };
+    long long published = 0;
+    ccxt::ClockSync::Options options;
+    options.samples = 3;
+    ccxt::ClockSync sync(server, [&published](long long offset) { published = offset; }, options);
+    EXPECT_FALSE(sync.synced());
+    ASSERT_TRUE(sync.sync());
+    EXPECT_NEAR(sync.offset(), skew, 3);
+    EXPECT_EQ(published, sync.offset());
+    EXPECT_LT(sync.roundTrip(), 20000);
+
+    ccxt::ClockSync failing([]() -> long long { throw ccxt::RequestTimeout("no answer"); });
+    EXPECT_FALSE(failing.sync());
+    EXPECT_FALSE(failing.synced());
+}
+
+TEST(DnsCacheTest, CachesUntilTtlAndSharesAsyncLookups) {
+    ccxt::DnsCache cache;
+    const auto addresses = cache.resolve("localhost", "443");
+    ASSERT_FALSE(addresses.empty());
+    EXPECT_EQ(cache.misses(), 1u);
+    EXPECT_EQ(cache.resolve("localhost", "443"), addresses);
+    EXPECT_EQ(cache.hits(), 1u);
+    ASSERT_TRUE(cache.cached("localhost", "443").has_value());
+    EXPECT_FALSE(cache.cached("localhost", "80").has_value());
+
+    // Two lookups of a new name while it is in flight resolve it once
+    boost::asio::io_context io;
+    std::vector<ccxt::DnsCache::Addresses> answers;
+    for (int i = 0; i < 2; ++i) {
+        cache.asyncResolve(io, "127.0.0.1", "80", [&answers](const ccxt::DnsCache::Addresses& result,
+                                                             std::exception_ptr error) {
+            EXPECT_FALSE(error);
+            answers.push_back(result);
+        });
+    }
+    io.run();
+    ASSERT_EQ(answers.size(), 2u);
+    EXPECT_EQ(answers[0], ccxt::DnsCache::Addresses({"127.0.0.1"}));
+    EXPECT_EQ(answers[1], answers[0]);
+    EXPECT_EQ(cache.misses(), 3u);
+    EXPECT_EQ(cache.size(), 2u);
+
+    ccxt::DnsCache::Options options;
+    options.ttl = std::chrono::seconds(0);
+    ccxt::DnsCache expiring(options);
+    expiring.resolve("localhost", "443");
+    expiring.resolve("localhost", "443");
+    EXPECT_EQ(expiring.misses(), 2u);
+    EXPECT_THROW(expiring.resolve("name.invalid", "443"), ccxt::NetworkError);
+}
+
 int main(int argc, char **argv) {
     testing::InitGoogleTest(&argc, argv);
     return RUN_ALL_TESTS();
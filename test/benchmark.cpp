@@ -0,0 +1,123 @@
+// End-to-end latency through Exchange::fetch and WebSocketClient against the
+// in-process mock exchange. Everything stays on loopback.
+//
+//   ccxt_benchmark [--requests N] [--frames N] [--rate FRAMES_PER_S]
+//                  [--latency-us US] [--jitter-us US]
+#include "mock_exchange.h"
+#include <ccxt/base/histogram.h>
+#include <ccxt/base/websocket_client.h>
+#include <ccxt/exchanges/binance.h>
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/ssl/context.hpp>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <thread>
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+uint64_t nowNs() {
+    return static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now().time_since_epoch()).count());
+}
+
+// Exposes the protected transport so requests take the same path as adapters
+class BenchBinance : public ccxt::Binance {
+public:
+    using Binance::Binance;
+    using Exchange::fetch;
+};
+
+// Frames carry the steady-clock time they were generated at in "T"
+class LatencyClient : public ccxt::WebSocketClient {
+public:
+    using WebSocketClient::WebSocketClient;
+    ccxt::LatencyHistogram latency;
+    std::atomic<uint64_t> received{0};
+
+protected:
+    void handleMessage(const std::string& message) override {
+        const json frame = json::parse(message, nullptr, false);
+        if (frame.is_object() && frame.contains("T")) {
+            latency.record(nowNs() - frame["T"].get<uint64_t>());
+            received.fetch_add(1, std::memory_order_release);
+        }
+    }
+};
+
+void print(const char* name, const ccxt::HistogramSummary& s, double seconds) {
+    std::printf("%-18s n=%-8llu %10.0f/s  min %8.1fus  p50 %8.1fus  p90 %8.1fus  p99 %8.1fus  p99.9 %8.1fus  max %8.1fus\n",
+                name, static_cast<unsigned long long>(s.count), seconds > 0 ? s.count / seconds : 0.0,
+                s.min / 1e3, s.p50 / 1e3, s.p90 / 1e3, s.p99 / 1e3, s.p999 / 1e3, s.max / 1e3);
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    long requests = 2000;
+    long frames = 10000;
+    double rate = 2000;
+    ccxt::testing::MockOptions options;
+    options.fixtures = "test/fixtures/binance";
+    for (int i = 1; i + 1 < argc; i += 2) {
+        const char* flag = argv[i];
+        const char* value = argv[i + 1];
+        if (!std::strcmp(flag, "--requests")) requests = std::atol(value);
+        else if (!std::strcmp(flag, "--frames")) frames = std::atol(value);
+        else if (!std::strcmp(flag, "--rate")) rate = std::atof(value);
+        else if (!std::strcmp(flag, "--latency-us")) options.latency = std::chrono::microseconds(std::atol(value));
+        else if (!std::strcmp(flag, "--jitter-us")) options.jitter = std::chrono::microseconds(std::atol(value));
+        else {
+            std::cerr << "unknown option " << flag << std::endl;
+            return 2;
+        }
+    }
+    options.messagesPerSecond = rate;
+    ccxt::testing::MockExchange mock("config/binance_rest.json", options);
+
+    // REST: request -> parsed response through curl and Exchange::fetch
+    boost::asio::io_context context;
+    BenchBinance exchange(context, ccxt::Config());
+    exchange.enableRateLimit = false;
+    const std::string url = mock.restUrl("public") + "/ticker/24hr?symbol=BTCUSDT";
+    ccxt::LatencyHistogram rest;
+    exchange.fetch(url);  // connection setup isn't part of the steady state
+    const auto restStart = Clock::now();
+    for (long i = 0; i < requests; ++i) {
+        const uint64_t start = nowNs();
+        const json response = exchange.fetch(url);
+        rest.record(nowNs() - start);
+        if (!response.contains("lastPrice")) {
+            std::cerr << "unexpected response " << response.dump() << std::endl;
+            return 1;
+        }
+    }
+    print("rest fetch", rest.summary(), std::chrono::duration<double>(Clock::now() - restStart).count());
+
+    // WS: frame generated on the server -> handleMessage on the client
+    boost::asio::ssl::context tls(boost::asio::ssl::context::tlsv12_client);
+    auto client = std::make_shared<LatencyClient>(context, tls);
+    client->connect("127.0.0.1", std::to_string(mock.wsPort()), "/ws");
+    std::thread io([&context]() { context.run(); });
+    while (mock.sessions() == 0) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    const auto wsStart = Clock::now();
+    mock.setStream([](uint64_t sequence) {
+        return json{{"e", "trade"}, {"s", "BTCUSDT"}, {"t", sequence}, {"p", "37139.01"}, {"q", "0.002"},
+                    {"T", nowNs()}}.dump();
+    });
+    const auto deadline = Clock::now() + std::chrono::seconds(60);
+    while (client->received.load(std::memory_order_acquire) < static_cast<uint64_t>(frames) && Clock::now() < deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    mock.setStream(nullptr);
+    print("ws frame->callback", client->latency.summary(), std::chrono::duration<double>(Clock::now() - wsStart).count());
+    context.stop();
+    io.join();
+    return client->received.load() >= static_cast<uint64_t>(frames) ? 0 : 1;
+}
@@ -1,5 +1,20 @@
 #include <gtest/gtest.h>
 #include <ccxt.h>
+#include <ccxt/base/clock_sync.h>
+#include <ccxt/base/dns_cache.h>
+#include <ccxt/base/executor.h>
+#include <ccxt/base/offload.h>
+#include <ccxt/base/websocket_client.h>
+#include <ccxt/exchanges/binance.h>
+#include <ccxt/exchanges/ws/binance_ws.h>
+#include <boost/asio/bind_executor.hpp>
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/ssl/context.hpp>
+#include <algorithm>
+#include <chrono>
+#include <mutex>
+#include <thread>
+#include "mock_exchange.h"
 
 class ExchangeTest : public ::testing::Test {
 protected:
@@ -63,3 +78,637 @@ TEST_F(ExchangeTest, AlpacaRateLimits) {
     EXPECT_TRUE(exchange.pro);
     */
 }
+
+namespace {
+
+class MockedBinance : public ccxt::Binance {
+public:
+    using Binance::Binance;
+    using Exchange::fetch;
+    void setApiUrl(const std::string& api, const std::string& url) { config_.json_rest["urls"]["api"][api] = url; }
+};
+
+// Single-order calls that take a while, so a batch only finishes quickly
+// when they run concurrently
+class SlowOrdersBinance : public ccxt::Binance {
+public:
+    using Binance::Binance;
+    std::atomic<int> calls{0};
+
+protected:
+    json createOrderImpl(const std::string& symbol, const std::string& type, const std::string& side,
+                         double amount, const std::optional<double>& price) override {
+        ++calls;
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        if (amount <= 0) {
+            throw ccxt::InvalidOrder("amount must be positive");
+        }
+        return {{"id", std::to_string(amount)}, {"symbol", symbol}, {"status", "open"}};
+    }
+    json cancelOrderImpl(const std::string& id, const std::string& symbol) override {
+        ++calls;
+        return {{"id", id}, {"symbol", symbol}, {"status", "canceled"}};
+    }
+};
+
+// Records the thread fetchTicker ran on
+class ThreadRecordingBinance : public ccxt::Binance {
+public:
+    using Binance::Binance;
+    std::thread::id thread;
+
+    json fetchTicker(const std::string& symbol, const json& params) override {
+        thread = std::this_thread::get_id();
+        return {{"symbol", symbol}};
+    }
+};
+
+class CollectingClient : public ccxt::WebSocketClient {
+public:
+    using WebSocketClient::WebSocketClient;
+    std::mutex mutex;
+    std::vector<std::string> frames;
+
+protected:
+    void handleMessage(const std::string& message) override {
+        std::lock_guard<std::mutex> lock(mutex);
+        frames.push_back(message);
+    }
+};
+
+} // namespace
+
+TEST_F(ExchangeTest, MockServesDescriptorEndpoints) {
+    ccxt::testing::MockOptions options;
+    options.fixtures = "test/fixtures/binance";
+    ccxt::testing::MockExchange mock("config/binance_rest.json", options);
+    boost::asio::io_context context;
+    MockedBinance exchange(context, ccxt::Config());
+    exchange.enableRateLimit = false;
+
+    auto ticker = exchange.fetch(mock.restUrl("public") + "/ticker/24hr?symbol=BTCUSDT");
+    EXPECT_EQ(ticker["symbol"], "BTCUSDT");
+    // Listed in the descriptor but without a fixture
+    EXPECT_EQ(exchange.fetch(mock.restUrl("public") + "/avgPrice"), json::object());
+    mock.setResponse("GET", "/api/v3/time", {{"serverTime", 42}});
+    EXPECT_EQ(exchange.fetch(mock.restUrl("public") + "/time")["serverTime"], 42);
+    EXPECT_EQ(exchange.fetch(mock.restUrl("public") + "/nope")["code"], -1);
+    EXPECT_EQ(mock.requests(), 4u);
+}
+
+TEST_F(ExchangeTest, MockInjectsErrorsAndLatency) {
+    ccxt::testing::MockOptions options;
+    options.errorRate = 1;
+    options.latency = std::chrono::milliseconds(20);
+    ccxt::testing::MockExchange mock("config/binance_rest.json", options);
+    boost::asio::io_context context;
+    MockedBinance exchange(context, ccxt::Config());
+    exchange.enableRateLimit = false;
+
+    const auto start = std::chrono::steady_clock::now();
+    EXPECT_EQ(exchange.fetch(mock.restUrl("public") + "/ping")["code"], -1003);
+    EXPECT_GE(std::chrono::steady_clock::now() - start, std::chrono::milliseconds(20));
+}
+
+TEST_F(ExchangeTest, MetricsBreakDownRequests) {
+    ccxt::testing::MockOptions options;
+    options.fixtures = "test/fixtures/binance";
+    options.latency = std::chrono::milliseconds(5);
+    ccxt::testing::MockExchange mock("config/binance_rest.json", options);
+    boost::asio::io_context context;
+    MockedBinance exchange(context, ccxt::Config());
+    exchange.enableRateLimit = false;
+
+    for (int i = 0; i < 3; ++i) {
+        exchange.fetch(mock.restUrl("public") + "/ticker/24hr?symbol=BTCUSDT");
+    }
+    exchange.fetch(mock.restUrl("public") + "/nope");
+
+    const ccxt::MetricsSnapshot snapshot = exchange.metrics();
+    EXPECT_EQ(snapshot.exchange, exchange.id);
+    ASSERT_EQ(snapshot.endpoints.count("GET /api/v3/ticker/24hr"), 1u);
+    const ccxt::EndpointMetrics& ticker = snapshot.endpoints.at("GET /api/v3/ticker/24hr");
+    EXPECT_EQ(ticker.requests, 3u);
+    EXPECT_EQ(ticker.errors, 0u);
+    EXPECT_EQ(ticker[ccxt::RequestPhase::Total].count, 3u);
+    EXPECT_EQ(ticker[ccxt::RequestPhase::Parse].count, 3u);
+    EXPECT_GE(ticker[ccxt::RequestPhase::FirstByte].min, 5000000u);
+    // One keep-alive connection for all of them
+    EXPECT_LE(ticker[ccxt::RequestPhase::Connect].count, 1u);
+    EXPECT_EQ(snapshot.endpoints.at("GET /api/v3/nope").errors, 1u);
+}
+
+TEST_F(ExchangeTest, BinanceWsPublishesTypedEvents) {
+    boost::asio::io_context context;
+    boost::asio::ssl::context tls(boost::asio::ssl::context::tlsv12_client);
+    ccxt::Binance exchange(context, ccxt::Config());
+    ccxt::BinanceWS ws(context, tls, exchange);
+    auto trades = exchange.events().subscribe<ccxt::Trade>(exchange.events().topic("BTCUSDT"));
+    auto books = exchange.events().subscribe<ccxt::OrderBook>();
+
+    ws.deliver(R"({"stream":"btcusdt@trade","data":{"e":"trade","E":1700000000001,"s":"BTCUSDT","t":12345,)"
+               R"("p":"37139.01","q":"0.002","T":1700000000000,"m":true}})");
+    ws.deliver(R"({"stream":"ethusdt@trade","data":{"e":"trade","E":1700000000001,"s":"ETHUSDT","t":1,)"
+               R"("p":"2000.00","q":"1","T":1700000000000,"m":false}})");
+    // Diffs aren't books; only the partial-depth snapshot is published
+    ws.deliver(R"({"stream":"btcusdt@depth@100ms","data":{"e":"depthUpdate","E":1700000000002,"s":"BTCUSDT",)"
+               R"("U":1,"u":2,"b":[["37200.00","0"]],"a":[["37000.00","0"]]}})");
+    ws.deliver(R"({"stream":"btcusdt@depth20@100ms","data":{"lastUpdateId":160,)"
+               R"("bids":[["37139.00","1.5"]],"asks":[["37139.02","0.5"],["37139.03","2"]]}})");
+
+    ccxt::Event<ccxt::Trade> trade;
+    ASSERT_TRUE(trades.poll(trade));
+    EXPECT_EQ(exchange.events().topicName(trade.source), "binance");
+    EXPECT_EQ(trade.data.id, "12345");
+    EXPECT_DOUBLE_EQ(trade.data.price, 37139.01);
+    EXPECT_EQ(trade.data.side, "sell");
+    EXPECT_FALSE(trades.poll(trade));  // ETHUSDT is another topic
+
+    ccxt::Event<ccxt::OrderBook> book;
+    ASSERT_TRUE(books.poll(book));
+    ASSERT_EQ(book.data.bids.size(), 1u);
+    EXPECT_EQ(book.data.bids[0], (std::vector<double>{37139.00, 1.5}));
+    EXPECT_EQ(book.data.asks.size(), 2u);
+    EXPECT_EQ(exchange.events().topicName(book.topic), "BTCUSDT");
+    EXPECT_FALSE(books.poll(book));
+
+    // The same trades are kept in the bounded per-symbol caches
+    ASSERT_NE(ws.trades("BTCUSDT"), nullptr);
+    EXPECT_EQ(ws.trades("BTCUSDT")->capacity(), 1000u);
+    EXPECT_EQ(ws.trades("BTCUSDT")->back().id, "12345");
+    EXPECT_EQ(ws.trades("XRPUSDT"), nullptr);
+    auto minuteBars = exchange.events().subscribe<ccxt::OHLCV>(exchange.events().topic("BTCUSDT@1m"));
+    ws.deliver(R"({"stream":"btcusdt@kline_1m","data":{"e":"kline","E":1700000000003,"s":"BTCUSDT",)"
+               R"("k":{"t":1699999980000,"i":"1m","o":"1","h":"2","l":"1","c":"2","v":"5"}}})");
+    ws.deliver(R"({"stream":"btcusdt@kline_5m","data":{"e":"kline","E":1700000000003,"s":"BTCUSDT",)"
+               R"("k":{"t":1699999800000,"i":"5m","o":"1","h":"3","l":"1","c":"2","v":"20"}}})");
+    ASSERT_NE(ws.ohlcv("BTCUSDT", "1m"), nullptr);
+    EXPECT_DOUBLE_EQ(ws.ohlcv("BTCUSDT", "1m")->back().volume, 5);
+    // Each interval is its own topic
+    ccxt::Event<ccxt::OHLCV> bar;
+    ASSERT_TRUE(minuteBars.poll(bar));
+    EXPECT_DOUBLE_EQ(bar.data.volume, 5);
+    EXPECT_FALSE(minuteBars.poll(bar));
+
+    // Execution reports keep the exchange's order state current
+    ws.deliver(R"({"e":"executionReport","E":1700000000004,"s":"BTCUSDT","c":"web_1","C":"","S":"BUY",)"
+               R"("o":"LIMIT","p":"37000","q":"1","z":"0","X":"NEW","x":"NEW","i":42})");
+    ws.deliver(R"({"e":"executionReport","E":1700000000005,"s":"BTCUSDT","c":"cancel_9","C":"web_1","S":"BUY",)"
+               R"("o":"LIMIT","p":"37000","q":"1","z":"0","X":"CANCELED","x":"CANCELED","i":42})");
+    auto order = exchange.orders().byClientOrderId("web_1");
+    ASSERT_TRUE(order.has_value());
+    EXPECT_EQ(order->id, "42");
+    EXPECT_EQ(order->status, "CANCELED");
+    EXPECT_TRUE(exchange.orders().open().empty());
+
+    // Topic ids interned for the old bus are dropped when the bus changes
+    trades.cancel();
+    books.cancel();
+    minuteBars.cancel();
+    auto shared = std::make_shared<ccxt::EventBus>();
+    shared->topic("kraken");
+    shared->topic("XBT/USD");
+    exchange.setEventBus(shared);
+    auto sharedTrades = shared->subscribe<ccxt::Trade>(shared->topic("BTCUSDT"));
+    ws.deliver(R"({"stream":"btcusdt@trade","data":{"e":"trade","E":1700000000006,"s":"BTCUSDT","t":12346,)"
+               R"("p":"37140.00","q":"0.001","T":1700000000005,"m":false}})");
+    ASSERT_TRUE(sharedTrades.poll(trade));
+    EXPECT_EQ(shared->topicName(trade.source), "binance");
+    EXPECT_EQ(shared->topicName(trade.topic), "BTCUSDT");
+}
+
+TEST_F(ExchangeTest, MockStreamsWebSocketFrames) {
+    ccxt::testing::MockExchange mock("config/binance_rest.json");
+    boost::asio::io_context context;
+    boost::asio::ssl::context tls(boost::asio::ssl::context::tlsv12_client);
+    auto client = std::make_shared<CollectingClient>(context, tls);
+    client->connect("127.0.0.1", std::to_string(mock.wsPort()), "/ws");
+    std::thread io([&context]() { context.run(); });
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    while (mock.sessions() == 0 && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    ASSERT_EQ(mock.sessions(), 1u);
+    client->send(R"({"method":"SUBSCRIBE","params":["btcusdt@trade"],"id":1})");
+    mock.publish(R"({"e":"trade","s":"BTCUSDT"})");
+    size_t received = 0;
+    while (received < 2 && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        std::lock_guard<std::mutex> lock(client->mutex);
+        received = client->frames.size();
+    }
+    context.stop();
+    io.join();
+    ASSERT_EQ(client->frames.size(), 2u);
+    std::sort(client->frames.begin(), client->frames.end());
+    EXPECT_EQ(client->frames[0], R"({"e":"trade","s":"BTCUSDT"})");
+    EXPECT_EQ(client->frames[1], R"({"id":1,"result":null})");
+}
+
+TEST_F(ExchangeTest, WebSocketConnectFailureRejectsRequests) {
+    boost::asio::io_context context;
+    boost::asio::ssl::context tls(boost::asio::ssl::context::tlsv12_client);
+    auto client = std::make_shared<CollectingClient>(context, tls);
+    EXPECT_THROW(client->connect("127.0.0.1", "wss", "/ws"), ccxt::BadRequest);
+    EXPECT_THROW(client->connect("127.0.0.1", "70000", "/ws"), ccxt::BadRequest);
+
+    unsigned short closedPort = 0;
+    {
+        ccxt::testing::MockExchange mock("config/binance_rest.json");
+        closedPort = mock.wsPort();
+    }
+    client->connect("127.0.0.1", std::to_string(closedPort), "/ws");
+    auto response = client->request(client->nextRequestId(), "order.place", "{}", std::chrono::seconds(30));
+    std::thread io([&context]() { context.run(); });
+    // Fails with the connection, not at the 30 s timeout
+    const bool failed = response.wait_for(std::chrono::seconds(5)) == std::future_status::ready;
+    context.stop();
+    io.join();
+    ASSERT_TRUE(failed);
+    EXPECT_THROW(response.get(), ccxt::NetworkError);
+    EXPECT_EQ(client->pendingRequests(), 0u);
+}
+
+TEST_F(ExchangeTest, BatchOrdersFallBackToConcurrentRequests) {
+    boost::asio::io_context context;
+    SlowOrdersBinance exchange(context, ccxt::Config());
+    std::vector<ccxt::OrderRequest> orders;
+    for (int i = 0; i < 5; ++i) {
+        ccxt::OrderRequest order;
+        order.symbol = "BTC/USDT";
+        order.type = "limit";
+        order.side = "buy";
+        order.amount = i == 2 ? 0.0 : i + 1.0;
+        order.price = 30000.0 - i;
+        orders.push_back(order);
+    }
+
+    const auto started = std::chrono::steady_clock::now();
+    const json placed = exchange.createOrders(orders);
+    const auto elapsed = std::chrono::steady_clock::now() - started;
+    EXPECT_EQ(exchange.calls, 5);
+    EXPECT_LT(elapsed, std::chrono::milliseconds(240));  // 5 x 50ms one after another
+    ASSERT_EQ(placed.size(), 5u);
+    EXPECT_EQ(placed[0]["status"], "open");
+    EXPECT_EQ(placed[4]["id"], std::to_string(5.0));
+    EXPECT_EQ(placed[2]["status"], "rejected");
+    EXPECT_EQ(placed[2]["error"], "amount must be positive");
+
+    const json canceled = exchange.cancelOrders({"1", "2"}, "BTC/USDT");
+    ASSERT_EQ(canceled.size(), 2u);
+    EXPECT_EQ(canceled[1]["id"], "2");
+    EXPECT_TRUE(exchange.cancelOrders({}).empty());
+}
+
+TEST_F(ExchangeTest, BatchOrdersUseNativeFuturesEndpoint) {
+    ccxt::testing::MockExchange mock("config/binance_rest.json");
+    boost::asio::io_context context;
+    ccxt::Config config;
+    config.apiKey = "test_api_key";
+    config.secret = "test_secret";
+    MockedBinance exchange(context, config);
+    exchange.enableRateLimit = false;
+    exchange.setApiUrl("fapiPrivate", mock.restUrl("fapiPrivate"));
+    ccxt::Market perp;
+    perp.id = "BTCUSDT";
+    perp.symbol = "BTC/USDT:USDT";
+    perp.quote = "USDT";
+    perp.type = "future";
+    exchange.markets[perp.symbol] = perp;
+    exchange.markets_by_id[perp.id] = perp;
+    const json placed = {{"orderId", 7}, {"clientOrderId", "a"}, {"symbol", "BTCUSDT"}, {"status", "NEW"},
+                         {"type", "LIMIT"}, {"side", "BUY"}, {"price", "30000"}, {"origQty", "1"},
+                         {"executedQty", "0"}, {"cumQuote", "0"}, {"updateTime", 1700000000000LL}};
+    json canceled = placed;
+    canceled["status"] = "CANCELED";
+    mock.setResponse("POST", "/fapi/v1/batchOrders",
+                     json::array({placed, {{"code", -2019}, {"msg", "Margin is insufficient."}}}));
+    mock.setResponse("DELETE", "/fapi/v1/batchOrders", json::array({canceled}));
+    mock.setResponse("PUT", "/fapi/v1/batchOrders", json::array({placed}));
+    const uint64_t before = mock.requests();
+
+    ccxt::OrderRequest order;
+    order.symbol = perp.symbol;
+    order.type = "limit";
+    order.side = "buy";
+    order.amount = 1;
+    order.price = 30000.0;
+    const json created = exchange.createOrders({order, order});
+    ASSERT_EQ(created.size(), 2u);
+    EXPECT_EQ(created[0]["id"], 7);
+    EXPECT_EQ(created[0]["status"], "open");
+    EXPECT_EQ(created[0]["symbol"], "BTC/USDT:USDT");
+    EXPECT_EQ(created[1]["status"], "rejected");
+    EXPECT_EQ(created[1]["error"], "Margin is insufficient.");
+
+    const json cancels = exchange.cancelOrders({"7"}, perp.symbol);
+    ASSERT_EQ(cancels.size(), 1u);
+    EXPECT_EQ(cancels[0]["status"], "canceled");
+
+    order.id = "7";
+    const json edited = exchange.editOrders({order});
+    ASSERT_EQ(edited.size(), 1u);
+    EXPECT_EQ(edited[0]["status"], "open");
+    // One signed request per batch
+    EXPECT_EQ(mock.requests(), before + 3);
+}
+
+TEST_F(ExchangeTest, AsyncMethodsRunOnTheExecutor) {
+    boost::asio::io_context context;
+    ThreadRecordingBinance exchange(context, ccxt::Config());
+    std::future<json> ticker = exchange.fetchTickerAsync("BTC/USDT");
+    EXPECT_EQ(ticker.get()["symbol"], "BTC/USDT");
+    EXPECT_NE(exchange.thread, std::this_thread::get_id());
+}
+
+TEST_F(ExchangeTest, WsRequestsResolveByIdAndTimeOut) {
+    ccxt::testing::MockExchange mock("config/binance_rest.json");
+    boost::asio::io_context context;
+    boost::asio::ssl::context tls(boost::asio::ssl::context::tlsv12_client);
+    ccxt::Binance exchange(context, ccxt::Config());
+    auto ws = std::make_shared<ccxt::BinanceWS>(context, tls, exchange);
+    ws->connect("127.0.0.1", std::to_string(mock.wsPort()), "/ws");
+    std::thread io([&context]() { context.run(); });
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    while (mock.sessions() == 0 && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    ASSERT_EQ(mock.sessions(), 1u);
+
+    // The mock answers {"method", "id"} frames with {"id", "result": null}
+    std::vector<std::future<std::string>> answered;
+    for (int i = 0; i < 3; ++i) {
+        const uint64_t id = ws->nextRequestId();
+        answered.push_back(ws->request(id, "order.place", json{{"method", "order.place"}, {"id", id}}.dump()));
+    }
+    // ...and ignores anything else
+    const uint64_t silent = ws->nextRequestId();
+    auto unanswered = ws->request(silent, "order.cancel", json{{"id", silent}}.dump(), std::chrono::milliseconds(50));
+    EXPECT_THROW(ws->request(silent, "order.cancel", "{}"), ccxt::BadRequest);
+
+    for (auto& response : answered) {
+        ASSERT_EQ(response.wait_for(std::chrono::seconds(5)), std::future_status::ready);
+        EXPECT_TRUE(json::parse(response.get())["result"].is_null());
+    }
+    ASSERT_EQ(unanswered.wait_for(std::chrono::seconds(5)), std::future_status::ready);
+    EXPECT_THROW(unanswered.get(), ccxt::RequestTimeout);
+    EXPECT_EQ(ws->pendingRequests(), 0u);
+    const auto latency = ws->requestLatency();
+    EXPECT_EQ(latency.at("order.place").count, 3u);
+    EXPECT_GT(latency.at("order.place").min, 0u);
+    EXPECT_EQ(latency.at("order.cancel").count, 0u);
+
+    context.stop();
+    io.join();
+}
+
+TEST_F(ExchangeTest, ClockSyncFeedsSigningOffset) {
+    ccxt::testing::MockExchange mock("config/binance_rest.json");
+    boost::asio::io_context context;
+    MockedBinance exchange(context, ccxt::Config());
+    exchange.enableRateLimit = false;
+    exchange.setApiUrl("public", mock.restUrl("public"));
+    const long long ahead = 90000;
+    mock.setResponse("GET", "/api/v3/time", {{"serverTime", exchange.milliseconds() + ahead}});
+
+    ccxt::ClockSync sync(exchange);
+    ASSERT_TRUE(sync.sync());
+    // The canned time is already a little stale when it's read
+    EXPECT_NEAR(exchange.clockOffset(), ahead, 1000);
+    EXPECT_NEAR(exchange.serverMilliseconds() - exchange.milliseconds(), ahead, 1000);
+
+    // Time probes skip the rate limiter, so a queue wait isn't taken for latency
+    exchange.enableRateLimit = true;
+    exchange.rateLimit = 500;
+    exchange.fetch(mock.restUrl("public") + "/time");
+    ASSERT_TRUE(sync.sync());
+    EXPECT_LT(sync.roundTrip(), 250000);
+}
+
+TEST_F(ExchangeTest, ReconcilesOrdersFromOpenOrders) {
+    ccxt::testing::MockExchange mock("config/binance_rest.json");
+    boost::asio::io_context context;
+    ccxt::Config config;
+    config.apiKey = "test_api_key";
+    config.secret = "test_secret";
+    MockedBinance exchange(context, config);
+    exchange.enableRateLimit = false;
+    exchange.setApiUrl("private", mock.restUrl("private"));
+    ccxt::Market btc;
+    btc.id = "BTCUSDT";
+    btc.symbol = "BTC/USDT";
+    btc.quote = "USDT";
+    exchange.markets[btc.symbol] = btc;
+    exchange.markets_by_id[btc.id] = btc;
+    mock.setResponse("GET", "/api/v3/openOrders", json::array({{
+        {"symbol", "BTCUSDT"}, {"orderId", 42}, {"clientOrderId", "web_1"}, {"price", "37000.00"},
+        {"origQty", "1.0"}, {"executedQty", "0.25"}, {"cummulativeQuoteQty", "9250.00"}, {"status", "PARTIALLY_FILLED"},
+        {"type", "LIMIT"}, {"side", "BUY"}, {"time", 1700000000000LL}, {"updateTime", 1700000000500LL}}}));
+
+    EXPECT_EQ(exchange.reconcileOrders(), 1u);
+    auto order = exchange.orders().byId("42");
+    ASSERT_TRUE(order.has_value());
+    EXPECT_EQ(order->symbol, "BTC/USDT");
+    EXPECT_EQ(order->clientOrderId, "web_1");
+    EXPECT_DOUBLE_EQ(order->price, 37000);
+    EXPECT_DOUBLE_EQ(order->remaining, 0.75);
+    EXPECT_EQ(exchange.orders().open().size(), 1u);
+}
+
+TEST_F(ExchangeTest, ReconcileFetchesOrdersMissingFromSnapshot) {
+    ccxt::testing::MockExchange mock("config/binance_rest.json");
+    boost::asio::io_context context;
+    ccxt::Config config;
+    config.apiKey = "test_api_key";
+    config.secret = "test_secret";
+    MockedBinance exchange(context, config);
+    exchange.enableRateLimit = false;
+    exchange.setApiUrl("private", mock.restUrl("private"));
+    ccxt::Market btc;
+    btc.id = "BTCUSDT";
+    btc.symbol = "BTC/USDT";
+    btc.quote = "USDT";
+    exchange.markets[btc.symbol] = btc;
+    exchange.markets_by_id[btc.id] = btc;
+
+    // Filled while the stream was down: the tracker still has it open
+    ccxt::Order tracked{};
+    tracked.id = "43";
+    tracked.symbol = "BTC/USDT";
+    tracked.status = "open";
+    tracked.timestamp = 1700000000000LL;
+    tracked.amount = 1;
+    exchange.orders().apply(tracked);
+    mock.setResponse("GET", "/api/v3/openOrders", json::array());
+    mock.setResponse("GET", "/api/v3/order", {
+        {"symbol", "BTCUSDT"}, {"orderId", 43}, {"clientOrderId", "web_2"}, {"price", "37000.00"},
+        {"origQty", "1.0"}, {"executedQty", "1.0"}, {"cummulativeQuoteQty", "37000.00"}, {"status", "FILLED"},
+        {"type", "LIMIT"}, {"side", "SELL"}, {"time", 1700000000000LL}, {"updateTime", 1700000001000LL}});
+
+    EXPECT_EQ(exchange.reconcileOrders("BTC/USDT"), 1u);
+    auto order = exchange.orders().byId("43");
+    ASSERT_TRUE(order.has_value());
+    EXPECT_EQ(order->status, "closed");
+    EXPECT_DOUBLE_EQ(order->filled, 1);
+    EXPECT_TRUE(exchange.orders().open().empty());
+}
+
+TEST_F(ExchangeTest, OffloadedRequestsCompleteOnTheIoContext) {
+    ccxt::testing::MockOptions options;
+    options.latency = std::chrono::milliseconds(100);
+    options.threads = 4;
+    ccxt::testing::MockExchange mock("config/binance_rest.json", options);
+    mock.setResponse("GET", "/api/v3/time", {{"serverTime", 1700000000000LL}});
+    boost::asio::io_context context;
+    MockedBinance exchange(context, ccxt::Config());
+    exchange.enableRateLimit = false;
+    exchange.setApiUrl("public", mock.restUrl("public"));
+
+    // Real HTTP through fetch(); requests overlap up to the pool size
+    const size_t requests = 2 * ccxt::Executor::shared().size();
+    std::vector<long long> times;
+    const std::thread::id ioThread = std::this_thread::get_id();
+    const auto started = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < requests; ++i) {
+        ccxt::offload::fetchTime(exchange, boost::asio::bind_executor(context,
+            [&times, ioThread](std::exception_ptr error, long long time) {
+                EXPECT_FALSE(error);
+                EXPECT_EQ(std::this_thread::get_id(), ioThread);
+                times.push_back(time);
+            }));
+    }
+    context.run();
+    const auto elapsed = std::chrono::steady_clock::now() - started;
+    ASSERT_EQ(times.size(), requests);
+    EXPECT_EQ(times.front(), 1700000000000LL);
+    EXPECT_LT(elapsed, std::chrono::milliseconds(100) * requests - std::chrono::milliseconds(50));
+}
+
+TEST_F(ExchangeTest, OffloadedCallsReturnAdapterData) {
+    ccxt::testing::MockExchange mock("config/binance_rest.json");
+    mock.setResponse("GET", "/api/v3/ticker/24hr",
+                     {{"symbol", "BTCUSDT"}, {"lastPrice", "50000.5"}, {"closeTime", 1700000000000LL}});
+    mock.setResponse("GET", "/api/v3/depth",
+                     {{"lastUpdateId", 7},
+                      {"bids", json::array({json::array({"49999", "2"})})},
+                      {"asks", json::array({json::array({"50001", "1.5"})})}});
+    mock.setResponse("GET", "/api/v3/account",
+                     {{"balances", {{{"asset", "USDT"}, {"free", "100"}, {"locked", "25"}}}}});
+    boost::asio::io_context context;
+    ccxt::Config config;
+    config.apiKey = "key";
+    config.secret = "secret";
+    MockedBinance exchange(context, config);
+    exchange.enableRateLimit = false;
+    exchange.setApiUrl("public", mock.restUrl("public"));
+    exchange.setApiUrl("private", mock.restUrl("private"));
+    ccxt::Market btc;
+    btc.id = "BTCUSDT";
+    btc.symbol = "BTC/USDT";
+    exchange.markets[btc.symbol] = btc;
+    exchange.markets_by_id[btc.id] = btc;
+
+    json ticker, book, balance;
+    auto store = [&context](json& target) {
+        return boost::asio::bind_executor(context, [&target](std::exception_ptr error, json result) {
+            EXPECT_FALSE(error);
+            target = std::move(result);
+        });
+    };
+    ccxt::offload::fetchTicker(exchange, "BTC/USDT", json::object(), store(ticker));
+    ccxt::offload::fetchOrderBook(exchange, "BTC/USDT", 5, json::object(), store(book));
+    ccxt::offload::fetchBalance(exchange, json::object(), store(balance));
+    context.run();
+
+    EXPECT_EQ(ticker["symbol"], "BTC/USDT");
+    EXPECT_DOUBLE_EQ(ticker["last"].get<double>(), 50000.5);
+    EXPECT_DOUBLE_EQ(book["bids"][0][0].get<double>(), 49999);
+    EXPECT_DOUBLE_EQ(book["asks"][0][1].get<double>(), 1.5);
+    EXPECT_DOUBLE_EQ(balance["USDT"]["total"].get<double>(), 125);
+}
+
+TEST_F(ExchangeTest, HedgingOnlyRetriesServerErrors) {
+    auto hedgedRequests = [](int status) {
+        ccxt::testing::MockOptions options;
+        options.errorRate = 1;
+        options.errorStatus = status;
+        ccxt::testing::MockExchange first("config/binance_rest.json", options);
+        ccxt::testing::MockExchange second("config/binance_rest.json", options);
+        boost::asio::io_context context;
+        MockedBinance exchange(context, ccxt::Config());
+        exchange.enableRateLimit = false;
+        ccxt::HedgingPolicy policy;
+        policy.hosts = {"http://127.0.0.1:" + std::to_string(first.restPort()),
+                        "http://127.0.0.1:" + std::to_string(second.restPort())};
+        policy.initialDelay = std::chrono::seconds(1);
+        exchange.setHedging(policy);
+        for (int i = 0; i < 4; ++i) {
+            json response = exchange.fetch(first.restUrl("public") + "/time");
+            EXPECT_EQ(response["code"], -1003);
+        }
+        return first.requests() + second.requests();
+    };
+    // A rejected or rate limited request is answered as-is
+    EXPECT_EQ(hedgedRequests(400), 4u);
+    EXPECT_EQ(hedgedRequests(429), 4u);
+    // A failing host gets the other host tried at once
+    EXPECT_EQ(hedgedRequests(503), 8u);
+}
+
+TEST_F(ExchangeTest, HedgedGetsTakeTheFasterHost) {
+    ccxt::testing::MockOptions slowOptions;
+    slowOptions.latency = std::chrono::milliseconds(300);
+    slowOptions.threads = 4;
+    ccxt::testing::MockExchange slow("config/binance_rest.json", slowOptions);
+    ccxt::testing::MockExchange fast("config/binance_rest.json");
+    slow.setResponse("GET", "/api/v3/time", {{"serverTime", 1}});
+    fast.setResponse("GET", "/api/v3/time", {{"serverTime", 1}});
+    boost::asio::io_context context;
+    MockedBinance exchange(context, ccxt::Config());
+    exchange.enableRateLimit = false;
+    const std::string slowOrigin = "http://127.0.0.1:" + std::to_string(slow.restPort());
+    const std::string fastOrigin = "http://127.0.0.1:" + std::to_string(fast.restPort());
+    ccxt::HedgingPolicy policy;
+    policy.hosts = {slowOrigin, fastOrigin + "/"};
+    policy.minSamples = 3;
+    policy.initialDelay = std::chrono::milliseconds(20);
+    exchange.setHedging(policy);
+
+    for (int i = 0; i < 8; ++i) {
+        const auto started = std::chrono::steady_clock::now();
+        json response = exchange.fetch(slow.restUrl("public") + "/time");
+        EXPECT_TRUE(response.contains("serverTime"));
+        EXPECT_LT(std::chrono::steady_clock::now() - started, std::chrono::milliseconds(250));
+    }
+    const auto latency = exchange.hostLatency();
+    ASSERT_EQ(latency.size(), 2u);
+    EXPECT_GE(latency.at(fastOrigin).count, 8u);
+    EXPECT_GE(latency.at(slowOrigin).count, 1u);
+    // Once both hosts are known the fast one is primary and nothing is hedged
+    EXPECT_GE(exchange.hedging()->hedgeWins(), 1u);
+    EXPECT_LE(exchange.hedging()->hedged(), 4u);
+    EXPECT_EQ(exchange.hedging()->hedged(), exchange.hedging()->hedgeWins());
+}
+
+TEST_F(ExchangeTest, PrewarmResolvesAndConnectsConfiguredHosts) {
+    ccxt::testing::MockExchange mock("config/binance_rest.json");
+    boost::asio::io_context context;
+    MockedBinance exchange(context, ccxt::Config());
+    const std::string port = std::to_string(mock.restPort());
+    const uint64_t before = mock.requests();
+
+    // Duplicate origins and non-URLs are skipped
+    EXPECT_EQ(exchange.prewarm({mock.restUrl("public"), mock.restUrl("private"), "not a url",
+                                "wss://127.0.0.1:" + std::to_string(mock.wsPort()) + "/ws"}),
+              2u);
+    EXPECT_EQ(mock.requests(), before + 1);
+    EXPECT_TRUE(ccxt::DnsCache::shared().cached("127.0.0.1", port).has_value());
+    EXPECT_TRUE(ccxt::DnsCache::shared().cached("127.0.0.1", std::to_string(mock.wsPort())).has_value());
+
+    // A lookup pending on an io_context nobody runs yet doesn't hold it up
+    boost::asio::io_context idle;
+    ccxt::DnsCache::shared().asyncResolve(idle, "localhost", port,
+                                          [](const ccxt::DnsCache::Addresses&, std::exception_ptr) {});
+    EXPECT_EQ(exchange.prewarm({"http://localhost:" + port + "/api/v3"}), 1u);
+    idle.run();
+}
@@ -0,0 +1,457 @@
+#include "mock_exchange.h"
+#include <algorithm>
+#include <cctype>
+#include <deque>
+#include <fstream>
+#include <optional>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+#include <boost/asio/executor_work_guard.hpp>
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/ip/tcp.hpp>
+#include <boost/asio/ssl.hpp>
+#include <boost/asio/steady_timer.hpp>
+#include <boost/asio/strand.hpp>
+#include <boost/beast/core.hpp>
+#include <boost/beast/http.hpp>
+#include <boost/beast/ssl.hpp>
+#include <boost/beast/websocket.hpp>
+#include <boost/beast/websocket/ssl.hpp>
+#include <openssl/evp.h>
+#include <openssl/x509.h>
+
+namespace ccxt {
+namespace testing {
+
+namespace net = boost::asio;
+namespace beast = boost::beast;
+namespace http = beast::http;
+namespace websocket = beast::websocket;
+using tcp = net::ip::tcp;
+using Clock = std::chrono::steady_clock;
+
+namespace {
+
+// Path component of "https://host/api/v3" -> "/api/v3"
+std::string urlPath(const std::string& url) {
+    const size_t scheme = url.find("://");
+    const size_t slash = url.find('/', scheme == std::string::npos ? 0 : scheme + 3);
+    return slash == std::string::npos ? std::string() : url.substr(slash);
+}
+
+std::string upper(std::string text) {
+    for (char& c : text) {
+        c = static_cast<char>(std::toupper(static_cast<unsigned char>(c)));
+    }
+    return text;
+}
+
+// Throwaway certificate so the WS side speaks TLS like real exchanges
+void useSelfSignedCertificate(net::ssl::context& context) {
+    EVP_PKEY* key = EVP_EC_gen("prime256v1");
+    X509* certificate = X509_new();
+    X509_set_version(certificate, 2);
+    ASN1_INTEGER_set(X509_get_serialNumber(certificate), 1);
+    X509_gmtime_adj(X509_getm_notBefore(certificate), 0);
+    X509_gmtime_adj(X509_getm_notAfter(certificate), 24 * 3600);
+    X509_set_pubkey(certificate, key);
+    X509_NAME* name = X509_get_subject_name(certificate);
+    X509_NAME_add_entry_by_txt(name, "CN", MBSTRING_ASC, reinterpret_cast<const unsigned char*>("localhost"), -1, -1, 0);
+    X509_set_issuer_name(certificate, name);
+    X509_sign(certificate, key, EVP_sha256());
+    SSL_CTX_use_certificate(context.native_handle(), certificate);
+    SSL_CTX_use_PrivateKey(context.native_handle(), key);
+    X509_free(certificate);
+    EVP_PKEY_free(key);
+}
+
+} // namespace
+
+class WsSession;
+
+struct MockServer {
+    explicit MockServer(MockOptions opts)
+        : options(std::move(opts)), tls(net::ssl::context::tlsv12_server),
+          work(net::make_work_guard(ioc)), restAcceptor(ioc), wsAcceptor(ioc), streamTimer(ioc) {}
+
+    Clock::duration delay() {
+        auto total = std::chrono::duration_cast<Clock::duration>(options.latency);
+        if (options.jitter.count() > 0) {
+            thread_local std::mt19937_64 random{std::random_device{}()};
+            std::uniform_int_distribution<long long> spread(0, options.jitter.count() - 1);
+            total += std::chrono::microseconds(spread(random));
+        }
+        return total;
+    }
+
+    bool injectError() {
+        if (options.errorRate <= 0) {
+            return false;
+        }
+        thread_local std::mt19937_64 random{std::random_device{}()};
+        return std::uniform_real_distribution<double>(0, 1)(random) < options.errorRate;
+    }
+
+    void respond(const http::request<http::string_body>& request, http::response<http::string_body>& response);
+    void acceptRest();
+    void acceptWs();
+    void scheduleStream(Clock::time_point start);
+    void publish(const std::string& frame);
+
+    using StreamGenerator = MockExchange::StreamGenerator;
+
+    MockOptions options;
+    json descriptor;
+    net::ssl::context tls;
+    net::io_context ioc;
+    net::executor_work_guard<net::io_context::executor_type> work;
+    tcp::acceptor restAcceptor;
+    tcp::acceptor wsAcceptor;
+    net::steady_timer streamTimer;
+    std::vector<std::thread> threads;
+
+    // "GET /api/v3/time" -> fixture file
+    std::map<std::string, std::string> routes;
+    std::mutex responsesMutex;
+    std::map<std::string, std::string> responses;
+
+    mutable std::mutex sessionsMutex;
+    std::vector<std::weak_ptr<WsSession>> sessions;
+    std::mutex generatorMutex;
+    StreamGenerator generator;
+    uint64_t sequence = 0;
+    std::atomic<uint64_t> requests{0};
+};
+
+class HttpSession : public std::enable_shared_from_this<HttpSession> {
+public:
+    HttpSession(tcp::socket socket, MockServer& server)
+        : stream_(std::move(socket)), delay_(stream_.get_executor()), server_(server) {}
+
+    void read() {
+        request_ = {};
+        auto self = shared_from_this();
+        http::async_read(stream_, buffer_, request_, [self](beast::error_code ec, size_t) {
+            if (ec) {
+                beast::error_code ignored;
+                self->stream_.socket().shutdown(tcp::socket::shutdown_send, ignored);
+                return;
+            }
+            self->server_.requests.fetch_add(1, std::memory_order_relaxed);
+            self->server_.respond(self->request_, self->response_);
+            const Clock::duration delay = self->server_.delay();
+            if (delay.count() > 0) {
+                self->delay_.expires_after(delay);
+                self->delay_.async_wait([self](beast::error_code) { self->write(); });
+            } else {
+                self->write();
+            }
+        });
+    }
+
+private:
+    void write() {
+        auto self = shared_from_this();
+        http::async_write(stream_, response_, [self](beast::error_code ec, size_t) {
+            if (ec || self->response_.need_eof()) {
+                beast::error_code ignored;
+                self->stream_.socket().shutdown(tcp::socket::shutdown_send, ignored);
+                return;
+            }
+            self->read();
+        });
+    }
+
+    beast::tcp_stream stream_;
+    beast::flat_buffer buffer_;
+    net::steady_timer delay_;
+    http::request<http::string_body> request_;
+    http::response<http::string_body> response_;
+    MockServer& server_;
+};
+
+class WsSession : public std::enable_shared_from_this<WsSession> {
+public:
+    WsSession(tcp::socket socket, MockServer& server)
+        : ws_(std::move(socket), server.tls), timer_(ws_.get_executor()), server_(server) {}
+
+    void start() {
+        auto self = shared_from_this();
+        ws_.next_layer().async_handshake(net::ssl::stream_base::server, [self](beast::error_code ec) {
+            if (ec) {
+                return;
+            }
+            self->ws_.async_accept([self](beast::error_code ec) {
+                if (ec) {
+                    return;
+                }
+                {
+                    std::lock_guard<std::mutex> lock(self->server_.sessionsMutex);
+                    self->server_.sessions.push_back(self);
+                }
+                self->read();
+            });
+        });
+    }
+
+    void send(std::string frame) {
+        auto self = shared_from_this();
+        const Clock::time_point due = Clock::now() + server_.delay();
+        net::post(ws_.get_executor(), [self, frame = std::move(frame), due]() mutable {
+            self->queue_.push_back({std::move(frame), due});
+            if (self->queue_.size() == 1) {
+                self->write();
+            }
+        });
+    }
+
+private:
+    // Answers subscribe-style requests ({"method": ..., "id": n}) like Binance
+    void read() {
+        auto self = shared_from_this();
+        ws_.async_read(buffer_, [self](beast::error_code ec, size_t) {
+            if (ec) {
+                return;
+            }
+            const json request = json::parse(beast::buffers_to_string(self->buffer_.data()), nullptr, false);
+            self->buffer_.consume(self->buffer_.size());
+            if (request.is_object() && request.contains("id") && request.contains("method")) {
+                self->send(json{{"result", nullptr}, {"id", request["id"]}}.dump());
+            }
+            self->read();
+        });
+    }
+
+    // Each frame leaves at its own due time, so latency doesn't cap the rate
+    void write() {
+        auto self = shared_from_this();
+        timer_.expires_at(queue_.front().due);
+        timer_.async_wait([self](beast::error_code) {
+            self->ws_.text(true);
+            self->ws_.async_write(net::buffer(self->queue_.front().frame), [self](beast::error_code ec, size_t) {
+                if (ec) {
+                    self->queue_.clear();
+                    return;
+                }
+                self->queue_.pop_front();
+                if (!self->queue_.empty()) {
+                    self->write();
+                }
+            });
+        });
+    }
+
+    struct Pending {
+        std::string frame;
+        Clock::time_point due;
+    };
+
+    websocket::stream<beast::ssl_stream<beast::tcp_stream>> ws_;
+    beast::flat_buffer buffer_;
+    net::steady_timer timer_;
+    std::deque<Pending> queue_;
+    MockServer& server_;
+};
+
+void MockServer::respond(const http::request<http::string_body>& request,
+                                 http::response<http::string_body>& response) {
+    response = {};
+    response.version(request.version());
+    response.keep_alive(request.keep_alive());
+    response.set(http::field::content_type, "application/json");
+    const std::string target(request.target());
+    const std::string key = std::string(request.method_string()) + " " + target.substr(0, target.find('?'));
+
+    if (injectError()) {
+        response.result(static_cast<http::status>(options.errorStatus));
+        response.body() = R"({"code":-1003,"msg":"injected error"})";
+    } else {
+        std::lock_guard<std::mutex> lock(responsesMutex);
+        auto cached = responses.find(key);
+        if (cached == responses.end()) {
+            auto route = routes.find(key);
+            if (route != routes.end()) {
+                std::ifstream file(route->second);
+                std::stringstream body;
+                if (file) {
+                    body << file.rdbuf();
+                }
+                cached = responses.emplace(key, file ? body.str() : "{}").first;
+            }
+        }
+        if (cached != responses.end()) {
+            response.result(http::status::ok);
+            response.body() = cached->second;
+        } else {
+            response.result(http::status::not_found);
+            response.body() = R"({"code":-1,"msg":"unknown endpoint"})";
+        }
+    }
+    response.prepare_payload();
+}
+
+void MockServer::acceptRest() {
+    restAcceptor.async_accept(net::make_strand(ioc), [this](beast::error_code ec, tcp::socket socket) {
+        if (ec) {
+            return;
+        }
+        socket.set_option(tcp::no_delay(true), ec);
+        std::make_shared<HttpSession>(std::move(socket), *this)->read();
+        acceptRest();
+    });
+}
+
+void MockServer::acceptWs() {
+    wsAcceptor.async_accept(net::make_strand(ioc), [this](beast::error_code ec, tcp::socket socket) {
+        if (ec) {
+            return;
+        }
+        socket.set_option(tcp::no_delay(true), ec);
+        std::make_shared<WsSession>(std::move(socket), *this)->start();
+        acceptWs();
+    });
+}
+
+void MockServer::publish(const std::string& frame) {
+    std::vector<std::shared_ptr<WsSession>> live;
+    {
+        std::lock_guard<std::mutex> lock(sessionsMutex);
+        for (auto it = sessions.begin(); it != sessions.end();) {
+            if (auto session = it->lock()) {
+                live.push_back(std::move(session));
+                ++it;
+            } else {
+                it = sessions.erase(it);
+            }
+        }
+    }
+    for (auto& session : live) {
+        session->send(frame);
+    }
+}
+
+// Frames are due at start + n / rate; a late timer catches up in one batch
+void MockServer::scheduleStream(Clock::time_point start) {
+    const auto interval = std::chrono::duration_cast<Clock::duration>(
+        std::chrono::duration<double>(1.0 / options.messagesPerSecond));
+    streamTimer.expires_at(start + interval * static_cast<long long>(sequence + 1));
+    streamTimer.async_wait([this, start, interval](beast::error_code ec) {
+        if (ec) {
+            return;
+        }
+        const auto now = Clock::now();
+        std::lock_guard<std::mutex> lock(generatorMutex);
+        while (start + interval * static_cast<long long>(sequence + 1) <= now) {
+            ++sequence;
+            if (generator) {
+                publish(generator(sequence));
+            }
+        }
+        scheduleStream(start);
+    });
+}
+
+struct MockExchange::Impl : MockServer {
+    using MockServer::MockServer;
+};
+
+MockExchange::MockExchange(const std::string& descriptor, MockOptions options)
+    : impl_(std::make_unique<Impl>(std::move(options))) {
+    std::ifstream file(descriptor);
+    if (!file) {
+        throw std::runtime_error("cannot open " + descriptor);
+    }
+    impl_->descriptor = json::parse(file);
+
+    // ccxt layout: api.<name>.<method>.<endpoint>, rooted at urls.api.<name>
+    const json urls = impl_->descriptor["urls"].value("api", json::object());
+    const json api = impl_->descriptor.value("api", json::object());
+    for (const auto& [name, methods] : api.items()) {
+        if (!urls.contains(name) || !urls[name].is_string() || !methods.is_object()) {
+            continue;
+        }
+        const std::string prefix = urlPath(urls[name].get<std::string>());
+        for (const auto& [method, endpoints] : methods.items()) {
+            if (!endpoints.is_object()) {
+                continue;
+            }
+            for (const auto& [endpoint, cost] : endpoints.items()) {
+                std::string fixture = endpoint;
+                std::replace(fixture.begin(), fixture.end(), '/', '_');
+                impl_->routes[upper(method) + " " + prefix + "/" + endpoint] =
+                    impl_->options.fixtures + "/" + name + "/" + fixture + ".json";
+            }
+        }
+    }
+
+    useSelfSignedCertificate(impl_->tls);
+    const tcp::endpoint loopback(net::ip::make_address("127.0.0.1"), 0);
+    for (tcp::acceptor* acceptor : {&impl_->restAcceptor, &impl_->wsAcceptor}) {
+        acceptor->open(loopback.protocol());
+        acceptor->set_option(net::socket_base::reuse_address(true));
+        acceptor->bind(loopback);
+        acceptor->listen();
+    }
+    impl_->acceptRest();
+    impl_->acceptWs();
+    if (impl_->options.messagesPerSecond > 0) {
+        impl_->scheduleStream(Clock::now());
+    }
+    for (unsigned i = 0; i < std::max(1u, impl_->options.threads); ++i) {
+        impl_->threads.emplace_back([this]() { impl_->ioc.run(); });
+    }
+}
+
+MockExchange::~MockExchange() {
+    impl_->work.reset();
+    impl_->ioc.stop();
+    for (auto& thread : impl_->threads) {
+        thread.join();
+    }
+}
+
+unsigned short MockExchange::restPort() const {
+    return impl_->restAcceptor.local_endpoint().port();
+}
+
+unsigned short MockExchange::wsPort() const {
+    return impl_->wsAcceptor.local_endpoint().port();
+}
+
+std::string MockExchange::restUrl(const std::string& api) const {
+    const json& url = impl_->descriptor["urls"]["api"][api];
+    return "http://127.0.0.1:" + std::to_string(restPort()) + urlPath(url.get<std::string>());
+}
+
+void MockExchange::setResponse(const std::string& method, const std::string& path, const json& body) {
+    std::lock_guard<std::mutex> lock(impl_->responsesMutex);
+    impl_->responses[upper(method) + " " + path] = body.dump();
+}
+
+void MockExchange::setStream(StreamGenerator generator) {
+    std::lock_guard<std::mutex> lock(impl_->generatorMutex);
+    impl_->generator = std::move(generator);
+}
+
+void MockExchange::publish(const std::string& frame) {
+    impl_->publish(frame);
+}
+
+size_t MockExchange::sessions() const {
+    std::lock_guard<std::mutex> lock(impl_->sessionsMutex);
+    size_t live = 0;
+    for (const auto& session : impl_->sessions) {
+        live += session.expired() ? 0 : 1;
+    }
+    return live;
+}
+
+uint64_t MockExchange::requests() const {
+    return impl_->requests.load(std::memory_order_relaxed);
+}
+
+} // namespace testing
+} // namespace ccxt
@@ -0,0 +1,68 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <nlohmann/json.hpp>
+
+using json = nlohmann::json;
+
+namespace ccxt {
+namespace testing {
+
+struct MockOptions {
+    // Added before every REST response and WS frame
+    std::chrono::microseconds latency{0};
+    // Uniform extra delay in [0, jitter)
+    std::chrono::microseconds jitter{0};
+    // Fraction of REST requests answered with errorStatus instead
+    double errorRate = 0;
+    int errorStatus = 503;
+    // Frames per second pushed to every WS session from the stream
+    // generator; 0 sends only what publish() is given
+    double messagesPerSecond = 0;
+    // Directory of fixture payloads: <fixtures>/<api>/<path>.json, with the
+    // path's '/' replaced by '_'
+    std::string fixtures;
+    unsigned threads = 1;
+};
+
+// In-process exchange on 127.0.0.1: plain HTTP for the REST endpoints listed
+// in a config/<id>_rest.json descriptor and TLS WebSockets (self-signed
+// certificate) for streams. Everything runs on the server's own threads.
+class MockExchange {
+public:
+    using StreamGenerator = std::function<std::string(uint64_t sequence)>;
+
+    MockExchange(const std::string& descriptor, MockOptions options = MockOptions());
+    ~MockExchange();
+    MockExchange(const MockExchange&) = delete;
+    MockExchange& operator=(const MockExchange&) = delete;
+
+    unsigned short restPort() const;
+    unsigned short wsPort() const;
+    // The descriptor's urls.api[api] rebased onto the mock,
+    // e.g. "http://127.0.0.1:41234/api/v3" for Binance "public"
+    std::string restUrl(const std::string& api) const;
+
+    // Overrides the fixture for one endpoint, e.g. ("GET", "/api/v3/time")
+    void setResponse(const std::string& method, const std::string& path, const json& body);
+    void setStream(StreamGenerator generator);
+    // Sends a frame to every connected WS session
+    void publish(const std::string& frame);
+
+    size_t sessions() const;
+    uint64_t requests() const;
+
+private:
+    struct Impl;
+    std::unique_ptr<Impl> impl_;
+};
+
+} // namespace testing
+} // namespace ccxt